@@ -7,16 +7,18 @@
     APIs: gl=3.3
     Profile: core
     Extensions:
-        
+        GL_ARB_buffer_storage,
+        GL_ARB_get_program_binary,
+        GL_KHR_parallel_shader_compile
     Loader: True
     Local files: False
     Omit khrplatform: False
     Reproducible: False
 
     Commandline:
-        --profile="core" --api="gl=3.3" --generator="c" --spec="gl" --extensions=""
+        --profile="core" --api="gl=3.3" --generator="c" --spec="gl" --extensions="GL_ARB_buffer_storage,GL_ARB_get_program_binary,GL_KHR_parallel_shader_compile"
     Online:
-        https://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D3.3
+        https://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D3.3&extensions=GL_ARB_buffer_storage&extensions=GL_ARB_get_program_binary&extensions=GL_KHR_parallel_shader_compile
 */
 
 
@@ -86,6 +88,14 @@ GLAPI int gladLoadGL(void);
 
 GLAPI int gladLoadGLLoader(GLADloadproc);
 
+/* like gladLoadGLLoader, but every function is only looked up on its first call;
+ * load has to stay valid (and find the same context's functions) for as long as GL is used */
+GLAPI int gladLoadGLLoaderLazy(GLADloadproc);
+
+/* whether the current context has the extension; the set is built once when loading, so this is
+ * a hash lookup that can be called at any time (also for extensions glad has no flag for) */
+GLAPI int gladHasExtension(const char *ext);
+
 #include <KHR/khrplatform.h>
 typedef unsigned int GLenum;
 typedef unsigned char GLboolean;
@@ -951,6 +961,19 @@ typedef void (APIENTRY *GLVULKANPROCNV)(void);
 #define GL_TIME_ELAPSED 0x88BF
 #define GL_TIMESTAMP 0x8E28
 #define GL_INT_2_10_10_10_REV 0x8D9F
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+#define GL_PROGRAM_BINARY_FORMATS 0x87FF
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#define GL_MAP_PERSISTENT_BIT 0x0040
+#define GL_MAP_COHERENT_BIT 0x0080
+#define GL_DYNAMIC_STORAGE_BIT 0x0100
+#define GL_CLIENT_STORAGE_BIT 0x0200
+#define GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT 0x00004000
+#define GL_BUFFER_IMMUTABLE_STORAGE 0x821F
+#define GL_BUFFER_STORAGE_FLAGS 0x8220
 #ifndef GL_VERSION_1_0
 #define GL_VERSION_1_0 1
 GLAPI int GLAD_GL_VERSION_1_0;
@@ -2121,6 +2144,1233 @@ typedef void (APIENTRYP PFNGLSECONDARYCOLORP3UIVPROC)(GLenum type, const GLuint
 GLAPI PFNGLSECONDARYCOLORP3UIVPROC glad_glSecondaryColorP3uiv;
 #define glSecondaryColorP3uiv glad_glSecondaryColorP3uiv
 #endif
+#ifndef GL_ARB_get_program_binary
+#define GL_ARB_get_program_binary 1
+GLAPI int GLAD_GL_ARB_get_program_binary;
+typedef void (APIENTRYP PFNGLGETPROGRAMBINARYPROC)(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary);
+GLAPI PFNGLGETPROGRAMBINARYPROC glad_glGetProgramBinary;
+#define glGetProgramBinary glad_glGetProgramBinary
+typedef void (APIENTRYP PFNGLPROGRAMBINARYPROC)(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length);
+GLAPI PFNGLPROGRAMBINARYPROC glad_glProgramBinary;
+#define glProgramBinary glad_glProgramBinary
+typedef void (APIENTRYP PFNGLPROGRAMPARAMETERIPROC)(GLuint program, GLenum pname, GLint value);
+GLAPI PFNGLPROGRAMPARAMETERIPROC glad_glProgramParameteri;
+#define glProgramParameteri glad_glProgramParameteri
+#endif
+
+#ifndef GL_KHR_parallel_shader_compile
+#define GL_KHR_parallel_shader_compile 1
+GLAPI int GLAD_GL_KHR_parallel_shader_compile;
+typedef void (APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)(GLuint count);
+GLAPI PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glad_glMaxShaderCompilerThreadsKHR;
+#define glMaxShaderCompilerThreadsKHR glad_glMaxShaderCompilerThreadsKHR
+#endif
+
+#ifndef GL_ARB_buffer_storage
+#define GL_ARB_buffer_storage 1
+GLAPI int GLAD_GL_ARB_buffer_storage;
+typedef void (APIENTRYP PFNGLBUFFERSTORAGEPROC)(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags);
+GLAPI PFNGLBUFFERSTORAGEPROC glad_glBufferStorage;
+#define glBufferStorage glad_glBufferStorage
+#endif
+
+/* glad_extras.py: begin context */
+/* ----- per-context dispatch
+ * A GladGLContext holds one context's function pointers, version, extension set and flags, filled by
+ * gladLoadGLContext without touching the global glad_gl* pointers. gladSetGLContext makes a table
+ * current for the calling thread only, so threads driving different contexts (or drivers) never
+ * see each other's pointers. Translation units that define GLAD_GL_CONTEXT_CALLS before including
+ * this header keep writing glDrawArrays(...), GLVersion, gladHasExtension(...) and GLAD_GL_*, but
+ * all of them go through the current thread's table.
+ */
+typedef struct GladGLContext {
+    struct gladGLversionStruct version;
+    void *extensions; /* every extension the context has, owned by the table */
+    int VERSION_1_0;
+    int VERSION_1_1;
+    int VERSION_1_2;
+    int VERSION_1_3;
+    int VERSION_1_4;
+    int VERSION_1_5;
+    int VERSION_2_0;
+    int VERSION_2_1;
+    int VERSION_3_0;
+    int VERSION_3_1;
+    int VERSION_3_2;
+    int VERSION_3_3;
+    int ARB_get_program_binary;
+    int KHR_parallel_shader_compile;
+    int ARB_buffer_storage;
+    PFNGLCULLFACEPROC CullFace;
+    PFNGLFRONTFACEPROC FrontFace;
+    PFNGLHINTPROC Hint;
+    PFNGLLINEWIDTHPROC LineWidth;
+    PFNGLPOINTSIZEPROC PointSize;
+    PFNGLPOLYGONMODEPROC PolygonMode;
+    PFNGLSCISSORPROC Scissor;
+    PFNGLTEXPARAMETERFPROC TexParameterf;
+    PFNGLTEXPARAMETERFVPROC TexParameterfv;
+    PFNGLTEXPARAMETERIPROC TexParameteri;
+    PFNGLTEXPARAMETERIVPROC TexParameteriv;
+    PFNGLTEXIMAGE1DPROC TexImage1D;
+    PFNGLTEXIMAGE2DPROC TexImage2D;
+    PFNGLDRAWBUFFERPROC DrawBuffer;
+    PFNGLCLEARPROC Clear;
+    PFNGLCLEARCOLORPROC ClearColor;
+    PFNGLCLEARSTENCILPROC ClearStencil;
+    PFNGLCLEARDEPTHPROC ClearDepth;
+    PFNGLSTENCILMASKPROC StencilMask;
+    PFNGLCOLORMASKPROC ColorMask;
+    PFNGLDEPTHMASKPROC DepthMask;
+    PFNGLDISABLEPROC Disable;
+    PFNGLENABLEPROC Enable;
+    PFNGLFINISHPROC Finish;
+    PFNGLFLUSHPROC Flush;
+    PFNGLBLENDFUNCPROC BlendFunc;
+    PFNGLLOGICOPPROC LogicOp;
+    PFNGLSTENCILFUNCPROC StencilFunc;
+    PFNGLSTENCILOPPROC StencilOp;
+    PFNGLDEPTHFUNCPROC DepthFunc;
+    PFNGLPIXELSTOREFPROC PixelStoref;
+    PFNGLPIXELSTOREIPROC PixelStorei;
+    PFNGLREADBUFFERPROC ReadBuffer;
+    PFNGLREADPIXELSPROC ReadPixels;
+    PFNGLGETBOOLEANVPROC GetBooleanv;
+    PFNGLGETDOUBLEVPROC GetDoublev;
+    PFNGLGETERRORPROC GetError;
+    PFNGLGETFLOATVPROC GetFloatv;
+    PFNGLGETINTEGERVPROC GetIntegerv;
+    PFNGLGETSTRINGPROC GetString;
+    PFNGLGETTEXIMAGEPROC GetTexImage;
+    PFNGLGETTEXPARAMETERFVPROC GetTexParameterfv;
+    PFNGLGETTEXPARAMETERIVPROC GetTexParameteriv;
+    PFNGLGETTEXLEVELPARAMETERFVPROC GetTexLevelParameterfv;
+    PFNGLGETTEXLEVELPARAMETERIVPROC GetTexLevelParameteriv;
+    PFNGLISENABLEDPROC IsEnabled;
+    PFNGLDEPTHRANGEPROC DepthRange;
+    PFNGLVIEWPORTPROC Viewport;
+    PFNGLDRAWARRAYSPROC DrawArrays;
+    PFNGLDRAWELEMENTSPROC DrawElements;
+    PFNGLPOLYGONOFFSETPROC PolygonOffset;
+    PFNGLCOPYTEXIMAGE1DPROC CopyTexImage1D;
+    PFNGLCOPYTEXIMAGE2DPROC CopyTexImage2D;
+    PFNGLCOPYTEXSUBIMAGE1DPROC CopyTexSubImage1D;
+    PFNGLCOPYTEXSUBIMAGE2DPROC CopyTexSubImage2D;
+    PFNGLTEXSUBIMAGE1DPROC TexSubImage1D;
+    PFNGLTEXSUBIMAGE2DPROC TexSubImage2D;
+    PFNGLBINDTEXTUREPROC BindTexture;
+    PFNGLDELETETEXTURESPROC DeleteTextures;
+    PFNGLGENTEXTURESPROC GenTextures;
+    PFNGLISTEXTUREPROC IsTexture;
+    PFNGLDRAWRANGEELEMENTSPROC DrawRangeElements;
+    PFNGLTEXIMAGE3DPROC TexImage3D;
+    PFNGLTEXSUBIMAGE3DPROC TexSubImage3D;
+    PFNGLCOPYTEXSUBIMAGE3DPROC CopyTexSubImage3D;
+    PFNGLACTIVETEXTUREPROC ActiveTexture;
+    PFNGLSAMPLECOVERAGEPROC SampleCoverage;
+    PFNGLCOMPRESSEDTEXIMAGE3DPROC CompressedTexImage3D;
+    PFNGLCOMPRESSEDTEXIMAGE2DPROC CompressedTexImage2D;
+    PFNGLCOMPRESSEDTEXIMAGE1DPROC CompressedTexImage1D;
+    PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC CompressedTexSubImage3D;
+    PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC CompressedTexSubImage2D;
+    PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC CompressedTexSubImage1D;
+    PFNGLGETCOMPRESSEDTEXIMAGEPROC GetCompressedTexImage;
+    PFNGLBLENDFUNCSEPARATEPROC BlendFuncSeparate;
+    PFNGLMULTIDRAWARRAYSPROC MultiDrawArrays;
+    PFNGLMULTIDRAWELEMENTSPROC MultiDrawElements;
+    PFNGLPOINTPARAMETERFPROC PointParameterf;
+    PFNGLPOINTPARAMETERFVPROC PointParameterfv;
+    PFNGLPOINTPARAMETERIPROC PointParameteri;
+    PFNGLPOINTPARAMETERIVPROC PointParameteriv;
+    PFNGLBLENDCOLORPROC BlendColor;
+    PFNGLBLENDEQUATIONPROC BlendEquation;
+    PFNGLGENQUERIESPROC GenQueries;
+    PFNGLDELETEQUERIESPROC DeleteQueries;
+    PFNGLISQUERYPROC IsQuery;
+    PFNGLBEGINQUERYPROC BeginQuery;
+    PFNGLENDQUERYPROC EndQuery;
+    PFNGLGETQUERYIVPROC GetQueryiv;
+    PFNGLGETQUERYOBJECTIVPROC GetQueryObjectiv;
+    PFNGLGETQUERYOBJECTUIVPROC GetQueryObjectuiv;
+    PFNGLBINDBUFFERPROC BindBuffer;
+    PFNGLDELETEBUFFERSPROC DeleteBuffers;
+    PFNGLGENBUFFERSPROC GenBuffers;
+    PFNGLISBUFFERPROC IsBuffer;
+    PFNGLBUFFERDATAPROC BufferData;
+    PFNGLBUFFERSUBDATAPROC BufferSubData;
+    PFNGLGETBUFFERSUBDATAPROC GetBufferSubData;
+    PFNGLMAPBUFFERPROC MapBuffer;
+    PFNGLUNMAPBUFFERPROC UnmapBuffer;
+    PFNGLGETBUFFERPARAMETERIVPROC GetBufferParameteriv;
+    PFNGLGETBUFFERPOINTERVPROC GetBufferPointerv;
+    PFNGLBLENDEQUATIONSEPARATEPROC BlendEquationSeparate;
+    PFNGLDRAWBUFFERSPROC DrawBuffers;
+    PFNGLSTENCILOPSEPARATEPROC StencilOpSeparate;
+    PFNGLSTENCILFUNCSEPARATEPROC StencilFuncSeparate;
+    PFNGLSTENCILMASKSEPARATEPROC StencilMaskSeparate;
+    PFNGLATTACHSHADERPROC AttachShader;
+    PFNGLBINDATTRIBLOCATIONPROC BindAttribLocation;
+    PFNGLCOMPILESHADERPROC CompileShader;
+    PFNGLCREATEPROGRAMPROC CreateProgram;
+    PFNGLCREATESHADERPROC CreateShader;
+    PFNGLDELETEPROGRAMPROC DeleteProgram;
+    PFNGLDELETESHADERPROC DeleteShader;
+    PFNGLDETACHSHADERPROC DetachShader;
+    PFNGLDISABLEVERTEXATTRIBARRAYPROC DisableVertexAttribArray;
+    PFNGLENABLEVERTEXATTRIBARRAYPROC EnableVertexAttribArray;
+    PFNGLGETACTIVEATTRIBPROC GetActiveAttrib;
+    PFNGLGETACTIVEUNIFORMPROC GetActiveUniform;
+    PFNGLGETATTACHEDSHADERSPROC GetAttachedShaders;
+    PFNGLGETATTRIBLOCATIONPROC GetAttribLocation;
+    PFNGLGETPROGRAMIVPROC GetProgramiv;
+    PFNGLGETPROGRAMINFOLOGPROC GetProgramInfoLog;
+    PFNGLGETSHADERIVPROC GetShaderiv;
+    PFNGLGETSHADERINFOLOGPROC GetShaderInfoLog;
+    PFNGLGETSHADERSOURCEPROC GetShaderSource;
+    PFNGLGETUNIFORMLOCATIONPROC GetUniformLocation;
+    PFNGLGETUNIFORMFVPROC GetUniformfv;
+    PFNGLGETUNIFORMIVPROC GetUniformiv;
+    PFNGLGETVERTEXATTRIBDVPROC GetVertexAttribdv;
+    PFNGLGETVERTEXATTRIBFVPROC GetVertexAttribfv;
+    PFNGLGETVERTEXATTRIBIVPROC GetVertexAttribiv;
+    PFNGLGETVERTEXATTRIBPOINTERVPROC GetVertexAttribPointerv;
+    PFNGLISPROGRAMPROC IsProgram;
+    PFNGLISSHADERPROC IsShader;
+    PFNGLLINKPROGRAMPROC LinkProgram;
+    PFNGLSHADERSOURCEPROC ShaderSource;
+    PFNGLUSEPROGRAMPROC UseProgram;
+    PFNGLUNIFORM1FPROC Uniform1f;
+    PFNGLUNIFORM2FPROC Uniform2f;
+    PFNGLUNIFORM3FPROC Uniform3f;
+    PFNGLUNIFORM4FPROC Uniform4f;
+    PFNGLUNIFORM1IPROC Uniform1i;
+    PFNGLUNIFORM2IPROC Uniform2i;
+    PFNGLUNIFORM3IPROC Uniform3i;
+    PFNGLUNIFORM4IPROC Uniform4i;
+    PFNGLUNIFORM1FVPROC Uniform1fv;
+    PFNGLUNIFORM2FVPROC Uniform2fv;
+    PFNGLUNIFORM3FVPROC Uniform3fv;
+    PFNGLUNIFORM4FVPROC Uniform4fv;
+    PFNGLUNIFORM1IVPROC Uniform1iv;
+    PFNGLUNIFORM2IVPROC Uniform2iv;
+    PFNGLUNIFORM3IVPROC Uniform3iv;
+    PFNGLUNIFORM4IVPROC Uniform4iv;
+    PFNGLUNIFORMMATRIX2FVPROC UniformMatrix2fv;
+    PFNGLUNIFORMMATRIX3FVPROC UniformMatrix3fv;
+    PFNGLUNIFORMMATRIX4FVPROC UniformMatrix4fv;
+    PFNGLVALIDATEPROGRAMPROC ValidateProgram;
+    PFNGLVERTEXATTRIB1DPROC VertexAttrib1d;
+    PFNGLVERTEXATTRIB1DVPROC VertexAttrib1dv;
+    PFNGLVERTEXATTRIB1FPROC VertexAttrib1f;
+    PFNGLVERTEXATTRIB1FVPROC VertexAttrib1fv;
+    PFNGLVERTEXATTRIB1SPROC VertexAttrib1s;
+    PFNGLVERTEXATTRIB1SVPROC VertexAttrib1sv;
+    PFNGLVERTEXATTRIB2DPROC VertexAttrib2d;
+    PFNGLVERTEXATTRIB2DVPROC VertexAttrib2dv;
+    PFNGLVERTEXATTRIB2FPROC VertexAttrib2f;
+    PFNGLVERTEXATTRIB2FVPROC VertexAttrib2fv;
+    PFNGLVERTEXATTRIB2SPROC VertexAttrib2s;
+    PFNGLVERTEXATTRIB2SVPROC VertexAttrib2sv;
+    PFNGLVERTEXATTRIB3DPROC VertexAttrib3d;
+    PFNGLVERTEXATTRIB3DVPROC VertexAttrib3dv;
+    PFNGLVERTEXATTRIB3FPROC VertexAttrib3f;
+    PFNGLVERTEXATTRIB3FVPROC VertexAttrib3fv;
+    PFNGLVERTEXATTRIB3SPROC VertexAttrib3s;
+    PFNGLVERTEXATTRIB3SVPROC VertexAttrib3sv;
+    PFNGLVERTEXATTRIB4NBVPROC VertexAttrib4Nbv;
+    PFNGLVERTEXATTRIB4NIVPROC VertexAttrib4Niv;
+    PFNGLVERTEXATTRIB4NSVPROC VertexAttrib4Nsv;
+    PFNGLVERTEXATTRIB4NUBPROC VertexAttrib4Nub;
+    PFNGLVERTEXATTRIB4NUBVPROC VertexAttrib4Nubv;
+    PFNGLVERTEXATTRIB4NUIVPROC VertexAttrib4Nuiv;
+    PFNGLVERTEXATTRIB4NUSVPROC VertexAttrib4Nusv;
+    PFNGLVERTEXATTRIB4BVPROC VertexAttrib4bv;
+    PFNGLVERTEXATTRIB4DPROC VertexAttrib4d;
+    PFNGLVERTEXATTRIB4DVPROC VertexAttrib4dv;
+    PFNGLVERTEXATTRIB4FPROC VertexAttrib4f;
+    PFNGLVERTEXATTRIB4FVPROC VertexAttrib4fv;
+    PFNGLVERTEXATTRIB4IVPROC VertexAttrib4iv;
+    PFNGLVERTEXATTRIB4SPROC VertexAttrib4s;
+    PFNGLVERTEXATTRIB4SVPROC VertexAttrib4sv;
+    PFNGLVERTEXATTRIB4UBVPROC VertexAttrib4ubv;
+    PFNGLVERTEXATTRIB4UIVPROC VertexAttrib4uiv;
+    PFNGLVERTEXATTRIB4USVPROC VertexAttrib4usv;
+    PFNGLVERTEXATTRIBPOINTERPROC VertexAttribPointer;
+    PFNGLUNIFORMMATRIX2X3FVPROC UniformMatrix2x3fv;
+    PFNGLUNIFORMMATRIX3X2FVPROC UniformMatrix3x2fv;
+    PFNGLUNIFORMMATRIX2X4FVPROC UniformMatrix2x4fv;
+    PFNGLUNIFORMMATRIX4X2FVPROC UniformMatrix4x2fv;
+    PFNGLUNIFORMMATRIX3X4FVPROC UniformMatrix3x4fv;
+    PFNGLUNIFORMMATRIX4X3FVPROC UniformMatrix4x3fv;
+    PFNGLCOLORMASKIPROC ColorMaski;
+    PFNGLGETBOOLEANI_VPROC GetBooleani_v;
+    PFNGLGETINTEGERI_VPROC GetIntegeri_v;
+    PFNGLENABLEIPROC Enablei;
+    PFNGLDISABLEIPROC Disablei;
+    PFNGLISENABLEDIPROC IsEnabledi;
+    PFNGLBEGINTRANSFORMFEEDBACKPROC BeginTransformFeedback;
+    PFNGLENDTRANSFORMFEEDBACKPROC EndTransformFeedback;
+    PFNGLBINDBUFFERRANGEPROC BindBufferRange;
+    PFNGLBINDBUFFERBASEPROC BindBufferBase;
+    PFNGLTRANSFORMFEEDBACKVARYINGSPROC TransformFeedbackVaryings;
+    PFNGLGETTRANSFORMFEEDBACKVARYINGPROC GetTransformFeedbackVarying;
+    PFNGLCLAMPCOLORPROC ClampColor;
+    PFNGLBEGINCONDITIONALRENDERPROC BeginConditionalRender;
+    PFNGLENDCONDITIONALRENDERPROC EndConditionalRender;
+    PFNGLVERTEXATTRIBIPOINTERPROC VertexAttribIPointer;
+    PFNGLGETVERTEXATTRIBIIVPROC GetVertexAttribIiv;
+    PFNGLGETVERTEXATTRIBIUIVPROC GetVertexAttribIuiv;
+    PFNGLVERTEXATTRIBI1IPROC VertexAttribI1i;
+    PFNGLVERTEXATTRIBI2IPROC VertexAttribI2i;
+    PFNGLVERTEXATTRIBI3IPROC VertexAttribI3i;
+    PFNGLVERTEXATTRIBI4IPROC VertexAttribI4i;
+    PFNGLVERTEXATTRIBI1UIPROC VertexAttribI1ui;
+    PFNGLVERTEXATTRIBI2UIPROC VertexAttribI2ui;
+    PFNGLVERTEXATTRIBI3UIPROC VertexAttribI3ui;
+    PFNGLVERTEXATTRIBI4UIPROC VertexAttribI4ui;
+    PFNGLVERTEXATTRIBI1IVPROC VertexAttribI1iv;
+    PFNGLVERTEXATTRIBI2IVPROC VertexAttribI2iv;
+    PFNGLVERTEXATTRIBI3IVPROC VertexAttribI3iv;
+    PFNGLVERTEXATTRIBI4IVPROC VertexAttribI4iv;
+    PFNGLVERTEXATTRIBI1UIVPROC VertexAttribI1uiv;
+    PFNGLVERTEXATTRIBI2UIVPROC VertexAttribI2uiv;
+    PFNGLVERTEXATTRIBI3UIVPROC VertexAttribI3uiv;
+    PFNGLVERTEXATTRIBI4UIVPROC VertexAttribI4uiv;
+    PFNGLVERTEXATTRIBI4BVPROC VertexAttribI4bv;
+    PFNGLVERTEXATTRIBI4SVPROC VertexAttribI4sv;
+    PFNGLVERTEXATTRIBI4UBVPROC VertexAttribI4ubv;
+    PFNGLVERTEXATTRIBI4USVPROC VertexAttribI4usv;
+    PFNGLGETUNIFORMUIVPROC GetUniformuiv;
+    PFNGLBINDFRAGDATALOCATIONPROC BindFragDataLocation;
+    PFNGLGETFRAGDATALOCATIONPROC GetFragDataLocation;
+    PFNGLUNIFORM1UIPROC Uniform1ui;
+    PFNGLUNIFORM2UIPROC Uniform2ui;
+    PFNGLUNIFORM3UIPROC Uniform3ui;
+    PFNGLUNIFORM4UIPROC Uniform4ui;
+    PFNGLUNIFORM1UIVPROC Uniform1uiv;
+    PFNGLUNIFORM2UIVPROC Uniform2uiv;
+    PFNGLUNIFORM3UIVPROC Uniform3uiv;
+    PFNGLUNIFORM4UIVPROC Uniform4uiv;
+    PFNGLTEXPARAMETERIIVPROC TexParameterIiv;
+    PFNGLTEXPARAMETERIUIVPROC TexParameterIuiv;
+    PFNGLGETTEXPARAMETERIIVPROC GetTexParameterIiv;
+    PFNGLGETTEXPARAMETERIUIVPROC GetTexParameterIuiv;
+    PFNGLCLEARBUFFERIVPROC ClearBufferiv;
+    PFNGLCLEARBUFFERUIVPROC ClearBufferuiv;
+    PFNGLCLEARBUFFERFVPROC ClearBufferfv;
+    PFNGLCLEARBUFFERFIPROC ClearBufferfi;
+    PFNGLGETSTRINGIPROC GetStringi;
+    PFNGLISRENDERBUFFERPROC IsRenderbuffer;
+    PFNGLBINDRENDERBUFFERPROC BindRenderbuffer;
+    PFNGLDELETERENDERBUFFERSPROC DeleteRenderbuffers;
+    PFNGLGENRENDERBUFFERSPROC GenRenderbuffers;
+    PFNGLRENDERBUFFERSTORAGEPROC RenderbufferStorage;
+    PFNGLGETRENDERBUFFERPARAMETERIVPROC GetRenderbufferParameteriv;
+    PFNGLISFRAMEBUFFERPROC IsFramebuffer;
+    PFNGLBINDFRAMEBUFFERPROC BindFramebuffer;
+    PFNGLDELETEFRAMEBUFFERSPROC DeleteFramebuffers;
+    PFNGLGENFRAMEBUFFERSPROC GenFramebuffers;
+    PFNGLCHECKFRAMEBUFFERSTATUSPROC CheckFramebufferStatus;
+    PFNGLFRAMEBUFFERTEXTURE1DPROC FramebufferTexture1D;
+    PFNGLFRAMEBUFFERTEXTURE2DPROC FramebufferTexture2D;
+    PFNGLFRAMEBUFFERTEXTURE3DPROC FramebufferTexture3D;
+    PFNGLFRAMEBUFFERRENDERBUFFERPROC FramebufferRenderbuffer;
+    PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC GetFramebufferAttachmentParameteriv;
+    PFNGLGENERATEMIPMAPPROC GenerateMipmap;
+    PFNGLBLITFRAMEBUFFERPROC BlitFramebuffer;
+    PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC RenderbufferStorageMultisample;
+    PFNGLFRAMEBUFFERTEXTURELAYERPROC FramebufferTextureLayer;
+    PFNGLMAPBUFFERRANGEPROC MapBufferRange;
+    PFNGLFLUSHMAPPEDBUFFERRANGEPROC FlushMappedBufferRange;
+    PFNGLBINDVERTEXARRAYPROC BindVertexArray;
+    PFNGLDELETEVERTEXARRAYSPROC DeleteVertexArrays;
+    PFNGLGENVERTEXARRAYSPROC GenVertexArrays;
+    PFNGLISVERTEXARRAYPROC IsVertexArray;
+    PFNGLDRAWARRAYSINSTANCEDPROC DrawArraysInstanced;
+    PFNGLDRAWELEMENTSINSTANCEDPROC DrawElementsInstanced;
+    PFNGLTEXBUFFERPROC TexBuffer;
+    PFNGLPRIMITIVERESTARTINDEXPROC PrimitiveRestartIndex;
+    PFNGLCOPYBUFFERSUBDATAPROC CopyBufferSubData;
+    PFNGLGETUNIFORMINDICESPROC GetUniformIndices;
+    PFNGLGETACTIVEUNIFORMSIVPROC GetActiveUniformsiv;
+    PFNGLGETACTIVEUNIFORMNAMEPROC GetActiveUniformName;
+    PFNGLGETUNIFORMBLOCKINDEXPROC GetUniformBlockIndex;
+    PFNGLGETACTIVEUNIFORMBLOCKIVPROC GetActiveUniformBlockiv;
+    PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC GetActiveUniformBlockName;
+    PFNGLUNIFORMBLOCKBINDINGPROC UniformBlockBinding;
+    PFNGLDRAWELEMENTSBASEVERTEXPROC DrawElementsBaseVertex;
+    PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC DrawRangeElementsBaseVertex;
+    PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC DrawElementsInstancedBaseVertex;
+    PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC MultiDrawElementsBaseVertex;
+    PFNGLPROVOKINGVERTEXPROC ProvokingVertex;
+    PFNGLFENCESYNCPROC FenceSync;
+    PFNGLISSYNCPROC IsSync;
+    PFNGLDELETESYNCPROC DeleteSync;
+    PFNGLCLIENTWAITSYNCPROC ClientWaitSync;
+    PFNGLWAITSYNCPROC WaitSync;
+    PFNGLGETINTEGER64VPROC GetInteger64v;
+    PFNGLGETSYNCIVPROC GetSynciv;
+    PFNGLGETINTEGER64I_VPROC GetInteger64i_v;
+    PFNGLGETBUFFERPARAMETERI64VPROC GetBufferParameteri64v;
+    PFNGLFRAMEBUFFERTEXTUREPROC FramebufferTexture;
+    PFNGLTEXIMAGE2DMULTISAMPLEPROC TexImage2DMultisample;
+    PFNGLTEXIMAGE3DMULTISAMPLEPROC TexImage3DMultisample;
+    PFNGLGETMULTISAMPLEFVPROC GetMultisamplefv;
+    PFNGLSAMPLEMASKIPROC SampleMaski;
+    PFNGLBINDFRAGDATALOCATIONINDEXEDPROC BindFragDataLocationIndexed;
+    PFNGLGETFRAGDATAINDEXPROC GetFragDataIndex;
+    PFNGLGENSAMPLERSPROC GenSamplers;
+    PFNGLDELETESAMPLERSPROC DeleteSamplers;
+    PFNGLISSAMPLERPROC IsSampler;
+    PFNGLBINDSAMPLERPROC BindSampler;
+    PFNGLSAMPLERPARAMETERIPROC SamplerParameteri;
+    PFNGLSAMPLERPARAMETERIVPROC SamplerParameteriv;
+    PFNGLSAMPLERPARAMETERFPROC SamplerParameterf;
+    PFNGLSAMPLERPARAMETERFVPROC SamplerParameterfv;
+    PFNGLSAMPLERPARAMETERIIVPROC SamplerParameterIiv;
+    PFNGLSAMPLERPARAMETERIUIVPROC SamplerParameterIuiv;
+    PFNGLGETSAMPLERPARAMETERIVPROC GetSamplerParameteriv;
+    PFNGLGETSAMPLERPARAMETERIIVPROC GetSamplerParameterIiv;
+    PFNGLGETSAMPLERPARAMETERFVPROC GetSamplerParameterfv;
+    PFNGLGETSAMPLERPARAMETERIUIVPROC GetSamplerParameterIuiv;
+    PFNGLQUERYCOUNTERPROC QueryCounter;
+    PFNGLGETQUERYOBJECTI64VPROC GetQueryObjecti64v;
+    PFNGLGETQUERYOBJECTUI64VPROC GetQueryObjectui64v;
+    PFNGLVERTEXATTRIBDIVISORPROC VertexAttribDivisor;
+    PFNGLVERTEXATTRIBP1UIPROC VertexAttribP1ui;
+    PFNGLVERTEXATTRIBP1UIVPROC VertexAttribP1uiv;
+    PFNGLVERTEXATTRIBP2UIPROC VertexAttribP2ui;
+    PFNGLVERTEXATTRIBP2UIVPROC VertexAttribP2uiv;
+    PFNGLVERTEXATTRIBP3UIPROC VertexAttribP3ui;
+    PFNGLVERTEXATTRIBP3UIVPROC VertexAttribP3uiv;
+    PFNGLVERTEXATTRIBP4UIPROC VertexAttribP4ui;
+    PFNGLVERTEXATTRIBP4UIVPROC VertexAttribP4uiv;
+    PFNGLVERTEXP2UIPROC VertexP2ui;
+    PFNGLVERTEXP2UIVPROC VertexP2uiv;
+    PFNGLVERTEXP3UIPROC VertexP3ui;
+    PFNGLVERTEXP3UIVPROC VertexP3uiv;
+    PFNGLVERTEXP4UIPROC VertexP4ui;
+    PFNGLVERTEXP4UIVPROC VertexP4uiv;
+    PFNGLTEXCOORDP1UIPROC TexCoordP1ui;
+    PFNGLTEXCOORDP1UIVPROC TexCoordP1uiv;
+    PFNGLTEXCOORDP2UIPROC TexCoordP2ui;
+    PFNGLTEXCOORDP2UIVPROC TexCoordP2uiv;
+    PFNGLTEXCOORDP3UIPROC TexCoordP3ui;
+    PFNGLTEXCOORDP3UIVPROC TexCoordP3uiv;
+    PFNGLTEXCOORDP4UIPROC TexCoordP4ui;
+    PFNGLTEXCOORDP4UIVPROC TexCoordP4uiv;
+    PFNGLMULTITEXCOORDP1UIPROC MultiTexCoordP1ui;
+    PFNGLMULTITEXCOORDP1UIVPROC MultiTexCoordP1uiv;
+    PFNGLMULTITEXCOORDP2UIPROC MultiTexCoordP2ui;
+    PFNGLMULTITEXCOORDP2UIVPROC MultiTexCoordP2uiv;
+    PFNGLMULTITEXCOORDP3UIPROC MultiTexCoordP3ui;
+    PFNGLMULTITEXCOORDP3UIVPROC MultiTexCoordP3uiv;
+    PFNGLMULTITEXCOORDP4UIPROC MultiTexCoordP4ui;
+    PFNGLMULTITEXCOORDP4UIVPROC MultiTexCoordP4uiv;
+    PFNGLNORMALP3UIPROC NormalP3ui;
+    PFNGLNORMALP3UIVPROC NormalP3uiv;
+    PFNGLCOLORP3UIPROC ColorP3ui;
+    PFNGLCOLORP3UIVPROC ColorP3uiv;
+    PFNGLCOLORP4UIPROC ColorP4ui;
+    PFNGLCOLORP4UIVPROC ColorP4uiv;
+    PFNGLSECONDARYCOLORP3UIPROC SecondaryColorP3ui;
+    PFNGLSECONDARYCOLORP3UIVPROC SecondaryColorP3uiv;
+    PFNGLGETPROGRAMBINARYPROC GetProgramBinary;
+    PFNGLPROGRAMBINARYPROC ProgramBinary;
+    PFNGLPROGRAMPARAMETERIPROC ProgramParameteri;
+    PFNGLMAXSHADERCOMPILERTHREADSKHRPROC MaxShaderCompilerThreadsKHR;
+    PFNGLBUFFERSTORAGEPROC BufferStorage;
+    void *userptr;
+} GladGLContext;
+
+/* fills context, which has to start out zeroed or unloaded (loading it again replaces everything it
+ * had); the context must be current while loading */
+GLAPI int gladLoadGLContext(GladGLContext *context, GLADloadproc load);
+/* frees the extension set and zeroes the table */
+GLAPI void gladUnloadGLContext(GladGLContext *context);
+GLAPI int gladContextHasExtension(const GladGLContext *context, const char *ext);
+/* the calling thread's current table, NULL until set */
+GLAPI void gladSetGLContext(GladGLContext *context);
+GLAPI GladGLContext *gladGetGLContext(void);
+
+#ifdef GLAD_GL_CONTEXT_CALLS
+#define GLVersion (gladGetGLContext()->version)
+#define gladHasExtension(ext) gladContextHasExtension(gladGetGLContext(), (ext))
+#define GLAD_GL_VERSION_1_0 (gladGetGLContext()->VERSION_1_0)
+#define GLAD_GL_VERSION_1_1 (gladGetGLContext()->VERSION_1_1)
+#define GLAD_GL_VERSION_1_2 (gladGetGLContext()->VERSION_1_2)
+#define GLAD_GL_VERSION_1_3 (gladGetGLContext()->VERSION_1_3)
+#define GLAD_GL_VERSION_1_4 (gladGetGLContext()->VERSION_1_4)
+#define GLAD_GL_VERSION_1_5 (gladGetGLContext()->VERSION_1_5)
+#define GLAD_GL_VERSION_2_0 (gladGetGLContext()->VERSION_2_0)
+#define GLAD_GL_VERSION_2_1 (gladGetGLContext()->VERSION_2_1)
+#define GLAD_GL_VERSION_3_0 (gladGetGLContext()->VERSION_3_0)
+#define GLAD_GL_VERSION_3_1 (gladGetGLContext()->VERSION_3_1)
+#define GLAD_GL_VERSION_3_2 (gladGetGLContext()->VERSION_3_2)
+#define GLAD_GL_VERSION_3_3 (gladGetGLContext()->VERSION_3_3)
+#define GLAD_GL_ARB_get_program_binary (gladGetGLContext()->ARB_get_program_binary)
+#define GLAD_GL_KHR_parallel_shader_compile (gladGetGLContext()->KHR_parallel_shader_compile)
+#define GLAD_GL_ARB_buffer_storage (gladGetGLContext()->ARB_buffer_storage)
+#undef glCullFace
+#define glCullFace (gladGetGLContext()->CullFace)
+#undef glFrontFace
+#define glFrontFace (gladGetGLContext()->FrontFace)
+#undef glHint
+#define glHint (gladGetGLContext()->Hint)
+#undef glLineWidth
+#define glLineWidth (gladGetGLContext()->LineWidth)
+#undef glPointSize
+#define glPointSize (gladGetGLContext()->PointSize)
+#undef glPolygonMode
+#define glPolygonMode (gladGetGLContext()->PolygonMode)
+#undef glScissor
+#define glScissor (gladGetGLContext()->Scissor)
+#undef glTexParameterf
+#define glTexParameterf (gladGetGLContext()->TexParameterf)
+#undef glTexParameterfv
+#define glTexParameterfv (gladGetGLContext()->TexParameterfv)
+#undef glTexParameteri
+#define glTexParameteri (gladGetGLContext()->TexParameteri)
+#undef glTexParameteriv
+#define glTexParameteriv (gladGetGLContext()->TexParameteriv)
+#undef glTexImage1D
+#define glTexImage1D (gladGetGLContext()->TexImage1D)
+#undef glTexImage2D
+#define glTexImage2D (gladGetGLContext()->TexImage2D)
+#undef glDrawBuffer
+#define glDrawBuffer (gladGetGLContext()->DrawBuffer)
+#undef glClear
+#define glClear (gladGetGLContext()->Clear)
+#undef glClearColor
+#define glClearColor (gladGetGLContext()->ClearColor)
+#undef glClearStencil
+#define glClearStencil (gladGetGLContext()->ClearStencil)
+#undef glClearDepth
+#define glClearDepth (gladGetGLContext()->ClearDepth)
+#undef glStencilMask
+#define glStencilMask (gladGetGLContext()->StencilMask)
+#undef glColorMask
+#define glColorMask (gladGetGLContext()->ColorMask)
+#undef glDepthMask
+#define glDepthMask (gladGetGLContext()->DepthMask)
+#undef glDisable
+#define glDisable (gladGetGLContext()->Disable)
+#undef glEnable
+#define glEnable (gladGetGLContext()->Enable)
+#undef glFinish
+#define glFinish (gladGetGLContext()->Finish)
+#undef glFlush
+#define glFlush (gladGetGLContext()->Flush)
+#undef glBlendFunc
+#define glBlendFunc (gladGetGLContext()->BlendFunc)
+#undef glLogicOp
+#define glLogicOp (gladGetGLContext()->LogicOp)
+#undef glStencilFunc
+#define glStencilFunc (gladGetGLContext()->StencilFunc)
+#undef glStencilOp
+#define glStencilOp (gladGetGLContext()->StencilOp)
+#undef glDepthFunc
+#define glDepthFunc (gladGetGLContext()->DepthFunc)
+#undef glPixelStoref
+#define glPixelStoref (gladGetGLContext()->PixelStoref)
+#undef glPixelStorei
+#define glPixelStorei (gladGetGLContext()->PixelStorei)
+#undef glReadBuffer
+#define glReadBuffer (gladGetGLContext()->ReadBuffer)
+#undef glReadPixels
+#define glReadPixels (gladGetGLContext()->ReadPixels)
+#undef glGetBooleanv
+#define glGetBooleanv (gladGetGLContext()->GetBooleanv)
+#undef glGetDoublev
+#define glGetDoublev (gladGetGLContext()->GetDoublev)
+#undef glGetError
+#define glGetError (gladGetGLContext()->GetError)
+#undef glGetFloatv
+#define glGetFloatv (gladGetGLContext()->GetFloatv)
+#undef glGetIntegerv
+#define glGetIntegerv (gladGetGLContext()->GetIntegerv)
+#undef glGetString
+#define glGetString (gladGetGLContext()->GetString)
+#undef glGetTexImage
+#define glGetTexImage (gladGetGLContext()->GetTexImage)
+#undef glGetTexParameterfv
+#define glGetTexParameterfv (gladGetGLContext()->GetTexParameterfv)
+#undef glGetTexParameteriv
+#define glGetTexParameteriv (gladGetGLContext()->GetTexParameteriv)
+#undef glGetTexLevelParameterfv
+#define glGetTexLevelParameterfv (gladGetGLContext()->GetTexLevelParameterfv)
+#undef glGetTexLevelParameteriv
+#define glGetTexLevelParameteriv (gladGetGLContext()->GetTexLevelParameteriv)
+#undef glIsEnabled
+#define glIsEnabled (gladGetGLContext()->IsEnabled)
+#undef glDepthRange
+#define glDepthRange (gladGetGLContext()->DepthRange)
+#undef glViewport
+#define glViewport (gladGetGLContext()->Viewport)
+#undef glDrawArrays
+#define glDrawArrays (gladGetGLContext()->DrawArrays)
+#undef glDrawElements
+#define glDrawElements (gladGetGLContext()->DrawElements)
+#undef glPolygonOffset
+#define glPolygonOffset (gladGetGLContext()->PolygonOffset)
+#undef glCopyTexImage1D
+#define glCopyTexImage1D (gladGetGLContext()->CopyTexImage1D)
+#undef glCopyTexImage2D
+#define glCopyTexImage2D (gladGetGLContext()->CopyTexImage2D)
+#undef glCopyTexSubImage1D
+#define glCopyTexSubImage1D (gladGetGLContext()->CopyTexSubImage1D)
+#undef glCopyTexSubImage2D
+#define glCopyTexSubImage2D (gladGetGLContext()->CopyTexSubImage2D)
+#undef glTexSubImage1D
+#define glTexSubImage1D (gladGetGLContext()->TexSubImage1D)
+#undef glTexSubImage2D
+#define glTexSubImage2D (gladGetGLContext()->TexSubImage2D)
+#undef glBindTexture
+#define glBindTexture (gladGetGLContext()->BindTexture)
+#undef glDeleteTextures
+#define glDeleteTextures (gladGetGLContext()->DeleteTextures)
+#undef glGenTextures
+#define glGenTextures (gladGetGLContext()->GenTextures)
+#undef glIsTexture
+#define glIsTexture (gladGetGLContext()->IsTexture)
+#undef glDrawRangeElements
+#define glDrawRangeElements (gladGetGLContext()->DrawRangeElements)
+#undef glTexImage3D
+#define glTexImage3D (gladGetGLContext()->TexImage3D)
+#undef glTexSubImage3D
+#define glTexSubImage3D (gladGetGLContext()->TexSubImage3D)
+#undef glCopyTexSubImage3D
+#define glCopyTexSubImage3D (gladGetGLContext()->CopyTexSubImage3D)
+#undef glActiveTexture
+#define glActiveTexture (gladGetGLContext()->ActiveTexture)
+#undef glSampleCoverage
+#define glSampleCoverage (gladGetGLContext()->SampleCoverage)
+#undef glCompressedTexImage3D
+#define glCompressedTexImage3D (gladGetGLContext()->CompressedTexImage3D)
+#undef glCompressedTexImage2D
+#define glCompressedTexImage2D (gladGetGLContext()->CompressedTexImage2D)
+#undef glCompressedTexImage1D
+#define glCompressedTexImage1D (gladGetGLContext()->CompressedTexImage1D)
+#undef glCompressedTexSubImage3D
+#define glCompressedTexSubImage3D (gladGetGLContext()->CompressedTexSubImage3D)
+#undef glCompressedTexSubImage2D
+#define glCompressedTexSubImage2D (gladGetGLContext()->CompressedTexSubImage2D)
+#undef glCompressedTexSubImage1D
+#define glCompressedTexSubImage1D (gladGetGLContext()->CompressedTexSubImage1D)
+#undef glGetCompressedTexImage
+#define glGetCompressedTexImage (gladGetGLContext()->GetCompressedTexImage)
+#undef glBlendFuncSeparate
+#define glBlendFuncSeparate (gladGetGLContext()->BlendFuncSeparate)
+#undef glMultiDrawArrays
+#define glMultiDrawArrays (gladGetGLContext()->MultiDrawArrays)
+#undef glMultiDrawElements
+#define glMultiDrawElements (gladGetGLContext()->MultiDrawElements)
+#undef glPointParameterf
+#define glPointParameterf (gladGetGLContext()->PointParameterf)
+#undef glPointParameterfv
+#define glPointParameterfv (gladGetGLContext()->PointParameterfv)
+#undef glPointParameteri
+#define glPointParameteri (gladGetGLContext()->PointParameteri)
+#undef glPointParameteriv
+#define glPointParameteriv (gladGetGLContext()->PointParameteriv)
+#undef glBlendColor
+#define glBlendColor (gladGetGLContext()->BlendColor)
+#undef glBlendEquation
+#define glBlendEquation (gladGetGLContext()->BlendEquation)
+#undef glGenQueries
+#define glGenQueries (gladGetGLContext()->GenQueries)
+#undef glDeleteQueries
+#define glDeleteQueries (gladGetGLContext()->DeleteQueries)
+#undef glIsQuery
+#define glIsQuery (gladGetGLContext()->IsQuery)
+#undef glBeginQuery
+#define glBeginQuery (gladGetGLContext()->BeginQuery)
+#undef glEndQuery
+#define glEndQuery (gladGetGLContext()->EndQuery)
+#undef glGetQueryiv
+#define glGetQueryiv (gladGetGLContext()->GetQueryiv)
+#undef glGetQueryObjectiv
+#define glGetQueryObjectiv (gladGetGLContext()->GetQueryObjectiv)
+#undef glGetQueryObjectuiv
+#define glGetQueryObjectuiv (gladGetGLContext()->GetQueryObjectuiv)
+#undef glBindBuffer
+#define glBindBuffer (gladGetGLContext()->BindBuffer)
+#undef glDeleteBuffers
+#define glDeleteBuffers (gladGetGLContext()->DeleteBuffers)
+#undef glGenBuffers
+#define glGenBuffers (gladGetGLContext()->GenBuffers)
+#undef glIsBuffer
+#define glIsBuffer (gladGetGLContext()->IsBuffer)
+#undef glBufferData
+#define glBufferData (gladGetGLContext()->BufferData)
+#undef glBufferSubData
+#define glBufferSubData (gladGetGLContext()->BufferSubData)
+#undef glGetBufferSubData
+#define glGetBufferSubData (gladGetGLContext()->GetBufferSubData)
+#undef glMapBuffer
+#define glMapBuffer (gladGetGLContext()->MapBuffer)
+#undef glUnmapBuffer
+#define glUnmapBuffer (gladGetGLContext()->UnmapBuffer)
+#undef glGetBufferParameteriv
+#define glGetBufferParameteriv (gladGetGLContext()->GetBufferParameteriv)
+#undef glGetBufferPointerv
+#define glGetBufferPointerv (gladGetGLContext()->GetBufferPointerv)
+#undef glBlendEquationSeparate
+#define glBlendEquationSeparate (gladGetGLContext()->BlendEquationSeparate)
+#undef glDrawBuffers
+#define glDrawBuffers (gladGetGLContext()->DrawBuffers)
+#undef glStencilOpSeparate
+#define glStencilOpSeparate (gladGetGLContext()->StencilOpSeparate)
+#undef glStencilFuncSeparate
+#define glStencilFuncSeparate (gladGetGLContext()->StencilFuncSeparate)
+#undef glStencilMaskSeparate
+#define glStencilMaskSeparate (gladGetGLContext()->StencilMaskSeparate)
+#undef glAttachShader
+#define glAttachShader (gladGetGLContext()->AttachShader)
+#undef glBindAttribLocation
+#define glBindAttribLocation (gladGetGLContext()->BindAttribLocation)
+#undef glCompileShader
+#define glCompileShader (gladGetGLContext()->CompileShader)
+#undef glCreateProgram
+#define glCreateProgram (gladGetGLContext()->CreateProgram)
+#undef glCreateShader
+#define glCreateShader (gladGetGLContext()->CreateShader)
+#undef glDeleteProgram
+#define glDeleteProgram (gladGetGLContext()->DeleteProgram)
+#undef glDeleteShader
+#define glDeleteShader (gladGetGLContext()->DeleteShader)
+#undef glDetachShader
+#define glDetachShader (gladGetGLContext()->DetachShader)
+#undef glDisableVertexAttribArray
+#define glDisableVertexAttribArray (gladGetGLContext()->DisableVertexAttribArray)
+#undef glEnableVertexAttribArray
+#define glEnableVertexAttribArray (gladGetGLContext()->EnableVertexAttribArray)
+#undef glGetActiveAttrib
+#define glGetActiveAttrib (gladGetGLContext()->GetActiveAttrib)
+#undef glGetActiveUniform
+#define glGetActiveUniform (gladGetGLContext()->GetActiveUniform)
+#undef glGetAttachedShaders
+#define glGetAttachedShaders (gladGetGLContext()->GetAttachedShaders)
+#undef glGetAttribLocation
+#define glGetAttribLocation (gladGetGLContext()->GetAttribLocation)
+#undef glGetProgramiv
+#define glGetProgramiv (gladGetGLContext()->GetProgramiv)
+#undef glGetProgramInfoLog
+#define glGetProgramInfoLog (gladGetGLContext()->GetProgramInfoLog)
+#undef glGetShaderiv
+#define glGetShaderiv (gladGetGLContext()->GetShaderiv)
+#undef glGetShaderInfoLog
+#define glGetShaderInfoLog (gladGetGLContext()->GetShaderInfoLog)
+#undef glGetShaderSource
+#define glGetShaderSource (gladGetGLContext()->GetShaderSource)
+#undef glGetUniformLocation
+#define glGetUniformLocation (gladGetGLContext()->GetUniformLocation)
+#undef glGetUniformfv
+#define glGetUniformfv (gladGetGLContext()->GetUniformfv)
+#undef glGetUniformiv
+#define glGetUniformiv (gladGetGLContext()->GetUniformiv)
+#undef glGetVertexAttribdv
+#define glGetVertexAttribdv (gladGetGLContext()->GetVertexAttribdv)
+#undef glGetVertexAttribfv
+#define glGetVertexAttribfv (gladGetGLContext()->GetVertexAttribfv)
+#undef glGetVertexAttribiv
+#define glGetVertexAttribiv (gladGetGLContext()->GetVertexAttribiv)
+#undef glGetVertexAttribPointerv
+#define glGetVertexAttribPointerv (gladGetGLContext()->GetVertexAttribPointerv)
+#undef glIsProgram
+#define glIsProgram (gladGetGLContext()->IsProgram)
+#undef glIsShader
+#define glIsShader (gladGetGLContext()->IsShader)
+#undef glLinkProgram
+#define glLinkProgram (gladGetGLContext()->LinkProgram)
+#undef glShaderSource
+#define glShaderSource (gladGetGLContext()->ShaderSource)
+#undef glUseProgram
+#define glUseProgram (gladGetGLContext()->UseProgram)
+#undef glUniform1f
+#define glUniform1f (gladGetGLContext()->Uniform1f)
+#undef glUniform2f
+#define glUniform2f (gladGetGLContext()->Uniform2f)
+#undef glUniform3f
+#define glUniform3f (gladGetGLContext()->Uniform3f)
+#undef glUniform4f
+#define glUniform4f (gladGetGLContext()->Uniform4f)
+#undef glUniform1i
+#define glUniform1i (gladGetGLContext()->Uniform1i)
+#undef glUniform2i
+#define glUniform2i (gladGetGLContext()->Uniform2i)
+#undef glUniform3i
+#define glUniform3i (gladGetGLContext()->Uniform3i)
+#undef glUniform4i
+#define glUniform4i (gladGetGLContext()->Uniform4i)
+#undef glUniform1fv
+#define glUniform1fv (gladGetGLContext()->Uniform1fv)
+#undef glUniform2fv
+#define glUniform2fv (gladGetGLContext()->Uniform2fv)
+#undef glUniform3fv
+#define glUniform3fv (gladGetGLContext()->Uniform3fv)
+#undef glUniform4fv
+#define glUniform4fv (gladGetGLContext()->Uniform4fv)
+#undef glUniform1iv
+#define glUniform1iv (gladGetGLContext()->Uniform1iv)
+#undef glUniform2iv
+#define glUniform2iv (gladGetGLContext()->Uniform2iv)
+#undef glUniform3iv
+#define glUniform3iv (gladGetGLContext()->Uniform3iv)
+#undef glUniform4iv
+#define glUniform4iv (gladGetGLContext()->Uniform4iv)
+#undef glUniformMatrix2fv
+#define glUniformMatrix2fv (gladGetGLContext()->UniformMatrix2fv)
+#undef glUniformMatrix3fv
+#define glUniformMatrix3fv (gladGetGLContext()->UniformMatrix3fv)
+#undef glUniformMatrix4fv
+#define glUniformMatrix4fv (gladGetGLContext()->UniformMatrix4fv)
+#undef glValidateProgram
+#define glValidateProgram (gladGetGLContext()->ValidateProgram)
+#undef glVertexAttrib1d
+#define glVertexAttrib1d (gladGetGLContext()->VertexAttrib1d)
+#undef glVertexAttrib1dv
+#define glVertexAttrib1dv (gladGetGLContext()->VertexAttrib1dv)
+#undef glVertexAttrib1f
+#define glVertexAttrib1f (gladGetGLContext()->VertexAttrib1f)
+#undef glVertexAttrib1fv
+#define glVertexAttrib1fv (gladGetGLContext()->VertexAttrib1fv)
+#undef glVertexAttrib1s
+#define glVertexAttrib1s (gladGetGLContext()->VertexAttrib1s)
+#undef glVertexAttrib1sv
+#define glVertexAttrib1sv (gladGetGLContext()->VertexAttrib1sv)
+#undef glVertexAttrib2d
+#define glVertexAttrib2d (gladGetGLContext()->VertexAttrib2d)
+#undef glVertexAttrib2dv
+#define glVertexAttrib2dv (gladGetGLContext()->VertexAttrib2dv)
+#undef glVertexAttrib2f
+#define glVertexAttrib2f (gladGetGLContext()->VertexAttrib2f)
+#undef glVertexAttrib2fv
+#define glVertexAttrib2fv (gladGetGLContext()->VertexAttrib2fv)
+#undef glVertexAttrib2s
+#define glVertexAttrib2s (gladGetGLContext()->VertexAttrib2s)
+#undef glVertexAttrib2sv
+#define glVertexAttrib2sv (gladGetGLContext()->VertexAttrib2sv)
+#undef glVertexAttrib3d
+#define glVertexAttrib3d (gladGetGLContext()->VertexAttrib3d)
+#undef glVertexAttrib3dv
+#define glVertexAttrib3dv (gladGetGLContext()->VertexAttrib3dv)
+#undef glVertexAttrib3f
+#define glVertexAttrib3f (gladGetGLContext()->VertexAttrib3f)
+#undef glVertexAttrib3fv
+#define glVertexAttrib3fv (gladGetGLContext()->VertexAttrib3fv)
+#undef glVertexAttrib3s
+#define glVertexAttrib3s (gladGetGLContext()->VertexAttrib3s)
+#undef glVertexAttrib3sv
+#define glVertexAttrib3sv (gladGetGLContext()->VertexAttrib3sv)
+#undef glVertexAttrib4Nbv
+#define glVertexAttrib4Nbv (gladGetGLContext()->VertexAttrib4Nbv)
+#undef glVertexAttrib4Niv
+#define glVertexAttrib4Niv (gladGetGLContext()->VertexAttrib4Niv)
+#undef glVertexAttrib4Nsv
+#define glVertexAttrib4Nsv (gladGetGLContext()->VertexAttrib4Nsv)
+#undef glVertexAttrib4Nub
+#define glVertexAttrib4Nub (gladGetGLContext()->VertexAttrib4Nub)
+#undef glVertexAttrib4Nubv
+#define glVertexAttrib4Nubv (gladGetGLContext()->VertexAttrib4Nubv)
+#undef glVertexAttrib4Nuiv
+#define glVertexAttrib4Nuiv (gladGetGLContext()->VertexAttrib4Nuiv)
+#undef glVertexAttrib4Nusv
+#define glVertexAttrib4Nusv (gladGetGLContext()->VertexAttrib4Nusv)
+#undef glVertexAttrib4bv
+#define glVertexAttrib4bv (gladGetGLContext()->VertexAttrib4bv)
+#undef glVertexAttrib4d
+#define glVertexAttrib4d (gladGetGLContext()->VertexAttrib4d)
+#undef glVertexAttrib4dv
+#define glVertexAttrib4dv (gladGetGLContext()->VertexAttrib4dv)
+#undef glVertexAttrib4f
+#define glVertexAttrib4f (gladGetGLContext()->VertexAttrib4f)
+#undef glVertexAttrib4fv
+#define glVertexAttrib4fv (gladGetGLContext()->VertexAttrib4fv)
+#undef glVertexAttrib4iv
+#define glVertexAttrib4iv (gladGetGLContext()->VertexAttrib4iv)
+#undef glVertexAttrib4s
+#define glVertexAttrib4s (gladGetGLContext()->VertexAttrib4s)
+#undef glVertexAttrib4sv
+#define glVertexAttrib4sv (gladGetGLContext()->VertexAttrib4sv)
+#undef glVertexAttrib4ubv
+#define glVertexAttrib4ubv (gladGetGLContext()->VertexAttrib4ubv)
+#undef glVertexAttrib4uiv
+#define glVertexAttrib4uiv (gladGetGLContext()->VertexAttrib4uiv)
+#undef glVertexAttrib4usv
+#define glVertexAttrib4usv (gladGetGLContext()->VertexAttrib4usv)
+#undef glVertexAttribPointer
+#define glVertexAttribPointer (gladGetGLContext()->VertexAttribPointer)
+#undef glUniformMatrix2x3fv
+#define glUniformMatrix2x3fv (gladGetGLContext()->UniformMatrix2x3fv)
+#undef glUniformMatrix3x2fv
+#define glUniformMatrix3x2fv (gladGetGLContext()->UniformMatrix3x2fv)
+#undef glUniformMatrix2x4fv
+#define glUniformMatrix2x4fv (gladGetGLContext()->UniformMatrix2x4fv)
+#undef glUniformMatrix4x2fv
+#define glUniformMatrix4x2fv (gladGetGLContext()->UniformMatrix4x2fv)
+#undef glUniformMatrix3x4fv
+#define glUniformMatrix3x4fv (gladGetGLContext()->UniformMatrix3x4fv)
+#undef glUniformMatrix4x3fv
+#define glUniformMatrix4x3fv (gladGetGLContext()->UniformMatrix4x3fv)
+#undef glColorMaski
+#define glColorMaski (gladGetGLContext()->ColorMaski)
+#undef glGetBooleani_v
+#define glGetBooleani_v (gladGetGLContext()->GetBooleani_v)
+#undef glGetIntegeri_v
+#define glGetIntegeri_v (gladGetGLContext()->GetIntegeri_v)
+#undef glEnablei
+#define glEnablei (gladGetGLContext()->Enablei)
+#undef glDisablei
+#define glDisablei (gladGetGLContext()->Disablei)
+#undef glIsEnabledi
+#define glIsEnabledi (gladGetGLContext()->IsEnabledi)
+#undef glBeginTransformFeedback
+#define glBeginTransformFeedback (gladGetGLContext()->BeginTransformFeedback)
+#undef glEndTransformFeedback
+#define glEndTransformFeedback (gladGetGLContext()->EndTransformFeedback)
+#undef glBindBufferRange
+#define glBindBufferRange (gladGetGLContext()->BindBufferRange)
+#undef glBindBufferBase
+#define glBindBufferBase (gladGetGLContext()->BindBufferBase)
+#undef glTransformFeedbackVaryings
+#define glTransformFeedbackVaryings (gladGetGLContext()->TransformFeedbackVaryings)
+#undef glGetTransformFeedbackVarying
+#define glGetTransformFeedbackVarying (gladGetGLContext()->GetTransformFeedbackVarying)
+#undef glClampColor
+#define glClampColor (gladGetGLContext()->ClampColor)
+#undef glBeginConditionalRender
+#define glBeginConditionalRender (gladGetGLContext()->BeginConditionalRender)
+#undef glEndConditionalRender
+#define glEndConditionalRender (gladGetGLContext()->EndConditionalRender)
+#undef glVertexAttribIPointer
+#define glVertexAttribIPointer (gladGetGLContext()->VertexAttribIPointer)
+#undef glGetVertexAttribIiv
+#define glGetVertexAttribIiv (gladGetGLContext()->GetVertexAttribIiv)
+#undef glGetVertexAttribIuiv
+#define glGetVertexAttribIuiv (gladGetGLContext()->GetVertexAttribIuiv)
+#undef glVertexAttribI1i
+#define glVertexAttribI1i (gladGetGLContext()->VertexAttribI1i)
+#undef glVertexAttribI2i
+#define glVertexAttribI2i (gladGetGLContext()->VertexAttribI2i)
+#undef glVertexAttribI3i
+#define glVertexAttribI3i (gladGetGLContext()->VertexAttribI3i)
+#undef glVertexAttribI4i
+#define glVertexAttribI4i (gladGetGLContext()->VertexAttribI4i)
+#undef glVertexAttribI1ui
+#define glVertexAttribI1ui (gladGetGLContext()->VertexAttribI1ui)
+#undef glVertexAttribI2ui
+#define glVertexAttribI2ui (gladGetGLContext()->VertexAttribI2ui)
+#undef glVertexAttribI3ui
+#define glVertexAttribI3ui (gladGetGLContext()->VertexAttribI3ui)
+#undef glVertexAttribI4ui
+#define glVertexAttribI4ui (gladGetGLContext()->VertexAttribI4ui)
+#undef glVertexAttribI1iv
+#define glVertexAttribI1iv (gladGetGLContext()->VertexAttribI1iv)
+#undef glVertexAttribI2iv
+#define glVertexAttribI2iv (gladGetGLContext()->VertexAttribI2iv)
+#undef glVertexAttribI3iv
+#define glVertexAttribI3iv (gladGetGLContext()->VertexAttribI3iv)
+#undef glVertexAttribI4iv
+#define glVertexAttribI4iv (gladGetGLContext()->VertexAttribI4iv)
+#undef glVertexAttribI1uiv
+#define glVertexAttribI1uiv (gladGetGLContext()->VertexAttribI1uiv)
+#undef glVertexAttribI2uiv
+#define glVertexAttribI2uiv (gladGetGLContext()->VertexAttribI2uiv)
+#undef glVertexAttribI3uiv
+#define glVertexAttribI3uiv (gladGetGLContext()->VertexAttribI3uiv)
+#undef glVertexAttribI4uiv
+#define glVertexAttribI4uiv (gladGetGLContext()->VertexAttribI4uiv)
+#undef glVertexAttribI4bv
+#define glVertexAttribI4bv (gladGetGLContext()->VertexAttribI4bv)
+#undef glVertexAttribI4sv
+#define glVertexAttribI4sv (gladGetGLContext()->VertexAttribI4sv)
+#undef glVertexAttribI4ubv
+#define glVertexAttribI4ubv (gladGetGLContext()->VertexAttribI4ubv)
+#undef glVertexAttribI4usv
+#define glVertexAttribI4usv (gladGetGLContext()->VertexAttribI4usv)
+#undef glGetUniformuiv
+#define glGetUniformuiv (gladGetGLContext()->GetUniformuiv)
+#undef glBindFragDataLocation
+#define glBindFragDataLocation (gladGetGLContext()->BindFragDataLocation)
+#undef glGetFragDataLocation
+#define glGetFragDataLocation (gladGetGLContext()->GetFragDataLocation)
+#undef glUniform1ui
+#define glUniform1ui (gladGetGLContext()->Uniform1ui)
+#undef glUniform2ui
+#define glUniform2ui (gladGetGLContext()->Uniform2ui)
+#undef glUniform3ui
+#define glUniform3ui (gladGetGLContext()->Uniform3ui)
+#undef glUniform4ui
+#define glUniform4ui (gladGetGLContext()->Uniform4ui)
+#undef glUniform1uiv
+#define glUniform1uiv (gladGetGLContext()->Uniform1uiv)
+#undef glUniform2uiv
+#define glUniform2uiv (gladGetGLContext()->Uniform2uiv)
+#undef glUniform3uiv
+#define glUniform3uiv (gladGetGLContext()->Uniform3uiv)
+#undef glUniform4uiv
+#define glUniform4uiv (gladGetGLContext()->Uniform4uiv)
+#undef glTexParameterIiv
+#define glTexParameterIiv (gladGetGLContext()->TexParameterIiv)
+#undef glTexParameterIuiv
+#define glTexParameterIuiv (gladGetGLContext()->TexParameterIuiv)
+#undef glGetTexParameterIiv
+#define glGetTexParameterIiv (gladGetGLContext()->GetTexParameterIiv)
+#undef glGetTexParameterIuiv
+#define glGetTexParameterIuiv (gladGetGLContext()->GetTexParameterIuiv)
+#undef glClearBufferiv
+#define glClearBufferiv (gladGetGLContext()->ClearBufferiv)
+#undef glClearBufferuiv
+#define glClearBufferuiv (gladGetGLContext()->ClearBufferuiv)
+#undef glClearBufferfv
+#define glClearBufferfv (gladGetGLContext()->ClearBufferfv)
+#undef glClearBufferfi
+#define glClearBufferfi (gladGetGLContext()->ClearBufferfi)
+#undef glGetStringi
+#define glGetStringi (gladGetGLContext()->GetStringi)
+#undef glIsRenderbuffer
+#define glIsRenderbuffer (gladGetGLContext()->IsRenderbuffer)
+#undef glBindRenderbuffer
+#define glBindRenderbuffer (gladGetGLContext()->BindRenderbuffer)
+#undef glDeleteRenderbuffers
+#define glDeleteRenderbuffers (gladGetGLContext()->DeleteRenderbuffers)
+#undef glGenRenderbuffers
+#define glGenRenderbuffers (gladGetGLContext()->GenRenderbuffers)
+#undef glRenderbufferStorage
+#define glRenderbufferStorage (gladGetGLContext()->RenderbufferStorage)
+#undef glGetRenderbufferParameteriv
+#define glGetRenderbufferParameteriv (gladGetGLContext()->GetRenderbufferParameteriv)
+#undef glIsFramebuffer
+#define glIsFramebuffer (gladGetGLContext()->IsFramebuffer)
+#undef glBindFramebuffer
+#define glBindFramebuffer (gladGetGLContext()->BindFramebuffer)
+#undef glDeleteFramebuffers
+#define glDeleteFramebuffers (gladGetGLContext()->DeleteFramebuffers)
+#undef glGenFramebuffers
+#define glGenFramebuffers (gladGetGLContext()->GenFramebuffers)
+#undef glCheckFramebufferStatus
+#define glCheckFramebufferStatus (gladGetGLContext()->CheckFramebufferStatus)
+#undef glFramebufferTexture1D
+#define glFramebufferTexture1D (gladGetGLContext()->FramebufferTexture1D)
+#undef glFramebufferTexture2D
+#define glFramebufferTexture2D (gladGetGLContext()->FramebufferTexture2D)
+#undef glFramebufferTexture3D
+#define glFramebufferTexture3D (gladGetGLContext()->FramebufferTexture3D)
+#undef glFramebufferRenderbuffer
+#define glFramebufferRenderbuffer (gladGetGLContext()->FramebufferRenderbuffer)
+#undef glGetFramebufferAttachmentParameteriv
+#define glGetFramebufferAttachmentParameteriv (gladGetGLContext()->GetFramebufferAttachmentParameteriv)
+#undef glGenerateMipmap
+#define glGenerateMipmap (gladGetGLContext()->GenerateMipmap)
+#undef glBlitFramebuffer
+#define glBlitFramebuffer (gladGetGLContext()->BlitFramebuffer)
+#undef glRenderbufferStorageMultisample
+#define glRenderbufferStorageMultisample (gladGetGLContext()->RenderbufferStorageMultisample)
+#undef glFramebufferTextureLayer
+#define glFramebufferTextureLayer (gladGetGLContext()->FramebufferTextureLayer)
+#undef glMapBufferRange
+#define glMapBufferRange (gladGetGLContext()->MapBufferRange)
+#undef glFlushMappedBufferRange
+#define glFlushMappedBufferRange (gladGetGLContext()->FlushMappedBufferRange)
+#undef glBindVertexArray
+#define glBindVertexArray (gladGetGLContext()->BindVertexArray)
+#undef glDeleteVertexArrays
+#define glDeleteVertexArrays (gladGetGLContext()->DeleteVertexArrays)
+#undef glGenVertexArrays
+#define glGenVertexArrays (gladGetGLContext()->GenVertexArrays)
+#undef glIsVertexArray
+#define glIsVertexArray (gladGetGLContext()->IsVertexArray)
+#undef glDrawArraysInstanced
+#define glDrawArraysInstanced (gladGetGLContext()->DrawArraysInstanced)
+#undef glDrawElementsInstanced
+#define glDrawElementsInstanced (gladGetGLContext()->DrawElementsInstanced)
+#undef glTexBuffer
+#define glTexBuffer (gladGetGLContext()->TexBuffer)
+#undef glPrimitiveRestartIndex
+#define glPrimitiveRestartIndex (gladGetGLContext()->PrimitiveRestartIndex)
+#undef glCopyBufferSubData
+#define glCopyBufferSubData (gladGetGLContext()->CopyBufferSubData)
+#undef glGetUniformIndices
+#define glGetUniformIndices (gladGetGLContext()->GetUniformIndices)
+#undef glGetActiveUniformsiv
+#define glGetActiveUniformsiv (gladGetGLContext()->GetActiveUniformsiv)
+#undef glGetActiveUniformName
+#define glGetActiveUniformName (gladGetGLContext()->GetActiveUniformName)
+#undef glGetUniformBlockIndex
+#define glGetUniformBlockIndex (gladGetGLContext()->GetUniformBlockIndex)
+#undef glGetActiveUniformBlockiv
+#define glGetActiveUniformBlockiv (gladGetGLContext()->GetActiveUniformBlockiv)
+#undef glGetActiveUniformBlockName
+#define glGetActiveUniformBlockName (gladGetGLContext()->GetActiveUniformBlockName)
+#undef glUniformBlockBinding
+#define glUniformBlockBinding (gladGetGLContext()->UniformBlockBinding)
+#undef glDrawElementsBaseVertex
+#define glDrawElementsBaseVertex (gladGetGLContext()->DrawElementsBaseVertex)
+#undef glDrawRangeElementsBaseVertex
+#define glDrawRangeElementsBaseVertex (gladGetGLContext()->DrawRangeElementsBaseVertex)
+#undef glDrawElementsInstancedBaseVertex
+#define glDrawElementsInstancedBaseVertex (gladGetGLContext()->DrawElementsInstancedBaseVertex)
+#undef glMultiDrawElementsBaseVertex
+#define glMultiDrawElementsBaseVertex (gladGetGLContext()->MultiDrawElementsBaseVertex)
+#undef glProvokingVertex
+#define glProvokingVertex (gladGetGLContext()->ProvokingVertex)
+#undef glFenceSync
+#define glFenceSync (gladGetGLContext()->FenceSync)
+#undef glIsSync
+#define glIsSync (gladGetGLContext()->IsSync)
+#undef glDeleteSync
+#define glDeleteSync (gladGetGLContext()->DeleteSync)
+#undef glClientWaitSync
+#define glClientWaitSync (gladGetGLContext()->ClientWaitSync)
+#undef glWaitSync
+#define glWaitSync (gladGetGLContext()->WaitSync)
+#undef glGetInteger64v
+#define glGetInteger64v (gladGetGLContext()->GetInteger64v)
+#undef glGetSynciv
+#define glGetSynciv (gladGetGLContext()->GetSynciv)
+#undef glGetInteger64i_v
+#define glGetInteger64i_v (gladGetGLContext()->GetInteger64i_v)
+#undef glGetBufferParameteri64v
+#define glGetBufferParameteri64v (gladGetGLContext()->GetBufferParameteri64v)
+#undef glFramebufferTexture
+#define glFramebufferTexture (gladGetGLContext()->FramebufferTexture)
+#undef glTexImage2DMultisample
+#define glTexImage2DMultisample (gladGetGLContext()->TexImage2DMultisample)
+#undef glTexImage3DMultisample
+#define glTexImage3DMultisample (gladGetGLContext()->TexImage3DMultisample)
+#undef glGetMultisamplefv
+#define glGetMultisamplefv (gladGetGLContext()->GetMultisamplefv)
+#undef glSampleMaski
+#define glSampleMaski (gladGetGLContext()->SampleMaski)
+#undef glBindFragDataLocationIndexed
+#define glBindFragDataLocationIndexed (gladGetGLContext()->BindFragDataLocationIndexed)
+#undef glGetFragDataIndex
+#define glGetFragDataIndex (gladGetGLContext()->GetFragDataIndex)
+#undef glGenSamplers
+#define glGenSamplers (gladGetGLContext()->GenSamplers)
+#undef glDeleteSamplers
+#define glDeleteSamplers (gladGetGLContext()->DeleteSamplers)
+#undef glIsSampler
+#define glIsSampler (gladGetGLContext()->IsSampler)
+#undef glBindSampler
+#define glBindSampler (gladGetGLContext()->BindSampler)
+#undef glSamplerParameteri
+#define glSamplerParameteri (gladGetGLContext()->SamplerParameteri)
+#undef glSamplerParameteriv
+#define glSamplerParameteriv (gladGetGLContext()->SamplerParameteriv)
+#undef glSamplerParameterf
+#define glSamplerParameterf (gladGetGLContext()->SamplerParameterf)
+#undef glSamplerParameterfv
+#define glSamplerParameterfv (gladGetGLContext()->SamplerParameterfv)
+#undef glSamplerParameterIiv
+#define glSamplerParameterIiv (gladGetGLContext()->SamplerParameterIiv)
+#undef glSamplerParameterIuiv
+#define glSamplerParameterIuiv (gladGetGLContext()->SamplerParameterIuiv)
+#undef glGetSamplerParameteriv
+#define glGetSamplerParameteriv (gladGetGLContext()->GetSamplerParameteriv)
+#undef glGetSamplerParameterIiv
+#define glGetSamplerParameterIiv (gladGetGLContext()->GetSamplerParameterIiv)
+#undef glGetSamplerParameterfv
+#define glGetSamplerParameterfv (gladGetGLContext()->GetSamplerParameterfv)
+#undef glGetSamplerParameterIuiv
+#define glGetSamplerParameterIuiv (gladGetGLContext()->GetSamplerParameterIuiv)
+#undef glQueryCounter
+#define glQueryCounter (gladGetGLContext()->QueryCounter)
+#undef glGetQueryObjecti64v
+#define glGetQueryObjecti64v (gladGetGLContext()->GetQueryObjecti64v)
+#undef glGetQueryObjectui64v
+#define glGetQueryObjectui64v (gladGetGLContext()->GetQueryObjectui64v)
+#undef glVertexAttribDivisor
+#define glVertexAttribDivisor (gladGetGLContext()->VertexAttribDivisor)
+#undef glVertexAttribP1ui
+#define glVertexAttribP1ui (gladGetGLContext()->VertexAttribP1ui)
+#undef glVertexAttribP1uiv
+#define glVertexAttribP1uiv (gladGetGLContext()->VertexAttribP1uiv)
+#undef glVertexAttribP2ui
+#define glVertexAttribP2ui (gladGetGLContext()->VertexAttribP2ui)
+#undef glVertexAttribP2uiv
+#define glVertexAttribP2uiv (gladGetGLContext()->VertexAttribP2uiv)
+#undef glVertexAttribP3ui
+#define glVertexAttribP3ui (gladGetGLContext()->VertexAttribP3ui)
+#undef glVertexAttribP3uiv
+#define glVertexAttribP3uiv (gladGetGLContext()->VertexAttribP3uiv)
+#undef glVertexAttribP4ui
+#define glVertexAttribP4ui (gladGetGLContext()->VertexAttribP4ui)
+#undef glVertexAttribP4uiv
+#define glVertexAttribP4uiv (gladGetGLContext()->VertexAttribP4uiv)
+#undef glVertexP2ui
+#define glVertexP2ui (gladGetGLContext()->VertexP2ui)
+#undef glVertexP2uiv
+#define glVertexP2uiv (gladGetGLContext()->VertexP2uiv)
+#undef glVertexP3ui
+#define glVertexP3ui (gladGetGLContext()->VertexP3ui)
+#undef glVertexP3uiv
+#define glVertexP3uiv (gladGetGLContext()->VertexP3uiv)
+#undef glVertexP4ui
+#define glVertexP4ui (gladGetGLContext()->VertexP4ui)
+#undef glVertexP4uiv
+#define glVertexP4uiv (gladGetGLContext()->VertexP4uiv)
+#undef glTexCoordP1ui
+#define glTexCoordP1ui (gladGetGLContext()->TexCoordP1ui)
+#undef glTexCoordP1uiv
+#define glTexCoordP1uiv (gladGetGLContext()->TexCoordP1uiv)
+#undef glTexCoordP2ui
+#define glTexCoordP2ui (gladGetGLContext()->TexCoordP2ui)
+#undef glTexCoordP2uiv
+#define glTexCoordP2uiv (gladGetGLContext()->TexCoordP2uiv)
+#undef glTexCoordP3ui
+#define glTexCoordP3ui (gladGetGLContext()->TexCoordP3ui)
+#undef glTexCoordP3uiv
+#define glTexCoordP3uiv (gladGetGLContext()->TexCoordP3uiv)
+#undef glTexCoordP4ui
+#define glTexCoordP4ui (gladGetGLContext()->TexCoordP4ui)
+#undef glTexCoordP4uiv
+#define glTexCoordP4uiv (gladGetGLContext()->TexCoordP4uiv)
+#undef glMultiTexCoordP1ui
+#define glMultiTexCoordP1ui (gladGetGLContext()->MultiTexCoordP1ui)
+#undef glMultiTexCoordP1uiv
+#define glMultiTexCoordP1uiv (gladGetGLContext()->MultiTexCoordP1uiv)
+#undef glMultiTexCoordP2ui
+#define glMultiTexCoordP2ui (gladGetGLContext()->MultiTexCoordP2ui)
+#undef glMultiTexCoordP2uiv
+#define glMultiTexCoordP2uiv (gladGetGLContext()->MultiTexCoordP2uiv)
+#undef glMultiTexCoordP3ui
+#define glMultiTexCoordP3ui (gladGetGLContext()->MultiTexCoordP3ui)
+#undef glMultiTexCoordP3uiv
+#define glMultiTexCoordP3uiv (gladGetGLContext()->MultiTexCoordP3uiv)
+#undef glMultiTexCoordP4ui
+#define glMultiTexCoordP4ui (gladGetGLContext()->MultiTexCoordP4ui)
+#undef glMultiTexCoordP4uiv
+#define glMultiTexCoordP4uiv (gladGetGLContext()->MultiTexCoordP4uiv)
+#undef glNormalP3ui
+#define glNormalP3ui (gladGetGLContext()->NormalP3ui)
+#undef glNormalP3uiv
+#define glNormalP3uiv (gladGetGLContext()->NormalP3uiv)
+#undef glColorP3ui
+#define glColorP3ui (gladGetGLContext()->ColorP3ui)
+#undef glColorP3uiv
+#define glColorP3uiv (gladGetGLContext()->ColorP3uiv)
+#undef glColorP4ui
+#define glColorP4ui (gladGetGLContext()->ColorP4ui)
+#undef glColorP4uiv
+#define glColorP4uiv (gladGetGLContext()->ColorP4uiv)
+#undef glSecondaryColorP3ui
+#define glSecondaryColorP3ui (gladGetGLContext()->SecondaryColorP3ui)
+#undef glSecondaryColorP3uiv
+#define glSecondaryColorP3uiv (gladGetGLContext()->SecondaryColorP3uiv)
+#undef glGetProgramBinary
+#define glGetProgramBinary (gladGetGLContext()->GetProgramBinary)
+#undef glProgramBinary
+#define glProgramBinary (gladGetGLContext()->ProgramBinary)
+#undef glProgramParameteri
+#define glProgramParameteri (gladGetGLContext()->ProgramParameteri)
+#undef glMaxShaderCompilerThreadsKHR
+#define glMaxShaderCompilerThreadsKHR (gladGetGLContext()->MaxShaderCompilerThreadsKHR)
+#undef glBufferStorage
+#define glBufferStorage (gladGetGLContext()->BufferStorage)
+#endif
+/* glad_extras.py: end context */
 
 #ifdef __cplusplus
 }
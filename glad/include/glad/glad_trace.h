@@ -0,0 +1,112 @@
+/*
+ * GL call tracing for the glad loader (built with -DGL_TRACE=ON).
+ *
+ * gladTraceBegin wraps every loaded glad_gl* pointer in a shim that appends the call, its arguments
+ * and the data behind its pointer arguments to a memory-mapped trace file. Payloads (buffer data,
+ * shader sources, uniform arrays, ...) are stored once per content and referenced by a key afterwards,
+ * so a frame that re-uploads the same data costs a few bytes. The key is the content's FNV-1a hash,
+ * bumped past it when different bytes already hashed the same, so every key means one payload.
+ * Writes through glMapBufferRange/glMapBuffer are captured when the range is flushed or unmapped;
+ * persistent mappings can't be observed, so tracing hides GL_ARB_buffer_storage (and
+ * GL_ARB_get_program_binary, so programs are traced as source and replay on any driver).
+ * glreplay re-executes a trace against its own context, mapping object names as it goes.
+ *
+ * Everything is for the thread the calls are made on; the per-context tables (GladGLContext) are
+ * not traced. Texture uploads from client memory are recorded without their pixels.
+ */
+
+#ifndef __glad_trace_h_
+#define __glad_trace_h_
+
+#include <glad/glad.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GLAD_TRACE_VERSION 1
+
+enum {
+    GLAD_TRACE_RECORD_FRAME = 0xFFFD,        /* gladTraceFrame, no slots */
+    GLAD_TRACE_RECORD_MAPPED_WRITE = 0xFFFE, /* slots: target, offset into the mapping, size, payload key */
+    GLAD_TRACE_RECORD_BLOB = 0xFFFF          /* size payload bytes: a key slot, then the payload padded to 8 bytes */
+};
+
+/* file layout: GladTraceHeader, then records; every record starts 8-byte aligned */
+typedef struct {
+    char magic[4];              /* "GLTR" */
+    uint32_t version;
+    uint32_t functionCount;     /* ids are only valid for the loader that wrote them */
+    uint32_t pointerSize;
+    uint64_t recordBytes;       /* after the header, brought up to date at every frame and at the end */
+    uint64_t frameCount;
+} GladTraceHeader;
+
+/* a call is followed by argCount uint64 slots, plus one for the return value if hasReturn */
+typedef struct {
+    uint16_t id;
+    uint8_t argCount;
+    uint8_t hasReturn;
+    uint32_t size;
+} GladTraceRecord;
+
+/* what an argument slot holds */
+enum GladTraceParamKind {
+    GLAD_TRACE_SCALAR,          /* the value (floats and doubles bit for bit) */
+    GLAD_TRACE_OFFSET,          /* a pointer that is really an offset into a bound buffer */
+    GLAD_TRACE_BLOB,            /* payload key, 0 for NULL */
+    GLAD_TRACE_STRINGS,         /* payload key of the strings, each one null terminated */
+    GLAD_TRACE_NAMES_IN,        /* payload key of an array of object names */
+    GLAD_TRACE_NAMES_OUT,       /* payload key of the names the call generated */
+    GLAD_TRACE_OUT,             /* written by the call, not recorded */
+    GLAD_TRACE_UNUSED,          /* folded into another argument (glShaderSource lengths) */
+    GLAD_TRACE_UNSUPPORTED      /* payload of unknown size, replayed as NULL */
+};
+
+/* which name space a scalar, a name array or a return value lives in */
+enum GladTraceObject {
+    GLAD_TRACE_OBJECT_NONE,
+    GLAD_TRACE_OBJECT_BUFFER,
+    GLAD_TRACE_OBJECT_PROGRAM,
+    GLAD_TRACE_OBJECT_SHADER,
+    GLAD_TRACE_OBJECT_VERTEX_ARRAY,
+    GLAD_TRACE_OBJECT_FRAMEBUFFER,
+    GLAD_TRACE_OBJECT_RENDERBUFFER,
+    GLAD_TRACE_OBJECT_TEXTURE,
+    GLAD_TRACE_OBJECT_SAMPLER,
+    GLAD_TRACE_OBJECT_QUERY,
+    GLAD_TRACE_OBJECT_SYNC,
+    GLAD_TRACE_OBJECT_LOCATION,     /* uniform location, per program */
+    GLAD_TRACE_OBJECT_BLOCK_INDEX,  /* uniform block index, per program */
+    GLAD_TRACE_OBJECT_COUNT
+};
+
+typedef struct {
+    unsigned char kind;
+    unsigned char object;
+} GladTraceParam;
+
+typedef struct {
+    const char *name;
+    unsigned char paramCount;
+    unsigned char hasReturn;
+    unsigned char returnObject;
+    const GladTraceParam *params;
+} GladTraceFunction;
+
+/* after gladLoadGL*, before anything else wraps the pointers; returns 0 if the file can't be created */
+GLAPI int gladTraceBegin(const char *path);
+GLAPI void gladTraceFrame(void);     /* after every swap */
+GLAPI void gladTraceEnd(void);       /* unwraps and truncates the file; at exit it runs by itself, with a warning */
+
+GLAPI unsigned int gladTraceFunctionCount(void);
+GLAPI const GladTraceFunction *gladTraceFunction(unsigned int id);
+/* calls function id through the current glad_gl* pointers with already decoded slots, returns the widened result */
+GLAPI uint64_t gladTraceInvoke(unsigned int id, const uint64_t *args);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
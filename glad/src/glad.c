@@ -7,18 +7,21 @@
     APIs: gl=3.3
     Profile: core
     Extensions:
-        
+        GL_ARB_buffer_storage,
+        GL_ARB_get_program_binary,
+        GL_KHR_parallel_shader_compile
     Loader: True
     Local files: False
     Omit khrplatform: False
     Reproducible: False
 
     Commandline:
-        --profile="core" --api="gl=3.3" --generator="c" --spec="gl" --extensions=""
+        --profile="core" --api="gl=3.3" --generator="c" --spec="gl" --extensions="GL_ARB_buffer_storage,GL_ARB_get_program_binary,GL_KHR_parallel_shader_compile"
     Online:
-        https://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D3.3
+        https://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D3.3&extensions=GL_ARB_buffer_storage&extensions=GL_ARB_get_program_binary&extensions=GL_KHR_parallel_shader_compile
 */
 
+#include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -165,96 +168,173 @@ struct gladGLversionStruct GLVersion = { 0, 0 };
 static int max_loaded_major;
 static int max_loaded_minor;
 
-static const char *exts = NULL;
-static int num_exts_i = 0;
-static char **exts_i = NULL;
+/* The extension set: an open-addressing table of FNV-1a hashes plus the names it points into, all in
+ * one allocation that is built once per load and kept, so has_ext/gladHasExtension is a hash and
+ * (almost always) a single strcmp, with no allocation after loading. The global loader keeps its set
+ * in ext_arena, every GladGLContext keeps its own. */
+typedef struct {
+    unsigned int hash;
+    unsigned int name; /* offset into the names + 1, 0 marks an empty slot */
+} glad_ext_slot;
 
-static int get_exts(void) {
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
-#endif
-        exts = (const char *)glGetString(GL_EXTENSIONS);
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    } else {
-        unsigned int index;
+typedef struct {
+    unsigned int mask;
+} glad_ext_header; /* followed by mask + 1 slots, then the names */
 
-        num_exts_i = 0;
-        glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
-        if (num_exts_i > 0) {
-            exts_i = (char **)malloc((size_t)num_exts_i * (sizeof *exts_i));
-        }
+static void *ext_arena = NULL;
 
-        if (exts_i == NULL) {
-            return 0;
-        }
+static glad_ext_slot *ext_slots(const void *arena) {
+    return (glad_ext_slot *)((glad_ext_header *)arena + 1);
+}
 
-        for(index = 0; index < (unsigned)num_exts_i; index++) {
-            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
-            size_t len = strlen(gl_str_tmp);
+static char *ext_names(const void *arena) {
+    return (char *)(ext_slots(arena) + ((const glad_ext_header *)arena)->mask + 1);
+}
 
-            char *local_str = (char*)malloc((len+1) * sizeof(char));
-            if(local_str != NULL) {
-                memcpy(local_str, gl_str_tmp, (len+1) * sizeof(char));
-            }
-            exts_i[index] = local_str;
-        }
+static unsigned int ext_hash(const char *name, size_t length) {
+    unsigned int hash = 2166136261u;
+    size_t i;
+    for(i = 0; i < length; i++) {
+        hash = (hash ^ (unsigned char)name[i]) * 16777619u;
     }
-#endif
-    return 1;
+    return hash;
 }
 
-static void free_exts(void) {
-    if (exts_i != NULL) {
-        int index;
-        for(index = 0; index < num_exts_i; index++) {
-            free((char *)exts_i[index]);
-        }
-        free((void *)exts_i);
-        exts_i = NULL;
+/* count names of name_bytes bytes in total (terminators included) */
+static void *alloc_exts(unsigned int count, size_t name_bytes) {
+    unsigned int capacity = 16;
+    glad_ext_header *header;
+    while(capacity < 2 * count) {
+        capacity *= 2;
+    }
+
+    header = (glad_ext_header *)calloc(1, sizeof(glad_ext_header) + capacity * sizeof(glad_ext_slot) + name_bytes);
+    if(header != NULL) {
+        header->mask = capacity - 1;
     }
+    return header;
 }
 
-static int has_ext(const char *ext) {
+/* the name is already in the arena's names at offset, null terminated */
+static void insert_ext(void *arena, size_t offset, size_t length) {
+    glad_ext_slot *slots = ext_slots(arena);
+    unsigned int mask = ((glad_ext_header *)arena)->mask;
+    unsigned int hash = ext_hash(ext_names(arena) + offset, length);
+    unsigned int slot = hash & mask;
+    while(slots[slot].name != 0) {
+        slot = (slot + 1) & mask;
+    }
+    slots[slot].hash = hash;
+    slots[slot].name = (unsigned int)offset + 1;
+}
+
+/* asks whichever context these functions belong to; NULL if out of memory */
+static void *build_exts(int major, PFNGLGETSTRINGPROC get_string, PFNGLGETINTEGERVPROC get_integerv, PFNGLGETSTRINGIPROC get_stringi) {
+    void *arena;
 #ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
+    if(major < 3 || get_integerv == NULL || get_stringi == NULL) {
+#else
+    (void)major; (void)get_integerv; (void)get_stringi;
 #endif
-        const char *extensions;
-        const char *loc;
-        const char *terminator;
-        extensions = exts;
-        if(extensions == NULL || ext == NULL) {
-            return 0;
+        /* one space separated string: copy it and terminate every name in place */
+        const char *exts = (const char *)get_string(GL_EXTENSIONS);
+        char *names;
+        size_t length, start, index;
+        unsigned int count = 1;
+        if(exts == NULL) {
+            exts = "";
+        }
+        length = strlen(exts);
+        for(index = 0; index < length; index++) {
+            count += exts[index] == ' ';
         }
 
-        while(1) {
-            loc = strstr(extensions, ext);
-            if(loc == NULL) {
-                return 0;
-            }
-
-            terminator = loc + strlen(ext);
-            if((loc == extensions || *(loc - 1) == ' ') &&
-                (*terminator == ' ' || *terminator == '\0')) {
-                return 1;
+        arena = alloc_exts(count, length + 1);
+        if(arena == NULL) {
+            return NULL;
+        }
+        names = ext_names(arena);
+        memcpy(names, exts, length + 1);
+        for(start = 0, index = 0; index <= length; index++) {
+            if(names[index] == ' ' || names[index] == '\0') {
+                names[index] = '\0';
+                if(index > start) {
+                    insert_ext(arena, start, index - start);
+                }
+                start = index + 1;
             }
-            extensions = terminator;
         }
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     } else {
-        int index;
-        if(exts_i == NULL) return 0;
-        for(index = 0; index < num_exts_i; index++) {
-            const char *e = exts_i[index];
+        /* two passes over glGetStringi, the first one only sizes the arena */
+        int num_exts_i = 0;
+        unsigned int index;
+        size_t name_bytes = 0, offset = 0;
+
+        get_integerv(GL_NUM_EXTENSIONS, &num_exts_i);
+        if(num_exts_i < 0) {
+            num_exts_i = 0; /* an empty set is still a set */
+        }
+        for(index = 0; index < (unsigned)num_exts_i; index++) {
+            const char *gl_str_tmp = (const char *)get_stringi(GL_EXTENSIONS, index);
+            name_bytes += gl_str_tmp != NULL ? strlen(gl_str_tmp) + 1 : 0;
+        }
 
-            if(exts_i[index] != NULL && strcmp(e, ext) == 0) {
-                return 1;
+        arena = alloc_exts((unsigned int)num_exts_i, name_bytes);
+        if(arena == NULL) {
+            return NULL;
+        }
+        for(index = 0; index < (unsigned)num_exts_i; index++) {
+            const char *gl_str_tmp = (const char *)get_stringi(GL_EXTENSIONS, index);
+            size_t len;
+            if(gl_str_tmp == NULL) {
+                continue;
+            }
+            len = strlen(gl_str_tmp);
+            if(offset + len + 1 > name_bytes) {
+                break; /* the driver changed its mind between the passes */
             }
+            memcpy(ext_names(arena) + offset, gl_str_tmp, len + 1);
+            insert_ext(arena, offset, len);
+            offset += len + 1;
         }
     }
 #endif
+    return arena;
+}
+
+static int find_ext(const void *arena, const char *ext) {
+    const glad_ext_slot *slots;
+    unsigned int hash, mask, slot;
+    if(arena == NULL || ext == NULL) {
+        return 0;
+    }
 
+    slots = ext_slots(arena);
+    mask = ((const glad_ext_header *)arena)->mask;
+    hash = ext_hash(ext, strlen(ext));
+    for(slot = hash & mask; slots[slot].name != 0; slot = (slot + 1) & mask) {
+        if(slots[slot].hash == hash && strcmp(ext_names(arena) + slots[slot].name - 1, ext) == 0) {
+            return 1;
+        }
+    }
     return 0;
 }
+
+static int get_exts(void) {
+    free(ext_arena);
+    ext_arena = build_exts(max_loaded_major, glGetString, glGetIntegerv, glGetStringi);
+    return ext_arena != NULL;
+}
+
+static int has_ext(const char *ext) {
+    return find_ext(ext_arena, ext);
+}
+
+int gladHasExtension(const char *ext) {
+    return has_ext(ext);
+}
+
 int GLAD_GL_VERSION_1_0 = 0;
 int GLAD_GL_VERSION_1_1 = 0;
 int GLAD_GL_VERSION_1_2 = 0;
@@ -267,6 +347,9 @@ int GLAD_GL_VERSION_3_0 = 0;
 int GLAD_GL_VERSION_3_1 = 0;
 int GLAD_GL_VERSION_3_2 = 0;
 int GLAD_GL_VERSION_3_3 = 0;
+int GLAD_GL_ARB_get_program_binary = 0;
+int GLAD_GL_KHR_parallel_shader_compile = 0;
+int GLAD_GL_ARB_buffer_storage = 0;
 PFNGLACTIVETEXTUREPROC glad_glActiveTexture = NULL;
 PFNGLATTACHSHADERPROC glad_glAttachShader = NULL;
 PFNGLBEGINCONDITIONALRENDERPROC glad_glBeginConditionalRender = NULL;
@@ -641,6 +724,11 @@ PFNGLVERTEXP4UIPROC glad_glVertexP4ui = NULL;
 PFNGLVERTEXP4UIVPROC glad_glVertexP4uiv = NULL;
 PFNGLVIEWPORTPROC glad_glViewport = NULL;
 PFNGLWAITSYNCPROC glad_glWaitSync = NULL;
+PFNGLGETPROGRAMBINARYPROC glad_glGetProgramBinary = NULL;
+PFNGLPROGRAMBINARYPROC glad_glProgramBinary = NULL;
+PFNGLPROGRAMPARAMETERIPROC glad_glProgramParameteri = NULL;
+PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glad_glMaxShaderCompilerThreadsKHR = NULL;
+PFNGLBUFFERSTORAGEPROC glad_glBufferStorage = NULL;
 static void load_GL_VERSION_1_0(GLADloadproc load) {
 	if(!GLAD_GL_VERSION_1_0) return;
 	glad_glCullFace = (PFNGLCULLFACEPROC)load("glCullFace");
@@ -1054,10 +1142,25 @@ static void load_GL_VERSION_3_3(GLADloadproc load) {
 	glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)load("glSecondaryColorP3ui");
 	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)load("glSecondaryColorP3uiv");
 }
+static void load_GL_ARB_get_program_binary(GLADloadproc load) {
+	if(!GLAD_GL_ARB_get_program_binary) return;
+	glad_glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)load("glGetProgramBinary");
+	glad_glProgramBinary = (PFNGLPROGRAMBINARYPROC)load("glProgramBinary");
+	glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)load("glProgramParameteri");
+}
+static void load_GL_KHR_parallel_shader_compile(GLADloadproc load) {
+	if(!GLAD_GL_KHR_parallel_shader_compile) return;
+	glad_glMaxShaderCompilerThreadsKHR = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)load("glMaxShaderCompilerThreadsKHR");
+}
+static void load_GL_ARB_buffer_storage(GLADloadproc load) {
+	if(!GLAD_GL_ARB_buffer_storage) return;
+	glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC)load("glBufferStorage");
+}
 static int find_extensionsGL(void) {
 	if (!get_exts()) return 0;
-	(void)&has_ext;
-	free_exts();
+	GLAD_GL_ARB_get_program_binary = has_ext("GL_ARB_get_program_binary");
+	GLAD_GL_KHR_parallel_shader_compile = has_ext("GL_KHR_parallel_shader_compile");
+	GLAD_GL_ARB_buffer_storage = has_ext("GL_ARB_buffer_storage");
 	return 1;
 }
 
@@ -1135,6 +1238,2885 @@ int gladLoadGLLoader(GLADloadproc load) {
 	load_GL_VERSION_3_3(load);
 
 	if (!find_extensionsGL()) return 0;
+	load_GL_ARB_get_program_binary(load);
+	load_GL_KHR_parallel_shader_compile(load);
+	load_GL_ARB_buffer_storage(load);
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 
+/* glad_extras.py: begin lazy */
+/* ----- lazy binding
+ * gladLoadGLLoaderLazy only finds the version and extensions; every glad_gl* pointer starts at a stub
+ * that looks the real entry point up on its first call and then points the glad_gl* pointer straight
+ * at it, so startup pays for the handful of functions a program uses instead of all of them.
+ * A stub only repoints the glad_gl* pointer while it still points at the stub, so whoever wrapped
+ * the pointer in between (a state cache, a tracer) keeps its wrapper and calls through the stub,
+ * which by then is one extra branch. Two threads resolving the same entry point store the same value.
+ */
+
+static GLADloadproc glad_lazy_load = NULL;
+
+/* the version or extension said the function is there; calling through NULL would only crash
+ * somewhere less obvious, so a driver that doesn't have it after all stops the program right here */
+static void *glad_lazy_resolve(const char *name) {
+	void *function = glad_lazy_load(name);
+	if(function == NULL) {
+		fprintf(stderr, "glad: %s was not found, the driver advertises it but can't load it\n", name);
+		abort();
+	}
+	return function;
+}
+
+static struct {
+	PFNGLCULLFACEPROC glCullFace;
+	PFNGLFRONTFACEPROC glFrontFace;
+	PFNGLHINTPROC glHint;
+	PFNGLLINEWIDTHPROC glLineWidth;
+	PFNGLPOINTSIZEPROC glPointSize;
+	PFNGLPOLYGONMODEPROC glPolygonMode;
+	PFNGLSCISSORPROC glScissor;
+	PFNGLTEXPARAMETERFPROC glTexParameterf;
+	PFNGLTEXPARAMETERFVPROC glTexParameterfv;
+	PFNGLTEXPARAMETERIPROC glTexParameteri;
+	PFNGLTEXPARAMETERIVPROC glTexParameteriv;
+	PFNGLTEXIMAGE1DPROC glTexImage1D;
+	PFNGLTEXIMAGE2DPROC glTexImage2D;
+	PFNGLDRAWBUFFERPROC glDrawBuffer;
+	PFNGLCLEARPROC glClear;
+	PFNGLCLEARCOLORPROC glClearColor;
+	PFNGLCLEARSTENCILPROC glClearStencil;
+	PFNGLCLEARDEPTHPROC glClearDepth;
+	PFNGLSTENCILMASKPROC glStencilMask;
+	PFNGLCOLORMASKPROC glColorMask;
+	PFNGLDEPTHMASKPROC glDepthMask;
+	PFNGLDISABLEPROC glDisable;
+	PFNGLENABLEPROC glEnable;
+	PFNGLFINISHPROC glFinish;
+	PFNGLFLUSHPROC glFlush;
+	PFNGLBLENDFUNCPROC glBlendFunc;
+	PFNGLLOGICOPPROC glLogicOp;
+	PFNGLSTENCILFUNCPROC glStencilFunc;
+	PFNGLSTENCILOPPROC glStencilOp;
+	PFNGLDEPTHFUNCPROC glDepthFunc;
+	PFNGLPIXELSTOREFPROC glPixelStoref;
+	PFNGLPIXELSTOREIPROC glPixelStorei;
+	PFNGLREADBUFFERPROC glReadBuffer;
+	PFNGLREADPIXELSPROC glReadPixels;
+	PFNGLGETBOOLEANVPROC glGetBooleanv;
+	PFNGLGETDOUBLEVPROC glGetDoublev;
+	PFNGLGETERRORPROC glGetError;
+	PFNGLGETFLOATVPROC glGetFloatv;
+	PFNGLGETINTEGERVPROC glGetIntegerv;
+	PFNGLGETSTRINGPROC glGetString;
+	PFNGLGETTEXIMAGEPROC glGetTexImage;
+	PFNGLGETTEXPARAMETERFVPROC glGetTexParameterfv;
+	PFNGLGETTEXPARAMETERIVPROC glGetTexParameteriv;
+	PFNGLGETTEXLEVELPARAMETERFVPROC glGetTexLevelParameterfv;
+	PFNGLGETTEXLEVELPARAMETERIVPROC glGetTexLevelParameteriv;
+	PFNGLISENABLEDPROC glIsEnabled;
+	PFNGLDEPTHRANGEPROC glDepthRange;
+	PFNGLVIEWPORTPROC glViewport;
+	PFNGLDRAWARRAYSPROC glDrawArrays;
+	PFNGLDRAWELEMENTSPROC glDrawElements;
+	PFNGLPOLYGONOFFSETPROC glPolygonOffset;
+	PFNGLCOPYTEXIMAGE1DPROC glCopyTexImage1D;
+	PFNGLCOPYTEXIMAGE2DPROC glCopyTexImage2D;
+	PFNGLCOPYTEXSUBIMAGE1DPROC glCopyTexSubImage1D;
+	PFNGLCOPYTEXSUBIMAGE2DPROC glCopyTexSubImage2D;
+	PFNGLTEXSUBIMAGE1DPROC glTexSubImage1D;
+	PFNGLTEXSUBIMAGE2DPROC glTexSubImage2D;
+	PFNGLBINDTEXTUREPROC glBindTexture;
+	PFNGLDELETETEXTURESPROC glDeleteTextures;
+	PFNGLGENTEXTURESPROC glGenTextures;
+	PFNGLISTEXTUREPROC glIsTexture;
+	PFNGLDRAWRANGEELEMENTSPROC glDrawRangeElements;
+	PFNGLTEXIMAGE3DPROC glTexImage3D;
+	PFNGLTEXSUBIMAGE3DPROC glTexSubImage3D;
+	PFNGLCOPYTEXSUBIMAGE3DPROC glCopyTexSubImage3D;
+	PFNGLACTIVETEXTUREPROC glActiveTexture;
+	PFNGLSAMPLECOVERAGEPROC glSampleCoverage;
+	PFNGLCOMPRESSEDTEXIMAGE3DPROC glCompressedTexImage3D;
+	PFNGLCOMPRESSEDTEXIMAGE2DPROC glCompressedTexImage2D;
+	PFNGLCOMPRESSEDTEXIMAGE1DPROC glCompressedTexImage1D;
+	PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glCompressedTexSubImage3D;
+	PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glCompressedTexSubImage2D;
+	PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glCompressedTexSubImage1D;
+	PFNGLGETCOMPRESSEDTEXIMAGEPROC glGetCompressedTexImage;
+	PFNGLBLENDFUNCSEPARATEPROC glBlendFuncSeparate;
+	PFNGLMULTIDRAWARRAYSPROC glMultiDrawArrays;
+	PFNGLMULTIDRAWELEMENTSPROC glMultiDrawElements;
+	PFNGLPOINTPARAMETERFPROC glPointParameterf;
+	PFNGLPOINTPARAMETERFVPROC glPointParameterfv;
+	PFNGLPOINTPARAMETERIPROC glPointParameteri;
+	PFNGLPOINTPARAMETERIVPROC glPointParameteriv;
+	PFNGLBLENDCOLORPROC glBlendColor;
+	PFNGLBLENDEQUATIONPROC glBlendEquation;
+	PFNGLGENQUERIESPROC glGenQueries;
+	PFNGLDELETEQUERIESPROC glDeleteQueries;
+	PFNGLISQUERYPROC glIsQuery;
+	PFNGLBEGINQUERYPROC glBeginQuery;
+	PFNGLENDQUERYPROC glEndQuery;
+	PFNGLGETQUERYIVPROC glGetQueryiv;
+	PFNGLGETQUERYOBJECTIVPROC glGetQueryObjectiv;
+	PFNGLGETQUERYOBJECTUIVPROC glGetQueryObjectuiv;
+	PFNGLBINDBUFFERPROC glBindBuffer;
+	PFNGLDELETEBUFFERSPROC glDeleteBuffers;
+	PFNGLGENBUFFERSPROC glGenBuffers;
+	PFNGLISBUFFERPROC glIsBuffer;
+	PFNGLBUFFERDATAPROC glBufferData;
+	PFNGLBUFFERSUBDATAPROC glBufferSubData;
+	PFNGLGETBUFFERSUBDATAPROC glGetBufferSubData;
+	PFNGLMAPBUFFERPROC glMapBuffer;
+	PFNGLUNMAPBUFFERPROC glUnmapBuffer;
+	PFNGLGETBUFFERPARAMETERIVPROC glGetBufferParameteriv;
+	PFNGLGETBUFFERPOINTERVPROC glGetBufferPointerv;
+	PFNGLBLENDEQUATIONSEPARATEPROC glBlendEquationSeparate;
+	PFNGLDRAWBUFFERSPROC glDrawBuffers;
+	PFNGLSTENCILOPSEPARATEPROC glStencilOpSeparate;
+	PFNGLSTENCILFUNCSEPARATEPROC glStencilFuncSeparate;
+	PFNGLSTENCILMASKSEPARATEPROC glStencilMaskSeparate;
+	PFNGLATTACHSHADERPROC glAttachShader;
+	PFNGLBINDATTRIBLOCATIONPROC glBindAttribLocation;
+	PFNGLCOMPILESHADERPROC glCompileShader;
+	PFNGLCREATEPROGRAMPROC glCreateProgram;
+	PFNGLCREATESHADERPROC glCreateShader;
+	PFNGLDELETEPROGRAMPROC glDeleteProgram;
+	PFNGLDELETESHADERPROC glDeleteShader;
+	PFNGLDETACHSHADERPROC glDetachShader;
+	PFNGLDISABLEVERTEXATTRIBARRAYPROC glDisableVertexAttribArray;
+	PFNGLENABLEVERTEXATTRIBARRAYPROC glEnableVertexAttribArray;
+	PFNGLGETACTIVEATTRIBPROC glGetActiveAttrib;
+	PFNGLGETACTIVEUNIFORMPROC glGetActiveUniform;
+	PFNGLGETATTACHEDSHADERSPROC glGetAttachedShaders;
+	PFNGLGETATTRIBLOCATIONPROC glGetAttribLocation;
+	PFNGLGETPROGRAMIVPROC glGetProgramiv;
+	PFNGLGETPROGRAMINFOLOGPROC glGetProgramInfoLog;
+	PFNGLGETSHADERIVPROC glGetShaderiv;
+	PFNGLGETSHADERINFOLOGPROC glGetShaderInfoLog;
+	PFNGLGETSHADERSOURCEPROC glGetShaderSource;
+	PFNGLGETUNIFORMLOCATIONPROC glGetUniformLocation;
+	PFNGLGETUNIFORMFVPROC glGetUniformfv;
+	PFNGLGETUNIFORMIVPROC glGetUniformiv;
+	PFNGLGETVERTEXATTRIBDVPROC glGetVertexAttribdv;
+	PFNGLGETVERTEXATTRIBFVPROC glGetVertexAttribfv;
+	PFNGLGETVERTEXATTRIBIVPROC glGetVertexAttribiv;
+	PFNGLGETVERTEXATTRIBPOINTERVPROC glGetVertexAttribPointerv;
+	PFNGLISPROGRAMPROC glIsProgram;
+	PFNGLISSHADERPROC glIsShader;
+	PFNGLLINKPROGRAMPROC glLinkProgram;
+	PFNGLSHADERSOURCEPROC glShaderSource;
+	PFNGLUSEPROGRAMPROC glUseProgram;
+	PFNGLUNIFORM1FPROC glUniform1f;
+	PFNGLUNIFORM2FPROC glUniform2f;
+	PFNGLUNIFORM3FPROC glUniform3f;
+	PFNGLUNIFORM4FPROC glUniform4f;
+	PFNGLUNIFORM1IPROC glUniform1i;
+	PFNGLUNIFORM2IPROC glUniform2i;
+	PFNGLUNIFORM3IPROC glUniform3i;
+	PFNGLUNIFORM4IPROC glUniform4i;
+	PFNGLUNIFORM1FVPROC glUniform1fv;
+	PFNGLUNIFORM2FVPROC glUniform2fv;
+	PFNGLUNIFORM3FVPROC glUniform3fv;
+	PFNGLUNIFORM4FVPROC glUniform4fv;
+	PFNGLUNIFORM1IVPROC glUniform1iv;
+	PFNGLUNIFORM2IVPROC glUniform2iv;
+	PFNGLUNIFORM3IVPROC glUniform3iv;
+	PFNGLUNIFORM4IVPROC glUniform4iv;
+	PFNGLUNIFORMMATRIX2FVPROC glUniformMatrix2fv;
+	PFNGLUNIFORMMATRIX3FVPROC glUniformMatrix3fv;
+	PFNGLUNIFORMMATRIX4FVPROC glUniformMatrix4fv;
+	PFNGLVALIDATEPROGRAMPROC glValidateProgram;
+	PFNGLVERTEXATTRIB1DPROC glVertexAttrib1d;
+	PFNGLVERTEXATTRIB1DVPROC glVertexAttrib1dv;
+	PFNGLVERTEXATTRIB1FPROC glVertexAttrib1f;
+	PFNGLVERTEXATTRIB1FVPROC glVertexAttrib1fv;
+	PFNGLVERTEXATTRIB1SPROC glVertexAttrib1s;
+	PFNGLVERTEXATTRIB1SVPROC glVertexAttrib1sv;
+	PFNGLVERTEXATTRIB2DPROC glVertexAttrib2d;
+	PFNGLVERTEXATTRIB2DVPROC glVertexAttrib2dv;
+	PFNGLVERTEXATTRIB2FPROC glVertexAttrib2f;
+	PFNGLVERTEXATTRIB2FVPROC glVertexAttrib2fv;
+	PFNGLVERTEXATTRIB2SPROC glVertexAttrib2s;
+	PFNGLVERTEXATTRIB2SVPROC glVertexAttrib2sv;
+	PFNGLVERTEXATTRIB3DPROC glVertexAttrib3d;
+	PFNGLVERTEXATTRIB3DVPROC glVertexAttrib3dv;
+	PFNGLVERTEXATTRIB3FPROC glVertexAttrib3f;
+	PFNGLVERTEXATTRIB3FVPROC glVertexAttrib3fv;
+	PFNGLVERTEXATTRIB3SPROC glVertexAttrib3s;
+	PFNGLVERTEXATTRIB3SVPROC glVertexAttrib3sv;
+	PFNGLVERTEXATTRIB4NBVPROC glVertexAttrib4Nbv;
+	PFNGLVERTEXATTRIB4NIVPROC glVertexAttrib4Niv;
+	PFNGLVERTEXATTRIB4NSVPROC glVertexAttrib4Nsv;
+	PFNGLVERTEXATTRIB4NUBPROC glVertexAttrib4Nub;
+	PFNGLVERTEXATTRIB4NUBVPROC glVertexAttrib4Nubv;
+	PFNGLVERTEXATTRIB4NUIVPROC glVertexAttrib4Nuiv;
+	PFNGLVERTEXATTRIB4NUSVPROC glVertexAttrib4Nusv;
+	PFNGLVERTEXATTRIB4BVPROC glVertexAttrib4bv;
+	PFNGLVERTEXATTRIB4DPROC glVertexAttrib4d;
+	PFNGLVERTEXATTRIB4DVPROC glVertexAttrib4dv;
+	PFNGLVERTEXATTRIB4FPROC glVertexAttrib4f;
+	PFNGLVERTEXATTRIB4FVPROC glVertexAttrib4fv;
+	PFNGLVERTEXATTRIB4IVPROC glVertexAttrib4iv;
+	PFNGLVERTEXATTRIB4SPROC glVertexAttrib4s;
+	PFNGLVERTEXATTRIB4SVPROC glVertexAttrib4sv;
+	PFNGLVERTEXATTRIB4UBVPROC glVertexAttrib4ubv;
+	PFNGLVERTEXATTRIB4UIVPROC glVertexAttrib4uiv;
+	PFNGLVERTEXATTRIB4USVPROC glVertexAttrib4usv;
+	PFNGLVERTEXATTRIBPOINTERPROC glVertexAttribPointer;
+	PFNGLUNIFORMMATRIX2X3FVPROC glUniformMatrix2x3fv;
+	PFNGLUNIFORMMATRIX3X2FVPROC glUniformMatrix3x2fv;
+	PFNGLUNIFORMMATRIX2X4FVPROC glUniformMatrix2x4fv;
+	PFNGLUNIFORMMATRIX4X2FVPROC glUniformMatrix4x2fv;
+	PFNGLUNIFORMMATRIX3X4FVPROC glUniformMatrix3x4fv;
+	PFNGLUNIFORMMATRIX4X3FVPROC glUniformMatrix4x3fv;
+	PFNGLCOLORMASKIPROC glColorMaski;
+	PFNGLGETBOOLEANI_VPROC glGetBooleani_v;
+	PFNGLGETINTEGERI_VPROC glGetIntegeri_v;
+	PFNGLENABLEIPROC glEnablei;
+	PFNGLDISABLEIPROC glDisablei;
+	PFNGLISENABLEDIPROC glIsEnabledi;
+	PFNGLBEGINTRANSFORMFEEDBACKPROC glBeginTransformFeedback;
+	PFNGLENDTRANSFORMFEEDBACKPROC glEndTransformFeedback;
+	PFNGLBINDBUFFERRANGEPROC glBindBufferRange;
+	PFNGLBINDBUFFERBASEPROC glBindBufferBase;
+	PFNGLTRANSFORMFEEDBACKVARYINGSPROC glTransformFeedbackVaryings;
+	PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glGetTransformFeedbackVarying;
+	PFNGLCLAMPCOLORPROC glClampColor;
+	PFNGLBEGINCONDITIONALRENDERPROC glBeginConditionalRender;
+	PFNGLENDCONDITIONALRENDERPROC glEndConditionalRender;
+	PFNGLVERTEXATTRIBIPOINTERPROC glVertexAttribIPointer;
+	PFNGLGETVERTEXATTRIBIIVPROC glGetVertexAttribIiv;
+	PFNGLGETVERTEXATTRIBIUIVPROC glGetVertexAttribIuiv;
+	PFNGLVERTEXATTRIBI1IPROC glVertexAttribI1i;
+	PFNGLVERTEXATTRIBI2IPROC glVertexAttribI2i;
+	PFNGLVERTEXATTRIBI3IPROC glVertexAttribI3i;
+	PFNGLVERTEXATTRIBI4IPROC glVertexAttribI4i;
+	PFNGLVERTEXATTRIBI1UIPROC glVertexAttribI1ui;
+	PFNGLVERTEXATTRIBI2UIPROC glVertexAttribI2ui;
+	PFNGLVERTEXATTRIBI3UIPROC glVertexAttribI3ui;
+	PFNGLVERTEXATTRIBI4UIPROC glVertexAttribI4ui;
+	PFNGLVERTEXATTRIBI1IVPROC glVertexAttribI1iv;
+	PFNGLVERTEXATTRIBI2IVPROC glVertexAttribI2iv;
+	PFNGLVERTEXATTRIBI3IVPROC glVertexAttribI3iv;
+	PFNGLVERTEXATTRIBI4IVPROC glVertexAttribI4iv;
+	PFNGLVERTEXATTRIBI1UIVPROC glVertexAttribI1uiv;
+	PFNGLVERTEXATTRIBI2UIVPROC glVertexAttribI2uiv;
+	PFNGLVERTEXATTRIBI3UIVPROC glVertexAttribI3uiv;
+	PFNGLVERTEXATTRIBI4UIVPROC glVertexAttribI4uiv;
+	PFNGLVERTEXATTRIBI4BVPROC glVertexAttribI4bv;
+	PFNGLVERTEXATTRIBI4SVPROC glVertexAttribI4sv;
+	PFNGLVERTEXATTRIBI4UBVPROC glVertexAttribI4ubv;
+	PFNGLVERTEXATTRIBI4USVPROC glVertexAttribI4usv;
+	PFNGLGETUNIFORMUIVPROC glGetUniformuiv;
+	PFNGLBINDFRAGDATALOCATIONPROC glBindFragDataLocation;
+	PFNGLGETFRAGDATALOCATIONPROC glGetFragDataLocation;
+	PFNGLUNIFORM1UIPROC glUniform1ui;
+	PFNGLUNIFORM2UIPROC glUniform2ui;
+	PFNGLUNIFORM3UIPROC glUniform3ui;
+	PFNGLUNIFORM4UIPROC glUniform4ui;
+	PFNGLUNIFORM1UIVPROC glUniform1uiv;
+	PFNGLUNIFORM2UIVPROC glUniform2uiv;
+	PFNGLUNIFORM3UIVPROC glUniform3uiv;
+	PFNGLUNIFORM4UIVPROC glUniform4uiv;
+	PFNGLTEXPARAMETERIIVPROC glTexParameterIiv;
+	PFNGLTEXPARAMETERIUIVPROC glTexParameterIuiv;
+	PFNGLGETTEXPARAMETERIIVPROC glGetTexParameterIiv;
+	PFNGLGETTEXPARAMETERIUIVPROC glGetTexParameterIuiv;
+	PFNGLCLEARBUFFERIVPROC glClearBufferiv;
+	PFNGLCLEARBUFFERUIVPROC glClearBufferuiv;
+	PFNGLCLEARBUFFERFVPROC glClearBufferfv;
+	PFNGLCLEARBUFFERFIPROC glClearBufferfi;
+	PFNGLGETSTRINGIPROC glGetStringi;
+	PFNGLISRENDERBUFFERPROC glIsRenderbuffer;
+	PFNGLBINDRENDERBUFFERPROC glBindRenderbuffer;
+	PFNGLDELETERENDERBUFFERSPROC glDeleteRenderbuffers;
+	PFNGLGENRENDERBUFFERSPROC glGenRenderbuffers;
+	PFNGLRENDERBUFFERSTORAGEPROC glRenderbufferStorage;
+	PFNGLGETRENDERBUFFERPARAMETERIVPROC glGetRenderbufferParameteriv;
+	PFNGLISFRAMEBUFFERPROC glIsFramebuffer;
+	PFNGLBINDFRAMEBUFFERPROC glBindFramebuffer;
+	PFNGLDELETEFRAMEBUFFERSPROC glDeleteFramebuffers;
+	PFNGLGENFRAMEBUFFERSPROC glGenFramebuffers;
+	PFNGLCHECKFRAMEBUFFERSTATUSPROC glCheckFramebufferStatus;
+	PFNGLFRAMEBUFFERTEXTURE1DPROC glFramebufferTexture1D;
+	PFNGLFRAMEBUFFERTEXTURE2DPROC glFramebufferTexture2D;
+	PFNGLFRAMEBUFFERTEXTURE3DPROC glFramebufferTexture3D;
+	PFNGLFRAMEBUFFERRENDERBUFFERPROC glFramebufferRenderbuffer;
+	PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glGetFramebufferAttachmentParameteriv;
+	PFNGLGENERATEMIPMAPPROC glGenerateMipmap;
+	PFNGLBLITFRAMEBUFFERPROC glBlitFramebuffer;
+	PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glRenderbufferStorageMultisample;
+	PFNGLFRAMEBUFFERTEXTURELAYERPROC glFramebufferTextureLayer;
+	PFNGLMAPBUFFERRANGEPROC glMapBufferRange;
+	PFNGLFLUSHMAPPEDBUFFERRANGEPROC glFlushMappedBufferRange;
+	PFNGLBINDVERTEXARRAYPROC glBindVertexArray;
+	PFNGLDELETEVERTEXARRAYSPROC glDeleteVertexArrays;
+	PFNGLGENVERTEXARRAYSPROC glGenVertexArrays;
+	PFNGLISVERTEXARRAYPROC glIsVertexArray;
+	PFNGLDRAWARRAYSINSTANCEDPROC glDrawArraysInstanced;
+	PFNGLDRAWELEMENTSINSTANCEDPROC glDrawElementsInstanced;
+	PFNGLTEXBUFFERPROC glTexBuffer;
+	PFNGLPRIMITIVERESTARTINDEXPROC glPrimitiveRestartIndex;
+	PFNGLCOPYBUFFERSUBDATAPROC glCopyBufferSubData;
+	PFNGLGETUNIFORMINDICESPROC glGetUniformIndices;
+	PFNGLGETACTIVEUNIFORMSIVPROC glGetActiveUniformsiv;
+	PFNGLGETACTIVEUNIFORMNAMEPROC glGetActiveUniformName;
+	PFNGLGETUNIFORMBLOCKINDEXPROC glGetUniformBlockIndex;
+	PFNGLGETACTIVEUNIFORMBLOCKIVPROC glGetActiveUniformBlockiv;
+	PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glGetActiveUniformBlockName;
+	PFNGLUNIFORMBLOCKBINDINGPROC glUniformBlockBinding;
+	PFNGLDRAWELEMENTSBASEVERTEXPROC glDrawElementsBaseVertex;
+	PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glDrawRangeElementsBaseVertex;
+	PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glDrawElementsInstancedBaseVertex;
+	PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glMultiDrawElementsBaseVertex;
+	PFNGLPROVOKINGVERTEXPROC glProvokingVertex;
+	PFNGLFENCESYNCPROC glFenceSync;
+	PFNGLISSYNCPROC glIsSync;
+	PFNGLDELETESYNCPROC glDeleteSync;
+	PFNGLCLIENTWAITSYNCPROC glClientWaitSync;
+	PFNGLWAITSYNCPROC glWaitSync;
+	PFNGLGETINTEGER64VPROC glGetInteger64v;
+	PFNGLGETSYNCIVPROC glGetSynciv;
+	PFNGLGETINTEGER64I_VPROC glGetInteger64i_v;
+	PFNGLGETBUFFERPARAMETERI64VPROC glGetBufferParameteri64v;
+	PFNGLFRAMEBUFFERTEXTUREPROC glFramebufferTexture;
+	PFNGLTEXIMAGE2DMULTISAMPLEPROC glTexImage2DMultisample;
+	PFNGLTEXIMAGE3DMULTISAMPLEPROC glTexImage3DMultisample;
+	PFNGLGETMULTISAMPLEFVPROC glGetMultisamplefv;
+	PFNGLSAMPLEMASKIPROC glSampleMaski;
+	PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glBindFragDataLocationIndexed;
+	PFNGLGETFRAGDATAINDEXPROC glGetFragDataIndex;
+	PFNGLGENSAMPLERSPROC glGenSamplers;
+	PFNGLDELETESAMPLERSPROC glDeleteSamplers;
+	PFNGLISSAMPLERPROC glIsSampler;
+	PFNGLBINDSAMPLERPROC glBindSampler;
+	PFNGLSAMPLERPARAMETERIPROC glSamplerParameteri;
+	PFNGLSAMPLERPARAMETERIVPROC glSamplerParameteriv;
+	PFNGLSAMPLERPARAMETERFPROC glSamplerParameterf;
+	PFNGLSAMPLERPARAMETERFVPROC glSamplerParameterfv;
+	PFNGLSAMPLERPARAMETERIIVPROC glSamplerParameterIiv;
+	PFNGLSAMPLERPARAMETERIUIVPROC glSamplerParameterIuiv;
+	PFNGLGETSAMPLERPARAMETERIVPROC glGetSamplerParameteriv;
+	PFNGLGETSAMPLERPARAMETERIIVPROC glGetSamplerParameterIiv;
+	PFNGLGETSAMPLERPARAMETERFVPROC glGetSamplerParameterfv;
+	PFNGLGETSAMPLERPARAMETERIUIVPROC glGetSamplerParameterIuiv;
+	PFNGLQUERYCOUNTERPROC glQueryCounter;
+	PFNGLGETQUERYOBJECTI64VPROC glGetQueryObjecti64v;
+	PFNGLGETQUERYOBJECTUI64VPROC glGetQueryObjectui64v;
+	PFNGLVERTEXATTRIBDIVISORPROC glVertexAttribDivisor;
+	PFNGLVERTEXATTRIBP1UIPROC glVertexAttribP1ui;
+	PFNGLVERTEXATTRIBP1UIVPROC glVertexAttribP1uiv;
+	PFNGLVERTEXATTRIBP2UIPROC glVertexAttribP2ui;
+	PFNGLVERTEXATTRIBP2UIVPROC glVertexAttribP2uiv;
+	PFNGLVERTEXATTRIBP3UIPROC glVertexAttribP3ui;
+	PFNGLVERTEXATTRIBP3UIVPROC glVertexAttribP3uiv;
+	PFNGLVERTEXATTRIBP4UIPROC glVertexAttribP4ui;
+	PFNGLVERTEXATTRIBP4UIVPROC glVertexAttribP4uiv;
+	PFNGLVERTEXP2UIPROC glVertexP2ui;
+	PFNGLVERTEXP2UIVPROC glVertexP2uiv;
+	PFNGLVERTEXP3UIPROC glVertexP3ui;
+	PFNGLVERTEXP3UIVPROC glVertexP3uiv;
+	PFNGLVERTEXP4UIPROC glVertexP4ui;
+	PFNGLVERTEXP4UIVPROC glVertexP4uiv;
+	PFNGLTEXCOORDP1UIPROC glTexCoordP1ui;
+	PFNGLTEXCOORDP1UIVPROC glTexCoordP1uiv;
+	PFNGLTEXCOORDP2UIPROC glTexCoordP2ui;
+	PFNGLTEXCOORDP2UIVPROC glTexCoordP2uiv;
+	PFNGLTEXCOORDP3UIPROC glTexCoordP3ui;
+	PFNGLTEXCOORDP3UIVPROC glTexCoordP3uiv;
+	PFNGLTEXCOORDP4UIPROC glTexCoordP4ui;
+	PFNGLTEXCOORDP4UIVPROC glTexCoordP4uiv;
+	PFNGLMULTITEXCOORDP1UIPROC glMultiTexCoordP1ui;
+	PFNGLMULTITEXCOORDP1UIVPROC glMultiTexCoordP1uiv;
+	PFNGLMULTITEXCOORDP2UIPROC glMultiTexCoordP2ui;
+	PFNGLMULTITEXCOORDP2UIVPROC glMultiTexCoordP2uiv;
+	PFNGLMULTITEXCOORDP3UIPROC glMultiTexCoordP3ui;
+	PFNGLMULTITEXCOORDP3UIVPROC glMultiTexCoordP3uiv;
+	PFNGLMULTITEXCOORDP4UIPROC glMultiTexCoordP4ui;
+	PFNGLMULTITEXCOORDP4UIVPROC glMultiTexCoordP4uiv;
+	PFNGLNORMALP3UIPROC glNormalP3ui;
+	PFNGLNORMALP3UIVPROC glNormalP3uiv;
+	PFNGLCOLORP3UIPROC glColorP3ui;
+	PFNGLCOLORP3UIVPROC glColorP3uiv;
+	PFNGLCOLORP4UIPROC glColorP4ui;
+	PFNGLCOLORP4UIVPROC glColorP4uiv;
+	PFNGLSECONDARYCOLORP3UIPROC glSecondaryColorP3ui;
+	PFNGLSECONDARYCOLORP3UIVPROC glSecondaryColorP3uiv;
+	PFNGLGETPROGRAMBINARYPROC glGetProgramBinary;
+	PFNGLPROGRAMBINARYPROC glProgramBinary;
+	PFNGLPROGRAMPARAMETERIPROC glProgramParameteri;
+	PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glMaxShaderCompilerThreadsKHR;
+	PFNGLBUFFERSTORAGEPROC glBufferStorage;
+} glad_lazy_slots;
+
+#define GLAD_LAZY_BIND(name, proc) \
+	if(glad_lazy_slots.name == NULL) glad_lazy_slots.name = (proc)glad_lazy_resolve(#name); \
+	if(glad_##name == glad_lazy_##name) glad_##name = glad_lazy_slots.name
+
+static void APIENTRY glad_lazy_glCullFace(GLenum mode) {
+	GLAD_LAZY_BIND(glCullFace, PFNGLCULLFACEPROC);
+	glad_lazy_slots.glCullFace(mode);
+}
+static void APIENTRY glad_lazy_glFrontFace(GLenum mode) {
+	GLAD_LAZY_BIND(glFrontFace, PFNGLFRONTFACEPROC);
+	glad_lazy_slots.glFrontFace(mode);
+}
+static void APIENTRY glad_lazy_glHint(GLenum target, GLenum mode) {
+	GLAD_LAZY_BIND(glHint, PFNGLHINTPROC);
+	glad_lazy_slots.glHint(target, mode);
+}
+static void APIENTRY glad_lazy_glLineWidth(GLfloat width) {
+	GLAD_LAZY_BIND(glLineWidth, PFNGLLINEWIDTHPROC);
+	glad_lazy_slots.glLineWidth(width);
+}
+static void APIENTRY glad_lazy_glPointSize(GLfloat size) {
+	GLAD_LAZY_BIND(glPointSize, PFNGLPOINTSIZEPROC);
+	glad_lazy_slots.glPointSize(size);
+}
+static void APIENTRY glad_lazy_glPolygonMode(GLenum face, GLenum mode) {
+	GLAD_LAZY_BIND(glPolygonMode, PFNGLPOLYGONMODEPROC);
+	glad_lazy_slots.glPolygonMode(face, mode);
+}
+static void APIENTRY glad_lazy_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+	GLAD_LAZY_BIND(glScissor, PFNGLSCISSORPROC);
+	glad_lazy_slots.glScissor(x, y, width, height);
+}
+static void APIENTRY glad_lazy_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+	GLAD_LAZY_BIND(glTexParameterf, PFNGLTEXPARAMETERFPROC);
+	glad_lazy_slots.glTexParameterf(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+	GLAD_LAZY_BIND(glTexParameterfv, PFNGLTEXPARAMETERFVPROC);
+	glad_lazy_slots.glTexParameterfv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+	GLAD_LAZY_BIND(glTexParameteri, PFNGLTEXPARAMETERIPROC);
+	glad_lazy_slots.glTexParameteri(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+	GLAD_LAZY_BIND(glTexParameteriv, PFNGLTEXPARAMETERIVPROC);
+	glad_lazy_slots.glTexParameteriv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+	GLAD_LAZY_BIND(glTexImage1D, PFNGLTEXIMAGE1DPROC);
+	glad_lazy_slots.glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+	GLAD_LAZY_BIND(glTexImage2D, PFNGLTEXIMAGE2DPROC);
+	glad_lazy_slots.glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glDrawBuffer(GLenum buf) {
+	GLAD_LAZY_BIND(glDrawBuffer, PFNGLDRAWBUFFERPROC);
+	glad_lazy_slots.glDrawBuffer(buf);
+}
+static void APIENTRY glad_lazy_glClear(GLbitfield mask) {
+	GLAD_LAZY_BIND(glClear, PFNGLCLEARPROC);
+	glad_lazy_slots.glClear(mask);
+}
+static void APIENTRY glad_lazy_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	GLAD_LAZY_BIND(glClearColor, PFNGLCLEARCOLORPROC);
+	glad_lazy_slots.glClearColor(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glClearStencil(GLint s) {
+	GLAD_LAZY_BIND(glClearStencil, PFNGLCLEARSTENCILPROC);
+	glad_lazy_slots.glClearStencil(s);
+}
+static void APIENTRY glad_lazy_glClearDepth(GLdouble depth) {
+	GLAD_LAZY_BIND(glClearDepth, PFNGLCLEARDEPTHPROC);
+	glad_lazy_slots.glClearDepth(depth);
+}
+static void APIENTRY glad_lazy_glStencilMask(GLuint mask) {
+	GLAD_LAZY_BIND(glStencilMask, PFNGLSTENCILMASKPROC);
+	glad_lazy_slots.glStencilMask(mask);
+}
+static void APIENTRY glad_lazy_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+	GLAD_LAZY_BIND(glColorMask, PFNGLCOLORMASKPROC);
+	glad_lazy_slots.glColorMask(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glDepthMask(GLboolean flag) {
+	GLAD_LAZY_BIND(glDepthMask, PFNGLDEPTHMASKPROC);
+	glad_lazy_slots.glDepthMask(flag);
+}
+static void APIENTRY glad_lazy_glDisable(GLenum cap) {
+	GLAD_LAZY_BIND(glDisable, PFNGLDISABLEPROC);
+	glad_lazy_slots.glDisable(cap);
+}
+static void APIENTRY glad_lazy_glEnable(GLenum cap) {
+	GLAD_LAZY_BIND(glEnable, PFNGLENABLEPROC);
+	glad_lazy_slots.glEnable(cap);
+}
+static void APIENTRY glad_lazy_glFinish(void) {
+	GLAD_LAZY_BIND(glFinish, PFNGLFINISHPROC);
+	glad_lazy_slots.glFinish();
+}
+static void APIENTRY glad_lazy_glFlush(void) {
+	GLAD_LAZY_BIND(glFlush, PFNGLFLUSHPROC);
+	glad_lazy_slots.glFlush();
+}
+static void APIENTRY glad_lazy_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+	GLAD_LAZY_BIND(glBlendFunc, PFNGLBLENDFUNCPROC);
+	glad_lazy_slots.glBlendFunc(sfactor, dfactor);
+}
+static void APIENTRY glad_lazy_glLogicOp(GLenum opcode) {
+	GLAD_LAZY_BIND(glLogicOp, PFNGLLOGICOPPROC);
+	glad_lazy_slots.glLogicOp(opcode);
+}
+static void APIENTRY glad_lazy_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+	GLAD_LAZY_BIND(glStencilFunc, PFNGLSTENCILFUNCPROC);
+	glad_lazy_slots.glStencilFunc(func, ref, mask);
+}
+static void APIENTRY glad_lazy_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+	GLAD_LAZY_BIND(glStencilOp, PFNGLSTENCILOPPROC);
+	glad_lazy_slots.glStencilOp(fail, zfail, zpass);
+}
+static void APIENTRY glad_lazy_glDepthFunc(GLenum func) {
+	GLAD_LAZY_BIND(glDepthFunc, PFNGLDEPTHFUNCPROC);
+	glad_lazy_slots.glDepthFunc(func);
+}
+static void APIENTRY glad_lazy_glPixelStoref(GLenum pname, GLfloat param) {
+	GLAD_LAZY_BIND(glPixelStoref, PFNGLPIXELSTOREFPROC);
+	glad_lazy_slots.glPixelStoref(pname, param);
+}
+static void APIENTRY glad_lazy_glPixelStorei(GLenum pname, GLint param) {
+	GLAD_LAZY_BIND(glPixelStorei, PFNGLPIXELSTOREIPROC);
+	glad_lazy_slots.glPixelStorei(pname, param);
+}
+static void APIENTRY glad_lazy_glReadBuffer(GLenum src) {
+	GLAD_LAZY_BIND(glReadBuffer, PFNGLREADBUFFERPROC);
+	glad_lazy_slots.glReadBuffer(src);
+}
+static void APIENTRY glad_lazy_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+	GLAD_LAZY_BIND(glReadPixels, PFNGLREADPIXELSPROC);
+	glad_lazy_slots.glReadPixels(x, y, width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glGetBooleanv(GLenum pname, GLboolean *data) {
+	GLAD_LAZY_BIND(glGetBooleanv, PFNGLGETBOOLEANVPROC);
+	glad_lazy_slots.glGetBooleanv(pname, data);
+}
+static void APIENTRY glad_lazy_glGetDoublev(GLenum pname, GLdouble *data) {
+	GLAD_LAZY_BIND(glGetDoublev, PFNGLGETDOUBLEVPROC);
+	glad_lazy_slots.glGetDoublev(pname, data);
+}
+static GLenum APIENTRY glad_lazy_glGetError(void) {
+	GLAD_LAZY_BIND(glGetError, PFNGLGETERRORPROC);
+	return glad_lazy_slots.glGetError();
+}
+static void APIENTRY glad_lazy_glGetFloatv(GLenum pname, GLfloat *data) {
+	GLAD_LAZY_BIND(glGetFloatv, PFNGLGETFLOATVPROC);
+	glad_lazy_slots.glGetFloatv(pname, data);
+}
+static void APIENTRY glad_lazy_glGetIntegerv(GLenum pname, GLint *data) {
+	GLAD_LAZY_BIND(glGetIntegerv, PFNGLGETINTEGERVPROC);
+	glad_lazy_slots.glGetIntegerv(pname, data);
+}
+static const GLubyte * APIENTRY glad_lazy_glGetString(GLenum name) {
+	GLAD_LAZY_BIND(glGetString, PFNGLGETSTRINGPROC);
+	return glad_lazy_slots.glGetString(name);
+}
+static void APIENTRY glad_lazy_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+	GLAD_LAZY_BIND(glGetTexImage, PFNGLGETTEXIMAGEPROC);
+	glad_lazy_slots.glGetTexImage(target, level, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+	GLAD_LAZY_BIND(glGetTexParameterfv, PFNGLGETTEXPARAMETERFVPROC);
+	glad_lazy_slots.glGetTexParameterfv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+	GLAD_LAZY_BIND(glGetTexParameteriv, PFNGLGETTEXPARAMETERIVPROC);
+	glad_lazy_slots.glGetTexParameteriv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+	GLAD_LAZY_BIND(glGetTexLevelParameterfv, PFNGLGETTEXLEVELPARAMETERFVPROC);
+	glad_lazy_slots.glGetTexLevelParameterfv(target, level, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+	GLAD_LAZY_BIND(glGetTexLevelParameteriv, PFNGLGETTEXLEVELPARAMETERIVPROC);
+	glad_lazy_slots.glGetTexLevelParameteriv(target, level, pname, params);
+}
+static GLboolean APIENTRY glad_lazy_glIsEnabled(GLenum cap) {
+	GLAD_LAZY_BIND(glIsEnabled, PFNGLISENABLEDPROC);
+	return glad_lazy_slots.glIsEnabled(cap);
+}
+static void APIENTRY glad_lazy_glDepthRange(GLdouble n, GLdouble f) {
+	GLAD_LAZY_BIND(glDepthRange, PFNGLDEPTHRANGEPROC);
+	glad_lazy_slots.glDepthRange(n, f);
+}
+static void APIENTRY glad_lazy_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	GLAD_LAZY_BIND(glViewport, PFNGLVIEWPORTPROC);
+	glad_lazy_slots.glViewport(x, y, width, height);
+}
+static void APIENTRY glad_lazy_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+	GLAD_LAZY_BIND(glDrawArrays, PFNGLDRAWARRAYSPROC);
+	glad_lazy_slots.glDrawArrays(mode, first, count);
+}
+static void APIENTRY glad_lazy_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+	GLAD_LAZY_BIND(glDrawElements, PFNGLDRAWELEMENTSPROC);
+	glad_lazy_slots.glDrawElements(mode, count, type, indices);
+}
+static void APIENTRY glad_lazy_glPolygonOffset(GLfloat factor, GLfloat units) {
+	GLAD_LAZY_BIND(glPolygonOffset, PFNGLPOLYGONOFFSETPROC);
+	glad_lazy_slots.glPolygonOffset(factor, units);
+}
+static void APIENTRY glad_lazy_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	GLAD_LAZY_BIND(glCopyTexImage1D, PFNGLCOPYTEXIMAGE1DPROC);
+	glad_lazy_slots.glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+}
+static void APIENTRY glad_lazy_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	GLAD_LAZY_BIND(glCopyTexImage2D, PFNGLCOPYTEXIMAGE2DPROC);
+	glad_lazy_slots.glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	GLAD_LAZY_BIND(glCopyTexSubImage1D, PFNGLCOPYTEXSUBIMAGE1DPROC);
+	glad_lazy_slots.glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	GLAD_LAZY_BIND(glCopyTexSubImage2D, PFNGLCOPYTEXSUBIMAGE2DPROC);
+	glad_lazy_slots.glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	GLAD_LAZY_BIND(glTexSubImage1D, PFNGLTEXSUBIMAGE1DPROC);
+	glad_lazy_slots.glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	GLAD_LAZY_BIND(glTexSubImage2D, PFNGLTEXSUBIMAGE2DPROC);
+	glad_lazy_slots.glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glBindTexture(GLenum target, GLuint texture) {
+	GLAD_LAZY_BIND(glBindTexture, PFNGLBINDTEXTUREPROC);
+	glad_lazy_slots.glBindTexture(target, texture);
+}
+static void APIENTRY glad_lazy_glDeleteTextures(GLsizei n, const GLuint *textures) {
+	GLAD_LAZY_BIND(glDeleteTextures, PFNGLDELETETEXTURESPROC);
+	glad_lazy_slots.glDeleteTextures(n, textures);
+}
+static void APIENTRY glad_lazy_glGenTextures(GLsizei n, GLuint *textures) {
+	GLAD_LAZY_BIND(glGenTextures, PFNGLGENTEXTURESPROC);
+	glad_lazy_slots.glGenTextures(n, textures);
+}
+static GLboolean APIENTRY glad_lazy_glIsTexture(GLuint texture) {
+	GLAD_LAZY_BIND(glIsTexture, PFNGLISTEXTUREPROC);
+	return glad_lazy_slots.glIsTexture(texture);
+}
+static void APIENTRY glad_lazy_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+	GLAD_LAZY_BIND(glDrawRangeElements, PFNGLDRAWRANGEELEMENTSPROC);
+	glad_lazy_slots.glDrawRangeElements(mode, start, end, count, type, indices);
+}
+static void APIENTRY glad_lazy_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+	GLAD_LAZY_BIND(glTexImage3D, PFNGLTEXIMAGE3DPROC);
+	glad_lazy_slots.glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	GLAD_LAZY_BIND(glTexSubImage3D, PFNGLTEXSUBIMAGE3DPROC);
+	glad_lazy_slots.glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	GLAD_LAZY_BIND(glCopyTexSubImage3D, PFNGLCOPYTEXSUBIMAGE3DPROC);
+	glad_lazy_slots.glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glActiveTexture(GLenum texture) {
+	GLAD_LAZY_BIND(glActiveTexture, PFNGLACTIVETEXTUREPROC);
+	glad_lazy_slots.glActiveTexture(texture);
+}
+static void APIENTRY glad_lazy_glSampleCoverage(GLfloat value, GLboolean invert) {
+	GLAD_LAZY_BIND(glSampleCoverage, PFNGLSAMPLECOVERAGEPROC);
+	glad_lazy_slots.glSampleCoverage(value, invert);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+	GLAD_LAZY_BIND(glCompressedTexImage3D, PFNGLCOMPRESSEDTEXIMAGE3DPROC);
+	glad_lazy_slots.glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+	GLAD_LAZY_BIND(glCompressedTexImage2D, PFNGLCOMPRESSEDTEXIMAGE2DPROC);
+	glad_lazy_slots.glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+	GLAD_LAZY_BIND(glCompressedTexImage1D, PFNGLCOMPRESSEDTEXIMAGE1DPROC);
+	glad_lazy_slots.glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	GLAD_LAZY_BIND(glCompressedTexSubImage3D, PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC);
+	glad_lazy_slots.glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	GLAD_LAZY_BIND(glCompressedTexSubImage2D, PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC);
+	glad_lazy_slots.glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	GLAD_LAZY_BIND(glCompressedTexSubImage1D, PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC);
+	glad_lazy_slots.glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+	GLAD_LAZY_BIND(glGetCompressedTexImage, PFNGLGETCOMPRESSEDTEXIMAGEPROC);
+	glad_lazy_slots.glGetCompressedTexImage(target, level, img);
+}
+static void APIENTRY glad_lazy_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+	GLAD_LAZY_BIND(glBlendFuncSeparate, PFNGLBLENDFUNCSEPARATEPROC);
+	glad_lazy_slots.glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+static void APIENTRY glad_lazy_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+	GLAD_LAZY_BIND(glMultiDrawArrays, PFNGLMULTIDRAWARRAYSPROC);
+	glad_lazy_slots.glMultiDrawArrays(mode, first, count, drawcount);
+}
+static void APIENTRY glad_lazy_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+	GLAD_LAZY_BIND(glMultiDrawElements, PFNGLMULTIDRAWELEMENTSPROC);
+	glad_lazy_slots.glMultiDrawElements(mode, count, type, indices, drawcount);
+}
+static void APIENTRY glad_lazy_glPointParameterf(GLenum pname, GLfloat param) {
+	GLAD_LAZY_BIND(glPointParameterf, PFNGLPOINTPARAMETERFPROC);
+	glad_lazy_slots.glPointParameterf(pname, param);
+}
+static void APIENTRY glad_lazy_glPointParameterfv(GLenum pname, const GLfloat *params) {
+	GLAD_LAZY_BIND(glPointParameterfv, PFNGLPOINTPARAMETERFVPROC);
+	glad_lazy_slots.glPointParameterfv(pname, params);
+}
+static void APIENTRY glad_lazy_glPointParameteri(GLenum pname, GLint param) {
+	GLAD_LAZY_BIND(glPointParameteri, PFNGLPOINTPARAMETERIPROC);
+	glad_lazy_slots.glPointParameteri(pname, param);
+}
+static void APIENTRY glad_lazy_glPointParameteriv(GLenum pname, const GLint *params) {
+	GLAD_LAZY_BIND(glPointParameteriv, PFNGLPOINTPARAMETERIVPROC);
+	glad_lazy_slots.glPointParameteriv(pname, params);
+}
+static void APIENTRY glad_lazy_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	GLAD_LAZY_BIND(glBlendColor, PFNGLBLENDCOLORPROC);
+	glad_lazy_slots.glBlendColor(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glBlendEquation(GLenum mode) {
+	GLAD_LAZY_BIND(glBlendEquation, PFNGLBLENDEQUATIONPROC);
+	glad_lazy_slots.glBlendEquation(mode);
+}
+static void APIENTRY glad_lazy_glGenQueries(GLsizei n, GLuint *ids) {
+	GLAD_LAZY_BIND(glGenQueries, PFNGLGENQUERIESPROC);
+	glad_lazy_slots.glGenQueries(n, ids);
+}
+static void APIENTRY glad_lazy_glDeleteQueries(GLsizei n, const GLuint *ids) {
+	GLAD_LAZY_BIND(glDeleteQueries, PFNGLDELETEQUERIESPROC);
+	glad_lazy_slots.glDeleteQueries(n, ids);
+}
+static GLboolean APIENTRY glad_lazy_glIsQuery(GLuint id) {
+	GLAD_LAZY_BIND(glIsQuery, PFNGLISQUERYPROC);
+	return glad_lazy_slots.glIsQuery(id);
+}
+static void APIENTRY glad_lazy_glBeginQuery(GLenum target, GLuint id) {
+	GLAD_LAZY_BIND(glBeginQuery, PFNGLBEGINQUERYPROC);
+	glad_lazy_slots.glBeginQuery(target, id);
+}
+static void APIENTRY glad_lazy_glEndQuery(GLenum target) {
+	GLAD_LAZY_BIND(glEndQuery, PFNGLENDQUERYPROC);
+	glad_lazy_slots.glEndQuery(target);
+}
+static void APIENTRY glad_lazy_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+	GLAD_LAZY_BIND(glGetQueryiv, PFNGLGETQUERYIVPROC);
+	glad_lazy_slots.glGetQueryiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+	GLAD_LAZY_BIND(glGetQueryObjectiv, PFNGLGETQUERYOBJECTIVPROC);
+	glad_lazy_slots.glGetQueryObjectiv(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+	GLAD_LAZY_BIND(glGetQueryObjectuiv, PFNGLGETQUERYOBJECTUIVPROC);
+	glad_lazy_slots.glGetQueryObjectuiv(id, pname, params);
+}
+static void APIENTRY glad_lazy_glBindBuffer(GLenum target, GLuint buffer) {
+	GLAD_LAZY_BIND(glBindBuffer, PFNGLBINDBUFFERPROC);
+	glad_lazy_slots.glBindBuffer(target, buffer);
+}
+static void APIENTRY glad_lazy_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+	GLAD_LAZY_BIND(glDeleteBuffers, PFNGLDELETEBUFFERSPROC);
+	glad_lazy_slots.glDeleteBuffers(n, buffers);
+}
+static void APIENTRY glad_lazy_glGenBuffers(GLsizei n, GLuint *buffers) {
+	GLAD_LAZY_BIND(glGenBuffers, PFNGLGENBUFFERSPROC);
+	glad_lazy_slots.glGenBuffers(n, buffers);
+}
+static GLboolean APIENTRY glad_lazy_glIsBuffer(GLuint buffer) {
+	GLAD_LAZY_BIND(glIsBuffer, PFNGLISBUFFERPROC);
+	return glad_lazy_slots.glIsBuffer(buffer);
+}
+static void APIENTRY glad_lazy_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+	GLAD_LAZY_BIND(glBufferData, PFNGLBUFFERDATAPROC);
+	glad_lazy_slots.glBufferData(target, size, data, usage);
+}
+static void APIENTRY glad_lazy_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+	GLAD_LAZY_BIND(glBufferSubData, PFNGLBUFFERSUBDATAPROC);
+	glad_lazy_slots.glBufferSubData(target, offset, size, data);
+}
+static void APIENTRY glad_lazy_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+	GLAD_LAZY_BIND(glGetBufferSubData, PFNGLGETBUFFERSUBDATAPROC);
+	glad_lazy_slots.glGetBufferSubData(target, offset, size, data);
+}
+static void * APIENTRY glad_lazy_glMapBuffer(GLenum target, GLenum access) {
+	GLAD_LAZY_BIND(glMapBuffer, PFNGLMAPBUFFERPROC);
+	return glad_lazy_slots.glMapBuffer(target, access);
+}
+static GLboolean APIENTRY glad_lazy_glUnmapBuffer(GLenum target) {
+	GLAD_LAZY_BIND(glUnmapBuffer, PFNGLUNMAPBUFFERPROC);
+	return glad_lazy_slots.glUnmapBuffer(target);
+}
+static void APIENTRY glad_lazy_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	GLAD_LAZY_BIND(glGetBufferParameteriv, PFNGLGETBUFFERPARAMETERIVPROC);
+	glad_lazy_slots.glGetBufferParameteriv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+	GLAD_LAZY_BIND(glGetBufferPointerv, PFNGLGETBUFFERPOINTERVPROC);
+	glad_lazy_slots.glGetBufferPointerv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+	GLAD_LAZY_BIND(glBlendEquationSeparate, PFNGLBLENDEQUATIONSEPARATEPROC);
+	glad_lazy_slots.glBlendEquationSeparate(modeRGB, modeAlpha);
+}
+static void APIENTRY glad_lazy_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+	GLAD_LAZY_BIND(glDrawBuffers, PFNGLDRAWBUFFERSPROC);
+	glad_lazy_slots.glDrawBuffers(n, bufs);
+}
+static void APIENTRY glad_lazy_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+	GLAD_LAZY_BIND(glStencilOpSeparate, PFNGLSTENCILOPSEPARATEPROC);
+	glad_lazy_slots.glStencilOpSeparate(face, sfail, dpfail, dppass);
+}
+static void APIENTRY glad_lazy_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+	GLAD_LAZY_BIND(glStencilFuncSeparate, PFNGLSTENCILFUNCSEPARATEPROC);
+	glad_lazy_slots.glStencilFuncSeparate(face, func, ref, mask);
+}
+static void APIENTRY glad_lazy_glStencilMaskSeparate(GLenum face, GLuint mask) {
+	GLAD_LAZY_BIND(glStencilMaskSeparate, PFNGLSTENCILMASKSEPARATEPROC);
+	glad_lazy_slots.glStencilMaskSeparate(face, mask);
+}
+static void APIENTRY glad_lazy_glAttachShader(GLuint program, GLuint shader) {
+	GLAD_LAZY_BIND(glAttachShader, PFNGLATTACHSHADERPROC);
+	glad_lazy_slots.glAttachShader(program, shader);
+}
+static void APIENTRY glad_lazy_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+	GLAD_LAZY_BIND(glBindAttribLocation, PFNGLBINDATTRIBLOCATIONPROC);
+	glad_lazy_slots.glBindAttribLocation(program, index, name);
+}
+static void APIENTRY glad_lazy_glCompileShader(GLuint shader) {
+	GLAD_LAZY_BIND(glCompileShader, PFNGLCOMPILESHADERPROC);
+	glad_lazy_slots.glCompileShader(shader);
+}
+static GLuint APIENTRY glad_lazy_glCreateProgram(void) {
+	GLAD_LAZY_BIND(glCreateProgram, PFNGLCREATEPROGRAMPROC);
+	return glad_lazy_slots.glCreateProgram();
+}
+static GLuint APIENTRY glad_lazy_glCreateShader(GLenum type) {
+	GLAD_LAZY_BIND(glCreateShader, PFNGLCREATESHADERPROC);
+	return glad_lazy_slots.glCreateShader(type);
+}
+static void APIENTRY glad_lazy_glDeleteProgram(GLuint program) {
+	GLAD_LAZY_BIND(glDeleteProgram, PFNGLDELETEPROGRAMPROC);
+	glad_lazy_slots.glDeleteProgram(program);
+}
+static void APIENTRY glad_lazy_glDeleteShader(GLuint shader) {
+	GLAD_LAZY_BIND(glDeleteShader, PFNGLDELETESHADERPROC);
+	glad_lazy_slots.glDeleteShader(shader);
+}
+static void APIENTRY glad_lazy_glDetachShader(GLuint program, GLuint shader) {
+	GLAD_LAZY_BIND(glDetachShader, PFNGLDETACHSHADERPROC);
+	glad_lazy_slots.glDetachShader(program, shader);
+}
+static void APIENTRY glad_lazy_glDisableVertexAttribArray(GLuint index) {
+	GLAD_LAZY_BIND(glDisableVertexAttribArray, PFNGLDISABLEVERTEXATTRIBARRAYPROC);
+	glad_lazy_slots.glDisableVertexAttribArray(index);
+}
+static void APIENTRY glad_lazy_glEnableVertexAttribArray(GLuint index) {
+	GLAD_LAZY_BIND(glEnableVertexAttribArray, PFNGLENABLEVERTEXATTRIBARRAYPROC);
+	glad_lazy_slots.glEnableVertexAttribArray(index);
+}
+static void APIENTRY glad_lazy_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	GLAD_LAZY_BIND(glGetActiveAttrib, PFNGLGETACTIVEATTRIBPROC);
+	glad_lazy_slots.glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	GLAD_LAZY_BIND(glGetActiveUniform, PFNGLGETACTIVEUNIFORMPROC);
+	glad_lazy_slots.glGetActiveUniform(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+	GLAD_LAZY_BIND(glGetAttachedShaders, PFNGLGETATTACHEDSHADERSPROC);
+	glad_lazy_slots.glGetAttachedShaders(program, maxCount, count, shaders);
+}
+static GLint APIENTRY glad_lazy_glGetAttribLocation(GLuint program, const GLchar *name) {
+	GLAD_LAZY_BIND(glGetAttribLocation, PFNGLGETATTRIBLOCATIONPROC);
+	return glad_lazy_slots.glGetAttribLocation(program, name);
+}
+static void APIENTRY glad_lazy_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+	GLAD_LAZY_BIND(glGetProgramiv, PFNGLGETPROGRAMIVPROC);
+	glad_lazy_slots.glGetProgramiv(program, pname, params);
+}
+static void APIENTRY glad_lazy_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	GLAD_LAZY_BIND(glGetProgramInfoLog, PFNGLGETPROGRAMINFOLOGPROC);
+	glad_lazy_slots.glGetProgramInfoLog(program, bufSize, length, infoLog);
+}
+static void APIENTRY glad_lazy_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+	GLAD_LAZY_BIND(glGetShaderiv, PFNGLGETSHADERIVPROC);
+	glad_lazy_slots.glGetShaderiv(shader, pname, params);
+}
+static void APIENTRY glad_lazy_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	GLAD_LAZY_BIND(glGetShaderInfoLog, PFNGLGETSHADERINFOLOGPROC);
+	glad_lazy_slots.glGetShaderInfoLog(shader, bufSize, length, infoLog);
+}
+static void APIENTRY glad_lazy_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+	GLAD_LAZY_BIND(glGetShaderSource, PFNGLGETSHADERSOURCEPROC);
+	glad_lazy_slots.glGetShaderSource(shader, bufSize, length, source);
+}
+static GLint APIENTRY glad_lazy_glGetUniformLocation(GLuint program, const GLchar *name) {
+	GLAD_LAZY_BIND(glGetUniformLocation, PFNGLGETUNIFORMLOCATIONPROC);
+	return glad_lazy_slots.glGetUniformLocation(program, name);
+}
+static void APIENTRY glad_lazy_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+	GLAD_LAZY_BIND(glGetUniformfv, PFNGLGETUNIFORMFVPROC);
+	glad_lazy_slots.glGetUniformfv(program, location, params);
+}
+static void APIENTRY glad_lazy_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+	GLAD_LAZY_BIND(glGetUniformiv, PFNGLGETUNIFORMIVPROC);
+	glad_lazy_slots.glGetUniformiv(program, location, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+	GLAD_LAZY_BIND(glGetVertexAttribdv, PFNGLGETVERTEXATTRIBDVPROC);
+	glad_lazy_slots.glGetVertexAttribdv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+	GLAD_LAZY_BIND(glGetVertexAttribfv, PFNGLGETVERTEXATTRIBFVPROC);
+	glad_lazy_slots.glGetVertexAttribfv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+	GLAD_LAZY_BIND(glGetVertexAttribiv, PFNGLGETVERTEXATTRIBIVPROC);
+	glad_lazy_slots.glGetVertexAttribiv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+	GLAD_LAZY_BIND(glGetVertexAttribPointerv, PFNGLGETVERTEXATTRIBPOINTERVPROC);
+	glad_lazy_slots.glGetVertexAttribPointerv(index, pname, pointer);
+}
+static GLboolean APIENTRY glad_lazy_glIsProgram(GLuint program) {
+	GLAD_LAZY_BIND(glIsProgram, PFNGLISPROGRAMPROC);
+	return glad_lazy_slots.glIsProgram(program);
+}
+static GLboolean APIENTRY glad_lazy_glIsShader(GLuint shader) {
+	GLAD_LAZY_BIND(glIsShader, PFNGLISSHADERPROC);
+	return glad_lazy_slots.glIsShader(shader);
+}
+static void APIENTRY glad_lazy_glLinkProgram(GLuint program) {
+	GLAD_LAZY_BIND(glLinkProgram, PFNGLLINKPROGRAMPROC);
+	glad_lazy_slots.glLinkProgram(program);
+}
+static void APIENTRY glad_lazy_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+	GLAD_LAZY_BIND(glShaderSource, PFNGLSHADERSOURCEPROC);
+	glad_lazy_slots.glShaderSource(shader, count, string, length);
+}
+static void APIENTRY glad_lazy_glUseProgram(GLuint program) {
+	GLAD_LAZY_BIND(glUseProgram, PFNGLUSEPROGRAMPROC);
+	glad_lazy_slots.glUseProgram(program);
+}
+static void APIENTRY glad_lazy_glUniform1f(GLint location, GLfloat v0) {
+	GLAD_LAZY_BIND(glUniform1f, PFNGLUNIFORM1FPROC);
+	glad_lazy_slots.glUniform1f(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+	GLAD_LAZY_BIND(glUniform2f, PFNGLUNIFORM2FPROC);
+	glad_lazy_slots.glUniform2f(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	GLAD_LAZY_BIND(glUniform3f, PFNGLUNIFORM3FPROC);
+	glad_lazy_slots.glUniform3f(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	GLAD_LAZY_BIND(glUniform4f, PFNGLUNIFORM4FPROC);
+	glad_lazy_slots.glUniform4f(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform1i(GLint location, GLint v0) {
+	GLAD_LAZY_BIND(glUniform1i, PFNGLUNIFORM1IPROC);
+	glad_lazy_slots.glUniform1i(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform2i(GLint location, GLint v0, GLint v1) {
+	GLAD_LAZY_BIND(glUniform2i, PFNGLUNIFORM2IPROC);
+	glad_lazy_slots.glUniform2i(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+	GLAD_LAZY_BIND(glUniform3i, PFNGLUNIFORM3IPROC);
+	glad_lazy_slots.glUniform3i(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	GLAD_LAZY_BIND(glUniform4i, PFNGLUNIFORM4IPROC);
+	glad_lazy_slots.glUniform4i(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+	GLAD_LAZY_BIND(glUniform1fv, PFNGLUNIFORM1FVPROC);
+	glad_lazy_slots.glUniform1fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+	GLAD_LAZY_BIND(glUniform2fv, PFNGLUNIFORM2FVPROC);
+	glad_lazy_slots.glUniform2fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+	GLAD_LAZY_BIND(glUniform3fv, PFNGLUNIFORM3FVPROC);
+	glad_lazy_slots.glUniform3fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+	GLAD_LAZY_BIND(glUniform4fv, PFNGLUNIFORM4FVPROC);
+	glad_lazy_slots.glUniform4fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+	GLAD_LAZY_BIND(glUniform1iv, PFNGLUNIFORM1IVPROC);
+	glad_lazy_slots.glUniform1iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+	GLAD_LAZY_BIND(glUniform2iv, PFNGLUNIFORM2IVPROC);
+	glad_lazy_slots.glUniform2iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+	GLAD_LAZY_BIND(glUniform3iv, PFNGLUNIFORM3IVPROC);
+	glad_lazy_slots.glUniform3iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+	GLAD_LAZY_BIND(glUniform4iv, PFNGLUNIFORM4IVPROC);
+	glad_lazy_slots.glUniform4iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	GLAD_LAZY_BIND(glUniformMatrix2fv, PFNGLUNIFORMMATRIX2FVPROC);
+	glad_lazy_slots.glUniformMatrix2fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	GLAD_LAZY_BIND(glUniformMatrix3fv, PFNGLUNIFORMMATRIX3FVPROC);
+	glad_lazy_slots.glUniformMatrix3fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	GLAD_LAZY_BIND(glUniformMatrix4fv, PFNGLUNIFORMMATRIX4FVPROC);
+	glad_lazy_slots.glUniformMatrix4fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glValidateProgram(GLuint program) {
+	GLAD_LAZY_BIND(glValidateProgram, PFNGLVALIDATEPROGRAMPROC);
+	glad_lazy_slots.glValidateProgram(program);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1d(GLuint index, GLdouble x) {
+	GLAD_LAZY_BIND(glVertexAttrib1d, PFNGLVERTEXATTRIB1DPROC);
+	glad_lazy_slots.glVertexAttrib1d(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+	GLAD_LAZY_BIND(glVertexAttrib1dv, PFNGLVERTEXATTRIB1DVPROC);
+	glad_lazy_slots.glVertexAttrib1dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1f(GLuint index, GLfloat x) {
+	GLAD_LAZY_BIND(glVertexAttrib1f, PFNGLVERTEXATTRIB1FPROC);
+	glad_lazy_slots.glVertexAttrib1f(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+	GLAD_LAZY_BIND(glVertexAttrib1fv, PFNGLVERTEXATTRIB1FVPROC);
+	glad_lazy_slots.glVertexAttrib1fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1s(GLuint index, GLshort x) {
+	GLAD_LAZY_BIND(glVertexAttrib1s, PFNGLVERTEXATTRIB1SPROC);
+	glad_lazy_slots.glVertexAttrib1s(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+	GLAD_LAZY_BIND(glVertexAttrib1sv, PFNGLVERTEXATTRIB1SVPROC);
+	glad_lazy_slots.glVertexAttrib1sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+	GLAD_LAZY_BIND(glVertexAttrib2d, PFNGLVERTEXATTRIB2DPROC);
+	glad_lazy_slots.glVertexAttrib2d(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+	GLAD_LAZY_BIND(glVertexAttrib2dv, PFNGLVERTEXATTRIB2DVPROC);
+	glad_lazy_slots.glVertexAttrib2dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+	GLAD_LAZY_BIND(glVertexAttrib2f, PFNGLVERTEXATTRIB2FPROC);
+	glad_lazy_slots.glVertexAttrib2f(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+	GLAD_LAZY_BIND(glVertexAttrib2fv, PFNGLVERTEXATTRIB2FVPROC);
+	glad_lazy_slots.glVertexAttrib2fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+	GLAD_LAZY_BIND(glVertexAttrib2s, PFNGLVERTEXATTRIB2SPROC);
+	glad_lazy_slots.glVertexAttrib2s(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+	GLAD_LAZY_BIND(glVertexAttrib2sv, PFNGLVERTEXATTRIB2SVPROC);
+	glad_lazy_slots.glVertexAttrib2sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	GLAD_LAZY_BIND(glVertexAttrib3d, PFNGLVERTEXATTRIB3DPROC);
+	glad_lazy_slots.glVertexAttrib3d(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+	GLAD_LAZY_BIND(glVertexAttrib3dv, PFNGLVERTEXATTRIB3DVPROC);
+	glad_lazy_slots.glVertexAttrib3dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+	GLAD_LAZY_BIND(glVertexAttrib3f, PFNGLVERTEXATTRIB3FPROC);
+	glad_lazy_slots.glVertexAttrib3f(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+	GLAD_LAZY_BIND(glVertexAttrib3fv, PFNGLVERTEXATTRIB3FVPROC);
+	glad_lazy_slots.glVertexAttrib3fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+	GLAD_LAZY_BIND(glVertexAttrib3s, PFNGLVERTEXATTRIB3SPROC);
+	glad_lazy_slots.glVertexAttrib3s(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+	GLAD_LAZY_BIND(glVertexAttrib3sv, PFNGLVERTEXATTRIB3SVPROC);
+	glad_lazy_slots.glVertexAttrib3sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+	GLAD_LAZY_BIND(glVertexAttrib4Nbv, PFNGLVERTEXATTRIB4NBVPROC);
+	glad_lazy_slots.glVertexAttrib4Nbv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+	GLAD_LAZY_BIND(glVertexAttrib4Niv, PFNGLVERTEXATTRIB4NIVPROC);
+	glad_lazy_slots.glVertexAttrib4Niv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+	GLAD_LAZY_BIND(glVertexAttrib4Nsv, PFNGLVERTEXATTRIB4NSVPROC);
+	glad_lazy_slots.glVertexAttrib4Nsv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+	GLAD_LAZY_BIND(glVertexAttrib4Nub, PFNGLVERTEXATTRIB4NUBPROC);
+	glad_lazy_slots.glVertexAttrib4Nub(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+	GLAD_LAZY_BIND(glVertexAttrib4Nubv, PFNGLVERTEXATTRIB4NUBVPROC);
+	glad_lazy_slots.glVertexAttrib4Nubv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+	GLAD_LAZY_BIND(glVertexAttrib4Nuiv, PFNGLVERTEXATTRIB4NUIVPROC);
+	glad_lazy_slots.glVertexAttrib4Nuiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+	GLAD_LAZY_BIND(glVertexAttrib4Nusv, PFNGLVERTEXATTRIB4NUSVPROC);
+	glad_lazy_slots.glVertexAttrib4Nusv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+	GLAD_LAZY_BIND(glVertexAttrib4bv, PFNGLVERTEXATTRIB4BVPROC);
+	glad_lazy_slots.glVertexAttrib4bv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	GLAD_LAZY_BIND(glVertexAttrib4d, PFNGLVERTEXATTRIB4DPROC);
+	glad_lazy_slots.glVertexAttrib4d(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+	GLAD_LAZY_BIND(glVertexAttrib4dv, PFNGLVERTEXATTRIB4DVPROC);
+	glad_lazy_slots.glVertexAttrib4dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	GLAD_LAZY_BIND(glVertexAttrib4f, PFNGLVERTEXATTRIB4FPROC);
+	glad_lazy_slots.glVertexAttrib4f(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+	GLAD_LAZY_BIND(glVertexAttrib4fv, PFNGLVERTEXATTRIB4FVPROC);
+	glad_lazy_slots.glVertexAttrib4fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4iv(GLuint index, const GLint *v) {
+	GLAD_LAZY_BIND(glVertexAttrib4iv, PFNGLVERTEXATTRIB4IVPROC);
+	glad_lazy_slots.glVertexAttrib4iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+	GLAD_LAZY_BIND(glVertexAttrib4s, PFNGLVERTEXATTRIB4SPROC);
+	glad_lazy_slots.glVertexAttrib4s(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+	GLAD_LAZY_BIND(glVertexAttrib4sv, PFNGLVERTEXATTRIB4SVPROC);
+	glad_lazy_slots.glVertexAttrib4sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+	GLAD_LAZY_BIND(glVertexAttrib4ubv, PFNGLVERTEXATTRIB4UBVPROC);
+	glad_lazy_slots.glVertexAttrib4ubv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+	GLAD_LAZY_BIND(glVertexAttrib4uiv, PFNGLVERTEXATTRIB4UIVPROC);
+	glad_lazy_slots.glVertexAttrib4uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+	GLAD_LAZY_BIND(glVertexAttrib4usv, PFNGLVERTEXATTRIB4USVPROC);
+	glad_lazy_slots.glVertexAttrib4usv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+	GLAD_LAZY_BIND(glVertexAttribPointer, PFNGLVERTEXATTRIBPOINTERPROC);
+	glad_lazy_slots.glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	GLAD_LAZY_BIND(glUniformMatrix2x3fv, PFNGLUNIFORMMATRIX2X3FVPROC);
+	glad_lazy_slots.glUniformMatrix2x3fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	GLAD_LAZY_BIND(glUniformMatrix3x2fv, PFNGLUNIFORMMATRIX3X2FVPROC);
+	glad_lazy_slots.glUniformMatrix3x2fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	GLAD_LAZY_BIND(glUniformMatrix2x4fv, PFNGLUNIFORMMATRIX2X4FVPROC);
+	glad_lazy_slots.glUniformMatrix2x4fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	GLAD_LAZY_BIND(glUniformMatrix4x2fv, PFNGLUNIFORMMATRIX4X2FVPROC);
+	glad_lazy_slots.glUniformMatrix4x2fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	GLAD_LAZY_BIND(glUniformMatrix3x4fv, PFNGLUNIFORMMATRIX3X4FVPROC);
+	glad_lazy_slots.glUniformMatrix3x4fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	GLAD_LAZY_BIND(glUniformMatrix4x3fv, PFNGLUNIFORMMATRIX4X3FVPROC);
+	glad_lazy_slots.glUniformMatrix4x3fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+	GLAD_LAZY_BIND(glColorMaski, PFNGLCOLORMASKIPROC);
+	glad_lazy_slots.glColorMaski(index, r, g, b, a);
+}
+static void APIENTRY glad_lazy_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+	GLAD_LAZY_BIND(glGetBooleani_v, PFNGLGETBOOLEANI_VPROC);
+	glad_lazy_slots.glGetBooleani_v(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+	GLAD_LAZY_BIND(glGetIntegeri_v, PFNGLGETINTEGERI_VPROC);
+	glad_lazy_slots.glGetIntegeri_v(target, index, data);
+}
+static void APIENTRY glad_lazy_glEnablei(GLenum target, GLuint index) {
+	GLAD_LAZY_BIND(glEnablei, PFNGLENABLEIPROC);
+	glad_lazy_slots.glEnablei(target, index);
+}
+static void APIENTRY glad_lazy_glDisablei(GLenum target, GLuint index) {
+	GLAD_LAZY_BIND(glDisablei, PFNGLDISABLEIPROC);
+	glad_lazy_slots.glDisablei(target, index);
+}
+static GLboolean APIENTRY glad_lazy_glIsEnabledi(GLenum target, GLuint index) {
+	GLAD_LAZY_BIND(glIsEnabledi, PFNGLISENABLEDIPROC);
+	return glad_lazy_slots.glIsEnabledi(target, index);
+}
+static void APIENTRY glad_lazy_glBeginTransformFeedback(GLenum primitiveMode) {
+	GLAD_LAZY_BIND(glBeginTransformFeedback, PFNGLBEGINTRANSFORMFEEDBACKPROC);
+	glad_lazy_slots.glBeginTransformFeedback(primitiveMode);
+}
+static void APIENTRY glad_lazy_glEndTransformFeedback(void) {
+	GLAD_LAZY_BIND(glEndTransformFeedback, PFNGLENDTRANSFORMFEEDBACKPROC);
+	glad_lazy_slots.glEndTransformFeedback();
+}
+static void APIENTRY glad_lazy_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	GLAD_LAZY_BIND(glBindBufferRange, PFNGLBINDBUFFERRANGEPROC);
+	glad_lazy_slots.glBindBufferRange(target, index, buffer, offset, size);
+}
+static void APIENTRY glad_lazy_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+	GLAD_LAZY_BIND(glBindBufferBase, PFNGLBINDBUFFERBASEPROC);
+	glad_lazy_slots.glBindBufferBase(target, index, buffer);
+}
+static void APIENTRY glad_lazy_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+	GLAD_LAZY_BIND(glTransformFeedbackVaryings, PFNGLTRANSFORMFEEDBACKVARYINGSPROC);
+	glad_lazy_slots.glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+}
+static void APIENTRY glad_lazy_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+	GLAD_LAZY_BIND(glGetTransformFeedbackVarying, PFNGLGETTRANSFORMFEEDBACKVARYINGPROC);
+	glad_lazy_slots.glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glClampColor(GLenum target, GLenum clamp) {
+	GLAD_LAZY_BIND(glClampColor, PFNGLCLAMPCOLORPROC);
+	glad_lazy_slots.glClampColor(target, clamp);
+}
+static void APIENTRY glad_lazy_glBeginConditionalRender(GLuint id, GLenum mode) {
+	GLAD_LAZY_BIND(glBeginConditionalRender, PFNGLBEGINCONDITIONALRENDERPROC);
+	glad_lazy_slots.glBeginConditionalRender(id, mode);
+}
+static void APIENTRY glad_lazy_glEndConditionalRender(void) {
+	GLAD_LAZY_BIND(glEndConditionalRender, PFNGLENDCONDITIONALRENDERPROC);
+	glad_lazy_slots.glEndConditionalRender();
+}
+static void APIENTRY glad_lazy_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	GLAD_LAZY_BIND(glVertexAttribIPointer, PFNGLVERTEXATTRIBIPOINTERPROC);
+	glad_lazy_slots.glVertexAttribIPointer(index, size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+	GLAD_LAZY_BIND(glGetVertexAttribIiv, PFNGLGETVERTEXATTRIBIIVPROC);
+	glad_lazy_slots.glGetVertexAttribIiv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+	GLAD_LAZY_BIND(glGetVertexAttribIuiv, PFNGLGETVERTEXATTRIBIUIVPROC);
+	glad_lazy_slots.glGetVertexAttribIuiv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1i(GLuint index, GLint x) {
+	GLAD_LAZY_BIND(glVertexAttribI1i, PFNGLVERTEXATTRIBI1IPROC);
+	glad_lazy_slots.glVertexAttribI1i(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+	GLAD_LAZY_BIND(glVertexAttribI2i, PFNGLVERTEXATTRIBI2IPROC);
+	glad_lazy_slots.glVertexAttribI2i(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+	GLAD_LAZY_BIND(glVertexAttribI3i, PFNGLVERTEXATTRIBI3IPROC);
+	glad_lazy_slots.glVertexAttribI3i(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	GLAD_LAZY_BIND(glVertexAttribI4i, PFNGLVERTEXATTRIBI4IPROC);
+	glad_lazy_slots.glVertexAttribI4i(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1ui(GLuint index, GLuint x) {
+	GLAD_LAZY_BIND(glVertexAttribI1ui, PFNGLVERTEXATTRIBI1UIPROC);
+	glad_lazy_slots.glVertexAttribI1ui(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+	GLAD_LAZY_BIND(glVertexAttribI2ui, PFNGLVERTEXATTRIBI2UIPROC);
+	glad_lazy_slots.glVertexAttribI2ui(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+	GLAD_LAZY_BIND(glVertexAttribI3ui, PFNGLVERTEXATTRIBI3UIPROC);
+	glad_lazy_slots.glVertexAttribI3ui(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	GLAD_LAZY_BIND(glVertexAttribI4ui, PFNGLVERTEXATTRIBI4UIPROC);
+	glad_lazy_slots.glVertexAttribI4ui(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1iv(GLuint index, const GLint *v) {
+	GLAD_LAZY_BIND(glVertexAttribI1iv, PFNGLVERTEXATTRIBI1IVPROC);
+	glad_lazy_slots.glVertexAttribI1iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2iv(GLuint index, const GLint *v) {
+	GLAD_LAZY_BIND(glVertexAttribI2iv, PFNGLVERTEXATTRIBI2IVPROC);
+	glad_lazy_slots.glVertexAttribI2iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3iv(GLuint index, const GLint *v) {
+	GLAD_LAZY_BIND(glVertexAttribI3iv, PFNGLVERTEXATTRIBI3IVPROC);
+	glad_lazy_slots.glVertexAttribI3iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4iv(GLuint index, const GLint *v) {
+	GLAD_LAZY_BIND(glVertexAttribI4iv, PFNGLVERTEXATTRIBI4IVPROC);
+	glad_lazy_slots.glVertexAttribI4iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+	GLAD_LAZY_BIND(glVertexAttribI1uiv, PFNGLVERTEXATTRIBI1UIVPROC);
+	glad_lazy_slots.glVertexAttribI1uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+	GLAD_LAZY_BIND(glVertexAttribI2uiv, PFNGLVERTEXATTRIBI2UIVPROC);
+	glad_lazy_slots.glVertexAttribI2uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+	GLAD_LAZY_BIND(glVertexAttribI3uiv, PFNGLVERTEXATTRIBI3UIVPROC);
+	glad_lazy_slots.glVertexAttribI3uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+	GLAD_LAZY_BIND(glVertexAttribI4uiv, PFNGLVERTEXATTRIBI4UIVPROC);
+	glad_lazy_slots.glVertexAttribI4uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+	GLAD_LAZY_BIND(glVertexAttribI4bv, PFNGLVERTEXATTRIBI4BVPROC);
+	glad_lazy_slots.glVertexAttribI4bv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+	GLAD_LAZY_BIND(glVertexAttribI4sv, PFNGLVERTEXATTRIBI4SVPROC);
+	glad_lazy_slots.glVertexAttribI4sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+	GLAD_LAZY_BIND(glVertexAttribI4ubv, PFNGLVERTEXATTRIBI4UBVPROC);
+	glad_lazy_slots.glVertexAttribI4ubv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+	GLAD_LAZY_BIND(glVertexAttribI4usv, PFNGLVERTEXATTRIBI4USVPROC);
+	glad_lazy_slots.glVertexAttribI4usv(index, v);
+}
+static void APIENTRY glad_lazy_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+	GLAD_LAZY_BIND(glGetUniformuiv, PFNGLGETUNIFORMUIVPROC);
+	glad_lazy_slots.glGetUniformuiv(program, location, params);
+}
+static void APIENTRY glad_lazy_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+	GLAD_LAZY_BIND(glBindFragDataLocation, PFNGLBINDFRAGDATALOCATIONPROC);
+	glad_lazy_slots.glBindFragDataLocation(program, color, name);
+}
+static GLint APIENTRY glad_lazy_glGetFragDataLocation(GLuint program, const GLchar *name) {
+	GLAD_LAZY_BIND(glGetFragDataLocation, PFNGLGETFRAGDATALOCATIONPROC);
+	return glad_lazy_slots.glGetFragDataLocation(program, name);
+}
+static void APIENTRY glad_lazy_glUniform1ui(GLint location, GLuint v0) {
+	GLAD_LAZY_BIND(glUniform1ui, PFNGLUNIFORM1UIPROC);
+	glad_lazy_slots.glUniform1ui(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+	GLAD_LAZY_BIND(glUniform2ui, PFNGLUNIFORM2UIPROC);
+	glad_lazy_slots.glUniform2ui(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	GLAD_LAZY_BIND(glUniform3ui, PFNGLUNIFORM3UIPROC);
+	glad_lazy_slots.glUniform3ui(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	GLAD_LAZY_BIND(glUniform4ui, PFNGLUNIFORM4UIPROC);
+	glad_lazy_slots.glUniform4ui(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+	GLAD_LAZY_BIND(glUniform1uiv, PFNGLUNIFORM1UIVPROC);
+	glad_lazy_slots.glUniform1uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+	GLAD_LAZY_BIND(glUniform2uiv, PFNGLUNIFORM2UIVPROC);
+	glad_lazy_slots.glUniform2uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+	GLAD_LAZY_BIND(glUniform3uiv, PFNGLUNIFORM3UIVPROC);
+	glad_lazy_slots.glUniform3uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+	GLAD_LAZY_BIND(glUniform4uiv, PFNGLUNIFORM4UIVPROC);
+	glad_lazy_slots.glUniform4uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+	GLAD_LAZY_BIND(glTexParameterIiv, PFNGLTEXPARAMETERIIVPROC);
+	glad_lazy_slots.glTexParameterIiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+	GLAD_LAZY_BIND(glTexParameterIuiv, PFNGLTEXPARAMETERIUIVPROC);
+	glad_lazy_slots.glTexParameterIuiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+	GLAD_LAZY_BIND(glGetTexParameterIiv, PFNGLGETTEXPARAMETERIIVPROC);
+	glad_lazy_slots.glGetTexParameterIiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+	GLAD_LAZY_BIND(glGetTexParameterIuiv, PFNGLGETTEXPARAMETERIUIVPROC);
+	glad_lazy_slots.glGetTexParameterIuiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+	GLAD_LAZY_BIND(glClearBufferiv, PFNGLCLEARBUFFERIVPROC);
+	glad_lazy_slots.glClearBufferiv(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	GLAD_LAZY_BIND(glClearBufferuiv, PFNGLCLEARBUFFERUIVPROC);
+	glad_lazy_slots.glClearBufferuiv(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	GLAD_LAZY_BIND(glClearBufferfv, PFNGLCLEARBUFFERFVPROC);
+	glad_lazy_slots.glClearBufferfv(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	GLAD_LAZY_BIND(glClearBufferfi, PFNGLCLEARBUFFERFIPROC);
+	glad_lazy_slots.glClearBufferfi(buffer, drawbuffer, depth, stencil);
+}
+static const GLubyte * APIENTRY glad_lazy_glGetStringi(GLenum name, GLuint index) {
+	GLAD_LAZY_BIND(glGetStringi, PFNGLGETSTRINGIPROC);
+	return glad_lazy_slots.glGetStringi(name, index);
+}
+static GLboolean APIENTRY glad_lazy_glIsRenderbuffer(GLuint renderbuffer) {
+	GLAD_LAZY_BIND(glIsRenderbuffer, PFNGLISRENDERBUFFERPROC);
+	return glad_lazy_slots.glIsRenderbuffer(renderbuffer);
+}
+static void APIENTRY glad_lazy_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+	GLAD_LAZY_BIND(glBindRenderbuffer, PFNGLBINDRENDERBUFFERPROC);
+	glad_lazy_slots.glBindRenderbuffer(target, renderbuffer);
+}
+static void APIENTRY glad_lazy_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+	GLAD_LAZY_BIND(glDeleteRenderbuffers, PFNGLDELETERENDERBUFFERSPROC);
+	glad_lazy_slots.glDeleteRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY glad_lazy_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	GLAD_LAZY_BIND(glGenRenderbuffers, PFNGLGENRENDERBUFFERSPROC);
+	glad_lazy_slots.glGenRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY glad_lazy_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+	GLAD_LAZY_BIND(glRenderbufferStorage, PFNGLRENDERBUFFERSTORAGEPROC);
+	glad_lazy_slots.glRenderbufferStorage(target, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	GLAD_LAZY_BIND(glGetRenderbufferParameteriv, PFNGLGETRENDERBUFFERPARAMETERIVPROC);
+	glad_lazy_slots.glGetRenderbufferParameteriv(target, pname, params);
+}
+static GLboolean APIENTRY glad_lazy_glIsFramebuffer(GLuint framebuffer) {
+	GLAD_LAZY_BIND(glIsFramebuffer, PFNGLISFRAMEBUFFERPROC);
+	return glad_lazy_slots.glIsFramebuffer(framebuffer);
+}
+static void APIENTRY glad_lazy_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+	GLAD_LAZY_BIND(glBindFramebuffer, PFNGLBINDFRAMEBUFFERPROC);
+	glad_lazy_slots.glBindFramebuffer(target, framebuffer);
+}
+static void APIENTRY glad_lazy_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+	GLAD_LAZY_BIND(glDeleteFramebuffers, PFNGLDELETEFRAMEBUFFERSPROC);
+	glad_lazy_slots.glDeleteFramebuffers(n, framebuffers);
+}
+static void APIENTRY glad_lazy_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+	GLAD_LAZY_BIND(glGenFramebuffers, PFNGLGENFRAMEBUFFERSPROC);
+	glad_lazy_slots.glGenFramebuffers(n, framebuffers);
+}
+static GLenum APIENTRY glad_lazy_glCheckFramebufferStatus(GLenum target) {
+	GLAD_LAZY_BIND(glCheckFramebufferStatus, PFNGLCHECKFRAMEBUFFERSTATUSPROC);
+	return glad_lazy_slots.glCheckFramebufferStatus(target);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	GLAD_LAZY_BIND(glFramebufferTexture1D, PFNGLFRAMEBUFFERTEXTURE1DPROC);
+	glad_lazy_slots.glFramebufferTexture1D(target, attachment, textarget, texture, level);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	GLAD_LAZY_BIND(glFramebufferTexture2D, PFNGLFRAMEBUFFERTEXTURE2DPROC);
+	glad_lazy_slots.glFramebufferTexture2D(target, attachment, textarget, texture, level);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+	GLAD_LAZY_BIND(glFramebufferTexture3D, PFNGLFRAMEBUFFERTEXTURE3DPROC);
+	glad_lazy_slots.glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+}
+static void APIENTRY glad_lazy_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	GLAD_LAZY_BIND(glFramebufferRenderbuffer, PFNGLFRAMEBUFFERRENDERBUFFERPROC);
+	glad_lazy_slots.glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+static void APIENTRY glad_lazy_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+	GLAD_LAZY_BIND(glGetFramebufferAttachmentParameteriv, PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC);
+	glad_lazy_slots.glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+}
+static void APIENTRY glad_lazy_glGenerateMipmap(GLenum target) {
+	GLAD_LAZY_BIND(glGenerateMipmap, PFNGLGENERATEMIPMAPPROC);
+	glad_lazy_slots.glGenerateMipmap(target);
+}
+static void APIENTRY glad_lazy_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	GLAD_LAZY_BIND(glBlitFramebuffer, PFNGLBLITFRAMEBUFFERPROC);
+	glad_lazy_slots.glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+static void APIENTRY glad_lazy_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	GLAD_LAZY_BIND(glRenderbufferStorageMultisample, PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC);
+	glad_lazy_slots.glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	GLAD_LAZY_BIND(glFramebufferTextureLayer, PFNGLFRAMEBUFFERTEXTURELAYERPROC);
+	glad_lazy_slots.glFramebufferTextureLayer(target, attachment, texture, level, layer);
+}
+static void * APIENTRY glad_lazy_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	GLAD_LAZY_BIND(glMapBufferRange, PFNGLMAPBUFFERRANGEPROC);
+	return glad_lazy_slots.glMapBufferRange(target, offset, length, access);
+}
+static void APIENTRY glad_lazy_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+	GLAD_LAZY_BIND(glFlushMappedBufferRange, PFNGLFLUSHMAPPEDBUFFERRANGEPROC);
+	glad_lazy_slots.glFlushMappedBufferRange(target, offset, length);
+}
+static void APIENTRY glad_lazy_glBindVertexArray(GLuint array) {
+	GLAD_LAZY_BIND(glBindVertexArray, PFNGLBINDVERTEXARRAYPROC);
+	glad_lazy_slots.glBindVertexArray(array);
+}
+static void APIENTRY glad_lazy_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+	GLAD_LAZY_BIND(glDeleteVertexArrays, PFNGLDELETEVERTEXARRAYSPROC);
+	glad_lazy_slots.glDeleteVertexArrays(n, arrays);
+}
+static void APIENTRY glad_lazy_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+	GLAD_LAZY_BIND(glGenVertexArrays, PFNGLGENVERTEXARRAYSPROC);
+	glad_lazy_slots.glGenVertexArrays(n, arrays);
+}
+static GLboolean APIENTRY glad_lazy_glIsVertexArray(GLuint array) {
+	GLAD_LAZY_BIND(glIsVertexArray, PFNGLISVERTEXARRAYPROC);
+	return glad_lazy_slots.glIsVertexArray(array);
+}
+static void APIENTRY glad_lazy_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+	GLAD_LAZY_BIND(glDrawArraysInstanced, PFNGLDRAWARRAYSINSTANCEDPROC);
+	glad_lazy_slots.glDrawArraysInstanced(mode, first, count, instancecount);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+	GLAD_LAZY_BIND(glDrawElementsInstanced, PFNGLDRAWELEMENTSINSTANCEDPROC);
+	glad_lazy_slots.glDrawElementsInstanced(mode, count, type, indices, instancecount);
+}
+static void APIENTRY glad_lazy_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+	GLAD_LAZY_BIND(glTexBuffer, PFNGLTEXBUFFERPROC);
+	glad_lazy_slots.glTexBuffer(target, internalformat, buffer);
+}
+static void APIENTRY glad_lazy_glPrimitiveRestartIndex(GLuint index) {
+	GLAD_LAZY_BIND(glPrimitiveRestartIndex, PFNGLPRIMITIVERESTARTINDEXPROC);
+	glad_lazy_slots.glPrimitiveRestartIndex(index);
+}
+static void APIENTRY glad_lazy_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	GLAD_LAZY_BIND(glCopyBufferSubData, PFNGLCOPYBUFFERSUBDATAPROC);
+	glad_lazy_slots.glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+static void APIENTRY glad_lazy_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+	GLAD_LAZY_BIND(glGetUniformIndices, PFNGLGETUNIFORMINDICESPROC);
+	glad_lazy_slots.glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+	GLAD_LAZY_BIND(glGetActiveUniformsiv, PFNGLGETACTIVEUNIFORMSIVPROC);
+	glad_lazy_slots.glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+	GLAD_LAZY_BIND(glGetActiveUniformName, PFNGLGETACTIVEUNIFORMNAMEPROC);
+	glad_lazy_slots.glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+}
+static GLuint APIENTRY glad_lazy_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+	GLAD_LAZY_BIND(glGetUniformBlockIndex, PFNGLGETUNIFORMBLOCKINDEXPROC);
+	return glad_lazy_slots.glGetUniformBlockIndex(program, uniformBlockName);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+	GLAD_LAZY_BIND(glGetActiveUniformBlockiv, PFNGLGETACTIVEUNIFORMBLOCKIVPROC);
+	glad_lazy_slots.glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+	GLAD_LAZY_BIND(glGetActiveUniformBlockName, PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC);
+	glad_lazy_slots.glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+static void APIENTRY glad_lazy_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+	GLAD_LAZY_BIND(glUniformBlockBinding, PFNGLUNIFORMBLOCKBINDINGPROC);
+	glad_lazy_slots.glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+}
+static void APIENTRY glad_lazy_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	GLAD_LAZY_BIND(glDrawElementsBaseVertex, PFNGLDRAWELEMENTSBASEVERTEXPROC);
+	glad_lazy_slots.glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+}
+static void APIENTRY glad_lazy_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	GLAD_LAZY_BIND(glDrawRangeElementsBaseVertex, PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC);
+	glad_lazy_slots.glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+	GLAD_LAZY_BIND(glDrawElementsInstancedBaseVertex, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC);
+	glad_lazy_slots.glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+}
+static void APIENTRY glad_lazy_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+	GLAD_LAZY_BIND(glMultiDrawElementsBaseVertex, PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC);
+	glad_lazy_slots.glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+}
+static void APIENTRY glad_lazy_glProvokingVertex(GLenum mode) {
+	GLAD_LAZY_BIND(glProvokingVertex, PFNGLPROVOKINGVERTEXPROC);
+	glad_lazy_slots.glProvokingVertex(mode);
+}
+static GLsync APIENTRY glad_lazy_glFenceSync(GLenum condition, GLbitfield flags) {
+	GLAD_LAZY_BIND(glFenceSync, PFNGLFENCESYNCPROC);
+	return glad_lazy_slots.glFenceSync(condition, flags);
+}
+static GLboolean APIENTRY glad_lazy_glIsSync(GLsync sync) {
+	GLAD_LAZY_BIND(glIsSync, PFNGLISSYNCPROC);
+	return glad_lazy_slots.glIsSync(sync);
+}
+static void APIENTRY glad_lazy_glDeleteSync(GLsync sync) {
+	GLAD_LAZY_BIND(glDeleteSync, PFNGLDELETESYNCPROC);
+	glad_lazy_slots.glDeleteSync(sync);
+}
+static GLenum APIENTRY glad_lazy_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	GLAD_LAZY_BIND(glClientWaitSync, PFNGLCLIENTWAITSYNCPROC);
+	return glad_lazy_slots.glClientWaitSync(sync, flags, timeout);
+}
+static void APIENTRY glad_lazy_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	GLAD_LAZY_BIND(glWaitSync, PFNGLWAITSYNCPROC);
+	glad_lazy_slots.glWaitSync(sync, flags, timeout);
+}
+static void APIENTRY glad_lazy_glGetInteger64v(GLenum pname, GLint64 *data) {
+	GLAD_LAZY_BIND(glGetInteger64v, PFNGLGETINTEGER64VPROC);
+	glad_lazy_slots.glGetInteger64v(pname, data);
+}
+static void APIENTRY glad_lazy_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) {
+	GLAD_LAZY_BIND(glGetSynciv, PFNGLGETSYNCIVPROC);
+	glad_lazy_slots.glGetSynciv(sync, pname, count, length, values);
+}
+static void APIENTRY glad_lazy_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+	GLAD_LAZY_BIND(glGetInteger64i_v, PFNGLGETINTEGER64I_VPROC);
+	glad_lazy_slots.glGetInteger64i_v(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+	GLAD_LAZY_BIND(glGetBufferParameteri64v, PFNGLGETBUFFERPARAMETERI64VPROC);
+	glad_lazy_slots.glGetBufferParameteri64v(target, pname, params);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+	GLAD_LAZY_BIND(glFramebufferTexture, PFNGLFRAMEBUFFERTEXTUREPROC);
+	glad_lazy_slots.glFramebufferTexture(target, attachment, texture, level);
+}
+static void APIENTRY glad_lazy_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	GLAD_LAZY_BIND(glTexImage2DMultisample, PFNGLTEXIMAGE2DMULTISAMPLEPROC);
+	glad_lazy_slots.glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	GLAD_LAZY_BIND(glTexImage3DMultisample, PFNGLTEXIMAGE3DMULTISAMPLEPROC);
+	glad_lazy_slots.glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+	GLAD_LAZY_BIND(glGetMultisamplefv, PFNGLGETMULTISAMPLEFVPROC);
+	glad_lazy_slots.glGetMultisamplefv(pname, index, val);
+}
+static void APIENTRY glad_lazy_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+	GLAD_LAZY_BIND(glSampleMaski, PFNGLSAMPLEMASKIPROC);
+	glad_lazy_slots.glSampleMaski(maskNumber, mask);
+}
+static void APIENTRY glad_lazy_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+	GLAD_LAZY_BIND(glBindFragDataLocationIndexed, PFNGLBINDFRAGDATALOCATIONINDEXEDPROC);
+	glad_lazy_slots.glBindFragDataLocationIndexed(program, colorNumber, index, name);
+}
+static GLint APIENTRY glad_lazy_glGetFragDataIndex(GLuint program, const GLchar *name) {
+	GLAD_LAZY_BIND(glGetFragDataIndex, PFNGLGETFRAGDATAINDEXPROC);
+	return glad_lazy_slots.glGetFragDataIndex(program, name);
+}
+static void APIENTRY glad_lazy_glGenSamplers(GLsizei count, GLuint *samplers) {
+	GLAD_LAZY_BIND(glGenSamplers, PFNGLGENSAMPLERSPROC);
+	glad_lazy_slots.glGenSamplers(count, samplers);
+}
+static void APIENTRY glad_lazy_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+	GLAD_LAZY_BIND(glDeleteSamplers, PFNGLDELETESAMPLERSPROC);
+	glad_lazy_slots.glDeleteSamplers(count, samplers);
+}
+static GLboolean APIENTRY glad_lazy_glIsSampler(GLuint sampler) {
+	GLAD_LAZY_BIND(glIsSampler, PFNGLISSAMPLERPROC);
+	return glad_lazy_slots.glIsSampler(sampler);
+}
+static void APIENTRY glad_lazy_glBindSampler(GLuint unit, GLuint sampler) {
+	GLAD_LAZY_BIND(glBindSampler, PFNGLBINDSAMPLERPROC);
+	glad_lazy_slots.glBindSampler(unit, sampler);
+}
+static void APIENTRY glad_lazy_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+	GLAD_LAZY_BIND(glSamplerParameteri, PFNGLSAMPLERPARAMETERIPROC);
+	glad_lazy_slots.glSamplerParameteri(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+	GLAD_LAZY_BIND(glSamplerParameteriv, PFNGLSAMPLERPARAMETERIVPROC);
+	glad_lazy_slots.glSamplerParameteriv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+	GLAD_LAZY_BIND(glSamplerParameterf, PFNGLSAMPLERPARAMETERFPROC);
+	glad_lazy_slots.glSamplerParameterf(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+	GLAD_LAZY_BIND(glSamplerParameterfv, PFNGLSAMPLERPARAMETERFVPROC);
+	glad_lazy_slots.glSamplerParameterfv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+	GLAD_LAZY_BIND(glSamplerParameterIiv, PFNGLSAMPLERPARAMETERIIVPROC);
+	glad_lazy_slots.glSamplerParameterIiv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+	GLAD_LAZY_BIND(glSamplerParameterIuiv, PFNGLSAMPLERPARAMETERIUIVPROC);
+	glad_lazy_slots.glSamplerParameterIuiv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+	GLAD_LAZY_BIND(glGetSamplerParameteriv, PFNGLGETSAMPLERPARAMETERIVPROC);
+	glad_lazy_slots.glGetSamplerParameteriv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+	GLAD_LAZY_BIND(glGetSamplerParameterIiv, PFNGLGETSAMPLERPARAMETERIIVPROC);
+	glad_lazy_slots.glGetSamplerParameterIiv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+	GLAD_LAZY_BIND(glGetSamplerParameterfv, PFNGLGETSAMPLERPARAMETERFVPROC);
+	glad_lazy_slots.glGetSamplerParameterfv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+	GLAD_LAZY_BIND(glGetSamplerParameterIuiv, PFNGLGETSAMPLERPARAMETERIUIVPROC);
+	glad_lazy_slots.glGetSamplerParameterIuiv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glQueryCounter(GLuint id, GLenum target) {
+	GLAD_LAZY_BIND(glQueryCounter, PFNGLQUERYCOUNTERPROC);
+	glad_lazy_slots.glQueryCounter(id, target);
+}
+static void APIENTRY glad_lazy_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+	GLAD_LAZY_BIND(glGetQueryObjecti64v, PFNGLGETQUERYOBJECTI64VPROC);
+	glad_lazy_slots.glGetQueryObjecti64v(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+	GLAD_LAZY_BIND(glGetQueryObjectui64v, PFNGLGETQUERYOBJECTUI64VPROC);
+	glad_lazy_slots.glGetQueryObjectui64v(id, pname, params);
+}
+static void APIENTRY glad_lazy_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+	GLAD_LAZY_BIND(glVertexAttribDivisor, PFNGLVERTEXATTRIBDIVISORPROC);
+	glad_lazy_slots.glVertexAttribDivisor(index, divisor);
+}
+static void APIENTRY glad_lazy_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	GLAD_LAZY_BIND(glVertexAttribP1ui, PFNGLVERTEXATTRIBP1UIPROC);
+	glad_lazy_slots.glVertexAttribP1ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	GLAD_LAZY_BIND(glVertexAttribP1uiv, PFNGLVERTEXATTRIBP1UIVPROC);
+	glad_lazy_slots.glVertexAttribP1uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	GLAD_LAZY_BIND(glVertexAttribP2ui, PFNGLVERTEXATTRIBP2UIPROC);
+	glad_lazy_slots.glVertexAttribP2ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	GLAD_LAZY_BIND(glVertexAttribP2uiv, PFNGLVERTEXATTRIBP2UIVPROC);
+	glad_lazy_slots.glVertexAttribP2uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	GLAD_LAZY_BIND(glVertexAttribP3ui, PFNGLVERTEXATTRIBP3UIPROC);
+	glad_lazy_slots.glVertexAttribP3ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	GLAD_LAZY_BIND(glVertexAttribP3uiv, PFNGLVERTEXATTRIBP3UIVPROC);
+	glad_lazy_slots.glVertexAttribP3uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	GLAD_LAZY_BIND(glVertexAttribP4ui, PFNGLVERTEXATTRIBP4UIPROC);
+	glad_lazy_slots.glVertexAttribP4ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	GLAD_LAZY_BIND(glVertexAttribP4uiv, PFNGLVERTEXATTRIBP4UIVPROC);
+	glad_lazy_slots.glVertexAttribP4uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexP2ui(GLenum type, GLuint value) {
+	GLAD_LAZY_BIND(glVertexP2ui, PFNGLVERTEXP2UIPROC);
+	glad_lazy_slots.glVertexP2ui(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP2uiv(GLenum type, const GLuint *value) {
+	GLAD_LAZY_BIND(glVertexP2uiv, PFNGLVERTEXP2UIVPROC);
+	glad_lazy_slots.glVertexP2uiv(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP3ui(GLenum type, GLuint value) {
+	GLAD_LAZY_BIND(glVertexP3ui, PFNGLVERTEXP3UIPROC);
+	glad_lazy_slots.glVertexP3ui(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP3uiv(GLenum type, const GLuint *value) {
+	GLAD_LAZY_BIND(glVertexP3uiv, PFNGLVERTEXP3UIVPROC);
+	glad_lazy_slots.glVertexP3uiv(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP4ui(GLenum type, GLuint value) {
+	GLAD_LAZY_BIND(glVertexP4ui, PFNGLVERTEXP4UIPROC);
+	glad_lazy_slots.glVertexP4ui(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP4uiv(GLenum type, const GLuint *value) {
+	GLAD_LAZY_BIND(glVertexP4uiv, PFNGLVERTEXP4UIVPROC);
+	glad_lazy_slots.glVertexP4uiv(type, value);
+}
+static void APIENTRY glad_lazy_glTexCoordP1ui(GLenum type, GLuint coords) {
+	GLAD_LAZY_BIND(glTexCoordP1ui, PFNGLTEXCOORDP1UIPROC);
+	glad_lazy_slots.glTexCoordP1ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+	GLAD_LAZY_BIND(glTexCoordP1uiv, PFNGLTEXCOORDP1UIVPROC);
+	glad_lazy_slots.glTexCoordP1uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP2ui(GLenum type, GLuint coords) {
+	GLAD_LAZY_BIND(glTexCoordP2ui, PFNGLTEXCOORDP2UIPROC);
+	glad_lazy_slots.glTexCoordP2ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+	GLAD_LAZY_BIND(glTexCoordP2uiv, PFNGLTEXCOORDP2UIVPROC);
+	glad_lazy_slots.glTexCoordP2uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP3ui(GLenum type, GLuint coords) {
+	GLAD_LAZY_BIND(glTexCoordP3ui, PFNGLTEXCOORDP3UIPROC);
+	glad_lazy_slots.glTexCoordP3ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+	GLAD_LAZY_BIND(glTexCoordP3uiv, PFNGLTEXCOORDP3UIVPROC);
+	glad_lazy_slots.glTexCoordP3uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP4ui(GLenum type, GLuint coords) {
+	GLAD_LAZY_BIND(glTexCoordP4ui, PFNGLTEXCOORDP4UIPROC);
+	glad_lazy_slots.glTexCoordP4ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+	GLAD_LAZY_BIND(glTexCoordP4uiv, PFNGLTEXCOORDP4UIVPROC);
+	glad_lazy_slots.glTexCoordP4uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+	GLAD_LAZY_BIND(glMultiTexCoordP1ui, PFNGLMULTITEXCOORDP1UIPROC);
+	glad_lazy_slots.glMultiTexCoordP1ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	GLAD_LAZY_BIND(glMultiTexCoordP1uiv, PFNGLMULTITEXCOORDP1UIVPROC);
+	glad_lazy_slots.glMultiTexCoordP1uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+	GLAD_LAZY_BIND(glMultiTexCoordP2ui, PFNGLMULTITEXCOORDP2UIPROC);
+	glad_lazy_slots.glMultiTexCoordP2ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	GLAD_LAZY_BIND(glMultiTexCoordP2uiv, PFNGLMULTITEXCOORDP2UIVPROC);
+	glad_lazy_slots.glMultiTexCoordP2uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+	GLAD_LAZY_BIND(glMultiTexCoordP3ui, PFNGLMULTITEXCOORDP3UIPROC);
+	glad_lazy_slots.glMultiTexCoordP3ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	GLAD_LAZY_BIND(glMultiTexCoordP3uiv, PFNGLMULTITEXCOORDP3UIVPROC);
+	glad_lazy_slots.glMultiTexCoordP3uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+	GLAD_LAZY_BIND(glMultiTexCoordP4ui, PFNGLMULTITEXCOORDP4UIPROC);
+	glad_lazy_slots.glMultiTexCoordP4ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	GLAD_LAZY_BIND(glMultiTexCoordP4uiv, PFNGLMULTITEXCOORDP4UIVPROC);
+	glad_lazy_slots.glMultiTexCoordP4uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glNormalP3ui(GLenum type, GLuint coords) {
+	GLAD_LAZY_BIND(glNormalP3ui, PFNGLNORMALP3UIPROC);
+	glad_lazy_slots.glNormalP3ui(type, coords);
+}
+static void APIENTRY glad_lazy_glNormalP3uiv(GLenum type, const GLuint *coords) {
+	GLAD_LAZY_BIND(glNormalP3uiv, PFNGLNORMALP3UIVPROC);
+	glad_lazy_slots.glNormalP3uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glColorP3ui(GLenum type, GLuint color) {
+	GLAD_LAZY_BIND(glColorP3ui, PFNGLCOLORP3UIPROC);
+	glad_lazy_slots.glColorP3ui(type, color);
+}
+static void APIENTRY glad_lazy_glColorP3uiv(GLenum type, const GLuint *color) {
+	GLAD_LAZY_BIND(glColorP3uiv, PFNGLCOLORP3UIVPROC);
+	glad_lazy_slots.glColorP3uiv(type, color);
+}
+static void APIENTRY glad_lazy_glColorP4ui(GLenum type, GLuint color) {
+	GLAD_LAZY_BIND(glColorP4ui, PFNGLCOLORP4UIPROC);
+	glad_lazy_slots.glColorP4ui(type, color);
+}
+static void APIENTRY glad_lazy_glColorP4uiv(GLenum type, const GLuint *color) {
+	GLAD_LAZY_BIND(glColorP4uiv, PFNGLCOLORP4UIVPROC);
+	glad_lazy_slots.glColorP4uiv(type, color);
+}
+static void APIENTRY glad_lazy_glSecondaryColorP3ui(GLenum type, GLuint color) {
+	GLAD_LAZY_BIND(glSecondaryColorP3ui, PFNGLSECONDARYCOLORP3UIPROC);
+	glad_lazy_slots.glSecondaryColorP3ui(type, color);
+}
+static void APIENTRY glad_lazy_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+	GLAD_LAZY_BIND(glSecondaryColorP3uiv, PFNGLSECONDARYCOLORP3UIVPROC);
+	glad_lazy_slots.glSecondaryColorP3uiv(type, color);
+}
+static void APIENTRY glad_lazy_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) {
+	GLAD_LAZY_BIND(glGetProgramBinary, PFNGLGETPROGRAMBINARYPROC);
+	glad_lazy_slots.glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+}
+static void APIENTRY glad_lazy_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+	GLAD_LAZY_BIND(glProgramBinary, PFNGLPROGRAMBINARYPROC);
+	glad_lazy_slots.glProgramBinary(program, binaryFormat, binary, length);
+}
+static void APIENTRY glad_lazy_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+	GLAD_LAZY_BIND(glProgramParameteri, PFNGLPROGRAMPARAMETERIPROC);
+	glad_lazy_slots.glProgramParameteri(program, pname, value);
+}
+static void APIENTRY glad_lazy_glMaxShaderCompilerThreadsKHR(GLuint count) {
+	GLAD_LAZY_BIND(glMaxShaderCompilerThreadsKHR, PFNGLMAXSHADERCOMPILERTHREADSKHRPROC);
+	glad_lazy_slots.glMaxShaderCompilerThreadsKHR(count);
+}
+static void APIENTRY glad_lazy_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+	GLAD_LAZY_BIND(glBufferStorage, PFNGLBUFFERSTORAGEPROC);
+	glad_lazy_slots.glBufferStorage(target, size, data, flags);
+}
+
+static void lazy_GL_VERSION_1_0(void) {
+	if(!GLAD_GL_VERSION_1_0) return;
+	glad_glCullFace = glad_lazy_glCullFace;
+	glad_glFrontFace = glad_lazy_glFrontFace;
+	glad_glHint = glad_lazy_glHint;
+	glad_glLineWidth = glad_lazy_glLineWidth;
+	glad_glPointSize = glad_lazy_glPointSize;
+	glad_glPolygonMode = glad_lazy_glPolygonMode;
+	glad_glScissor = glad_lazy_glScissor;
+	glad_glTexParameterf = glad_lazy_glTexParameterf;
+	glad_glTexParameterfv = glad_lazy_glTexParameterfv;
+	glad_glTexParameteri = glad_lazy_glTexParameteri;
+	glad_glTexParameteriv = glad_lazy_glTexParameteriv;
+	glad_glTexImage1D = glad_lazy_glTexImage1D;
+	glad_glTexImage2D = glad_lazy_glTexImage2D;
+	glad_glDrawBuffer = glad_lazy_glDrawBuffer;
+	glad_glClear = glad_lazy_glClear;
+	glad_glClearColor = glad_lazy_glClearColor;
+	glad_glClearStencil = glad_lazy_glClearStencil;
+	glad_glClearDepth = glad_lazy_glClearDepth;
+	glad_glStencilMask = glad_lazy_glStencilMask;
+	glad_glColorMask = glad_lazy_glColorMask;
+	glad_glDepthMask = glad_lazy_glDepthMask;
+	glad_glDisable = glad_lazy_glDisable;
+	glad_glEnable = glad_lazy_glEnable;
+	glad_glFinish = glad_lazy_glFinish;
+	glad_glFlush = glad_lazy_glFlush;
+	glad_glBlendFunc = glad_lazy_glBlendFunc;
+	glad_glLogicOp = glad_lazy_glLogicOp;
+	glad_glStencilFunc = glad_lazy_glStencilFunc;
+	glad_glStencilOp = glad_lazy_glStencilOp;
+	glad_glDepthFunc = glad_lazy_glDepthFunc;
+	glad_glPixelStoref = glad_lazy_glPixelStoref;
+	glad_glPixelStorei = glad_lazy_glPixelStorei;
+	glad_glReadBuffer = glad_lazy_glReadBuffer;
+	glad_glReadPixels = glad_lazy_glReadPixels;
+	glad_glGetBooleanv = glad_lazy_glGetBooleanv;
+	glad_glGetDoublev = glad_lazy_glGetDoublev;
+	glad_glGetError = glad_lazy_glGetError;
+	glad_glGetFloatv = glad_lazy_glGetFloatv;
+	glad_glGetIntegerv = glad_lazy_glGetIntegerv;
+	glad_glGetString = glad_lazy_glGetString;
+	glad_glGetTexImage = glad_lazy_glGetTexImage;
+	glad_glGetTexParameterfv = glad_lazy_glGetTexParameterfv;
+	glad_glGetTexParameteriv = glad_lazy_glGetTexParameteriv;
+	glad_glGetTexLevelParameterfv = glad_lazy_glGetTexLevelParameterfv;
+	glad_glGetTexLevelParameteriv = glad_lazy_glGetTexLevelParameteriv;
+	glad_glIsEnabled = glad_lazy_glIsEnabled;
+	glad_glDepthRange = glad_lazy_glDepthRange;
+	glad_glViewport = glad_lazy_glViewport;
+}
+static void lazy_GL_VERSION_1_1(void) {
+	if(!GLAD_GL_VERSION_1_1) return;
+	glad_glDrawArrays = glad_lazy_glDrawArrays;
+	glad_glDrawElements = glad_lazy_glDrawElements;
+	glad_glPolygonOffset = glad_lazy_glPolygonOffset;
+	glad_glCopyTexImage1D = glad_lazy_glCopyTexImage1D;
+	glad_glCopyTexImage2D = glad_lazy_glCopyTexImage2D;
+	glad_glCopyTexSubImage1D = glad_lazy_glCopyTexSubImage1D;
+	glad_glCopyTexSubImage2D = glad_lazy_glCopyTexSubImage2D;
+	glad_glTexSubImage1D = glad_lazy_glTexSubImage1D;
+	glad_glTexSubImage2D = glad_lazy_glTexSubImage2D;
+	glad_glBindTexture = glad_lazy_glBindTexture;
+	glad_glDeleteTextures = glad_lazy_glDeleteTextures;
+	glad_glGenTextures = glad_lazy_glGenTextures;
+	glad_glIsTexture = glad_lazy_glIsTexture;
+}
+static void lazy_GL_VERSION_1_2(void) {
+	if(!GLAD_GL_VERSION_1_2) return;
+	glad_glDrawRangeElements = glad_lazy_glDrawRangeElements;
+	glad_glTexImage3D = glad_lazy_glTexImage3D;
+	glad_glTexSubImage3D = glad_lazy_glTexSubImage3D;
+	glad_glCopyTexSubImage3D = glad_lazy_glCopyTexSubImage3D;
+}
+static void lazy_GL_VERSION_1_3(void) {
+	if(!GLAD_GL_VERSION_1_3) return;
+	glad_glActiveTexture = glad_lazy_glActiveTexture;
+	glad_glSampleCoverage = glad_lazy_glSampleCoverage;
+	glad_glCompressedTexImage3D = glad_lazy_glCompressedTexImage3D;
+	glad_glCompressedTexImage2D = glad_lazy_glCompressedTexImage2D;
+	glad_glCompressedTexImage1D = glad_lazy_glCompressedTexImage1D;
+	glad_glCompressedTexSubImage3D = glad_lazy_glCompressedTexSubImage3D;
+	glad_glCompressedTexSubImage2D = glad_lazy_glCompressedTexSubImage2D;
+	glad_glCompressedTexSubImage1D = glad_lazy_glCompressedTexSubImage1D;
+	glad_glGetCompressedTexImage = glad_lazy_glGetCompressedTexImage;
+}
+static void lazy_GL_VERSION_1_4(void) {
+	if(!GLAD_GL_VERSION_1_4) return;
+	glad_glBlendFuncSeparate = glad_lazy_glBlendFuncSeparate;
+	glad_glMultiDrawArrays = glad_lazy_glMultiDrawArrays;
+	glad_glMultiDrawElements = glad_lazy_glMultiDrawElements;
+	glad_glPointParameterf = glad_lazy_glPointParameterf;
+	glad_glPointParameterfv = glad_lazy_glPointParameterfv;
+	glad_glPointParameteri = glad_lazy_glPointParameteri;
+	glad_glPointParameteriv = glad_lazy_glPointParameteriv;
+	glad_glBlendColor = glad_lazy_glBlendColor;
+	glad_glBlendEquation = glad_lazy_glBlendEquation;
+}
+static void lazy_GL_VERSION_1_5(void) {
+	if(!GLAD_GL_VERSION_1_5) return;
+	glad_glGenQueries = glad_lazy_glGenQueries;
+	glad_glDeleteQueries = glad_lazy_glDeleteQueries;
+	glad_glIsQuery = glad_lazy_glIsQuery;
+	glad_glBeginQuery = glad_lazy_glBeginQuery;
+	glad_glEndQuery = glad_lazy_glEndQuery;
+	glad_glGetQueryiv = glad_lazy_glGetQueryiv;
+	glad_glGetQueryObjectiv = glad_lazy_glGetQueryObjectiv;
+	glad_glGetQueryObjectuiv = glad_lazy_glGetQueryObjectuiv;
+	glad_glBindBuffer = glad_lazy_glBindBuffer;
+	glad_glDeleteBuffers = glad_lazy_glDeleteBuffers;
+	glad_glGenBuffers = glad_lazy_glGenBuffers;
+	glad_glIsBuffer = glad_lazy_glIsBuffer;
+	glad_glBufferData = glad_lazy_glBufferData;
+	glad_glBufferSubData = glad_lazy_glBufferSubData;
+	glad_glGetBufferSubData = glad_lazy_glGetBufferSubData;
+	glad_glMapBuffer = glad_lazy_glMapBuffer;
+	glad_glUnmapBuffer = glad_lazy_glUnmapBuffer;
+	glad_glGetBufferParameteriv = glad_lazy_glGetBufferParameteriv;
+	glad_glGetBufferPointerv = glad_lazy_glGetBufferPointerv;
+}
+static void lazy_GL_VERSION_2_0(void) {
+	if(!GLAD_GL_VERSION_2_0) return;
+	glad_glBlendEquationSeparate = glad_lazy_glBlendEquationSeparate;
+	glad_glDrawBuffers = glad_lazy_glDrawBuffers;
+	glad_glStencilOpSeparate = glad_lazy_glStencilOpSeparate;
+	glad_glStencilFuncSeparate = glad_lazy_glStencilFuncSeparate;
+	glad_glStencilMaskSeparate = glad_lazy_glStencilMaskSeparate;
+	glad_glAttachShader = glad_lazy_glAttachShader;
+	glad_glBindAttribLocation = glad_lazy_glBindAttribLocation;
+	glad_glCompileShader = glad_lazy_glCompileShader;
+	glad_glCreateProgram = glad_lazy_glCreateProgram;
+	glad_glCreateShader = glad_lazy_glCreateShader;
+	glad_glDeleteProgram = glad_lazy_glDeleteProgram;
+	glad_glDeleteShader = glad_lazy_glDeleteShader;
+	glad_glDetachShader = glad_lazy_glDetachShader;
+	glad_glDisableVertexAttribArray = glad_lazy_glDisableVertexAttribArray;
+	glad_glEnableVertexAttribArray = glad_lazy_glEnableVertexAttribArray;
+	glad_glGetActiveAttrib = glad_lazy_glGetActiveAttrib;
+	glad_glGetActiveUniform = glad_lazy_glGetActiveUniform;
+	glad_glGetAttachedShaders = glad_lazy_glGetAttachedShaders;
+	glad_glGetAttribLocation = glad_lazy_glGetAttribLocation;
+	glad_glGetProgramiv = glad_lazy_glGetProgramiv;
+	glad_glGetProgramInfoLog = glad_lazy_glGetProgramInfoLog;
+	glad_glGetShaderiv = glad_lazy_glGetShaderiv;
+	glad_glGetShaderInfoLog = glad_lazy_glGetShaderInfoLog;
+	glad_glGetShaderSource = glad_lazy_glGetShaderSource;
+	glad_glGetUniformLocation = glad_lazy_glGetUniformLocation;
+	glad_glGetUniformfv = glad_lazy_glGetUniformfv;
+	glad_glGetUniformiv = glad_lazy_glGetUniformiv;
+	glad_glGetVertexAttribdv = glad_lazy_glGetVertexAttribdv;
+	glad_glGetVertexAttribfv = glad_lazy_glGetVertexAttribfv;
+	glad_glGetVertexAttribiv = glad_lazy_glGetVertexAttribiv;
+	glad_glGetVertexAttribPointerv = glad_lazy_glGetVertexAttribPointerv;
+	glad_glIsProgram = glad_lazy_glIsProgram;
+	glad_glIsShader = glad_lazy_glIsShader;
+	glad_glLinkProgram = glad_lazy_glLinkProgram;
+	glad_glShaderSource = glad_lazy_glShaderSource;
+	glad_glUseProgram = glad_lazy_glUseProgram;
+	glad_glUniform1f = glad_lazy_glUniform1f;
+	glad_glUniform2f = glad_lazy_glUniform2f;
+	glad_glUniform3f = glad_lazy_glUniform3f;
+	glad_glUniform4f = glad_lazy_glUniform4f;
+	glad_glUniform1i = glad_lazy_glUniform1i;
+	glad_glUniform2i = glad_lazy_glUniform2i;
+	glad_glUniform3i = glad_lazy_glUniform3i;
+	glad_glUniform4i = glad_lazy_glUniform4i;
+	glad_glUniform1fv = glad_lazy_glUniform1fv;
+	glad_glUniform2fv = glad_lazy_glUniform2fv;
+	glad_glUniform3fv = glad_lazy_glUniform3fv;
+	glad_glUniform4fv = glad_lazy_glUniform4fv;
+	glad_glUniform1iv = glad_lazy_glUniform1iv;
+	glad_glUniform2iv = glad_lazy_glUniform2iv;
+	glad_glUniform3iv = glad_lazy_glUniform3iv;
+	glad_glUniform4iv = glad_lazy_glUniform4iv;
+	glad_glUniformMatrix2fv = glad_lazy_glUniformMatrix2fv;
+	glad_glUniformMatrix3fv = glad_lazy_glUniformMatrix3fv;
+	glad_glUniformMatrix4fv = glad_lazy_glUniformMatrix4fv;
+	glad_glValidateProgram = glad_lazy_glValidateProgram;
+	glad_glVertexAttrib1d = glad_lazy_glVertexAttrib1d;
+	glad_glVertexAttrib1dv = glad_lazy_glVertexAttrib1dv;
+	glad_glVertexAttrib1f = glad_lazy_glVertexAttrib1f;
+	glad_glVertexAttrib1fv = glad_lazy_glVertexAttrib1fv;
+	glad_glVertexAttrib1s = glad_lazy_glVertexAttrib1s;
+	glad_glVertexAttrib1sv = glad_lazy_glVertexAttrib1sv;
+	glad_glVertexAttrib2d = glad_lazy_glVertexAttrib2d;
+	glad_glVertexAttrib2dv = glad_lazy_glVertexAttrib2dv;
+	glad_glVertexAttrib2f = glad_lazy_glVertexAttrib2f;
+	glad_glVertexAttrib2fv = glad_lazy_glVertexAttrib2fv;
+	glad_glVertexAttrib2s = glad_lazy_glVertexAttrib2s;
+	glad_glVertexAttrib2sv = glad_lazy_glVertexAttrib2sv;
+	glad_glVertexAttrib3d = glad_lazy_glVertexAttrib3d;
+	glad_glVertexAttrib3dv = glad_lazy_glVertexAttrib3dv;
+	glad_glVertexAttrib3f = glad_lazy_glVertexAttrib3f;
+	glad_glVertexAttrib3fv = glad_lazy_glVertexAttrib3fv;
+	glad_glVertexAttrib3s = glad_lazy_glVertexAttrib3s;
+	glad_glVertexAttrib3sv = glad_lazy_glVertexAttrib3sv;
+	glad_glVertexAttrib4Nbv = glad_lazy_glVertexAttrib4Nbv;
+	glad_glVertexAttrib4Niv = glad_lazy_glVertexAttrib4Niv;
+	glad_glVertexAttrib4Nsv = glad_lazy_glVertexAttrib4Nsv;
+	glad_glVertexAttrib4Nub = glad_lazy_glVertexAttrib4Nub;
+	glad_glVertexAttrib4Nubv = glad_lazy_glVertexAttrib4Nubv;
+	glad_glVertexAttrib4Nuiv = glad_lazy_glVertexAttrib4Nuiv;
+	glad_glVertexAttrib4Nusv = glad_lazy_glVertexAttrib4Nusv;
+	glad_glVertexAttrib4bv = glad_lazy_glVertexAttrib4bv;
+	glad_glVertexAttrib4d = glad_lazy_glVertexAttrib4d;
+	glad_glVertexAttrib4dv = glad_lazy_glVertexAttrib4dv;
+	glad_glVertexAttrib4f = glad_lazy_glVertexAttrib4f;
+	glad_glVertexAttrib4fv = glad_lazy_glVertexAttrib4fv;
+	glad_glVertexAttrib4iv = glad_lazy_glVertexAttrib4iv;
+	glad_glVertexAttrib4s = glad_lazy_glVertexAttrib4s;
+	glad_glVertexAttrib4sv = glad_lazy_glVertexAttrib4sv;
+	glad_glVertexAttrib4ubv = glad_lazy_glVertexAttrib4ubv;
+	glad_glVertexAttrib4uiv = glad_lazy_glVertexAttrib4uiv;
+	glad_glVertexAttrib4usv = glad_lazy_glVertexAttrib4usv;
+	glad_glVertexAttribPointer = glad_lazy_glVertexAttribPointer;
+}
+static void lazy_GL_VERSION_2_1(void) {
+	if(!GLAD_GL_VERSION_2_1) return;
+	glad_glUniformMatrix2x3fv = glad_lazy_glUniformMatrix2x3fv;
+	glad_glUniformMatrix3x2fv = glad_lazy_glUniformMatrix3x2fv;
+	glad_glUniformMatrix2x4fv = glad_lazy_glUniformMatrix2x4fv;
+	glad_glUniformMatrix4x2fv = glad_lazy_glUniformMatrix4x2fv;
+	glad_glUniformMatrix3x4fv = glad_lazy_glUniformMatrix3x4fv;
+	glad_glUniformMatrix4x3fv = glad_lazy_glUniformMatrix4x3fv;
+}
+static void lazy_GL_VERSION_3_0(void) {
+	if(!GLAD_GL_VERSION_3_0) return;
+	glad_glColorMaski = glad_lazy_glColorMaski;
+	glad_glGetBooleani_v = glad_lazy_glGetBooleani_v;
+	glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+	glad_glEnablei = glad_lazy_glEnablei;
+	glad_glDisablei = glad_lazy_glDisablei;
+	glad_glIsEnabledi = glad_lazy_glIsEnabledi;
+	glad_glBeginTransformFeedback = glad_lazy_glBeginTransformFeedback;
+	glad_glEndTransformFeedback = glad_lazy_glEndTransformFeedback;
+	glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+	glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+	glad_glTransformFeedbackVaryings = glad_lazy_glTransformFeedbackVaryings;
+	glad_glGetTransformFeedbackVarying = glad_lazy_glGetTransformFeedbackVarying;
+	glad_glClampColor = glad_lazy_glClampColor;
+	glad_glBeginConditionalRender = glad_lazy_glBeginConditionalRender;
+	glad_glEndConditionalRender = glad_lazy_glEndConditionalRender;
+	glad_glVertexAttribIPointer = glad_lazy_glVertexAttribIPointer;
+	glad_glGetVertexAttribIiv = glad_lazy_glGetVertexAttribIiv;
+	glad_glGetVertexAttribIuiv = glad_lazy_glGetVertexAttribIuiv;
+	glad_glVertexAttribI1i = glad_lazy_glVertexAttribI1i;
+	glad_glVertexAttribI2i = glad_lazy_glVertexAttribI2i;
+	glad_glVertexAttribI3i = glad_lazy_glVertexAttribI3i;
+	glad_glVertexAttribI4i = glad_lazy_glVertexAttribI4i;
+	glad_glVertexAttribI1ui = glad_lazy_glVertexAttribI1ui;
+	glad_glVertexAttribI2ui = glad_lazy_glVertexAttribI2ui;
+	glad_glVertexAttribI3ui = glad_lazy_glVertexAttribI3ui;
+	glad_glVertexAttribI4ui = glad_lazy_glVertexAttribI4ui;
+	glad_glVertexAttribI1iv = glad_lazy_glVertexAttribI1iv;
+	glad_glVertexAttribI2iv = glad_lazy_glVertexAttribI2iv;
+	glad_glVertexAttribI3iv = glad_lazy_glVertexAttribI3iv;
+	glad_glVertexAttribI4iv = glad_lazy_glVertexAttribI4iv;
+	glad_glVertexAttribI1uiv = glad_lazy_glVertexAttribI1uiv;
+	glad_glVertexAttribI2uiv = glad_lazy_glVertexAttribI2uiv;
+	glad_glVertexAttribI3uiv = glad_lazy_glVertexAttribI3uiv;
+	glad_glVertexAttribI4uiv = glad_lazy_glVertexAttribI4uiv;
+	glad_glVertexAttribI4bv = glad_lazy_glVertexAttribI4bv;
+	glad_glVertexAttribI4sv = glad_lazy_glVertexAttribI4sv;
+	glad_glVertexAttribI4ubv = glad_lazy_glVertexAttribI4ubv;
+	glad_glVertexAttribI4usv = glad_lazy_glVertexAttribI4usv;
+	glad_glGetUniformuiv = glad_lazy_glGetUniformuiv;
+	glad_glBindFragDataLocation = glad_lazy_glBindFragDataLocation;
+	glad_glGetFragDataLocation = glad_lazy_glGetFragDataLocation;
+	glad_glUniform1ui = glad_lazy_glUniform1ui;
+	glad_glUniform2ui = glad_lazy_glUniform2ui;
+	glad_glUniform3ui = glad_lazy_glUniform3ui;
+	glad_glUniform4ui = glad_lazy_glUniform4ui;
+	glad_glUniform1uiv = glad_lazy_glUniform1uiv;
+	glad_glUniform2uiv = glad_lazy_glUniform2uiv;
+	glad_glUniform3uiv = glad_lazy_glUniform3uiv;
+	glad_glUniform4uiv = glad_lazy_glUniform4uiv;
+	glad_glTexParameterIiv = glad_lazy_glTexParameterIiv;
+	glad_glTexParameterIuiv = glad_lazy_glTexParameterIuiv;
+	glad_glGetTexParameterIiv = glad_lazy_glGetTexParameterIiv;
+	glad_glGetTexParameterIuiv = glad_lazy_glGetTexParameterIuiv;
+	glad_glClearBufferiv = glad_lazy_glClearBufferiv;
+	glad_glClearBufferuiv = glad_lazy_glClearBufferuiv;
+	glad_glClearBufferfv = glad_lazy_glClearBufferfv;
+	glad_glClearBufferfi = glad_lazy_glClearBufferfi;
+	glad_glGetStringi = glad_lazy_glGetStringi;
+	glad_glIsRenderbuffer = glad_lazy_glIsRenderbuffer;
+	glad_glBindRenderbuffer = glad_lazy_glBindRenderbuffer;
+	glad_glDeleteRenderbuffers = glad_lazy_glDeleteRenderbuffers;
+	glad_glGenRenderbuffers = glad_lazy_glGenRenderbuffers;
+	glad_glRenderbufferStorage = glad_lazy_glRenderbufferStorage;
+	glad_glGetRenderbufferParameteriv = glad_lazy_glGetRenderbufferParameteriv;
+	glad_glIsFramebuffer = glad_lazy_glIsFramebuffer;
+	glad_glBindFramebuffer = glad_lazy_glBindFramebuffer;
+	glad_glDeleteFramebuffers = glad_lazy_glDeleteFramebuffers;
+	glad_glGenFramebuffers = glad_lazy_glGenFramebuffers;
+	glad_glCheckFramebufferStatus = glad_lazy_glCheckFramebufferStatus;
+	glad_glFramebufferTexture1D = glad_lazy_glFramebufferTexture1D;
+	glad_glFramebufferTexture2D = glad_lazy_glFramebufferTexture2D;
+	glad_glFramebufferTexture3D = glad_lazy_glFramebufferTexture3D;
+	glad_glFramebufferRenderbuffer = glad_lazy_glFramebufferRenderbuffer;
+	glad_glGetFramebufferAttachmentParameteriv = glad_lazy_glGetFramebufferAttachmentParameteriv;
+	glad_glGenerateMipmap = glad_lazy_glGenerateMipmap;
+	glad_glBlitFramebuffer = glad_lazy_glBlitFramebuffer;
+	glad_glRenderbufferStorageMultisample = glad_lazy_glRenderbufferStorageMultisample;
+	glad_glFramebufferTextureLayer = glad_lazy_glFramebufferTextureLayer;
+	glad_glMapBufferRange = glad_lazy_glMapBufferRange;
+	glad_glFlushMappedBufferRange = glad_lazy_glFlushMappedBufferRange;
+	glad_glBindVertexArray = glad_lazy_glBindVertexArray;
+	glad_glDeleteVertexArrays = glad_lazy_glDeleteVertexArrays;
+	glad_glGenVertexArrays = glad_lazy_glGenVertexArrays;
+	glad_glIsVertexArray = glad_lazy_glIsVertexArray;
+}
+static void lazy_GL_VERSION_3_1(void) {
+	if(!GLAD_GL_VERSION_3_1) return;
+	glad_glDrawArraysInstanced = glad_lazy_glDrawArraysInstanced;
+	glad_glDrawElementsInstanced = glad_lazy_glDrawElementsInstanced;
+	glad_glTexBuffer = glad_lazy_glTexBuffer;
+	glad_glPrimitiveRestartIndex = glad_lazy_glPrimitiveRestartIndex;
+	glad_glCopyBufferSubData = glad_lazy_glCopyBufferSubData;
+	glad_glGetUniformIndices = glad_lazy_glGetUniformIndices;
+	glad_glGetActiveUniformsiv = glad_lazy_glGetActiveUniformsiv;
+	glad_glGetActiveUniformName = glad_lazy_glGetActiveUniformName;
+	glad_glGetUniformBlockIndex = glad_lazy_glGetUniformBlockIndex;
+	glad_glGetActiveUniformBlockiv = glad_lazy_glGetActiveUniformBlockiv;
+	glad_glGetActiveUniformBlockName = glad_lazy_glGetActiveUniformBlockName;
+	glad_glUniformBlockBinding = glad_lazy_glUniformBlockBinding;
+	glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+	glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+	glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+}
+static void lazy_GL_VERSION_3_2(void) {
+	if(!GLAD_GL_VERSION_3_2) return;
+	glad_glDrawElementsBaseVertex = glad_lazy_glDrawElementsBaseVertex;
+	glad_glDrawRangeElementsBaseVertex = glad_lazy_glDrawRangeElementsBaseVertex;
+	glad_glDrawElementsInstancedBaseVertex = glad_lazy_glDrawElementsInstancedBaseVertex;
+	glad_glMultiDrawElementsBaseVertex = glad_lazy_glMultiDrawElementsBaseVertex;
+	glad_glProvokingVertex = glad_lazy_glProvokingVertex;
+	glad_glFenceSync = glad_lazy_glFenceSync;
+	glad_glIsSync = glad_lazy_glIsSync;
+	glad_glDeleteSync = glad_lazy_glDeleteSync;
+	glad_glClientWaitSync = glad_lazy_glClientWaitSync;
+	glad_glWaitSync = glad_lazy_glWaitSync;
+	glad_glGetInteger64v = glad_lazy_glGetInteger64v;
+	glad_glGetSynciv = glad_lazy_glGetSynciv;
+	glad_glGetInteger64i_v = glad_lazy_glGetInteger64i_v;
+	glad_glGetBufferParameteri64v = glad_lazy_glGetBufferParameteri64v;
+	glad_glFramebufferTexture = glad_lazy_glFramebufferTexture;
+	glad_glTexImage2DMultisample = glad_lazy_glTexImage2DMultisample;
+	glad_glTexImage3DMultisample = glad_lazy_glTexImage3DMultisample;
+	glad_glGetMultisamplefv = glad_lazy_glGetMultisamplefv;
+	glad_glSampleMaski = glad_lazy_glSampleMaski;
+}
+static void lazy_GL_VERSION_3_3(void) {
+	if(!GLAD_GL_VERSION_3_3) return;
+	glad_glBindFragDataLocationIndexed = glad_lazy_glBindFragDataLocationIndexed;
+	glad_glGetFragDataIndex = glad_lazy_glGetFragDataIndex;
+	glad_glGenSamplers = glad_lazy_glGenSamplers;
+	glad_glDeleteSamplers = glad_lazy_glDeleteSamplers;
+	glad_glIsSampler = glad_lazy_glIsSampler;
+	glad_glBindSampler = glad_lazy_glBindSampler;
+	glad_glSamplerParameteri = glad_lazy_glSamplerParameteri;
+	glad_glSamplerParameteriv = glad_lazy_glSamplerParameteriv;
+	glad_glSamplerParameterf = glad_lazy_glSamplerParameterf;
+	glad_glSamplerParameterfv = glad_lazy_glSamplerParameterfv;
+	glad_glSamplerParameterIiv = glad_lazy_glSamplerParameterIiv;
+	glad_glSamplerParameterIuiv = glad_lazy_glSamplerParameterIuiv;
+	glad_glGetSamplerParameteriv = glad_lazy_glGetSamplerParameteriv;
+	glad_glGetSamplerParameterIiv = glad_lazy_glGetSamplerParameterIiv;
+	glad_glGetSamplerParameterfv = glad_lazy_glGetSamplerParameterfv;
+	glad_glGetSamplerParameterIuiv = glad_lazy_glGetSamplerParameterIuiv;
+	glad_glQueryCounter = glad_lazy_glQueryCounter;
+	glad_glGetQueryObjecti64v = glad_lazy_glGetQueryObjecti64v;
+	glad_glGetQueryObjectui64v = glad_lazy_glGetQueryObjectui64v;
+	glad_glVertexAttribDivisor = glad_lazy_glVertexAttribDivisor;
+	glad_glVertexAttribP1ui = glad_lazy_glVertexAttribP1ui;
+	glad_glVertexAttribP1uiv = glad_lazy_glVertexAttribP1uiv;
+	glad_glVertexAttribP2ui = glad_lazy_glVertexAttribP2ui;
+	glad_glVertexAttribP2uiv = glad_lazy_glVertexAttribP2uiv;
+	glad_glVertexAttribP3ui = glad_lazy_glVertexAttribP3ui;
+	glad_glVertexAttribP3uiv = glad_lazy_glVertexAttribP3uiv;
+	glad_glVertexAttribP4ui = glad_lazy_glVertexAttribP4ui;
+	glad_glVertexAttribP4uiv = glad_lazy_glVertexAttribP4uiv;
+	glad_glVertexP2ui = glad_lazy_glVertexP2ui;
+	glad_glVertexP2uiv = glad_lazy_glVertexP2uiv;
+	glad_glVertexP3ui = glad_lazy_glVertexP3ui;
+	glad_glVertexP3uiv = glad_lazy_glVertexP3uiv;
+	glad_glVertexP4ui = glad_lazy_glVertexP4ui;
+	glad_glVertexP4uiv = glad_lazy_glVertexP4uiv;
+	glad_glTexCoordP1ui = glad_lazy_glTexCoordP1ui;
+	glad_glTexCoordP1uiv = glad_lazy_glTexCoordP1uiv;
+	glad_glTexCoordP2ui = glad_lazy_glTexCoordP2ui;
+	glad_glTexCoordP2uiv = glad_lazy_glTexCoordP2uiv;
+	glad_glTexCoordP3ui = glad_lazy_glTexCoordP3ui;
+	glad_glTexCoordP3uiv = glad_lazy_glTexCoordP3uiv;
+	glad_glTexCoordP4ui = glad_lazy_glTexCoordP4ui;
+	glad_glTexCoordP4uiv = glad_lazy_glTexCoordP4uiv;
+	glad_glMultiTexCoordP1ui = glad_lazy_glMultiTexCoordP1ui;
+	glad_glMultiTexCoordP1uiv = glad_lazy_glMultiTexCoordP1uiv;
+	glad_glMultiTexCoordP2ui = glad_lazy_glMultiTexCoordP2ui;
+	glad_glMultiTexCoordP2uiv = glad_lazy_glMultiTexCoordP2uiv;
+	glad_glMultiTexCoordP3ui = glad_lazy_glMultiTexCoordP3ui;
+	glad_glMultiTexCoordP3uiv = glad_lazy_glMultiTexCoordP3uiv;
+	glad_glMultiTexCoordP4ui = glad_lazy_glMultiTexCoordP4ui;
+	glad_glMultiTexCoordP4uiv = glad_lazy_glMultiTexCoordP4uiv;
+	glad_glNormalP3ui = glad_lazy_glNormalP3ui;
+	glad_glNormalP3uiv = glad_lazy_glNormalP3uiv;
+	glad_glColorP3ui = glad_lazy_glColorP3ui;
+	glad_glColorP3uiv = glad_lazy_glColorP3uiv;
+	glad_glColorP4ui = glad_lazy_glColorP4ui;
+	glad_glColorP4uiv = glad_lazy_glColorP4uiv;
+	glad_glSecondaryColorP3ui = glad_lazy_glSecondaryColorP3ui;
+	glad_glSecondaryColorP3uiv = glad_lazy_glSecondaryColorP3uiv;
+}
+static void lazy_GL_ARB_get_program_binary(void) {
+	if(!GLAD_GL_ARB_get_program_binary) return;
+	glad_glGetProgramBinary = glad_lazy_glGetProgramBinary;
+	glad_glProgramBinary = glad_lazy_glProgramBinary;
+	glad_glProgramParameteri = glad_lazy_glProgramParameteri;
+}
+static void lazy_GL_KHR_parallel_shader_compile(void) {
+	if(!GLAD_GL_KHR_parallel_shader_compile) return;
+	glad_glMaxShaderCompilerThreadsKHR = glad_lazy_glMaxShaderCompilerThreadsKHR;
+}
+static void lazy_GL_ARB_buffer_storage(void) {
+	if(!GLAD_GL_ARB_buffer_storage) return;
+	glad_glBufferStorage = glad_lazy_glBufferStorage;
+}
+
+int gladLoadGLLoaderLazy(GLADloadproc load) {
+	GLVersion.major = 0; GLVersion.minor = 0;
+	glad_lazy_load = load;
+	memset(&glad_lazy_slots, 0, sizeof(glad_lazy_slots));
+	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(glGetString == NULL) return 0;
+	if(glGetString(GL_VERSION) == NULL) return 0;
+	find_coreGL();
+	lazy_GL_VERSION_1_0();
+	lazy_GL_VERSION_1_1();
+	lazy_GL_VERSION_1_2();
+	lazy_GL_VERSION_1_3();
+	lazy_GL_VERSION_1_4();
+	lazy_GL_VERSION_1_5();
+	lazy_GL_VERSION_2_0();
+	lazy_GL_VERSION_2_1();
+	lazy_GL_VERSION_3_0();
+	lazy_GL_VERSION_3_1();
+	lazy_GL_VERSION_3_2();
+	lazy_GL_VERSION_3_3();
+
+	if (!find_extensionsGL()) return 0;
+	lazy_GL_ARB_get_program_binary();
+	lazy_GL_KHR_parallel_shader_compile();
+	lazy_GL_ARB_buffer_storage();
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}
+/* glad_extras.py: end lazy */
+
+/* glad_extras.py: begin context */
+/* ----- per-context dispatch */
+
+#if defined(_MSC_VER)
+#define GLAD_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#define GLAD_THREAD_LOCAL __thread
+#else
+#define GLAD_THREAD_LOCAL _Thread_local
+#endif
+
+static GLAD_THREAD_LOCAL GladGLContext *glad_current_context = NULL;
+
+void gladSetGLContext(GladGLContext *context) {
+    glad_current_context = context;
+}
+
+GladGLContext *gladGetGLContext(void) {
+    return glad_current_context;
+}
+
+/* every entry point with the flag that has to be set for it to be loaded */
+typedef struct {
+    const char *name;
+    size_t function;
+    size_t feature;
+} glad_context_entry;
+
+static const glad_context_entry glad_context_versions[] = {
+	{ "glCullFace", offsetof(GladGLContext, CullFace), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glFrontFace", offsetof(GladGLContext, FrontFace), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glHint", offsetof(GladGLContext, Hint), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glLineWidth", offsetof(GladGLContext, LineWidth), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glPointSize", offsetof(GladGLContext, PointSize), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glPolygonMode", offsetof(GladGLContext, PolygonMode), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glScissor", offsetof(GladGLContext, Scissor), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glTexParameterf", offsetof(GladGLContext, TexParameterf), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glTexParameterfv", offsetof(GladGLContext, TexParameterfv), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glTexParameteri", offsetof(GladGLContext, TexParameteri), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glTexParameteriv", offsetof(GladGLContext, TexParameteriv), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glTexImage1D", offsetof(GladGLContext, TexImage1D), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glTexImage2D", offsetof(GladGLContext, TexImage2D), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glDrawBuffer", offsetof(GladGLContext, DrawBuffer), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glClear", offsetof(GladGLContext, Clear), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glClearColor", offsetof(GladGLContext, ClearColor), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glClearStencil", offsetof(GladGLContext, ClearStencil), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glClearDepth", offsetof(GladGLContext, ClearDepth), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glStencilMask", offsetof(GladGLContext, StencilMask), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glColorMask", offsetof(GladGLContext, ColorMask), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glDepthMask", offsetof(GladGLContext, DepthMask), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glDisable", offsetof(GladGLContext, Disable), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glEnable", offsetof(GladGLContext, Enable), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glFinish", offsetof(GladGLContext, Finish), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glFlush", offsetof(GladGLContext, Flush), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glBlendFunc", offsetof(GladGLContext, BlendFunc), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glLogicOp", offsetof(GladGLContext, LogicOp), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glStencilFunc", offsetof(GladGLContext, StencilFunc), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glStencilOp", offsetof(GladGLContext, StencilOp), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glDepthFunc", offsetof(GladGLContext, DepthFunc), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glPixelStoref", offsetof(GladGLContext, PixelStoref), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glPixelStorei", offsetof(GladGLContext, PixelStorei), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glReadBuffer", offsetof(GladGLContext, ReadBuffer), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glReadPixels", offsetof(GladGLContext, ReadPixels), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glGetBooleanv", offsetof(GladGLContext, GetBooleanv), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glGetDoublev", offsetof(GladGLContext, GetDoublev), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glGetError", offsetof(GladGLContext, GetError), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glGetFloatv", offsetof(GladGLContext, GetFloatv), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glGetIntegerv", offsetof(GladGLContext, GetIntegerv), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glGetString", offsetof(GladGLContext, GetString), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glGetTexImage", offsetof(GladGLContext, GetTexImage), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glGetTexParameterfv", offsetof(GladGLContext, GetTexParameterfv), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glGetTexParameteriv", offsetof(GladGLContext, GetTexParameteriv), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glGetTexLevelParameterfv", offsetof(GladGLContext, GetTexLevelParameterfv), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glGetTexLevelParameteriv", offsetof(GladGLContext, GetTexLevelParameteriv), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glIsEnabled", offsetof(GladGLContext, IsEnabled), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glDepthRange", offsetof(GladGLContext, DepthRange), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glViewport", offsetof(GladGLContext, Viewport), offsetof(GladGLContext, VERSION_1_0) },
+	{ "glDrawArrays", offsetof(GladGLContext, DrawArrays), offsetof(GladGLContext, VERSION_1_1) },
+	{ "glDrawElements", offsetof(GladGLContext, DrawElements), offsetof(GladGLContext, VERSION_1_1) },
+	{ "glPolygonOffset", offsetof(GladGLContext, PolygonOffset), offsetof(GladGLContext, VERSION_1_1) },
+	{ "glCopyTexImage1D", offsetof(GladGLContext, CopyTexImage1D), offsetof(GladGLContext, VERSION_1_1) },
+	{ "glCopyTexImage2D", offsetof(GladGLContext, CopyTexImage2D), offsetof(GladGLContext, VERSION_1_1) },
+	{ "glCopyTexSubImage1D", offsetof(GladGLContext, CopyTexSubImage1D), offsetof(GladGLContext, VERSION_1_1) },
+	{ "glCopyTexSubImage2D", offsetof(GladGLContext, CopyTexSubImage2D), offsetof(GladGLContext, VERSION_1_1) },
+	{ "glTexSubImage1D", offsetof(GladGLContext, TexSubImage1D), offsetof(GladGLContext, VERSION_1_1) },
+	{ "glTexSubImage2D", offsetof(GladGLContext, TexSubImage2D), offsetof(GladGLContext, VERSION_1_1) },
+	{ "glBindTexture", offsetof(GladGLContext, BindTexture), offsetof(GladGLContext, VERSION_1_1) },
+	{ "glDeleteTextures", offsetof(GladGLContext, DeleteTextures), offsetof(GladGLContext, VERSION_1_1) },
+	{ "glGenTextures", offsetof(GladGLContext, GenTextures), offsetof(GladGLContext, VERSION_1_1) },
+	{ "glIsTexture", offsetof(GladGLContext, IsTexture), offsetof(GladGLContext, VERSION_1_1) },
+	{ "glDrawRangeElements", offsetof(GladGLContext, DrawRangeElements), offsetof(GladGLContext, VERSION_1_2) },
+	{ "glTexImage3D", offsetof(GladGLContext, TexImage3D), offsetof(GladGLContext, VERSION_1_2) },
+	{ "glTexSubImage3D", offsetof(GladGLContext, TexSubImage3D), offsetof(GladGLContext, VERSION_1_2) },
+	{ "glCopyTexSubImage3D", offsetof(GladGLContext, CopyTexSubImage3D), offsetof(GladGLContext, VERSION_1_2) },
+	{ "glActiveTexture", offsetof(GladGLContext, ActiveTexture), offsetof(GladGLContext, VERSION_1_3) },
+	{ "glSampleCoverage", offsetof(GladGLContext, SampleCoverage), offsetof(GladGLContext, VERSION_1_3) },
+	{ "glCompressedTexImage3D", offsetof(GladGLContext, CompressedTexImage3D), offsetof(GladGLContext, VERSION_1_3) },
+	{ "glCompressedTexImage2D", offsetof(GladGLContext, CompressedTexImage2D), offsetof(GladGLContext, VERSION_1_3) },
+	{ "glCompressedTexImage1D", offsetof(GladGLContext, CompressedTexImage1D), offsetof(GladGLContext, VERSION_1_3) },
+	{ "glCompressedTexSubImage3D", offsetof(GladGLContext, CompressedTexSubImage3D), offsetof(GladGLContext, VERSION_1_3) },
+	{ "glCompressedTexSubImage2D", offsetof(GladGLContext, CompressedTexSubImage2D), offsetof(GladGLContext, VERSION_1_3) },
+	{ "glCompressedTexSubImage1D", offsetof(GladGLContext, CompressedTexSubImage1D), offsetof(GladGLContext, VERSION_1_3) },
+	{ "glGetCompressedTexImage", offsetof(GladGLContext, GetCompressedTexImage), offsetof(GladGLContext, VERSION_1_3) },
+	{ "glBlendFuncSeparate", offsetof(GladGLContext, BlendFuncSeparate), offsetof(GladGLContext, VERSION_1_4) },
+	{ "glMultiDrawArrays", offsetof(GladGLContext, MultiDrawArrays), offsetof(GladGLContext, VERSION_1_4) },
+	{ "glMultiDrawElements", offsetof(GladGLContext, MultiDrawElements), offsetof(GladGLContext, VERSION_1_4) },
+	{ "glPointParameterf", offsetof(GladGLContext, PointParameterf), offsetof(GladGLContext, VERSION_1_4) },
+	{ "glPointParameterfv", offsetof(GladGLContext, PointParameterfv), offsetof(GladGLContext, VERSION_1_4) },
+	{ "glPointParameteri", offsetof(GladGLContext, PointParameteri), offsetof(GladGLContext, VERSION_1_4) },
+	{ "glPointParameteriv", offsetof(GladGLContext, PointParameteriv), offsetof(GladGLContext, VERSION_1_4) },
+	{ "glBlendColor", offsetof(GladGLContext, BlendColor), offsetof(GladGLContext, VERSION_1_4) },
+	{ "glBlendEquation", offsetof(GladGLContext, BlendEquation), offsetof(GladGLContext, VERSION_1_4) },
+	{ "glGenQueries", offsetof(GladGLContext, GenQueries), offsetof(GladGLContext, VERSION_1_5) },
+	{ "glDeleteQueries", offsetof(GladGLContext, DeleteQueries), offsetof(GladGLContext, VERSION_1_5) },
+	{ "glIsQuery", offsetof(GladGLContext, IsQuery), offsetof(GladGLContext, VERSION_1_5) },
+	{ "glBeginQuery", offsetof(GladGLContext, BeginQuery), offsetof(GladGLContext, VERSION_1_5) },
+	{ "glEndQuery", offsetof(GladGLContext, EndQuery), offsetof(GladGLContext, VERSION_1_5) },
+	{ "glGetQueryiv", offsetof(GladGLContext, GetQueryiv), offsetof(GladGLContext, VERSION_1_5) },
+	{ "glGetQueryObjectiv", offsetof(GladGLContext, GetQueryObjectiv), offsetof(GladGLContext, VERSION_1_5) },
+	{ "glGetQueryObjectuiv", offsetof(GladGLContext, GetQueryObjectuiv), offsetof(GladGLContext, VERSION_1_5) },
+	{ "glBindBuffer", offsetof(GladGLContext, BindBuffer), offsetof(GladGLContext, VERSION_1_5) },
+	{ "glDeleteBuffers", offsetof(GladGLContext, DeleteBuffers), offsetof(GladGLContext, VERSION_1_5) },
+	{ "glGenBuffers", offsetof(GladGLContext, GenBuffers), offsetof(GladGLContext, VERSION_1_5) },
+	{ "glIsBuffer", offsetof(GladGLContext, IsBuffer), offsetof(GladGLContext, VERSION_1_5) },
+	{ "glBufferData", offsetof(GladGLContext, BufferData), offsetof(GladGLContext, VERSION_1_5) },
+	{ "glBufferSubData", offsetof(GladGLContext, BufferSubData), offsetof(GladGLContext, VERSION_1_5) },
+	{ "glGetBufferSubData", offsetof(GladGLContext, GetBufferSubData), offsetof(GladGLContext, VERSION_1_5) },
+	{ "glMapBuffer", offsetof(GladGLContext, MapBuffer), offsetof(GladGLContext, VERSION_1_5) },
+	{ "glUnmapBuffer", offsetof(GladGLContext, UnmapBuffer), offsetof(GladGLContext, VERSION_1_5) },
+	{ "glGetBufferParameteriv", offsetof(GladGLContext, GetBufferParameteriv), offsetof(GladGLContext, VERSION_1_5) },
+	{ "glGetBufferPointerv", offsetof(GladGLContext, GetBufferPointerv), offsetof(GladGLContext, VERSION_1_5) },
+	{ "glBlendEquationSeparate", offsetof(GladGLContext, BlendEquationSeparate), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glDrawBuffers", offsetof(GladGLContext, DrawBuffers), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glStencilOpSeparate", offsetof(GladGLContext, StencilOpSeparate), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glStencilFuncSeparate", offsetof(GladGLContext, StencilFuncSeparate), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glStencilMaskSeparate", offsetof(GladGLContext, StencilMaskSeparate), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glAttachShader", offsetof(GladGLContext, AttachShader), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glBindAttribLocation", offsetof(GladGLContext, BindAttribLocation), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glCompileShader", offsetof(GladGLContext, CompileShader), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glCreateProgram", offsetof(GladGLContext, CreateProgram), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glCreateShader", offsetof(GladGLContext, CreateShader), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glDeleteProgram", offsetof(GladGLContext, DeleteProgram), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glDeleteShader", offsetof(GladGLContext, DeleteShader), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glDetachShader", offsetof(GladGLContext, DetachShader), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glDisableVertexAttribArray", offsetof(GladGLContext, DisableVertexAttribArray), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glEnableVertexAttribArray", offsetof(GladGLContext, EnableVertexAttribArray), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glGetActiveAttrib", offsetof(GladGLContext, GetActiveAttrib), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glGetActiveUniform", offsetof(GladGLContext, GetActiveUniform), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glGetAttachedShaders", offsetof(GladGLContext, GetAttachedShaders), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glGetAttribLocation", offsetof(GladGLContext, GetAttribLocation), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glGetProgramiv", offsetof(GladGLContext, GetProgramiv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glGetProgramInfoLog", offsetof(GladGLContext, GetProgramInfoLog), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glGetShaderiv", offsetof(GladGLContext, GetShaderiv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glGetShaderInfoLog", offsetof(GladGLContext, GetShaderInfoLog), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glGetShaderSource", offsetof(GladGLContext, GetShaderSource), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glGetUniformLocation", offsetof(GladGLContext, GetUniformLocation), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glGetUniformfv", offsetof(GladGLContext, GetUniformfv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glGetUniformiv", offsetof(GladGLContext, GetUniformiv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glGetVertexAttribdv", offsetof(GladGLContext, GetVertexAttribdv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glGetVertexAttribfv", offsetof(GladGLContext, GetVertexAttribfv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glGetVertexAttribiv", offsetof(GladGLContext, GetVertexAttribiv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glGetVertexAttribPointerv", offsetof(GladGLContext, GetVertexAttribPointerv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glIsProgram", offsetof(GladGLContext, IsProgram), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glIsShader", offsetof(GladGLContext, IsShader), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glLinkProgram", offsetof(GladGLContext, LinkProgram), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glShaderSource", offsetof(GladGLContext, ShaderSource), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glUseProgram", offsetof(GladGLContext, UseProgram), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glUniform1f", offsetof(GladGLContext, Uniform1f), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glUniform2f", offsetof(GladGLContext, Uniform2f), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glUniform3f", offsetof(GladGLContext, Uniform3f), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glUniform4f", offsetof(GladGLContext, Uniform4f), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glUniform1i", offsetof(GladGLContext, Uniform1i), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glUniform2i", offsetof(GladGLContext, Uniform2i), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glUniform3i", offsetof(GladGLContext, Uniform3i), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glUniform4i", offsetof(GladGLContext, Uniform4i), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glUniform1fv", offsetof(GladGLContext, Uniform1fv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glUniform2fv", offsetof(GladGLContext, Uniform2fv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glUniform3fv", offsetof(GladGLContext, Uniform3fv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glUniform4fv", offsetof(GladGLContext, Uniform4fv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glUniform1iv", offsetof(GladGLContext, Uniform1iv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glUniform2iv", offsetof(GladGLContext, Uniform2iv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glUniform3iv", offsetof(GladGLContext, Uniform3iv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glUniform4iv", offsetof(GladGLContext, Uniform4iv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glUniformMatrix2fv", offsetof(GladGLContext, UniformMatrix2fv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glUniformMatrix3fv", offsetof(GladGLContext, UniformMatrix3fv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glUniformMatrix4fv", offsetof(GladGLContext, UniformMatrix4fv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glValidateProgram", offsetof(GladGLContext, ValidateProgram), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib1d", offsetof(GladGLContext, VertexAttrib1d), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib1dv", offsetof(GladGLContext, VertexAttrib1dv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib1f", offsetof(GladGLContext, VertexAttrib1f), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib1fv", offsetof(GladGLContext, VertexAttrib1fv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib1s", offsetof(GladGLContext, VertexAttrib1s), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib1sv", offsetof(GladGLContext, VertexAttrib1sv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib2d", offsetof(GladGLContext, VertexAttrib2d), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib2dv", offsetof(GladGLContext, VertexAttrib2dv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib2f", offsetof(GladGLContext, VertexAttrib2f), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib2fv", offsetof(GladGLContext, VertexAttrib2fv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib2s", offsetof(GladGLContext, VertexAttrib2s), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib2sv", offsetof(GladGLContext, VertexAttrib2sv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib3d", offsetof(GladGLContext, VertexAttrib3d), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib3dv", offsetof(GladGLContext, VertexAttrib3dv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib3f", offsetof(GladGLContext, VertexAttrib3f), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib3fv", offsetof(GladGLContext, VertexAttrib3fv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib3s", offsetof(GladGLContext, VertexAttrib3s), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib3sv", offsetof(GladGLContext, VertexAttrib3sv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib4Nbv", offsetof(GladGLContext, VertexAttrib4Nbv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib4Niv", offsetof(GladGLContext, VertexAttrib4Niv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib4Nsv", offsetof(GladGLContext, VertexAttrib4Nsv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib4Nub", offsetof(GladGLContext, VertexAttrib4Nub), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib4Nubv", offsetof(GladGLContext, VertexAttrib4Nubv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib4Nuiv", offsetof(GladGLContext, VertexAttrib4Nuiv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib4Nusv", offsetof(GladGLContext, VertexAttrib4Nusv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib4bv", offsetof(GladGLContext, VertexAttrib4bv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib4d", offsetof(GladGLContext, VertexAttrib4d), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib4dv", offsetof(GladGLContext, VertexAttrib4dv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib4f", offsetof(GladGLContext, VertexAttrib4f), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib4fv", offsetof(GladGLContext, VertexAttrib4fv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib4iv", offsetof(GladGLContext, VertexAttrib4iv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib4s", offsetof(GladGLContext, VertexAttrib4s), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib4sv", offsetof(GladGLContext, VertexAttrib4sv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib4ubv", offsetof(GladGLContext, VertexAttrib4ubv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib4uiv", offsetof(GladGLContext, VertexAttrib4uiv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttrib4usv", offsetof(GladGLContext, VertexAttrib4usv), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glVertexAttribPointer", offsetof(GladGLContext, VertexAttribPointer), offsetof(GladGLContext, VERSION_2_0) },
+	{ "glUniformMatrix2x3fv", offsetof(GladGLContext, UniformMatrix2x3fv), offsetof(GladGLContext, VERSION_2_1) },
+	{ "glUniformMatrix3x2fv", offsetof(GladGLContext, UniformMatrix3x2fv), offsetof(GladGLContext, VERSION_2_1) },
+	{ "glUniformMatrix2x4fv", offsetof(GladGLContext, UniformMatrix2x4fv), offsetof(GladGLContext, VERSION_2_1) },
+	{ "glUniformMatrix4x2fv", offsetof(GladGLContext, UniformMatrix4x2fv), offsetof(GladGLContext, VERSION_2_1) },
+	{ "glUniformMatrix3x4fv", offsetof(GladGLContext, UniformMatrix3x4fv), offsetof(GladGLContext, VERSION_2_1) },
+	{ "glUniformMatrix4x3fv", offsetof(GladGLContext, UniformMatrix4x3fv), offsetof(GladGLContext, VERSION_2_1) },
+	{ "glColorMaski", offsetof(GladGLContext, ColorMaski), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glGetBooleani_v", offsetof(GladGLContext, GetBooleani_v), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glGetIntegeri_v", offsetof(GladGLContext, GetIntegeri_v), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glEnablei", offsetof(GladGLContext, Enablei), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glDisablei", offsetof(GladGLContext, Disablei), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glIsEnabledi", offsetof(GladGLContext, IsEnabledi), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glBeginTransformFeedback", offsetof(GladGLContext, BeginTransformFeedback), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glEndTransformFeedback", offsetof(GladGLContext, EndTransformFeedback), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glBindBufferRange", offsetof(GladGLContext, BindBufferRange), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glBindBufferBase", offsetof(GladGLContext, BindBufferBase), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glTransformFeedbackVaryings", offsetof(GladGLContext, TransformFeedbackVaryings), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glGetTransformFeedbackVarying", offsetof(GladGLContext, GetTransformFeedbackVarying), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glClampColor", offsetof(GladGLContext, ClampColor), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glBeginConditionalRender", offsetof(GladGLContext, BeginConditionalRender), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glEndConditionalRender", offsetof(GladGLContext, EndConditionalRender), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glVertexAttribIPointer", offsetof(GladGLContext, VertexAttribIPointer), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glGetVertexAttribIiv", offsetof(GladGLContext, GetVertexAttribIiv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glGetVertexAttribIuiv", offsetof(GladGLContext, GetVertexAttribIuiv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glVertexAttribI1i", offsetof(GladGLContext, VertexAttribI1i), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glVertexAttribI2i", offsetof(GladGLContext, VertexAttribI2i), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glVertexAttribI3i", offsetof(GladGLContext, VertexAttribI3i), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glVertexAttribI4i", offsetof(GladGLContext, VertexAttribI4i), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glVertexAttribI1ui", offsetof(GladGLContext, VertexAttribI1ui), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glVertexAttribI2ui", offsetof(GladGLContext, VertexAttribI2ui), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glVertexAttribI3ui", offsetof(GladGLContext, VertexAttribI3ui), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glVertexAttribI4ui", offsetof(GladGLContext, VertexAttribI4ui), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glVertexAttribI1iv", offsetof(GladGLContext, VertexAttribI1iv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glVertexAttribI2iv", offsetof(GladGLContext, VertexAttribI2iv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glVertexAttribI3iv", offsetof(GladGLContext, VertexAttribI3iv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glVertexAttribI4iv", offsetof(GladGLContext, VertexAttribI4iv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glVertexAttribI1uiv", offsetof(GladGLContext, VertexAttribI1uiv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glVertexAttribI2uiv", offsetof(GladGLContext, VertexAttribI2uiv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glVertexAttribI3uiv", offsetof(GladGLContext, VertexAttribI3uiv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glVertexAttribI4uiv", offsetof(GladGLContext, VertexAttribI4uiv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glVertexAttribI4bv", offsetof(GladGLContext, VertexAttribI4bv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glVertexAttribI4sv", offsetof(GladGLContext, VertexAttribI4sv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glVertexAttribI4ubv", offsetof(GladGLContext, VertexAttribI4ubv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glVertexAttribI4usv", offsetof(GladGLContext, VertexAttribI4usv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glGetUniformuiv", offsetof(GladGLContext, GetUniformuiv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glBindFragDataLocation", offsetof(GladGLContext, BindFragDataLocation), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glGetFragDataLocation", offsetof(GladGLContext, GetFragDataLocation), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glUniform1ui", offsetof(GladGLContext, Uniform1ui), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glUniform2ui", offsetof(GladGLContext, Uniform2ui), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glUniform3ui", offsetof(GladGLContext, Uniform3ui), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glUniform4ui", offsetof(GladGLContext, Uniform4ui), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glUniform1uiv", offsetof(GladGLContext, Uniform1uiv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glUniform2uiv", offsetof(GladGLContext, Uniform2uiv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glUniform3uiv", offsetof(GladGLContext, Uniform3uiv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glUniform4uiv", offsetof(GladGLContext, Uniform4uiv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glTexParameterIiv", offsetof(GladGLContext, TexParameterIiv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glTexParameterIuiv", offsetof(GladGLContext, TexParameterIuiv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glGetTexParameterIiv", offsetof(GladGLContext, GetTexParameterIiv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glGetTexParameterIuiv", offsetof(GladGLContext, GetTexParameterIuiv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glClearBufferiv", offsetof(GladGLContext, ClearBufferiv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glClearBufferuiv", offsetof(GladGLContext, ClearBufferuiv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glClearBufferfv", offsetof(GladGLContext, ClearBufferfv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glClearBufferfi", offsetof(GladGLContext, ClearBufferfi), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glGetStringi", offsetof(GladGLContext, GetStringi), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glIsRenderbuffer", offsetof(GladGLContext, IsRenderbuffer), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glBindRenderbuffer", offsetof(GladGLContext, BindRenderbuffer), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glDeleteRenderbuffers", offsetof(GladGLContext, DeleteRenderbuffers), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glGenRenderbuffers", offsetof(GladGLContext, GenRenderbuffers), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glRenderbufferStorage", offsetof(GladGLContext, RenderbufferStorage), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glGetRenderbufferParameteriv", offsetof(GladGLContext, GetRenderbufferParameteriv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glIsFramebuffer", offsetof(GladGLContext, IsFramebuffer), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glBindFramebuffer", offsetof(GladGLContext, BindFramebuffer), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glDeleteFramebuffers", offsetof(GladGLContext, DeleteFramebuffers), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glGenFramebuffers", offsetof(GladGLContext, GenFramebuffers), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glCheckFramebufferStatus", offsetof(GladGLContext, CheckFramebufferStatus), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glFramebufferTexture1D", offsetof(GladGLContext, FramebufferTexture1D), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glFramebufferTexture2D", offsetof(GladGLContext, FramebufferTexture2D), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glFramebufferTexture3D", offsetof(GladGLContext, FramebufferTexture3D), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glFramebufferRenderbuffer", offsetof(GladGLContext, FramebufferRenderbuffer), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glGetFramebufferAttachmentParameteriv", offsetof(GladGLContext, GetFramebufferAttachmentParameteriv), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glGenerateMipmap", offsetof(GladGLContext, GenerateMipmap), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glBlitFramebuffer", offsetof(GladGLContext, BlitFramebuffer), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glRenderbufferStorageMultisample", offsetof(GladGLContext, RenderbufferStorageMultisample), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glFramebufferTextureLayer", offsetof(GladGLContext, FramebufferTextureLayer), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glMapBufferRange", offsetof(GladGLContext, MapBufferRange), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glFlushMappedBufferRange", offsetof(GladGLContext, FlushMappedBufferRange), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glBindVertexArray", offsetof(GladGLContext, BindVertexArray), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glDeleteVertexArrays", offsetof(GladGLContext, DeleteVertexArrays), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glGenVertexArrays", offsetof(GladGLContext, GenVertexArrays), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glIsVertexArray", offsetof(GladGLContext, IsVertexArray), offsetof(GladGLContext, VERSION_3_0) },
+	{ "glDrawArraysInstanced", offsetof(GladGLContext, DrawArraysInstanced), offsetof(GladGLContext, VERSION_3_1) },
+	{ "glDrawElementsInstanced", offsetof(GladGLContext, DrawElementsInstanced), offsetof(GladGLContext, VERSION_3_1) },
+	{ "glTexBuffer", offsetof(GladGLContext, TexBuffer), offsetof(GladGLContext, VERSION_3_1) },
+	{ "glPrimitiveRestartIndex", offsetof(GladGLContext, PrimitiveRestartIndex), offsetof(GladGLContext, VERSION_3_1) },
+	{ "glCopyBufferSubData", offsetof(GladGLContext, CopyBufferSubData), offsetof(GladGLContext, VERSION_3_1) },
+	{ "glGetUniformIndices", offsetof(GladGLContext, GetUniformIndices), offsetof(GladGLContext, VERSION_3_1) },
+	{ "glGetActiveUniformsiv", offsetof(GladGLContext, GetActiveUniformsiv), offsetof(GladGLContext, VERSION_3_1) },
+	{ "glGetActiveUniformName", offsetof(GladGLContext, GetActiveUniformName), offsetof(GladGLContext, VERSION_3_1) },
+	{ "glGetUniformBlockIndex", offsetof(GladGLContext, GetUniformBlockIndex), offsetof(GladGLContext, VERSION_3_1) },
+	{ "glGetActiveUniformBlockiv", offsetof(GladGLContext, GetActiveUniformBlockiv), offsetof(GladGLContext, VERSION_3_1) },
+	{ "glGetActiveUniformBlockName", offsetof(GladGLContext, GetActiveUniformBlockName), offsetof(GladGLContext, VERSION_3_1) },
+	{ "glUniformBlockBinding", offsetof(GladGLContext, UniformBlockBinding), offsetof(GladGLContext, VERSION_3_1) },
+	{ "glBindBufferRange", offsetof(GladGLContext, BindBufferRange), offsetof(GladGLContext, VERSION_3_1) },
+	{ "glBindBufferBase", offsetof(GladGLContext, BindBufferBase), offsetof(GladGLContext, VERSION_3_1) },
+	{ "glGetIntegeri_v", offsetof(GladGLContext, GetIntegeri_v), offsetof(GladGLContext, VERSION_3_1) },
+	{ "glDrawElementsBaseVertex", offsetof(GladGLContext, DrawElementsBaseVertex), offsetof(GladGLContext, VERSION_3_2) },
+	{ "glDrawRangeElementsBaseVertex", offsetof(GladGLContext, DrawRangeElementsBaseVertex), offsetof(GladGLContext, VERSION_3_2) },
+	{ "glDrawElementsInstancedBaseVertex", offsetof(GladGLContext, DrawElementsInstancedBaseVertex), offsetof(GladGLContext, VERSION_3_2) },
+	{ "glMultiDrawElementsBaseVertex", offsetof(GladGLContext, MultiDrawElementsBaseVertex), offsetof(GladGLContext, VERSION_3_2) },
+	{ "glProvokingVertex", offsetof(GladGLContext, ProvokingVertex), offsetof(GladGLContext, VERSION_3_2) },
+	{ "glFenceSync", offsetof(GladGLContext, FenceSync), offsetof(GladGLContext, VERSION_3_2) },
+	{ "glIsSync", offsetof(GladGLContext, IsSync), offsetof(GladGLContext, VERSION_3_2) },
+	{ "glDeleteSync", offsetof(GladGLContext, DeleteSync), offsetof(GladGLContext, VERSION_3_2) },
+	{ "glClientWaitSync", offsetof(GladGLContext, ClientWaitSync), offsetof(GladGLContext, VERSION_3_2) },
+	{ "glWaitSync", offsetof(GladGLContext, WaitSync), offsetof(GladGLContext, VERSION_3_2) },
+	{ "glGetInteger64v", offsetof(GladGLContext, GetInteger64v), offsetof(GladGLContext, VERSION_3_2) },
+	{ "glGetSynciv", offsetof(GladGLContext, GetSynciv), offsetof(GladGLContext, VERSION_3_2) },
+	{ "glGetInteger64i_v", offsetof(GladGLContext, GetInteger64i_v), offsetof(GladGLContext, VERSION_3_2) },
+	{ "glGetBufferParameteri64v", offsetof(GladGLContext, GetBufferParameteri64v), offsetof(GladGLContext, VERSION_3_2) },
+	{ "glFramebufferTexture", offsetof(GladGLContext, FramebufferTexture), offsetof(GladGLContext, VERSION_3_2) },
+	{ "glTexImage2DMultisample", offsetof(GladGLContext, TexImage2DMultisample), offsetof(GladGLContext, VERSION_3_2) },
+	{ "glTexImage3DMultisample", offsetof(GladGLContext, TexImage3DMultisample), offsetof(GladGLContext, VERSION_3_2) },
+	{ "glGetMultisamplefv", offsetof(GladGLContext, GetMultisamplefv), offsetof(GladGLContext, VERSION_3_2) },
+	{ "glSampleMaski", offsetof(GladGLContext, SampleMaski), offsetof(GladGLContext, VERSION_3_2) },
+	{ "glBindFragDataLocationIndexed", offsetof(GladGLContext, BindFragDataLocationIndexed), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glGetFragDataIndex", offsetof(GladGLContext, GetFragDataIndex), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glGenSamplers", offsetof(GladGLContext, GenSamplers), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glDeleteSamplers", offsetof(GladGLContext, DeleteSamplers), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glIsSampler", offsetof(GladGLContext, IsSampler), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glBindSampler", offsetof(GladGLContext, BindSampler), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glSamplerParameteri", offsetof(GladGLContext, SamplerParameteri), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glSamplerParameteriv", offsetof(GladGLContext, SamplerParameteriv), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glSamplerParameterf", offsetof(GladGLContext, SamplerParameterf), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glSamplerParameterfv", offsetof(GladGLContext, SamplerParameterfv), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glSamplerParameterIiv", offsetof(GladGLContext, SamplerParameterIiv), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glSamplerParameterIuiv", offsetof(GladGLContext, SamplerParameterIuiv), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glGetSamplerParameteriv", offsetof(GladGLContext, GetSamplerParameteriv), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glGetSamplerParameterIiv", offsetof(GladGLContext, GetSamplerParameterIiv), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glGetSamplerParameterfv", offsetof(GladGLContext, GetSamplerParameterfv), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glGetSamplerParameterIuiv", offsetof(GladGLContext, GetSamplerParameterIuiv), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glQueryCounter", offsetof(GladGLContext, QueryCounter), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glGetQueryObjecti64v", offsetof(GladGLContext, GetQueryObjecti64v), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glGetQueryObjectui64v", offsetof(GladGLContext, GetQueryObjectui64v), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glVertexAttribDivisor", offsetof(GladGLContext, VertexAttribDivisor), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glVertexAttribP1ui", offsetof(GladGLContext, VertexAttribP1ui), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glVertexAttribP1uiv", offsetof(GladGLContext, VertexAttribP1uiv), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glVertexAttribP2ui", offsetof(GladGLContext, VertexAttribP2ui), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glVertexAttribP2uiv", offsetof(GladGLContext, VertexAttribP2uiv), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glVertexAttribP3ui", offsetof(GladGLContext, VertexAttribP3ui), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glVertexAttribP3uiv", offsetof(GladGLContext, VertexAttribP3uiv), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glVertexAttribP4ui", offsetof(GladGLContext, VertexAttribP4ui), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glVertexAttribP4uiv", offsetof(GladGLContext, VertexAttribP4uiv), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glVertexP2ui", offsetof(GladGLContext, VertexP2ui), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glVertexP2uiv", offsetof(GladGLContext, VertexP2uiv), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glVertexP3ui", offsetof(GladGLContext, VertexP3ui), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glVertexP3uiv", offsetof(GladGLContext, VertexP3uiv), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glVertexP4ui", offsetof(GladGLContext, VertexP4ui), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glVertexP4uiv", offsetof(GladGLContext, VertexP4uiv), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glTexCoordP1ui", offsetof(GladGLContext, TexCoordP1ui), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glTexCoordP1uiv", offsetof(GladGLContext, TexCoordP1uiv), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glTexCoordP2ui", offsetof(GladGLContext, TexCoordP2ui), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glTexCoordP2uiv", offsetof(GladGLContext, TexCoordP2uiv), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glTexCoordP3ui", offsetof(GladGLContext, TexCoordP3ui), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glTexCoordP3uiv", offsetof(GladGLContext, TexCoordP3uiv), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glTexCoordP4ui", offsetof(GladGLContext, TexCoordP4ui), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glTexCoordP4uiv", offsetof(GladGLContext, TexCoordP4uiv), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glMultiTexCoordP1ui", offsetof(GladGLContext, MultiTexCoordP1ui), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glMultiTexCoordP1uiv", offsetof(GladGLContext, MultiTexCoordP1uiv), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glMultiTexCoordP2ui", offsetof(GladGLContext, MultiTexCoordP2ui), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glMultiTexCoordP2uiv", offsetof(GladGLContext, MultiTexCoordP2uiv), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glMultiTexCoordP3ui", offsetof(GladGLContext, MultiTexCoordP3ui), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glMultiTexCoordP3uiv", offsetof(GladGLContext, MultiTexCoordP3uiv), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glMultiTexCoordP4ui", offsetof(GladGLContext, MultiTexCoordP4ui), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glMultiTexCoordP4uiv", offsetof(GladGLContext, MultiTexCoordP4uiv), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glNormalP3ui", offsetof(GladGLContext, NormalP3ui), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glNormalP3uiv", offsetof(GladGLContext, NormalP3uiv), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glColorP3ui", offsetof(GladGLContext, ColorP3ui), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glColorP3uiv", offsetof(GladGLContext, ColorP3uiv), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glColorP4ui", offsetof(GladGLContext, ColorP4ui), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glColorP4uiv", offsetof(GladGLContext, ColorP4uiv), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glSecondaryColorP3ui", offsetof(GladGLContext, SecondaryColorP3ui), offsetof(GladGLContext, VERSION_3_3) },
+	{ "glSecondaryColorP3uiv", offsetof(GladGLContext, SecondaryColorP3uiv), offsetof(GladGLContext, VERSION_3_3) },
+};
+
+static const glad_context_entry glad_context_extensions[] = {
+	{ "glGetProgramBinary", offsetof(GladGLContext, GetProgramBinary), offsetof(GladGLContext, ARB_get_program_binary) },
+	{ "glProgramBinary", offsetof(GladGLContext, ProgramBinary), offsetof(GladGLContext, ARB_get_program_binary) },
+	{ "glProgramParameteri", offsetof(GladGLContext, ProgramParameteri), offsetof(GladGLContext, ARB_get_program_binary) },
+	{ "glMaxShaderCompilerThreadsKHR", offsetof(GladGLContext, MaxShaderCompilerThreadsKHR), offsetof(GladGLContext, KHR_parallel_shader_compile) },
+	{ "glBufferStorage", offsetof(GladGLContext, BufferStorage), offsetof(GladGLContext, ARB_buffer_storage) },
+};
+
+static const struct {
+    const char *name;
+    size_t feature;
+} glad_context_extension_names[] = {
+	{ "GL_ARB_get_program_binary", offsetof(GladGLContext, ARB_get_program_binary) },
+	{ "GL_KHR_parallel_shader_compile", offsetof(GladGLContext, KHR_parallel_shader_compile) },
+	{ "GL_ARB_buffer_storage", offsetof(GladGLContext, ARB_buffer_storage) },
+};
+
+static void load_context_entries(GladGLContext *context, GLADloadproc load, const glad_context_entry *entries, size_t count) {
+    size_t i;
+    for(i = 0; i < count; i++) {
+        void **function = (void **)((char *)context + entries[i].function);
+        if(*function == NULL && *(int *)((char *)context + entries[i].feature)) {
+            *function = load(entries[i].name);
+        }
+    }
+}
+
+int gladLoadGLContext(GladGLContext *context, GLADloadproc load) {
+    const char *version;
+    const char *prefixes[] = { "OpenGL ES-CM ", "OpenGL ES-CL ", "OpenGL ES ", NULL };
+    int i, major = 0, minor = 0;
+    size_t e;
+
+    gladUnloadGLContext(context);
+    context->GetString = (PFNGLGETSTRINGPROC)load("glGetString");
+    if(context->GetString == NULL) return 0;
+    version = (const char *)context->GetString(GL_VERSION);
+    if(version == NULL) return 0;
+
+    /* the same parsing as find_coreGL */
+    for(i = 0; prefixes[i]; i++) {
+        const size_t length = strlen(prefixes[i]);
+        if(strncmp(version, prefixes[i], length) == 0) {
+            version += length;
+            break;
+        }
+    }
+#ifdef _MSC_VER
+    sscanf_s(version, "%d.%d", &major, &minor);
+#else
+    sscanf(version, "%d.%d", &major, &minor);
+#endif
+    context->version.major = major; context->version.minor = minor;
+	context->VERSION_1_0 = (major == 1 && minor >= 0) || major > 1;
+	context->VERSION_1_1 = (major == 1 && minor >= 1) || major > 1;
+	context->VERSION_1_2 = (major == 1 && minor >= 2) || major > 1;
+	context->VERSION_1_3 = (major == 1 && minor >= 3) || major > 1;
+	context->VERSION_1_4 = (major == 1 && minor >= 4) || major > 1;
+	context->VERSION_1_5 = (major == 1 && minor >= 5) || major > 1;
+	context->VERSION_2_0 = (major == 2 && minor >= 0) || major > 2;
+	context->VERSION_2_1 = (major == 2 && minor >= 1) || major > 2;
+	context->VERSION_3_0 = (major == 3 && minor >= 0) || major > 3;
+	context->VERSION_3_1 = (major == 3 && minor >= 1) || major > 3;
+	context->VERSION_3_2 = (major == 3 && minor >= 2) || major > 3;
+	context->VERSION_3_3 = (major == 3 && minor >= 3) || major > 3;
+
+    load_context_entries(context, load, glad_context_versions, sizeof(glad_context_versions) / sizeof(glad_context_versions[0]));
+    context->extensions = build_exts(major, context->GetString, context->GetIntegerv, context->GetStringi);
+    if(context->extensions == NULL) return 0;
+    for(e = 0; e < sizeof(glad_context_extension_names) / sizeof(glad_context_extension_names[0]); e++) {
+        *(int *)((char *)context + glad_context_extension_names[e].feature) = find_ext(context->extensions, glad_context_extension_names[e].name);
+    }
+    load_context_entries(context, load, glad_context_extensions, sizeof(glad_context_extensions) / sizeof(glad_context_extensions[0]));
+    return major != 0 || minor != 0;
+}
+
+void gladUnloadGLContext(GladGLContext *context) {
+    free(context->extensions);
+    memset(context, 0, sizeof(*context));
+}
+
+int gladContextHasExtension(const GladGLContext *context, const char *ext) {
+    return context != NULL && find_ext(context->extensions, ext);
+}
+/* glad_extras.py: end context */
@@ -0,0 +1,6657 @@
+/*
+ * GL call tracing for glad, see glad_trace.h. The shims between the glad_extras.py markers are
+ * generated from glad.h and glad.c by glad/tools/glad_extras.py; rerun it when entry points change.
+ */
+
+#if !defined(_WIN32) && !defined(__CYGWIN__) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L /* ftruncate */
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <glad/glad_trace.h>
+
+#if defined(_WIN32) || defined(__CYGWIN__)
+#ifndef _WINDOWS_
+#undef APIENTRY
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+/* ----- the trace file, mapped and grown by doubling */
+
+static struct {
+#if defined(_WIN32) || defined(__CYGWIN__)
+    HANDLE file;
+    HANDLE mapping;
+#else
+    int file;
+#endif
+    char *data;
+    size_t capacity;
+    size_t used;
+    uint64_t frames;
+    int open;   /* from gladTraceBegin to gladTraceEnd, even after tracing had to stop */
+    int active;
+} trace_file;
+
+static void trace_unmap_file(void) {
+    if(trace_file.data == NULL) return;
+#if defined(_WIN32) || defined(__CYGWIN__)
+    UnmapViewOfFile(trace_file.data);
+    CloseHandle(trace_file.mapping);
+    trace_file.mapping = NULL;
+#else
+    munmap(trace_file.data, trace_file.capacity);
+#endif
+    trace_file.data = NULL;
+}
+
+static int trace_map_file(size_t capacity) {
+#if defined(_WIN32) || defined(__CYGWIN__)
+    trace_file.mapping = CreateFileMappingA(trace_file.file, NULL, PAGE_READWRITE,
+        (DWORD)((unsigned long long)capacity >> 32), (DWORD)(capacity & 0xFFFFFFFFu), NULL);
+    if(trace_file.mapping == NULL) return 0;
+    trace_file.data = (char *)MapViewOfFile(trace_file.mapping, FILE_MAP_WRITE, 0, 0, capacity);
+    if(trace_file.data == NULL) {
+        CloseHandle(trace_file.mapping);
+        trace_file.mapping = NULL;
+        return 0;
+    }
+#else
+    void *data;
+    if(ftruncate(trace_file.file, (off_t)capacity) != 0) return 0;
+    data = mmap(NULL, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, trace_file.file, 0);
+    if(data == MAP_FAILED) return 0;
+    trace_file.data = (char *)data;
+#endif
+    trace_file.capacity = capacity;
+    return 1;
+}
+
+static void trace_sync_header(void) {
+    GladTraceHeader *header = (GladTraceHeader *)trace_file.data;
+    header->recordBytes = trace_file.used - sizeof(GladTraceHeader);
+    header->frameCount = trace_file.frames;
+}
+
+/* space for size more bytes; on failure tracing stops, the trace keeps what it has */
+static char *trace_reserve(size_t size) {
+    if(trace_file.used + size > trace_file.capacity) {
+        size_t capacity = trace_file.capacity;
+        while(trace_file.used + size > capacity) {
+            capacity *= 2;
+        }
+        trace_sync_header();
+        trace_unmap_file();
+        if(!trace_map_file(capacity)) {
+            fprintf(stderr, "glad trace: can't grow the trace to %lu bytes, stopping\n", (unsigned long)capacity);
+            trace_file.active = 0;
+            return NULL;
+        }
+    }
+    return trace_file.data + trace_file.used;
+}
+
+/* ----- payloads: each one written once, under its FNV-1a 64 hash */
+
+typedef struct {
+    uint64_t key;       /* the hash, or past it if another payload had the same hash; 0 is free */
+    size_t record;      /* where the payload's record starts in the trace */
+} trace_blob_entry;
+
+static struct {
+    trace_blob_entry *entries;
+    size_t mask;
+    size_t count;
+} trace_blobs;
+
+static uint64_t trace_hash(const void *data, size_t size) {
+    const unsigned char *bytes = (const unsigned char *)data;
+    uint64_t hash = 14695981039346656037ull;
+    size_t i;
+    for(i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 1099511628211ull;
+    }
+    return hash != 0 ? hash : 1; /* 0 stands for NULL */
+}
+
+static int trace_blob_grow(void) {
+    size_t old_size = trace_blobs.mask + 1, i, slot;
+    trace_blob_entry *old = trace_blobs.entries;
+    trace_blob_entry *entries = (trace_blob_entry *)calloc(old_size * 2, sizeof(trace_blob_entry));
+    if(entries == NULL) return 0;
+    trace_blobs.entries = entries;
+    trace_blobs.mask = old_size * 2 - 1;
+    for(i = 0; i < old_size; i++) {
+        if(old[i].key == 0) continue;
+        for(slot = old[i].key & trace_blobs.mask; entries[slot].key != 0; slot = (slot + 1) & trace_blobs.mask);
+        entries[slot] = old[i];
+    }
+    free(old);
+    return 1;
+}
+
+static int trace_blob_matches(const trace_blob_entry *entry, const void *data, size_t size) {
+    const GladTraceRecord *record = (const GladTraceRecord *)(trace_file.data + entry->record);
+    return record->size == size && memcmp(trace_file.data + entry->record + sizeof(GladTraceRecord) + 8, data, size) == 0;
+}
+
+/* the entry holding this payload, or the free one to put it in; *key starts out as the payload's hash
+ * and moves past payloads that only share the hash, so a key always stands for one payload */
+static trace_blob_entry *trace_blob_find(uint64_t *key, const void *data, size_t size) {
+    for(;;) {
+        size_t slot;
+        for(slot = *key & trace_blobs.mask; trace_blobs.entries[slot].key != 0; slot = (slot + 1) & trace_blobs.mask) {
+            if(trace_blobs.entries[slot].key == *key) break;
+        }
+        if(trace_blobs.entries[slot].key == 0 || trace_blob_matches(&trace_blobs.entries[slot], data, size)) {
+            return &trace_blobs.entries[slot];
+        }
+        *key = *key + 1 != 0 ? *key + 1 : 1;
+    }
+}
+
+static uint64_t trace_blob(const void *data, size_t size) {
+    uint64_t key;
+    trace_blob_entry *entry;
+    GladTraceRecord *record;
+    char *out;
+    size_t padded = (size + 7) & ~(size_t)7;
+
+    if(data == NULL || !trace_file.active) return 0;
+    if(trace_blobs.count * 2 >= trace_blobs.mask + 1 && !trace_blob_grow() && trace_blobs.count == trace_blobs.mask) {
+        fprintf(stderr, "glad trace: out of memory for the payload set, stopping\n");
+        trace_file.active = 0;
+        return 0;
+    }
+    key = trace_hash(data, size);
+    entry = trace_blob_find(&key, data, size);
+    if(entry->key != 0) return key;
+
+    if(size > 0xFFFFFFFFu || (out = trace_reserve(sizeof(GladTraceRecord) + 8 + padded)) == NULL) return 0;
+    record = (GladTraceRecord *)out;
+    record->id = GLAD_TRACE_RECORD_BLOB;
+    record->argCount = 0;
+    record->hasReturn = 0;
+    record->size = (uint32_t)size;
+    memcpy(out + sizeof(GladTraceRecord), &key, 8);
+    memcpy(out + sizeof(GladTraceRecord) + 8, data, size);
+    memset(out + sizeof(GladTraceRecord) + 8 + size, 0, padded - size);
+    entry->key = key;
+    entry->record = trace_file.used;
+    trace_blobs.count++;
+    trace_file.used += sizeof(GladTraceRecord) + 8 + padded;
+    return key;
+}
+
+/* the strings back to back, each null terminated, as one payload */
+static uint64_t trace_strings(GLsizei count, const GLchar *const *strings, const GLint *lengths) {
+    size_t size = 0;
+    char *joined;
+    uint64_t hash;
+    GLsizei i;
+
+    if(strings == NULL || count <= 0) return 0;
+    for(i = 0; i < count; i++) {
+        size += (lengths != NULL && lengths[i] >= 0 ? (size_t)lengths[i] : strlen(strings[i])) + 1;
+    }
+    joined = (char *)malloc(size);
+    if(joined == NULL) return 0;
+
+    size = 0;
+    for(i = 0; i < count; i++) {
+        size_t length = lengths != NULL && lengths[i] >= 0 ? (size_t)lengths[i] : strlen(strings[i]);
+        memcpy(joined + size, strings[i], length);
+        joined[size + length] = '\0';
+        size += length + 1;
+    }
+    hash = trace_blob(joined, size);
+    free(joined);
+    return hash;
+}
+
+static void trace_record(unsigned int id, const uint64_t *args, unsigned int count, const uint64_t *result) {
+    size_t size = sizeof(GladTraceRecord) + 8 * (count + (result != NULL));
+    GladTraceRecord *record;
+    char *out;
+
+    if(!trace_file.active || (out = trace_reserve(size)) == NULL) return;
+    record = (GladTraceRecord *)out;
+    record->id = (uint16_t)id;
+    record->argCount = (uint8_t)count;
+    record->hasReturn = result != NULL;
+    record->size = 0;
+    if(count > 0) memcpy(out + sizeof(GladTraceRecord), args, 8 * count);
+    if(result != NULL) memcpy(out + sizeof(GladTraceRecord) + 8 * count, result, 8);
+    trace_file.used += size;
+}
+
+static uint64_t trace_integer(int64_t value) { return (uint64_t)value; }
+static uint64_t trace_pointer(const void *value) { return (uint64_t)(uintptr_t)value; }
+
+static uint64_t trace_float(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, 4);
+    return bits;
+}
+
+static uint64_t trace_double(double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, 8);
+    return bits;
+}
+
+static float replay_float(uint64_t slot) {
+    uint32_t bits = (uint32_t)slot;
+    float value;
+    memcpy(&value, &bits, 4);
+    return value;
+}
+
+static double replay_double(uint64_t slot) {
+    double value;
+    memcpy(&value, &slot, 8);
+    return value;
+}
+
+/* ----- mapped buffers: what the application wrote is only known once it flushes or unmaps */
+
+#define GLAD_TRACE_MAX_MAPPINGS 16
+
+static struct {
+    GLenum target;
+    char *data;
+    size_t length;
+    int flushed_explicitly;
+} trace_mappings[GLAD_TRACE_MAX_MAPPINGS];
+
+static int trace_find_mapping(GLenum target) {
+    int i;
+    for(i = 0; i < GLAD_TRACE_MAX_MAPPINGS; i++) {
+        if(trace_mappings[i].data != NULL && trace_mappings[i].target == target) return i;
+    }
+    return -1;
+}
+
+static void trace_mapped_write(GLenum target, GLintptr offset, GLsizeiptr length) {
+    uint64_t args[4];
+    int mapping = trace_find_mapping(target);
+    if(mapping < 0 || offset < 0 || length <= 0 || (size_t)(offset + length) > trace_mappings[mapping].length) return;
+
+    args[0] = target;
+    args[1] = (uint64_t)offset;
+    args[2] = (uint64_t)length;
+    args[3] = trace_blob(trace_mappings[mapping].data + offset, (size_t)length);
+    trace_record(GLAD_TRACE_RECORD_MAPPED_WRITE, args, 4, NULL);
+}
+
+static void trace_map(GLenum target, void *data, size_t length, GLbitfield access) {
+    int i;
+    if(data == NULL || !(access & GL_MAP_WRITE_BIT)) return;
+    for(i = 0; i < GLAD_TRACE_MAX_MAPPINGS; i++) {
+        if(trace_mappings[i].data == NULL) {
+            trace_mappings[i].target = target;
+            trace_mappings[i].data = (char *)data;
+            trace_mappings[i].length = length;
+            trace_mappings[i].flushed_explicitly = (access & GL_MAP_FLUSH_EXPLICIT_BIT) != 0;
+            return;
+        }
+    }
+}
+
+static void trace_map_buffer(GLenum target, void *data, GLenum access);
+
+static void trace_unmap(GLenum target) {
+    int mapping = trace_find_mapping(target);
+    if(mapping < 0) return;
+    if(!trace_mappings[mapping].flushed_explicitly) {
+        trace_mapped_write(target, 0, (GLsizeiptr)trace_mappings[mapping].length);
+    }
+    trace_mappings[mapping].data = NULL;
+}
+
+/* glad_extras.py: begin trace */
+/* ----- one shim per entry point, the metadata glreplay needs and the replay calls */
+
+enum {
+	GLAD_TRACE_ID_glCullFace = 0,
+	GLAD_TRACE_ID_glFrontFace = 1,
+	GLAD_TRACE_ID_glHint = 2,
+	GLAD_TRACE_ID_glLineWidth = 3,
+	GLAD_TRACE_ID_glPointSize = 4,
+	GLAD_TRACE_ID_glPolygonMode = 5,
+	GLAD_TRACE_ID_glScissor = 6,
+	GLAD_TRACE_ID_glTexParameterf = 7,
+	GLAD_TRACE_ID_glTexParameterfv = 8,
+	GLAD_TRACE_ID_glTexParameteri = 9,
+	GLAD_TRACE_ID_glTexParameteriv = 10,
+	GLAD_TRACE_ID_glTexImage1D = 11,
+	GLAD_TRACE_ID_glTexImage2D = 12,
+	GLAD_TRACE_ID_glDrawBuffer = 13,
+	GLAD_TRACE_ID_glClear = 14,
+	GLAD_TRACE_ID_glClearColor = 15,
+	GLAD_TRACE_ID_glClearStencil = 16,
+	GLAD_TRACE_ID_glClearDepth = 17,
+	GLAD_TRACE_ID_glStencilMask = 18,
+	GLAD_TRACE_ID_glColorMask = 19,
+	GLAD_TRACE_ID_glDepthMask = 20,
+	GLAD_TRACE_ID_glDisable = 21,
+	GLAD_TRACE_ID_glEnable = 22,
+	GLAD_TRACE_ID_glFinish = 23,
+	GLAD_TRACE_ID_glFlush = 24,
+	GLAD_TRACE_ID_glBlendFunc = 25,
+	GLAD_TRACE_ID_glLogicOp = 26,
+	GLAD_TRACE_ID_glStencilFunc = 27,
+	GLAD_TRACE_ID_glStencilOp = 28,
+	GLAD_TRACE_ID_glDepthFunc = 29,
+	GLAD_TRACE_ID_glPixelStoref = 30,
+	GLAD_TRACE_ID_glPixelStorei = 31,
+	GLAD_TRACE_ID_glReadBuffer = 32,
+	GLAD_TRACE_ID_glReadPixels = 33,
+	GLAD_TRACE_ID_glGetBooleanv = 34,
+	GLAD_TRACE_ID_glGetDoublev = 35,
+	GLAD_TRACE_ID_glGetError = 36,
+	GLAD_TRACE_ID_glGetFloatv = 37,
+	GLAD_TRACE_ID_glGetIntegerv = 38,
+	GLAD_TRACE_ID_glGetString = 39,
+	GLAD_TRACE_ID_glGetTexImage = 40,
+	GLAD_TRACE_ID_glGetTexParameterfv = 41,
+	GLAD_TRACE_ID_glGetTexParameteriv = 42,
+	GLAD_TRACE_ID_glGetTexLevelParameterfv = 43,
+	GLAD_TRACE_ID_glGetTexLevelParameteriv = 44,
+	GLAD_TRACE_ID_glIsEnabled = 45,
+	GLAD_TRACE_ID_glDepthRange = 46,
+	GLAD_TRACE_ID_glViewport = 47,
+	GLAD_TRACE_ID_glDrawArrays = 48,
+	GLAD_TRACE_ID_glDrawElements = 49,
+	GLAD_TRACE_ID_glPolygonOffset = 50,
+	GLAD_TRACE_ID_glCopyTexImage1D = 51,
+	GLAD_TRACE_ID_glCopyTexImage2D = 52,
+	GLAD_TRACE_ID_glCopyTexSubImage1D = 53,
+	GLAD_TRACE_ID_glCopyTexSubImage2D = 54,
+	GLAD_TRACE_ID_glTexSubImage1D = 55,
+	GLAD_TRACE_ID_glTexSubImage2D = 56,
+	GLAD_TRACE_ID_glBindTexture = 57,
+	GLAD_TRACE_ID_glDeleteTextures = 58,
+	GLAD_TRACE_ID_glGenTextures = 59,
+	GLAD_TRACE_ID_glIsTexture = 60,
+	GLAD_TRACE_ID_glDrawRangeElements = 61,
+	GLAD_TRACE_ID_glTexImage3D = 62,
+	GLAD_TRACE_ID_glTexSubImage3D = 63,
+	GLAD_TRACE_ID_glCopyTexSubImage3D = 64,
+	GLAD_TRACE_ID_glActiveTexture = 65,
+	GLAD_TRACE_ID_glSampleCoverage = 66,
+	GLAD_TRACE_ID_glCompressedTexImage3D = 67,
+	GLAD_TRACE_ID_glCompressedTexImage2D = 68,
+	GLAD_TRACE_ID_glCompressedTexImage1D = 69,
+	GLAD_TRACE_ID_glCompressedTexSubImage3D = 70,
+	GLAD_TRACE_ID_glCompressedTexSubImage2D = 71,
+	GLAD_TRACE_ID_glCompressedTexSubImage1D = 72,
+	GLAD_TRACE_ID_glGetCompressedTexImage = 73,
+	GLAD_TRACE_ID_glBlendFuncSeparate = 74,
+	GLAD_TRACE_ID_glMultiDrawArrays = 75,
+	GLAD_TRACE_ID_glMultiDrawElements = 76,
+	GLAD_TRACE_ID_glPointParameterf = 77,
+	GLAD_TRACE_ID_glPointParameterfv = 78,
+	GLAD_TRACE_ID_glPointParameteri = 79,
+	GLAD_TRACE_ID_glPointParameteriv = 80,
+	GLAD_TRACE_ID_glBlendColor = 81,
+	GLAD_TRACE_ID_glBlendEquation = 82,
+	GLAD_TRACE_ID_glGenQueries = 83,
+	GLAD_TRACE_ID_glDeleteQueries = 84,
+	GLAD_TRACE_ID_glIsQuery = 85,
+	GLAD_TRACE_ID_glBeginQuery = 86,
+	GLAD_TRACE_ID_glEndQuery = 87,
+	GLAD_TRACE_ID_glGetQueryiv = 88,
+	GLAD_TRACE_ID_glGetQueryObjectiv = 89,
+	GLAD_TRACE_ID_glGetQueryObjectuiv = 90,
+	GLAD_TRACE_ID_glBindBuffer = 91,
+	GLAD_TRACE_ID_glDeleteBuffers = 92,
+	GLAD_TRACE_ID_glGenBuffers = 93,
+	GLAD_TRACE_ID_glIsBuffer = 94,
+	GLAD_TRACE_ID_glBufferData = 95,
+	GLAD_TRACE_ID_glBufferSubData = 96,
+	GLAD_TRACE_ID_glGetBufferSubData = 97,
+	GLAD_TRACE_ID_glMapBuffer = 98,
+	GLAD_TRACE_ID_glUnmapBuffer = 99,
+	GLAD_TRACE_ID_glGetBufferParameteriv = 100,
+	GLAD_TRACE_ID_glGetBufferPointerv = 101,
+	GLAD_TRACE_ID_glBlendEquationSeparate = 102,
+	GLAD_TRACE_ID_glDrawBuffers = 103,
+	GLAD_TRACE_ID_glStencilOpSeparate = 104,
+	GLAD_TRACE_ID_glStencilFuncSeparate = 105,
+	GLAD_TRACE_ID_glStencilMaskSeparate = 106,
+	GLAD_TRACE_ID_glAttachShader = 107,
+	GLAD_TRACE_ID_glBindAttribLocation = 108,
+	GLAD_TRACE_ID_glCompileShader = 109,
+	GLAD_TRACE_ID_glCreateProgram = 110,
+	GLAD_TRACE_ID_glCreateShader = 111,
+	GLAD_TRACE_ID_glDeleteProgram = 112,
+	GLAD_TRACE_ID_glDeleteShader = 113,
+	GLAD_TRACE_ID_glDetachShader = 114,
+	GLAD_TRACE_ID_glDisableVertexAttribArray = 115,
+	GLAD_TRACE_ID_glEnableVertexAttribArray = 116,
+	GLAD_TRACE_ID_glGetActiveAttrib = 117,
+	GLAD_TRACE_ID_glGetActiveUniform = 118,
+	GLAD_TRACE_ID_glGetAttachedShaders = 119,
+	GLAD_TRACE_ID_glGetAttribLocation = 120,
+	GLAD_TRACE_ID_glGetProgramiv = 121,
+	GLAD_TRACE_ID_glGetProgramInfoLog = 122,
+	GLAD_TRACE_ID_glGetShaderiv = 123,
+	GLAD_TRACE_ID_glGetShaderInfoLog = 124,
+	GLAD_TRACE_ID_glGetShaderSource = 125,
+	GLAD_TRACE_ID_glGetUniformLocation = 126,
+	GLAD_TRACE_ID_glGetUniformfv = 127,
+	GLAD_TRACE_ID_glGetUniformiv = 128,
+	GLAD_TRACE_ID_glGetVertexAttribdv = 129,
+	GLAD_TRACE_ID_glGetVertexAttribfv = 130,
+	GLAD_TRACE_ID_glGetVertexAttribiv = 131,
+	GLAD_TRACE_ID_glGetVertexAttribPointerv = 132,
+	GLAD_TRACE_ID_glIsProgram = 133,
+	GLAD_TRACE_ID_glIsShader = 134,
+	GLAD_TRACE_ID_glLinkProgram = 135,
+	GLAD_TRACE_ID_glShaderSource = 136,
+	GLAD_TRACE_ID_glUseProgram = 137,
+	GLAD_TRACE_ID_glUniform1f = 138,
+	GLAD_TRACE_ID_glUniform2f = 139,
+	GLAD_TRACE_ID_glUniform3f = 140,
+	GLAD_TRACE_ID_glUniform4f = 141,
+	GLAD_TRACE_ID_glUniform1i = 142,
+	GLAD_TRACE_ID_glUniform2i = 143,
+	GLAD_TRACE_ID_glUniform3i = 144,
+	GLAD_TRACE_ID_glUniform4i = 145,
+	GLAD_TRACE_ID_glUniform1fv = 146,
+	GLAD_TRACE_ID_glUniform2fv = 147,
+	GLAD_TRACE_ID_glUniform3fv = 148,
+	GLAD_TRACE_ID_glUniform4fv = 149,
+	GLAD_TRACE_ID_glUniform1iv = 150,
+	GLAD_TRACE_ID_glUniform2iv = 151,
+	GLAD_TRACE_ID_glUniform3iv = 152,
+	GLAD_TRACE_ID_glUniform4iv = 153,
+	GLAD_TRACE_ID_glUniformMatrix2fv = 154,
+	GLAD_TRACE_ID_glUniformMatrix3fv = 155,
+	GLAD_TRACE_ID_glUniformMatrix4fv = 156,
+	GLAD_TRACE_ID_glValidateProgram = 157,
+	GLAD_TRACE_ID_glVertexAttrib1d = 158,
+	GLAD_TRACE_ID_glVertexAttrib1dv = 159,
+	GLAD_TRACE_ID_glVertexAttrib1f = 160,
+	GLAD_TRACE_ID_glVertexAttrib1fv = 161,
+	GLAD_TRACE_ID_glVertexAttrib1s = 162,
+	GLAD_TRACE_ID_glVertexAttrib1sv = 163,
+	GLAD_TRACE_ID_glVertexAttrib2d = 164,
+	GLAD_TRACE_ID_glVertexAttrib2dv = 165,
+	GLAD_TRACE_ID_glVertexAttrib2f = 166,
+	GLAD_TRACE_ID_glVertexAttrib2fv = 167,
+	GLAD_TRACE_ID_glVertexAttrib2s = 168,
+	GLAD_TRACE_ID_glVertexAttrib2sv = 169,
+	GLAD_TRACE_ID_glVertexAttrib3d = 170,
+	GLAD_TRACE_ID_glVertexAttrib3dv = 171,
+	GLAD_TRACE_ID_glVertexAttrib3f = 172,
+	GLAD_TRACE_ID_glVertexAttrib3fv = 173,
+	GLAD_TRACE_ID_glVertexAttrib3s = 174,
+	GLAD_TRACE_ID_glVertexAttrib3sv = 175,
+	GLAD_TRACE_ID_glVertexAttrib4Nbv = 176,
+	GLAD_TRACE_ID_glVertexAttrib4Niv = 177,
+	GLAD_TRACE_ID_glVertexAttrib4Nsv = 178,
+	GLAD_TRACE_ID_glVertexAttrib4Nub = 179,
+	GLAD_TRACE_ID_glVertexAttrib4Nubv = 180,
+	GLAD_TRACE_ID_glVertexAttrib4Nuiv = 181,
+	GLAD_TRACE_ID_glVertexAttrib4Nusv = 182,
+	GLAD_TRACE_ID_glVertexAttrib4bv = 183,
+	GLAD_TRACE_ID_glVertexAttrib4d = 184,
+	GLAD_TRACE_ID_glVertexAttrib4dv = 185,
+	GLAD_TRACE_ID_glVertexAttrib4f = 186,
+	GLAD_TRACE_ID_glVertexAttrib4fv = 187,
+	GLAD_TRACE_ID_glVertexAttrib4iv = 188,
+	GLAD_TRACE_ID_glVertexAttrib4s = 189,
+	GLAD_TRACE_ID_glVertexAttrib4sv = 190,
+	GLAD_TRACE_ID_glVertexAttrib4ubv = 191,
+	GLAD_TRACE_ID_glVertexAttrib4uiv = 192,
+	GLAD_TRACE_ID_glVertexAttrib4usv = 193,
+	GLAD_TRACE_ID_glVertexAttribPointer = 194,
+	GLAD_TRACE_ID_glUniformMatrix2x3fv = 195,
+	GLAD_TRACE_ID_glUniformMatrix3x2fv = 196,
+	GLAD_TRACE_ID_glUniformMatrix2x4fv = 197,
+	GLAD_TRACE_ID_glUniformMatrix4x2fv = 198,
+	GLAD_TRACE_ID_glUniformMatrix3x4fv = 199,
+	GLAD_TRACE_ID_glUniformMatrix4x3fv = 200,
+	GLAD_TRACE_ID_glColorMaski = 201,
+	GLAD_TRACE_ID_glGetBooleani_v = 202,
+	GLAD_TRACE_ID_glGetIntegeri_v = 203,
+	GLAD_TRACE_ID_glEnablei = 204,
+	GLAD_TRACE_ID_glDisablei = 205,
+	GLAD_TRACE_ID_glIsEnabledi = 206,
+	GLAD_TRACE_ID_glBeginTransformFeedback = 207,
+	GLAD_TRACE_ID_glEndTransformFeedback = 208,
+	GLAD_TRACE_ID_glBindBufferRange = 209,
+	GLAD_TRACE_ID_glBindBufferBase = 210,
+	GLAD_TRACE_ID_glTransformFeedbackVaryings = 211,
+	GLAD_TRACE_ID_glGetTransformFeedbackVarying = 212,
+	GLAD_TRACE_ID_glClampColor = 213,
+	GLAD_TRACE_ID_glBeginConditionalRender = 214,
+	GLAD_TRACE_ID_glEndConditionalRender = 215,
+	GLAD_TRACE_ID_glVertexAttribIPointer = 216,
+	GLAD_TRACE_ID_glGetVertexAttribIiv = 217,
+	GLAD_TRACE_ID_glGetVertexAttribIuiv = 218,
+	GLAD_TRACE_ID_glVertexAttribI1i = 219,
+	GLAD_TRACE_ID_glVertexAttribI2i = 220,
+	GLAD_TRACE_ID_glVertexAttribI3i = 221,
+	GLAD_TRACE_ID_glVertexAttribI4i = 222,
+	GLAD_TRACE_ID_glVertexAttribI1ui = 223,
+	GLAD_TRACE_ID_glVertexAttribI2ui = 224,
+	GLAD_TRACE_ID_glVertexAttribI3ui = 225,
+	GLAD_TRACE_ID_glVertexAttribI4ui = 226,
+	GLAD_TRACE_ID_glVertexAttribI1iv = 227,
+	GLAD_TRACE_ID_glVertexAttribI2iv = 228,
+	GLAD_TRACE_ID_glVertexAttribI3iv = 229,
+	GLAD_TRACE_ID_glVertexAttribI4iv = 230,
+	GLAD_TRACE_ID_glVertexAttribI1uiv = 231,
+	GLAD_TRACE_ID_glVertexAttribI2uiv = 232,
+	GLAD_TRACE_ID_glVertexAttribI3uiv = 233,
+	GLAD_TRACE_ID_glVertexAttribI4uiv = 234,
+	GLAD_TRACE_ID_glVertexAttribI4bv = 235,
+	GLAD_TRACE_ID_glVertexAttribI4sv = 236,
+	GLAD_TRACE_ID_glVertexAttribI4ubv = 237,
+	GLAD_TRACE_ID_glVertexAttribI4usv = 238,
+	GLAD_TRACE_ID_glGetUniformuiv = 239,
+	GLAD_TRACE_ID_glBindFragDataLocation = 240,
+	GLAD_TRACE_ID_glGetFragDataLocation = 241,
+	GLAD_TRACE_ID_glUniform1ui = 242,
+	GLAD_TRACE_ID_glUniform2ui = 243,
+	GLAD_TRACE_ID_glUniform3ui = 244,
+	GLAD_TRACE_ID_glUniform4ui = 245,
+	GLAD_TRACE_ID_glUniform1uiv = 246,
+	GLAD_TRACE_ID_glUniform2uiv = 247,
+	GLAD_TRACE_ID_glUniform3uiv = 248,
+	GLAD_TRACE_ID_glUniform4uiv = 249,
+	GLAD_TRACE_ID_glTexParameterIiv = 250,
+	GLAD_TRACE_ID_glTexParameterIuiv = 251,
+	GLAD_TRACE_ID_glGetTexParameterIiv = 252,
+	GLAD_TRACE_ID_glGetTexParameterIuiv = 253,
+	GLAD_TRACE_ID_glClearBufferiv = 254,
+	GLAD_TRACE_ID_glClearBufferuiv = 255,
+	GLAD_TRACE_ID_glClearBufferfv = 256,
+	GLAD_TRACE_ID_glClearBufferfi = 257,
+	GLAD_TRACE_ID_glGetStringi = 258,
+	GLAD_TRACE_ID_glIsRenderbuffer = 259,
+	GLAD_TRACE_ID_glBindRenderbuffer = 260,
+	GLAD_TRACE_ID_glDeleteRenderbuffers = 261,
+	GLAD_TRACE_ID_glGenRenderbuffers = 262,
+	GLAD_TRACE_ID_glRenderbufferStorage = 263,
+	GLAD_TRACE_ID_glGetRenderbufferParameteriv = 264,
+	GLAD_TRACE_ID_glIsFramebuffer = 265,
+	GLAD_TRACE_ID_glBindFramebuffer = 266,
+	GLAD_TRACE_ID_glDeleteFramebuffers = 267,
+	GLAD_TRACE_ID_glGenFramebuffers = 268,
+	GLAD_TRACE_ID_glCheckFramebufferStatus = 269,
+	GLAD_TRACE_ID_glFramebufferTexture1D = 270,
+	GLAD_TRACE_ID_glFramebufferTexture2D = 271,
+	GLAD_TRACE_ID_glFramebufferTexture3D = 272,
+	GLAD_TRACE_ID_glFramebufferRenderbuffer = 273,
+	GLAD_TRACE_ID_glGetFramebufferAttachmentParameteriv = 274,
+	GLAD_TRACE_ID_glGenerateMipmap = 275,
+	GLAD_TRACE_ID_glBlitFramebuffer = 276,
+	GLAD_TRACE_ID_glRenderbufferStorageMultisample = 277,
+	GLAD_TRACE_ID_glFramebufferTextureLayer = 278,
+	GLAD_TRACE_ID_glMapBufferRange = 279,
+	GLAD_TRACE_ID_glFlushMappedBufferRange = 280,
+	GLAD_TRACE_ID_glBindVertexArray = 281,
+	GLAD_TRACE_ID_glDeleteVertexArrays = 282,
+	GLAD_TRACE_ID_glGenVertexArrays = 283,
+	GLAD_TRACE_ID_glIsVertexArray = 284,
+	GLAD_TRACE_ID_glDrawArraysInstanced = 285,
+	GLAD_TRACE_ID_glDrawElementsInstanced = 286,
+	GLAD_TRACE_ID_glTexBuffer = 287,
+	GLAD_TRACE_ID_glPrimitiveRestartIndex = 288,
+	GLAD_TRACE_ID_glCopyBufferSubData = 289,
+	GLAD_TRACE_ID_glGetUniformIndices = 290,
+	GLAD_TRACE_ID_glGetActiveUniformsiv = 291,
+	GLAD_TRACE_ID_glGetActiveUniformName = 292,
+	GLAD_TRACE_ID_glGetUniformBlockIndex = 293,
+	GLAD_TRACE_ID_glGetActiveUniformBlockiv = 294,
+	GLAD_TRACE_ID_glGetActiveUniformBlockName = 295,
+	GLAD_TRACE_ID_glUniformBlockBinding = 296,
+	GLAD_TRACE_ID_glDrawElementsBaseVertex = 297,
+	GLAD_TRACE_ID_glDrawRangeElementsBaseVertex = 298,
+	GLAD_TRACE_ID_glDrawElementsInstancedBaseVertex = 299,
+	GLAD_TRACE_ID_glMultiDrawElementsBaseVertex = 300,
+	GLAD_TRACE_ID_glProvokingVertex = 301,
+	GLAD_TRACE_ID_glFenceSync = 302,
+	GLAD_TRACE_ID_glIsSync = 303,
+	GLAD_TRACE_ID_glDeleteSync = 304,
+	GLAD_TRACE_ID_glClientWaitSync = 305,
+	GLAD_TRACE_ID_glWaitSync = 306,
+	GLAD_TRACE_ID_glGetInteger64v = 307,
+	GLAD_TRACE_ID_glGetSynciv = 308,
+	GLAD_TRACE_ID_glGetInteger64i_v = 309,
+	GLAD_TRACE_ID_glGetBufferParameteri64v = 310,
+	GLAD_TRACE_ID_glFramebufferTexture = 311,
+	GLAD_TRACE_ID_glTexImage2DMultisample = 312,
+	GLAD_TRACE_ID_glTexImage3DMultisample = 313,
+	GLAD_TRACE_ID_glGetMultisamplefv = 314,
+	GLAD_TRACE_ID_glSampleMaski = 315,
+	GLAD_TRACE_ID_glBindFragDataLocationIndexed = 316,
+	GLAD_TRACE_ID_glGetFragDataIndex = 317,
+	GLAD_TRACE_ID_glGenSamplers = 318,
+	GLAD_TRACE_ID_glDeleteSamplers = 319,
+	GLAD_TRACE_ID_glIsSampler = 320,
+	GLAD_TRACE_ID_glBindSampler = 321,
+	GLAD_TRACE_ID_glSamplerParameteri = 322,
+	GLAD_TRACE_ID_glSamplerParameteriv = 323,
+	GLAD_TRACE_ID_glSamplerParameterf = 324,
+	GLAD_TRACE_ID_glSamplerParameterfv = 325,
+	GLAD_TRACE_ID_glSamplerParameterIiv = 326,
+	GLAD_TRACE_ID_glSamplerParameterIuiv = 327,
+	GLAD_TRACE_ID_glGetSamplerParameteriv = 328,
+	GLAD_TRACE_ID_glGetSamplerParameterIiv = 329,
+	GLAD_TRACE_ID_glGetSamplerParameterfv = 330,
+	GLAD_TRACE_ID_glGetSamplerParameterIuiv = 331,
+	GLAD_TRACE_ID_glQueryCounter = 332,
+	GLAD_TRACE_ID_glGetQueryObjecti64v = 333,
+	GLAD_TRACE_ID_glGetQueryObjectui64v = 334,
+	GLAD_TRACE_ID_glVertexAttribDivisor = 335,
+	GLAD_TRACE_ID_glVertexAttribP1ui = 336,
+	GLAD_TRACE_ID_glVertexAttribP1uiv = 337,
+	GLAD_TRACE_ID_glVertexAttribP2ui = 338,
+	GLAD_TRACE_ID_glVertexAttribP2uiv = 339,
+	GLAD_TRACE_ID_glVertexAttribP3ui = 340,
+	GLAD_TRACE_ID_glVertexAttribP3uiv = 341,
+	GLAD_TRACE_ID_glVertexAttribP4ui = 342,
+	GLAD_TRACE_ID_glVertexAttribP4uiv = 343,
+	GLAD_TRACE_ID_glVertexP2ui = 344,
+	GLAD_TRACE_ID_glVertexP2uiv = 345,
+	GLAD_TRACE_ID_glVertexP3ui = 346,
+	GLAD_TRACE_ID_glVertexP3uiv = 347,
+	GLAD_TRACE_ID_glVertexP4ui = 348,
+	GLAD_TRACE_ID_glVertexP4uiv = 349,
+	GLAD_TRACE_ID_glTexCoordP1ui = 350,
+	GLAD_TRACE_ID_glTexCoordP1uiv = 351,
+	GLAD_TRACE_ID_glTexCoordP2ui = 352,
+	GLAD_TRACE_ID_glTexCoordP2uiv = 353,
+	GLAD_TRACE_ID_glTexCoordP3ui = 354,
+	GLAD_TRACE_ID_glTexCoordP3uiv = 355,
+	GLAD_TRACE_ID_glTexCoordP4ui = 356,
+	GLAD_TRACE_ID_glTexCoordP4uiv = 357,
+	GLAD_TRACE_ID_glMultiTexCoordP1ui = 358,
+	GLAD_TRACE_ID_glMultiTexCoordP1uiv = 359,
+	GLAD_TRACE_ID_glMultiTexCoordP2ui = 360,
+	GLAD_TRACE_ID_glMultiTexCoordP2uiv = 361,
+	GLAD_TRACE_ID_glMultiTexCoordP3ui = 362,
+	GLAD_TRACE_ID_glMultiTexCoordP3uiv = 363,
+	GLAD_TRACE_ID_glMultiTexCoordP4ui = 364,
+	GLAD_TRACE_ID_glMultiTexCoordP4uiv = 365,
+	GLAD_TRACE_ID_glNormalP3ui = 366,
+	GLAD_TRACE_ID_glNormalP3uiv = 367,
+	GLAD_TRACE_ID_glColorP3ui = 368,
+	GLAD_TRACE_ID_glColorP3uiv = 369,
+	GLAD_TRACE_ID_glColorP4ui = 370,
+	GLAD_TRACE_ID_glColorP4uiv = 371,
+	GLAD_TRACE_ID_glSecondaryColorP3ui = 372,
+	GLAD_TRACE_ID_glSecondaryColorP3uiv = 373,
+	GLAD_TRACE_ID_glGetProgramBinary = 374,
+	GLAD_TRACE_ID_glProgramBinary = 375,
+	GLAD_TRACE_ID_glProgramParameteri = 376,
+	GLAD_TRACE_ID_glMaxShaderCompilerThreadsKHR = 377,
+	GLAD_TRACE_ID_glBufferStorage = 378,
+	GLAD_TRACE_ID_COUNT = 379
+};
+
+static struct {
+	PFNGLCULLFACEPROC glCullFace;
+	PFNGLFRONTFACEPROC glFrontFace;
+	PFNGLHINTPROC glHint;
+	PFNGLLINEWIDTHPROC glLineWidth;
+	PFNGLPOINTSIZEPROC glPointSize;
+	PFNGLPOLYGONMODEPROC glPolygonMode;
+	PFNGLSCISSORPROC glScissor;
+	PFNGLTEXPARAMETERFPROC glTexParameterf;
+	PFNGLTEXPARAMETERFVPROC glTexParameterfv;
+	PFNGLTEXPARAMETERIPROC glTexParameteri;
+	PFNGLTEXPARAMETERIVPROC glTexParameteriv;
+	PFNGLTEXIMAGE1DPROC glTexImage1D;
+	PFNGLTEXIMAGE2DPROC glTexImage2D;
+	PFNGLDRAWBUFFERPROC glDrawBuffer;
+	PFNGLCLEARPROC glClear;
+	PFNGLCLEARCOLORPROC glClearColor;
+	PFNGLCLEARSTENCILPROC glClearStencil;
+	PFNGLCLEARDEPTHPROC glClearDepth;
+	PFNGLSTENCILMASKPROC glStencilMask;
+	PFNGLCOLORMASKPROC glColorMask;
+	PFNGLDEPTHMASKPROC glDepthMask;
+	PFNGLDISABLEPROC glDisable;
+	PFNGLENABLEPROC glEnable;
+	PFNGLFINISHPROC glFinish;
+	PFNGLFLUSHPROC glFlush;
+	PFNGLBLENDFUNCPROC glBlendFunc;
+	PFNGLLOGICOPPROC glLogicOp;
+	PFNGLSTENCILFUNCPROC glStencilFunc;
+	PFNGLSTENCILOPPROC glStencilOp;
+	PFNGLDEPTHFUNCPROC glDepthFunc;
+	PFNGLPIXELSTOREFPROC glPixelStoref;
+	PFNGLPIXELSTOREIPROC glPixelStorei;
+	PFNGLREADBUFFERPROC glReadBuffer;
+	PFNGLREADPIXELSPROC glReadPixels;
+	PFNGLGETBOOLEANVPROC glGetBooleanv;
+	PFNGLGETDOUBLEVPROC glGetDoublev;
+	PFNGLGETERRORPROC glGetError;
+	PFNGLGETFLOATVPROC glGetFloatv;
+	PFNGLGETINTEGERVPROC glGetIntegerv;
+	PFNGLGETSTRINGPROC glGetString;
+	PFNGLGETTEXIMAGEPROC glGetTexImage;
+	PFNGLGETTEXPARAMETERFVPROC glGetTexParameterfv;
+	PFNGLGETTEXPARAMETERIVPROC glGetTexParameteriv;
+	PFNGLGETTEXLEVELPARAMETERFVPROC glGetTexLevelParameterfv;
+	PFNGLGETTEXLEVELPARAMETERIVPROC glGetTexLevelParameteriv;
+	PFNGLISENABLEDPROC glIsEnabled;
+	PFNGLDEPTHRANGEPROC glDepthRange;
+	PFNGLVIEWPORTPROC glViewport;
+	PFNGLDRAWARRAYSPROC glDrawArrays;
+	PFNGLDRAWELEMENTSPROC glDrawElements;
+	PFNGLPOLYGONOFFSETPROC glPolygonOffset;
+	PFNGLCOPYTEXIMAGE1DPROC glCopyTexImage1D;
+	PFNGLCOPYTEXIMAGE2DPROC glCopyTexImage2D;
+	PFNGLCOPYTEXSUBIMAGE1DPROC glCopyTexSubImage1D;
+	PFNGLCOPYTEXSUBIMAGE2DPROC glCopyTexSubImage2D;
+	PFNGLTEXSUBIMAGE1DPROC glTexSubImage1D;
+	PFNGLTEXSUBIMAGE2DPROC glTexSubImage2D;
+	PFNGLBINDTEXTUREPROC glBindTexture;
+	PFNGLDELETETEXTURESPROC glDeleteTextures;
+	PFNGLGENTEXTURESPROC glGenTextures;
+	PFNGLISTEXTUREPROC glIsTexture;
+	PFNGLDRAWRANGEELEMENTSPROC glDrawRangeElements;
+	PFNGLTEXIMAGE3DPROC glTexImage3D;
+	PFNGLTEXSUBIMAGE3DPROC glTexSubImage3D;
+	PFNGLCOPYTEXSUBIMAGE3DPROC glCopyTexSubImage3D;
+	PFNGLACTIVETEXTUREPROC glActiveTexture;
+	PFNGLSAMPLECOVERAGEPROC glSampleCoverage;
+	PFNGLCOMPRESSEDTEXIMAGE3DPROC glCompressedTexImage3D;
+	PFNGLCOMPRESSEDTEXIMAGE2DPROC glCompressedTexImage2D;
+	PFNGLCOMPRESSEDTEXIMAGE1DPROC glCompressedTexImage1D;
+	PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glCompressedTexSubImage3D;
+	PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glCompressedTexSubImage2D;
+	PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glCompressedTexSubImage1D;
+	PFNGLGETCOMPRESSEDTEXIMAGEPROC glGetCompressedTexImage;
+	PFNGLBLENDFUNCSEPARATEPROC glBlendFuncSeparate;
+	PFNGLMULTIDRAWARRAYSPROC glMultiDrawArrays;
+	PFNGLMULTIDRAWELEMENTSPROC glMultiDrawElements;
+	PFNGLPOINTPARAMETERFPROC glPointParameterf;
+	PFNGLPOINTPARAMETERFVPROC glPointParameterfv;
+	PFNGLPOINTPARAMETERIPROC glPointParameteri;
+	PFNGLPOINTPARAMETERIVPROC glPointParameteriv;
+	PFNGLBLENDCOLORPROC glBlendColor;
+	PFNGLBLENDEQUATIONPROC glBlendEquation;
+	PFNGLGENQUERIESPROC glGenQueries;
+	PFNGLDELETEQUERIESPROC glDeleteQueries;
+	PFNGLISQUERYPROC glIsQuery;
+	PFNGLBEGINQUERYPROC glBeginQuery;
+	PFNGLENDQUERYPROC glEndQuery;
+	PFNGLGETQUERYIVPROC glGetQueryiv;
+	PFNGLGETQUERYOBJECTIVPROC glGetQueryObjectiv;
+	PFNGLGETQUERYOBJECTUIVPROC glGetQueryObjectuiv;
+	PFNGLBINDBUFFERPROC glBindBuffer;
+	PFNGLDELETEBUFFERSPROC glDeleteBuffers;
+	PFNGLGENBUFFERSPROC glGenBuffers;
+	PFNGLISBUFFERPROC glIsBuffer;
+	PFNGLBUFFERDATAPROC glBufferData;
+	PFNGLBUFFERSUBDATAPROC glBufferSubData;
+	PFNGLGETBUFFERSUBDATAPROC glGetBufferSubData;
+	PFNGLMAPBUFFERPROC glMapBuffer;
+	PFNGLUNMAPBUFFERPROC glUnmapBuffer;
+	PFNGLGETBUFFERPARAMETERIVPROC glGetBufferParameteriv;
+	PFNGLGETBUFFERPOINTERVPROC glGetBufferPointerv;
+	PFNGLBLENDEQUATIONSEPARATEPROC glBlendEquationSeparate;
+	PFNGLDRAWBUFFERSPROC glDrawBuffers;
+	PFNGLSTENCILOPSEPARATEPROC glStencilOpSeparate;
+	PFNGLSTENCILFUNCSEPARATEPROC glStencilFuncSeparate;
+	PFNGLSTENCILMASKSEPARATEPROC glStencilMaskSeparate;
+	PFNGLATTACHSHADERPROC glAttachShader;
+	PFNGLBINDATTRIBLOCATIONPROC glBindAttribLocation;
+	PFNGLCOMPILESHADERPROC glCompileShader;
+	PFNGLCREATEPROGRAMPROC glCreateProgram;
+	PFNGLCREATESHADERPROC glCreateShader;
+	PFNGLDELETEPROGRAMPROC glDeleteProgram;
+	PFNGLDELETESHADERPROC glDeleteShader;
+	PFNGLDETACHSHADERPROC glDetachShader;
+	PFNGLDISABLEVERTEXATTRIBARRAYPROC glDisableVertexAttribArray;
+	PFNGLENABLEVERTEXATTRIBARRAYPROC glEnableVertexAttribArray;
+	PFNGLGETACTIVEATTRIBPROC glGetActiveAttrib;
+	PFNGLGETACTIVEUNIFORMPROC glGetActiveUniform;
+	PFNGLGETATTACHEDSHADERSPROC glGetAttachedShaders;
+	PFNGLGETATTRIBLOCATIONPROC glGetAttribLocation;
+	PFNGLGETPROGRAMIVPROC glGetProgramiv;
+	PFNGLGETPROGRAMINFOLOGPROC glGetProgramInfoLog;
+	PFNGLGETSHADERIVPROC glGetShaderiv;
+	PFNGLGETSHADERINFOLOGPROC glGetShaderInfoLog;
+	PFNGLGETSHADERSOURCEPROC glGetShaderSource;
+	PFNGLGETUNIFORMLOCATIONPROC glGetUniformLocation;
+	PFNGLGETUNIFORMFVPROC glGetUniformfv;
+	PFNGLGETUNIFORMIVPROC glGetUniformiv;
+	PFNGLGETVERTEXATTRIBDVPROC glGetVertexAttribdv;
+	PFNGLGETVERTEXATTRIBFVPROC glGetVertexAttribfv;
+	PFNGLGETVERTEXATTRIBIVPROC glGetVertexAttribiv;
+	PFNGLGETVERTEXATTRIBPOINTERVPROC glGetVertexAttribPointerv;
+	PFNGLISPROGRAMPROC glIsProgram;
+	PFNGLISSHADERPROC glIsShader;
+	PFNGLLINKPROGRAMPROC glLinkProgram;
+	PFNGLSHADERSOURCEPROC glShaderSource;
+	PFNGLUSEPROGRAMPROC glUseProgram;
+	PFNGLUNIFORM1FPROC glUniform1f;
+	PFNGLUNIFORM2FPROC glUniform2f;
+	PFNGLUNIFORM3FPROC glUniform3f;
+	PFNGLUNIFORM4FPROC glUniform4f;
+	PFNGLUNIFORM1IPROC glUniform1i;
+	PFNGLUNIFORM2IPROC glUniform2i;
+	PFNGLUNIFORM3IPROC glUniform3i;
+	PFNGLUNIFORM4IPROC glUniform4i;
+	PFNGLUNIFORM1FVPROC glUniform1fv;
+	PFNGLUNIFORM2FVPROC glUniform2fv;
+	PFNGLUNIFORM3FVPROC glUniform3fv;
+	PFNGLUNIFORM4FVPROC glUniform4fv;
+	PFNGLUNIFORM1IVPROC glUniform1iv;
+	PFNGLUNIFORM2IVPROC glUniform2iv;
+	PFNGLUNIFORM3IVPROC glUniform3iv;
+	PFNGLUNIFORM4IVPROC glUniform4iv;
+	PFNGLUNIFORMMATRIX2FVPROC glUniformMatrix2fv;
+	PFNGLUNIFORMMATRIX3FVPROC glUniformMatrix3fv;
+	PFNGLUNIFORMMATRIX4FVPROC glUniformMatrix4fv;
+	PFNGLVALIDATEPROGRAMPROC glValidateProgram;
+	PFNGLVERTEXATTRIB1DPROC glVertexAttrib1d;
+	PFNGLVERTEXATTRIB1DVPROC glVertexAttrib1dv;
+	PFNGLVERTEXATTRIB1FPROC glVertexAttrib1f;
+	PFNGLVERTEXATTRIB1FVPROC glVertexAttrib1fv;
+	PFNGLVERTEXATTRIB1SPROC glVertexAttrib1s;
+	PFNGLVERTEXATTRIB1SVPROC glVertexAttrib1sv;
+	PFNGLVERTEXATTRIB2DPROC glVertexAttrib2d;
+	PFNGLVERTEXATTRIB2DVPROC glVertexAttrib2dv;
+	PFNGLVERTEXATTRIB2FPROC glVertexAttrib2f;
+	PFNGLVERTEXATTRIB2FVPROC glVertexAttrib2fv;
+	PFNGLVERTEXATTRIB2SPROC glVertexAttrib2s;
+	PFNGLVERTEXATTRIB2SVPROC glVertexAttrib2sv;
+	PFNGLVERTEXATTRIB3DPROC glVertexAttrib3d;
+	PFNGLVERTEXATTRIB3DVPROC glVertexAttrib3dv;
+	PFNGLVERTEXATTRIB3FPROC glVertexAttrib3f;
+	PFNGLVERTEXATTRIB3FVPROC glVertexAttrib3fv;
+	PFNGLVERTEXATTRIB3SPROC glVertexAttrib3s;
+	PFNGLVERTEXATTRIB3SVPROC glVertexAttrib3sv;
+	PFNGLVERTEXATTRIB4NBVPROC glVertexAttrib4Nbv;
+	PFNGLVERTEXATTRIB4NIVPROC glVertexAttrib4Niv;
+	PFNGLVERTEXATTRIB4NSVPROC glVertexAttrib4Nsv;
+	PFNGLVERTEXATTRIB4NUBPROC glVertexAttrib4Nub;
+	PFNGLVERTEXATTRIB4NUBVPROC glVertexAttrib4Nubv;
+	PFNGLVERTEXATTRIB4NUIVPROC glVertexAttrib4Nuiv;
+	PFNGLVERTEXATTRIB4NUSVPROC glVertexAttrib4Nusv;
+	PFNGLVERTEXATTRIB4BVPROC glVertexAttrib4bv;
+	PFNGLVERTEXATTRIB4DPROC glVertexAttrib4d;
+	PFNGLVERTEXATTRIB4DVPROC glVertexAttrib4dv;
+	PFNGLVERTEXATTRIB4FPROC glVertexAttrib4f;
+	PFNGLVERTEXATTRIB4FVPROC glVertexAttrib4fv;
+	PFNGLVERTEXATTRIB4IVPROC glVertexAttrib4iv;
+	PFNGLVERTEXATTRIB4SPROC glVertexAttrib4s;
+	PFNGLVERTEXATTRIB4SVPROC glVertexAttrib4sv;
+	PFNGLVERTEXATTRIB4UBVPROC glVertexAttrib4ubv;
+	PFNGLVERTEXATTRIB4UIVPROC glVertexAttrib4uiv;
+	PFNGLVERTEXATTRIB4USVPROC glVertexAttrib4usv;
+	PFNGLVERTEXATTRIBPOINTERPROC glVertexAttribPointer;
+	PFNGLUNIFORMMATRIX2X3FVPROC glUniformMatrix2x3fv;
+	PFNGLUNIFORMMATRIX3X2FVPROC glUniformMatrix3x2fv;
+	PFNGLUNIFORMMATRIX2X4FVPROC glUniformMatrix2x4fv;
+	PFNGLUNIFORMMATRIX4X2FVPROC glUniformMatrix4x2fv;
+	PFNGLUNIFORMMATRIX3X4FVPROC glUniformMatrix3x4fv;
+	PFNGLUNIFORMMATRIX4X3FVPROC glUniformMatrix4x3fv;
+	PFNGLCOLORMASKIPROC glColorMaski;
+	PFNGLGETBOOLEANI_VPROC glGetBooleani_v;
+	PFNGLGETINTEGERI_VPROC glGetIntegeri_v;
+	PFNGLENABLEIPROC glEnablei;
+	PFNGLDISABLEIPROC glDisablei;
+	PFNGLISENABLEDIPROC glIsEnabledi;
+	PFNGLBEGINTRANSFORMFEEDBACKPROC glBeginTransformFeedback;
+	PFNGLENDTRANSFORMFEEDBACKPROC glEndTransformFeedback;
+	PFNGLBINDBUFFERRANGEPROC glBindBufferRange;
+	PFNGLBINDBUFFERBASEPROC glBindBufferBase;
+	PFNGLTRANSFORMFEEDBACKVARYINGSPROC glTransformFeedbackVaryings;
+	PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glGetTransformFeedbackVarying;
+	PFNGLCLAMPCOLORPROC glClampColor;
+	PFNGLBEGINCONDITIONALRENDERPROC glBeginConditionalRender;
+	PFNGLENDCONDITIONALRENDERPROC glEndConditionalRender;
+	PFNGLVERTEXATTRIBIPOINTERPROC glVertexAttribIPointer;
+	PFNGLGETVERTEXATTRIBIIVPROC glGetVertexAttribIiv;
+	PFNGLGETVERTEXATTRIBIUIVPROC glGetVertexAttribIuiv;
+	PFNGLVERTEXATTRIBI1IPROC glVertexAttribI1i;
+	PFNGLVERTEXATTRIBI2IPROC glVertexAttribI2i;
+	PFNGLVERTEXATTRIBI3IPROC glVertexAttribI3i;
+	PFNGLVERTEXATTRIBI4IPROC glVertexAttribI4i;
+	PFNGLVERTEXATTRIBI1UIPROC glVertexAttribI1ui;
+	PFNGLVERTEXATTRIBI2UIPROC glVertexAttribI2ui;
+	PFNGLVERTEXATTRIBI3UIPROC glVertexAttribI3ui;
+	PFNGLVERTEXATTRIBI4UIPROC glVertexAttribI4ui;
+	PFNGLVERTEXATTRIBI1IVPROC glVertexAttribI1iv;
+	PFNGLVERTEXATTRIBI2IVPROC glVertexAttribI2iv;
+	PFNGLVERTEXATTRIBI3IVPROC glVertexAttribI3iv;
+	PFNGLVERTEXATTRIBI4IVPROC glVertexAttribI4iv;
+	PFNGLVERTEXATTRIBI1UIVPROC glVertexAttribI1uiv;
+	PFNGLVERTEXATTRIBI2UIVPROC glVertexAttribI2uiv;
+	PFNGLVERTEXATTRIBI3UIVPROC glVertexAttribI3uiv;
+	PFNGLVERTEXATTRIBI4UIVPROC glVertexAttribI4uiv;
+	PFNGLVERTEXATTRIBI4BVPROC glVertexAttribI4bv;
+	PFNGLVERTEXATTRIBI4SVPROC glVertexAttribI4sv;
+	PFNGLVERTEXATTRIBI4UBVPROC glVertexAttribI4ubv;
+	PFNGLVERTEXATTRIBI4USVPROC glVertexAttribI4usv;
+	PFNGLGETUNIFORMUIVPROC glGetUniformuiv;
+	PFNGLBINDFRAGDATALOCATIONPROC glBindFragDataLocation;
+	PFNGLGETFRAGDATALOCATIONPROC glGetFragDataLocation;
+	PFNGLUNIFORM1UIPROC glUniform1ui;
+	PFNGLUNIFORM2UIPROC glUniform2ui;
+	PFNGLUNIFORM3UIPROC glUniform3ui;
+	PFNGLUNIFORM4UIPROC glUniform4ui;
+	PFNGLUNIFORM1UIVPROC glUniform1uiv;
+	PFNGLUNIFORM2UIVPROC glUniform2uiv;
+	PFNGLUNIFORM3UIVPROC glUniform3uiv;
+	PFNGLUNIFORM4UIVPROC glUniform4uiv;
+	PFNGLTEXPARAMETERIIVPROC glTexParameterIiv;
+	PFNGLTEXPARAMETERIUIVPROC glTexParameterIuiv;
+	PFNGLGETTEXPARAMETERIIVPROC glGetTexParameterIiv;
+	PFNGLGETTEXPARAMETERIUIVPROC glGetTexParameterIuiv;
+	PFNGLCLEARBUFFERIVPROC glClearBufferiv;
+	PFNGLCLEARBUFFERUIVPROC glClearBufferuiv;
+	PFNGLCLEARBUFFERFVPROC glClearBufferfv;
+	PFNGLCLEARBUFFERFIPROC glClearBufferfi;
+	PFNGLGETSTRINGIPROC glGetStringi;
+	PFNGLISRENDERBUFFERPROC glIsRenderbuffer;
+	PFNGLBINDRENDERBUFFERPROC glBindRenderbuffer;
+	PFNGLDELETERENDERBUFFERSPROC glDeleteRenderbuffers;
+	PFNGLGENRENDERBUFFERSPROC glGenRenderbuffers;
+	PFNGLRENDERBUFFERSTORAGEPROC glRenderbufferStorage;
+	PFNGLGETRENDERBUFFERPARAMETERIVPROC glGetRenderbufferParameteriv;
+	PFNGLISFRAMEBUFFERPROC glIsFramebuffer;
+	PFNGLBINDFRAMEBUFFERPROC glBindFramebuffer;
+	PFNGLDELETEFRAMEBUFFERSPROC glDeleteFramebuffers;
+	PFNGLGENFRAMEBUFFERSPROC glGenFramebuffers;
+	PFNGLCHECKFRAMEBUFFERSTATUSPROC glCheckFramebufferStatus;
+	PFNGLFRAMEBUFFERTEXTURE1DPROC glFramebufferTexture1D;
+	PFNGLFRAMEBUFFERTEXTURE2DPROC glFramebufferTexture2D;
+	PFNGLFRAMEBUFFERTEXTURE3DPROC glFramebufferTexture3D;
+	PFNGLFRAMEBUFFERRENDERBUFFERPROC glFramebufferRenderbuffer;
+	PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glGetFramebufferAttachmentParameteriv;
+	PFNGLGENERATEMIPMAPPROC glGenerateMipmap;
+	PFNGLBLITFRAMEBUFFERPROC glBlitFramebuffer;
+	PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glRenderbufferStorageMultisample;
+	PFNGLFRAMEBUFFERTEXTURELAYERPROC glFramebufferTextureLayer;
+	PFNGLMAPBUFFERRANGEPROC glMapBufferRange;
+	PFNGLFLUSHMAPPEDBUFFERRANGEPROC glFlushMappedBufferRange;
+	PFNGLBINDVERTEXARRAYPROC glBindVertexArray;
+	PFNGLDELETEVERTEXARRAYSPROC glDeleteVertexArrays;
+	PFNGLGENVERTEXARRAYSPROC glGenVertexArrays;
+	PFNGLISVERTEXARRAYPROC glIsVertexArray;
+	PFNGLDRAWARRAYSINSTANCEDPROC glDrawArraysInstanced;
+	PFNGLDRAWELEMENTSINSTANCEDPROC glDrawElementsInstanced;
+	PFNGLTEXBUFFERPROC glTexBuffer;
+	PFNGLPRIMITIVERESTARTINDEXPROC glPrimitiveRestartIndex;
+	PFNGLCOPYBUFFERSUBDATAPROC glCopyBufferSubData;
+	PFNGLGETUNIFORMINDICESPROC glGetUniformIndices;
+	PFNGLGETACTIVEUNIFORMSIVPROC glGetActiveUniformsiv;
+	PFNGLGETACTIVEUNIFORMNAMEPROC glGetActiveUniformName;
+	PFNGLGETUNIFORMBLOCKINDEXPROC glGetUniformBlockIndex;
+	PFNGLGETACTIVEUNIFORMBLOCKIVPROC glGetActiveUniformBlockiv;
+	PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glGetActiveUniformBlockName;
+	PFNGLUNIFORMBLOCKBINDINGPROC glUniformBlockBinding;
+	PFNGLDRAWELEMENTSBASEVERTEXPROC glDrawElementsBaseVertex;
+	PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glDrawRangeElementsBaseVertex;
+	PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glDrawElementsInstancedBaseVertex;
+	PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glMultiDrawElementsBaseVertex;
+	PFNGLPROVOKINGVERTEXPROC glProvokingVertex;
+	PFNGLFENCESYNCPROC glFenceSync;
+	PFNGLISSYNCPROC glIsSync;
+	PFNGLDELETESYNCPROC glDeleteSync;
+	PFNGLCLIENTWAITSYNCPROC glClientWaitSync;
+	PFNGLWAITSYNCPROC glWaitSync;
+	PFNGLGETINTEGER64VPROC glGetInteger64v;
+	PFNGLGETSYNCIVPROC glGetSynciv;
+	PFNGLGETINTEGER64I_VPROC glGetInteger64i_v;
+	PFNGLGETBUFFERPARAMETERI64VPROC glGetBufferParameteri64v;
+	PFNGLFRAMEBUFFERTEXTUREPROC glFramebufferTexture;
+	PFNGLTEXIMAGE2DMULTISAMPLEPROC glTexImage2DMultisample;
+	PFNGLTEXIMAGE3DMULTISAMPLEPROC glTexImage3DMultisample;
+	PFNGLGETMULTISAMPLEFVPROC glGetMultisamplefv;
+	PFNGLSAMPLEMASKIPROC glSampleMaski;
+	PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glBindFragDataLocationIndexed;
+	PFNGLGETFRAGDATAINDEXPROC glGetFragDataIndex;
+	PFNGLGENSAMPLERSPROC glGenSamplers;
+	PFNGLDELETESAMPLERSPROC glDeleteSamplers;
+	PFNGLISSAMPLERPROC glIsSampler;
+	PFNGLBINDSAMPLERPROC glBindSampler;
+	PFNGLSAMPLERPARAMETERIPROC glSamplerParameteri;
+	PFNGLSAMPLERPARAMETERIVPROC glSamplerParameteriv;
+	PFNGLSAMPLERPARAMETERFPROC glSamplerParameterf;
+	PFNGLSAMPLERPARAMETERFVPROC glSamplerParameterfv;
+	PFNGLSAMPLERPARAMETERIIVPROC glSamplerParameterIiv;
+	PFNGLSAMPLERPARAMETERIUIVPROC glSamplerParameterIuiv;
+	PFNGLGETSAMPLERPARAMETERIVPROC glGetSamplerParameteriv;
+	PFNGLGETSAMPLERPARAMETERIIVPROC glGetSamplerParameterIiv;
+	PFNGLGETSAMPLERPARAMETERFVPROC glGetSamplerParameterfv;
+	PFNGLGETSAMPLERPARAMETERIUIVPROC glGetSamplerParameterIuiv;
+	PFNGLQUERYCOUNTERPROC glQueryCounter;
+	PFNGLGETQUERYOBJECTI64VPROC glGetQueryObjecti64v;
+	PFNGLGETQUERYOBJECTUI64VPROC glGetQueryObjectui64v;
+	PFNGLVERTEXATTRIBDIVISORPROC glVertexAttribDivisor;
+	PFNGLVERTEXATTRIBP1UIPROC glVertexAttribP1ui;
+	PFNGLVERTEXATTRIBP1UIVPROC glVertexAttribP1uiv;
+	PFNGLVERTEXATTRIBP2UIPROC glVertexAttribP2ui;
+	PFNGLVERTEXATTRIBP2UIVPROC glVertexAttribP2uiv;
+	PFNGLVERTEXATTRIBP3UIPROC glVertexAttribP3ui;
+	PFNGLVERTEXATTRIBP3UIVPROC glVertexAttribP3uiv;
+	PFNGLVERTEXATTRIBP4UIPROC glVertexAttribP4ui;
+	PFNGLVERTEXATTRIBP4UIVPROC glVertexAttribP4uiv;
+	PFNGLVERTEXP2UIPROC glVertexP2ui;
+	PFNGLVERTEXP2UIVPROC glVertexP2uiv;
+	PFNGLVERTEXP3UIPROC glVertexP3ui;
+	PFNGLVERTEXP3UIVPROC glVertexP3uiv;
+	PFNGLVERTEXP4UIPROC glVertexP4ui;
+	PFNGLVERTEXP4UIVPROC glVertexP4uiv;
+	PFNGLTEXCOORDP1UIPROC glTexCoordP1ui;
+	PFNGLTEXCOORDP1UIVPROC glTexCoordP1uiv;
+	PFNGLTEXCOORDP2UIPROC glTexCoordP2ui;
+	PFNGLTEXCOORDP2UIVPROC glTexCoordP2uiv;
+	PFNGLTEXCOORDP3UIPROC glTexCoordP3ui;
+	PFNGLTEXCOORDP3UIVPROC glTexCoordP3uiv;
+	PFNGLTEXCOORDP4UIPROC glTexCoordP4ui;
+	PFNGLTEXCOORDP4UIVPROC glTexCoordP4uiv;
+	PFNGLMULTITEXCOORDP1UIPROC glMultiTexCoordP1ui;
+	PFNGLMULTITEXCOORDP1UIVPROC glMultiTexCoordP1uiv;
+	PFNGLMULTITEXCOORDP2UIPROC glMultiTexCoordP2ui;
+	PFNGLMULTITEXCOORDP2UIVPROC glMultiTexCoordP2uiv;
+	PFNGLMULTITEXCOORDP3UIPROC glMultiTexCoordP3ui;
+	PFNGLMULTITEXCOORDP3UIVPROC glMultiTexCoordP3uiv;
+	PFNGLMULTITEXCOORDP4UIPROC glMultiTexCoordP4ui;
+	PFNGLMULTITEXCOORDP4UIVPROC glMultiTexCoordP4uiv;
+	PFNGLNORMALP3UIPROC glNormalP3ui;
+	PFNGLNORMALP3UIVPROC glNormalP3uiv;
+	PFNGLCOLORP3UIPROC glColorP3ui;
+	PFNGLCOLORP3UIVPROC glColorP3uiv;
+	PFNGLCOLORP4UIPROC glColorP4ui;
+	PFNGLCOLORP4UIVPROC glColorP4uiv;
+	PFNGLSECONDARYCOLORP3UIPROC glSecondaryColorP3ui;
+	PFNGLSECONDARYCOLORP3UIVPROC glSecondaryColorP3uiv;
+	PFNGLGETPROGRAMBINARYPROC glGetProgramBinary;
+	PFNGLPROGRAMBINARYPROC glProgramBinary;
+	PFNGLPROGRAMPARAMETERIPROC glProgramParameteri;
+	PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glMaxShaderCompilerThreadsKHR;
+	PFNGLBUFFERSTORAGEPROC glBufferStorage;
+} glad_trace_real;
+
+static void APIENTRY glad_trace_glCullFace(GLenum mode) {
+	uint64_t args[1];
+	args[0] = trace_integer(mode);
+	glad_trace_real.glCullFace(mode);
+	trace_record(GLAD_TRACE_ID_glCullFace, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glFrontFace(GLenum mode) {
+	uint64_t args[1];
+	args[0] = trace_integer(mode);
+	glad_trace_real.glFrontFace(mode);
+	trace_record(GLAD_TRACE_ID_glFrontFace, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glHint(GLenum target, GLenum mode) {
+	uint64_t args[2];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(mode);
+	glad_trace_real.glHint(target, mode);
+	trace_record(GLAD_TRACE_ID_glHint, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glLineWidth(GLfloat width) {
+	uint64_t args[1];
+	args[0] = trace_float(width);
+	glad_trace_real.glLineWidth(width);
+	trace_record(GLAD_TRACE_ID_glLineWidth, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glPointSize(GLfloat size) {
+	uint64_t args[1];
+	args[0] = trace_float(size);
+	glad_trace_real.glPointSize(size);
+	trace_record(GLAD_TRACE_ID_glPointSize, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glPolygonMode(GLenum face, GLenum mode) {
+	uint64_t args[2];
+	args[0] = trace_integer(face);
+	args[1] = trace_integer(mode);
+	glad_trace_real.glPolygonMode(face, mode);
+	trace_record(GLAD_TRACE_ID_glPolygonMode, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+	uint64_t args[4];
+	args[0] = trace_integer(x);
+	args[1] = trace_integer(y);
+	args[2] = trace_integer(width);
+	args[3] = trace_integer(height);
+	glad_trace_real.glScissor(x, y, width, height);
+	trace_record(GLAD_TRACE_ID_glScissor, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+	uint64_t args[3];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(pname);
+	args[2] = trace_float(param);
+	glad_trace_real.glTexParameterf(target, pname, param);
+	trace_record(GLAD_TRACE_ID_glTexParameterf, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(pname);
+	args[2] = trace_blob(params, (pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1) * 4);
+	glad_trace_real.glTexParameterfv(target, pname, params);
+	trace_record(GLAD_TRACE_ID_glTexParameterfv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+	uint64_t args[3];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(pname);
+	args[2] = trace_integer(param);
+	glad_trace_real.glTexParameteri(target, pname, param);
+	trace_record(GLAD_TRACE_ID_glTexParameteri, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(pname);
+	args[2] = trace_blob(params, (pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1) * 4);
+	glad_trace_real.glTexParameteriv(target, pname, params);
+	trace_record(GLAD_TRACE_ID_glTexParameteriv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+	uint64_t args[8];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(level);
+	args[2] = trace_integer(internalformat);
+	args[3] = trace_integer(width);
+	args[4] = trace_integer(border);
+	args[5] = trace_integer(format);
+	args[6] = trace_integer(type);
+	args[7] = 0;
+	glad_trace_real.glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+	trace_record(GLAD_TRACE_ID_glTexImage1D, args, 8, NULL);
+}
+static void APIENTRY glad_trace_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+	uint64_t args[9];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(level);
+	args[2] = trace_integer(internalformat);
+	args[3] = trace_integer(width);
+	args[4] = trace_integer(height);
+	args[5] = trace_integer(border);
+	args[6] = trace_integer(format);
+	args[7] = trace_integer(type);
+	args[8] = 0;
+	glad_trace_real.glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+	trace_record(GLAD_TRACE_ID_glTexImage2D, args, 9, NULL);
+}
+static void APIENTRY glad_trace_glDrawBuffer(GLenum buf) {
+	uint64_t args[1];
+	args[0] = trace_integer(buf);
+	glad_trace_real.glDrawBuffer(buf);
+	trace_record(GLAD_TRACE_ID_glDrawBuffer, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glClear(GLbitfield mask) {
+	uint64_t args[1];
+	args[0] = trace_integer(mask);
+	glad_trace_real.glClear(mask);
+	trace_record(GLAD_TRACE_ID_glClear, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	uint64_t args[4];
+	args[0] = trace_float(red);
+	args[1] = trace_float(green);
+	args[2] = trace_float(blue);
+	args[3] = trace_float(alpha);
+	glad_trace_real.glClearColor(red, green, blue, alpha);
+	trace_record(GLAD_TRACE_ID_glClearColor, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glClearStencil(GLint s) {
+	uint64_t args[1];
+	args[0] = trace_integer(s);
+	glad_trace_real.glClearStencil(s);
+	trace_record(GLAD_TRACE_ID_glClearStencil, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glClearDepth(GLdouble depth) {
+	uint64_t args[1];
+	args[0] = trace_double(depth);
+	glad_trace_real.glClearDepth(depth);
+	trace_record(GLAD_TRACE_ID_glClearDepth, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glStencilMask(GLuint mask) {
+	uint64_t args[1];
+	args[0] = trace_integer(mask);
+	glad_trace_real.glStencilMask(mask);
+	trace_record(GLAD_TRACE_ID_glStencilMask, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+	uint64_t args[4];
+	args[0] = trace_integer(red);
+	args[1] = trace_integer(green);
+	args[2] = trace_integer(blue);
+	args[3] = trace_integer(alpha);
+	glad_trace_real.glColorMask(red, green, blue, alpha);
+	trace_record(GLAD_TRACE_ID_glColorMask, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glDepthMask(GLboolean flag) {
+	uint64_t args[1];
+	args[0] = trace_integer(flag);
+	glad_trace_real.glDepthMask(flag);
+	trace_record(GLAD_TRACE_ID_glDepthMask, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glDisable(GLenum cap) {
+	uint64_t args[1];
+	args[0] = trace_integer(cap);
+	glad_trace_real.glDisable(cap);
+	trace_record(GLAD_TRACE_ID_glDisable, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glEnable(GLenum cap) {
+	uint64_t args[1];
+	args[0] = trace_integer(cap);
+	glad_trace_real.glEnable(cap);
+	trace_record(GLAD_TRACE_ID_glEnable, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glFinish(void) {
+	glad_trace_real.glFinish();
+	trace_record(GLAD_TRACE_ID_glFinish, NULL, 0, NULL);
+}
+static void APIENTRY glad_trace_glFlush(void) {
+	glad_trace_real.glFlush();
+	trace_record(GLAD_TRACE_ID_glFlush, NULL, 0, NULL);
+}
+static void APIENTRY glad_trace_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+	uint64_t args[2];
+	args[0] = trace_integer(sfactor);
+	args[1] = trace_integer(dfactor);
+	glad_trace_real.glBlendFunc(sfactor, dfactor);
+	trace_record(GLAD_TRACE_ID_glBlendFunc, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glLogicOp(GLenum opcode) {
+	uint64_t args[1];
+	args[0] = trace_integer(opcode);
+	glad_trace_real.glLogicOp(opcode);
+	trace_record(GLAD_TRACE_ID_glLogicOp, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+	uint64_t args[3];
+	args[0] = trace_integer(func);
+	args[1] = trace_integer(ref);
+	args[2] = trace_integer(mask);
+	glad_trace_real.glStencilFunc(func, ref, mask);
+	trace_record(GLAD_TRACE_ID_glStencilFunc, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+	uint64_t args[3];
+	args[0] = trace_integer(fail);
+	args[1] = trace_integer(zfail);
+	args[2] = trace_integer(zpass);
+	glad_trace_real.glStencilOp(fail, zfail, zpass);
+	trace_record(GLAD_TRACE_ID_glStencilOp, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glDepthFunc(GLenum func) {
+	uint64_t args[1];
+	args[0] = trace_integer(func);
+	glad_trace_real.glDepthFunc(func);
+	trace_record(GLAD_TRACE_ID_glDepthFunc, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glPixelStoref(GLenum pname, GLfloat param) {
+	uint64_t args[2];
+	args[0] = trace_integer(pname);
+	args[1] = trace_float(param);
+	glad_trace_real.glPixelStoref(pname, param);
+	trace_record(GLAD_TRACE_ID_glPixelStoref, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glPixelStorei(GLenum pname, GLint param) {
+	uint64_t args[2];
+	args[0] = trace_integer(pname);
+	args[1] = trace_integer(param);
+	glad_trace_real.glPixelStorei(pname, param);
+	trace_record(GLAD_TRACE_ID_glPixelStorei, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glReadBuffer(GLenum src) {
+	uint64_t args[1];
+	args[0] = trace_integer(src);
+	glad_trace_real.glReadBuffer(src);
+	trace_record(GLAD_TRACE_ID_glReadBuffer, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+	uint64_t args[7];
+	args[0] = trace_integer(x);
+	args[1] = trace_integer(y);
+	args[2] = trace_integer(width);
+	args[3] = trace_integer(height);
+	args[4] = trace_integer(format);
+	args[5] = trace_integer(type);
+	args[6] = 0;
+	glad_trace_real.glReadPixels(x, y, width, height, format, type, pixels);
+	trace_record(GLAD_TRACE_ID_glReadPixels, args, 7, NULL);
+}
+static void APIENTRY glad_trace_glGetBooleanv(GLenum pname, GLboolean *data) {
+	uint64_t args[2];
+	args[0] = trace_integer(pname);
+	args[1] = 0;
+	glad_trace_real.glGetBooleanv(pname, data);
+	trace_record(GLAD_TRACE_ID_glGetBooleanv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glGetDoublev(GLenum pname, GLdouble *data) {
+	uint64_t args[2];
+	args[0] = trace_integer(pname);
+	args[1] = 0;
+	glad_trace_real.glGetDoublev(pname, data);
+	trace_record(GLAD_TRACE_ID_glGetDoublev, args, 2, NULL);
+}
+static GLenum APIENTRY glad_trace_glGetError(void) {
+	GLenum result;
+	uint64_t traced;
+	result = glad_trace_real.glGetError();
+	traced = trace_integer(result);
+	trace_record(GLAD_TRACE_ID_glGetError, NULL, 0, &traced);
+	return result;
+}
+static void APIENTRY glad_trace_glGetFloatv(GLenum pname, GLfloat *data) {
+	uint64_t args[2];
+	args[0] = trace_integer(pname);
+	args[1] = 0;
+	glad_trace_real.glGetFloatv(pname, data);
+	trace_record(GLAD_TRACE_ID_glGetFloatv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glGetIntegerv(GLenum pname, GLint *data) {
+	uint64_t args[2];
+	args[0] = trace_integer(pname);
+	args[1] = 0;
+	glad_trace_real.glGetIntegerv(pname, data);
+	trace_record(GLAD_TRACE_ID_glGetIntegerv, args, 2, NULL);
+}
+static const GLubyte * APIENTRY glad_trace_glGetString(GLenum name) {
+	uint64_t args[1];
+	const GLubyte * result;
+	uint64_t traced;
+	args[0] = trace_integer(name);
+	result = glad_trace_real.glGetString(name);
+	traced = trace_pointer(result);
+	trace_record(GLAD_TRACE_ID_glGetString, args, 1, &traced);
+	return result;
+}
+static void APIENTRY glad_trace_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+	uint64_t args[5];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(level);
+	args[2] = trace_integer(format);
+	args[3] = trace_integer(type);
+	args[4] = 0;
+	glad_trace_real.glGetTexImage(target, level, format, type, pixels);
+	trace_record(GLAD_TRACE_ID_glGetTexImage, args, 5, NULL);
+}
+static void APIENTRY glad_trace_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(pname);
+	args[2] = 0;
+	glad_trace_real.glGetTexParameterfv(target, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetTexParameterfv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(pname);
+	args[2] = 0;
+	glad_trace_real.glGetTexParameteriv(target, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetTexParameteriv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+	uint64_t args[4];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(level);
+	args[2] = trace_integer(pname);
+	args[3] = 0;
+	glad_trace_real.glGetTexLevelParameterfv(target, level, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetTexLevelParameterfv, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+	uint64_t args[4];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(level);
+	args[2] = trace_integer(pname);
+	args[3] = 0;
+	glad_trace_real.glGetTexLevelParameteriv(target, level, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetTexLevelParameteriv, args, 4, NULL);
+}
+static GLboolean APIENTRY glad_trace_glIsEnabled(GLenum cap) {
+	uint64_t args[1];
+	GLboolean result;
+	uint64_t traced;
+	args[0] = trace_integer(cap);
+	result = glad_trace_real.glIsEnabled(cap);
+	traced = trace_integer(result);
+	trace_record(GLAD_TRACE_ID_glIsEnabled, args, 1, &traced);
+	return result;
+}
+static void APIENTRY glad_trace_glDepthRange(GLdouble n, GLdouble f) {
+	uint64_t args[2];
+	args[0] = trace_double(n);
+	args[1] = trace_double(f);
+	glad_trace_real.glDepthRange(n, f);
+	trace_record(GLAD_TRACE_ID_glDepthRange, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	uint64_t args[4];
+	args[0] = trace_integer(x);
+	args[1] = trace_integer(y);
+	args[2] = trace_integer(width);
+	args[3] = trace_integer(height);
+	glad_trace_real.glViewport(x, y, width, height);
+	trace_record(GLAD_TRACE_ID_glViewport, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+	uint64_t args[3];
+	args[0] = trace_integer(mode);
+	args[1] = trace_integer(first);
+	args[2] = trace_integer(count);
+	glad_trace_real.glDrawArrays(mode, first, count);
+	trace_record(GLAD_TRACE_ID_glDrawArrays, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+	uint64_t args[4];
+	args[0] = trace_integer(mode);
+	args[1] = trace_integer(count);
+	args[2] = trace_integer(type);
+	args[3] = trace_pointer(indices);
+	glad_trace_real.glDrawElements(mode, count, type, indices);
+	trace_record(GLAD_TRACE_ID_glDrawElements, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glPolygonOffset(GLfloat factor, GLfloat units) {
+	uint64_t args[2];
+	args[0] = trace_float(factor);
+	args[1] = trace_float(units);
+	glad_trace_real.glPolygonOffset(factor, units);
+	trace_record(GLAD_TRACE_ID_glPolygonOffset, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	uint64_t args[7];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(level);
+	args[2] = trace_integer(internalformat);
+	args[3] = trace_integer(x);
+	args[4] = trace_integer(y);
+	args[5] = trace_integer(width);
+	args[6] = trace_integer(border);
+	glad_trace_real.glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+	trace_record(GLAD_TRACE_ID_glCopyTexImage1D, args, 7, NULL);
+}
+static void APIENTRY glad_trace_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	uint64_t args[8];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(level);
+	args[2] = trace_integer(internalformat);
+	args[3] = trace_integer(x);
+	args[4] = trace_integer(y);
+	args[5] = trace_integer(width);
+	args[6] = trace_integer(height);
+	args[7] = trace_integer(border);
+	glad_trace_real.glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+	trace_record(GLAD_TRACE_ID_glCopyTexImage2D, args, 8, NULL);
+}
+static void APIENTRY glad_trace_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	uint64_t args[6];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(level);
+	args[2] = trace_integer(xoffset);
+	args[3] = trace_integer(x);
+	args[4] = trace_integer(y);
+	args[5] = trace_integer(width);
+	glad_trace_real.glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+	trace_record(GLAD_TRACE_ID_glCopyTexSubImage1D, args, 6, NULL);
+}
+static void APIENTRY glad_trace_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	uint64_t args[8];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(level);
+	args[2] = trace_integer(xoffset);
+	args[3] = trace_integer(yoffset);
+	args[4] = trace_integer(x);
+	args[5] = trace_integer(y);
+	args[6] = trace_integer(width);
+	args[7] = trace_integer(height);
+	glad_trace_real.glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+	trace_record(GLAD_TRACE_ID_glCopyTexSubImage2D, args, 8, NULL);
+}
+static void APIENTRY glad_trace_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	uint64_t args[7];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(level);
+	args[2] = trace_integer(xoffset);
+	args[3] = trace_integer(width);
+	args[4] = trace_integer(format);
+	args[5] = trace_integer(type);
+	args[6] = 0;
+	glad_trace_real.glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+	trace_record(GLAD_TRACE_ID_glTexSubImage1D, args, 7, NULL);
+}
+static void APIENTRY glad_trace_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	uint64_t args[9];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(level);
+	args[2] = trace_integer(xoffset);
+	args[3] = trace_integer(yoffset);
+	args[4] = trace_integer(width);
+	args[5] = trace_integer(height);
+	args[6] = trace_integer(format);
+	args[7] = trace_integer(type);
+	args[8] = 0;
+	glad_trace_real.glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+	trace_record(GLAD_TRACE_ID_glTexSubImage2D, args, 9, NULL);
+}
+static void APIENTRY glad_trace_glBindTexture(GLenum target, GLuint texture) {
+	uint64_t args[2];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(texture);
+	glad_trace_real.glBindTexture(target, texture);
+	trace_record(GLAD_TRACE_ID_glBindTexture, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glDeleteTextures(GLsizei n, const GLuint *textures) {
+	uint64_t args[2];
+	args[0] = trace_integer(n);
+	args[1] = trace_blob(textures, (size_t)(n) * sizeof(GLuint));
+	glad_trace_real.glDeleteTextures(n, textures);
+	trace_record(GLAD_TRACE_ID_glDeleteTextures, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glGenTextures(GLsizei n, GLuint *textures) {
+	uint64_t args[2];
+	args[0] = trace_integer(n);
+	args[1] = 0;
+	glad_trace_real.glGenTextures(n, textures);
+	args[1] = trace_blob(textures, (size_t)(n) * sizeof(GLuint));
+	trace_record(GLAD_TRACE_ID_glGenTextures, args, 2, NULL);
+}
+static GLboolean APIENTRY glad_trace_glIsTexture(GLuint texture) {
+	uint64_t args[1];
+	GLboolean result;
+	uint64_t traced;
+	args[0] = trace_integer(texture);
+	result = glad_trace_real.glIsTexture(texture);
+	traced = trace_integer(result);
+	trace_record(GLAD_TRACE_ID_glIsTexture, args, 1, &traced);
+	return result;
+}
+static void APIENTRY glad_trace_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+	uint64_t args[6];
+	args[0] = trace_integer(mode);
+	args[1] = trace_integer(start);
+	args[2] = trace_integer(end);
+	args[3] = trace_integer(count);
+	args[4] = trace_integer(type);
+	args[5] = trace_pointer(indices);
+	glad_trace_real.glDrawRangeElements(mode, start, end, count, type, indices);
+	trace_record(GLAD_TRACE_ID_glDrawRangeElements, args, 6, NULL);
+}
+static void APIENTRY glad_trace_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+	uint64_t args[10];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(level);
+	args[2] = trace_integer(internalformat);
+	args[3] = trace_integer(width);
+	args[4] = trace_integer(height);
+	args[5] = trace_integer(depth);
+	args[6] = trace_integer(border);
+	args[7] = trace_integer(format);
+	args[8] = trace_integer(type);
+	args[9] = 0;
+	glad_trace_real.glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+	trace_record(GLAD_TRACE_ID_glTexImage3D, args, 10, NULL);
+}
+static void APIENTRY glad_trace_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	uint64_t args[11];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(level);
+	args[2] = trace_integer(xoffset);
+	args[3] = trace_integer(yoffset);
+	args[4] = trace_integer(zoffset);
+	args[5] = trace_integer(width);
+	args[6] = trace_integer(height);
+	args[7] = trace_integer(depth);
+	args[8] = trace_integer(format);
+	args[9] = trace_integer(type);
+	args[10] = 0;
+	glad_trace_real.glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	trace_record(GLAD_TRACE_ID_glTexSubImage3D, args, 11, NULL);
+}
+static void APIENTRY glad_trace_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	uint64_t args[9];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(level);
+	args[2] = trace_integer(xoffset);
+	args[3] = trace_integer(yoffset);
+	args[4] = trace_integer(zoffset);
+	args[5] = trace_integer(x);
+	args[6] = trace_integer(y);
+	args[7] = trace_integer(width);
+	args[8] = trace_integer(height);
+	glad_trace_real.glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+	trace_record(GLAD_TRACE_ID_glCopyTexSubImage3D, args, 9, NULL);
+}
+static void APIENTRY glad_trace_glActiveTexture(GLenum texture) {
+	uint64_t args[1];
+	args[0] = trace_integer(texture);
+	glad_trace_real.glActiveTexture(texture);
+	trace_record(GLAD_TRACE_ID_glActiveTexture, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glSampleCoverage(GLfloat value, GLboolean invert) {
+	uint64_t args[2];
+	args[0] = trace_float(value);
+	args[1] = trace_integer(invert);
+	glad_trace_real.glSampleCoverage(value, invert);
+	trace_record(GLAD_TRACE_ID_glSampleCoverage, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+	uint64_t args[9];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(level);
+	args[2] = trace_integer(internalformat);
+	args[3] = trace_integer(width);
+	args[4] = trace_integer(height);
+	args[5] = trace_integer(depth);
+	args[6] = trace_integer(border);
+	args[7] = trace_integer(imageSize);
+	args[8] = trace_blob(data, (size_t)(imageSize));
+	glad_trace_real.glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+	trace_record(GLAD_TRACE_ID_glCompressedTexImage3D, args, 9, NULL);
+}
+static void APIENTRY glad_trace_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+	uint64_t args[8];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(level);
+	args[2] = trace_integer(internalformat);
+	args[3] = trace_integer(width);
+	args[4] = trace_integer(height);
+	args[5] = trace_integer(border);
+	args[6] = trace_integer(imageSize);
+	args[7] = trace_blob(data, (size_t)(imageSize));
+	glad_trace_real.glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+	trace_record(GLAD_TRACE_ID_glCompressedTexImage2D, args, 8, NULL);
+}
+static void APIENTRY glad_trace_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+	uint64_t args[7];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(level);
+	args[2] = trace_integer(internalformat);
+	args[3] = trace_integer(width);
+	args[4] = trace_integer(border);
+	args[5] = trace_integer(imageSize);
+	args[6] = trace_blob(data, (size_t)(imageSize));
+	glad_trace_real.glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+	trace_record(GLAD_TRACE_ID_glCompressedTexImage1D, args, 7, NULL);
+}
+static void APIENTRY glad_trace_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	uint64_t args[11];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(level);
+	args[2] = trace_integer(xoffset);
+	args[3] = trace_integer(yoffset);
+	args[4] = trace_integer(zoffset);
+	args[5] = trace_integer(width);
+	args[6] = trace_integer(height);
+	args[7] = trace_integer(depth);
+	args[8] = trace_integer(format);
+	args[9] = trace_integer(imageSize);
+	args[10] = trace_blob(data, (size_t)(imageSize));
+	glad_trace_real.glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	trace_record(GLAD_TRACE_ID_glCompressedTexSubImage3D, args, 11, NULL);
+}
+static void APIENTRY glad_trace_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	uint64_t args[9];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(level);
+	args[2] = trace_integer(xoffset);
+	args[3] = trace_integer(yoffset);
+	args[4] = trace_integer(width);
+	args[5] = trace_integer(height);
+	args[6] = trace_integer(format);
+	args[7] = trace_integer(imageSize);
+	args[8] = trace_blob(data, (size_t)(imageSize));
+	glad_trace_real.glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+	trace_record(GLAD_TRACE_ID_glCompressedTexSubImage2D, args, 9, NULL);
+}
+static void APIENTRY glad_trace_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	uint64_t args[7];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(level);
+	args[2] = trace_integer(xoffset);
+	args[3] = trace_integer(width);
+	args[4] = trace_integer(format);
+	args[5] = trace_integer(imageSize);
+	args[6] = trace_blob(data, (size_t)(imageSize));
+	glad_trace_real.glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+	trace_record(GLAD_TRACE_ID_glCompressedTexSubImage1D, args, 7, NULL);
+}
+static void APIENTRY glad_trace_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+	uint64_t args[3];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(level);
+	args[2] = 0;
+	glad_trace_real.glGetCompressedTexImage(target, level, img);
+	trace_record(GLAD_TRACE_ID_glGetCompressedTexImage, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+	uint64_t args[4];
+	args[0] = trace_integer(sfactorRGB);
+	args[1] = trace_integer(dfactorRGB);
+	args[2] = trace_integer(sfactorAlpha);
+	args[3] = trace_integer(dfactorAlpha);
+	glad_trace_real.glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+	trace_record(GLAD_TRACE_ID_glBlendFuncSeparate, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+	uint64_t args[4];
+	args[0] = trace_integer(mode);
+	args[1] = trace_blob(first, (size_t)(drawcount) * 4);
+	args[2] = trace_blob(count, (size_t)(drawcount) * 4);
+	args[3] = trace_integer(drawcount);
+	glad_trace_real.glMultiDrawArrays(mode, first, count, drawcount);
+	trace_record(GLAD_TRACE_ID_glMultiDrawArrays, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+	uint64_t args[5];
+	args[0] = trace_integer(mode);
+	args[1] = trace_blob(count, (size_t)(drawcount) * 4);
+	args[2] = trace_integer(type);
+	args[3] = trace_blob(indices, (size_t)(drawcount) * sizeof(void *));
+	args[4] = trace_integer(drawcount);
+	glad_trace_real.glMultiDrawElements(mode, count, type, indices, drawcount);
+	trace_record(GLAD_TRACE_ID_glMultiDrawElements, args, 5, NULL);
+}
+static void APIENTRY glad_trace_glPointParameterf(GLenum pname, GLfloat param) {
+	uint64_t args[2];
+	args[0] = trace_integer(pname);
+	args[1] = trace_float(param);
+	glad_trace_real.glPointParameterf(pname, param);
+	trace_record(GLAD_TRACE_ID_glPointParameterf, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glPointParameterfv(GLenum pname, const GLfloat *params) {
+	uint64_t args[2];
+	args[0] = trace_integer(pname);
+	args[1] = trace_blob(params, 4);
+	glad_trace_real.glPointParameterfv(pname, params);
+	trace_record(GLAD_TRACE_ID_glPointParameterfv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glPointParameteri(GLenum pname, GLint param) {
+	uint64_t args[2];
+	args[0] = trace_integer(pname);
+	args[1] = trace_integer(param);
+	glad_trace_real.glPointParameteri(pname, param);
+	trace_record(GLAD_TRACE_ID_glPointParameteri, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glPointParameteriv(GLenum pname, const GLint *params) {
+	uint64_t args[2];
+	args[0] = trace_integer(pname);
+	args[1] = trace_blob(params, 4);
+	glad_trace_real.glPointParameteriv(pname, params);
+	trace_record(GLAD_TRACE_ID_glPointParameteriv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	uint64_t args[4];
+	args[0] = trace_float(red);
+	args[1] = trace_float(green);
+	args[2] = trace_float(blue);
+	args[3] = trace_float(alpha);
+	glad_trace_real.glBlendColor(red, green, blue, alpha);
+	trace_record(GLAD_TRACE_ID_glBlendColor, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glBlendEquation(GLenum mode) {
+	uint64_t args[1];
+	args[0] = trace_integer(mode);
+	glad_trace_real.glBlendEquation(mode);
+	trace_record(GLAD_TRACE_ID_glBlendEquation, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glGenQueries(GLsizei n, GLuint *ids) {
+	uint64_t args[2];
+	args[0] = trace_integer(n);
+	args[1] = 0;
+	glad_trace_real.glGenQueries(n, ids);
+	args[1] = trace_blob(ids, (size_t)(n) * sizeof(GLuint));
+	trace_record(GLAD_TRACE_ID_glGenQueries, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glDeleteQueries(GLsizei n, const GLuint *ids) {
+	uint64_t args[2];
+	args[0] = trace_integer(n);
+	args[1] = trace_blob(ids, (size_t)(n) * sizeof(GLuint));
+	glad_trace_real.glDeleteQueries(n, ids);
+	trace_record(GLAD_TRACE_ID_glDeleteQueries, args, 2, NULL);
+}
+static GLboolean APIENTRY glad_trace_glIsQuery(GLuint id) {
+	uint64_t args[1];
+	GLboolean result;
+	uint64_t traced;
+	args[0] = trace_integer(id);
+	result = glad_trace_real.glIsQuery(id);
+	traced = trace_integer(result);
+	trace_record(GLAD_TRACE_ID_glIsQuery, args, 1, &traced);
+	return result;
+}
+static void APIENTRY glad_trace_glBeginQuery(GLenum target, GLuint id) {
+	uint64_t args[2];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(id);
+	glad_trace_real.glBeginQuery(target, id);
+	trace_record(GLAD_TRACE_ID_glBeginQuery, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glEndQuery(GLenum target) {
+	uint64_t args[1];
+	args[0] = trace_integer(target);
+	glad_trace_real.glEndQuery(target);
+	trace_record(GLAD_TRACE_ID_glEndQuery, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(pname);
+	args[2] = 0;
+	glad_trace_real.glGetQueryiv(target, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetQueryiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(id);
+	args[1] = trace_integer(pname);
+	args[2] = 0;
+	glad_trace_real.glGetQueryObjectiv(id, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetQueryObjectiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(id);
+	args[1] = trace_integer(pname);
+	args[2] = 0;
+	glad_trace_real.glGetQueryObjectuiv(id, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetQueryObjectuiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glBindBuffer(GLenum target, GLuint buffer) {
+	uint64_t args[2];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(buffer);
+	glad_trace_real.glBindBuffer(target, buffer);
+	trace_record(GLAD_TRACE_ID_glBindBuffer, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+	uint64_t args[2];
+	args[0] = trace_integer(n);
+	args[1] = trace_blob(buffers, (size_t)(n) * sizeof(GLuint));
+	glad_trace_real.glDeleteBuffers(n, buffers);
+	trace_record(GLAD_TRACE_ID_glDeleteBuffers, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glGenBuffers(GLsizei n, GLuint *buffers) {
+	uint64_t args[2];
+	args[0] = trace_integer(n);
+	args[1] = 0;
+	glad_trace_real.glGenBuffers(n, buffers);
+	args[1] = trace_blob(buffers, (size_t)(n) * sizeof(GLuint));
+	trace_record(GLAD_TRACE_ID_glGenBuffers, args, 2, NULL);
+}
+static GLboolean APIENTRY glad_trace_glIsBuffer(GLuint buffer) {
+	uint64_t args[1];
+	GLboolean result;
+	uint64_t traced;
+	args[0] = trace_integer(buffer);
+	result = glad_trace_real.glIsBuffer(buffer);
+	traced = trace_integer(result);
+	trace_record(GLAD_TRACE_ID_glIsBuffer, args, 1, &traced);
+	return result;
+}
+static void APIENTRY glad_trace_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+	uint64_t args[4];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(size);
+	args[2] = trace_blob(data, (size_t)(size));
+	args[3] = trace_integer(usage);
+	glad_trace_real.glBufferData(target, size, data, usage);
+	trace_record(GLAD_TRACE_ID_glBufferData, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+	uint64_t args[4];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(offset);
+	args[2] = trace_integer(size);
+	args[3] = trace_blob(data, (size_t)(size));
+	glad_trace_real.glBufferSubData(target, offset, size, data);
+	trace_record(GLAD_TRACE_ID_glBufferSubData, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+	uint64_t args[4];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(offset);
+	args[2] = trace_integer(size);
+	args[3] = 0;
+	glad_trace_real.glGetBufferSubData(target, offset, size, data);
+	trace_record(GLAD_TRACE_ID_glGetBufferSubData, args, 4, NULL);
+}
+static void * APIENTRY glad_trace_glMapBuffer(GLenum target, GLenum access) {
+	uint64_t args[2];
+	void * result;
+	uint64_t traced;
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(access);
+	result = glad_trace_real.glMapBuffer(target, access);
+	trace_map_buffer(target, result, access);
+	traced = trace_pointer(result);
+	trace_record(GLAD_TRACE_ID_glMapBuffer, args, 2, &traced);
+	return result;
+}
+static GLboolean APIENTRY glad_trace_glUnmapBuffer(GLenum target) {
+	uint64_t args[1];
+	GLboolean result;
+	uint64_t traced;
+	args[0] = trace_integer(target);
+	trace_unmap(target);
+	result = glad_trace_real.glUnmapBuffer(target);
+	traced = trace_integer(result);
+	trace_record(GLAD_TRACE_ID_glUnmapBuffer, args, 1, &traced);
+	return result;
+}
+static void APIENTRY glad_trace_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(pname);
+	args[2] = 0;
+	glad_trace_real.glGetBufferParameteriv(target, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetBufferParameteriv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+	uint64_t args[3];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(pname);
+	args[2] = 0;
+	glad_trace_real.glGetBufferPointerv(target, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetBufferPointerv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+	uint64_t args[2];
+	args[0] = trace_integer(modeRGB);
+	args[1] = trace_integer(modeAlpha);
+	glad_trace_real.glBlendEquationSeparate(modeRGB, modeAlpha);
+	trace_record(GLAD_TRACE_ID_glBlendEquationSeparate, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+	uint64_t args[2];
+	args[0] = trace_integer(n);
+	args[1] = trace_blob(bufs, (size_t)(n) * 4);
+	glad_trace_real.glDrawBuffers(n, bufs);
+	trace_record(GLAD_TRACE_ID_glDrawBuffers, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+	uint64_t args[4];
+	args[0] = trace_integer(face);
+	args[1] = trace_integer(sfail);
+	args[2] = trace_integer(dpfail);
+	args[3] = trace_integer(dppass);
+	glad_trace_real.glStencilOpSeparate(face, sfail, dpfail, dppass);
+	trace_record(GLAD_TRACE_ID_glStencilOpSeparate, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+	uint64_t args[4];
+	args[0] = trace_integer(face);
+	args[1] = trace_integer(func);
+	args[2] = trace_integer(ref);
+	args[3] = trace_integer(mask);
+	glad_trace_real.glStencilFuncSeparate(face, func, ref, mask);
+	trace_record(GLAD_TRACE_ID_glStencilFuncSeparate, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glStencilMaskSeparate(GLenum face, GLuint mask) {
+	uint64_t args[2];
+	args[0] = trace_integer(face);
+	args[1] = trace_integer(mask);
+	glad_trace_real.glStencilMaskSeparate(face, mask);
+	trace_record(GLAD_TRACE_ID_glStencilMaskSeparate, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glAttachShader(GLuint program, GLuint shader) {
+	uint64_t args[2];
+	args[0] = trace_integer(program);
+	args[1] = trace_integer(shader);
+	glad_trace_real.glAttachShader(program, shader);
+	trace_record(GLAD_TRACE_ID_glAttachShader, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+	uint64_t args[3];
+	args[0] = trace_integer(program);
+	args[1] = trace_integer(index);
+	args[2] = trace_blob(name, strlen(name) + 1);
+	glad_trace_real.glBindAttribLocation(program, index, name);
+	trace_record(GLAD_TRACE_ID_glBindAttribLocation, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glCompileShader(GLuint shader) {
+	uint64_t args[1];
+	args[0] = trace_integer(shader);
+	glad_trace_real.glCompileShader(shader);
+	trace_record(GLAD_TRACE_ID_glCompileShader, args, 1, NULL);
+}
+static GLuint APIENTRY glad_trace_glCreateProgram(void) {
+	GLuint result;
+	uint64_t traced;
+	result = glad_trace_real.glCreateProgram();
+	traced = trace_integer(result);
+	trace_record(GLAD_TRACE_ID_glCreateProgram, NULL, 0, &traced);
+	return result;
+}
+static GLuint APIENTRY glad_trace_glCreateShader(GLenum type) {
+	uint64_t args[1];
+	GLuint result;
+	uint64_t traced;
+	args[0] = trace_integer(type);
+	result = glad_trace_real.glCreateShader(type);
+	traced = trace_integer(result);
+	trace_record(GLAD_TRACE_ID_glCreateShader, args, 1, &traced);
+	return result;
+}
+static void APIENTRY glad_trace_glDeleteProgram(GLuint program) {
+	uint64_t args[1];
+	args[0] = trace_integer(program);
+	glad_trace_real.glDeleteProgram(program);
+	trace_record(GLAD_TRACE_ID_glDeleteProgram, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glDeleteShader(GLuint shader) {
+	uint64_t args[1];
+	args[0] = trace_integer(shader);
+	glad_trace_real.glDeleteShader(shader);
+	trace_record(GLAD_TRACE_ID_glDeleteShader, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glDetachShader(GLuint program, GLuint shader) {
+	uint64_t args[2];
+	args[0] = trace_integer(program);
+	args[1] = trace_integer(shader);
+	glad_trace_real.glDetachShader(program, shader);
+	trace_record(GLAD_TRACE_ID_glDetachShader, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glDisableVertexAttribArray(GLuint index) {
+	uint64_t args[1];
+	args[0] = trace_integer(index);
+	glad_trace_real.glDisableVertexAttribArray(index);
+	trace_record(GLAD_TRACE_ID_glDisableVertexAttribArray, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glEnableVertexAttribArray(GLuint index) {
+	uint64_t args[1];
+	args[0] = trace_integer(index);
+	glad_trace_real.glEnableVertexAttribArray(index);
+	trace_record(GLAD_TRACE_ID_glEnableVertexAttribArray, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	uint64_t args[7];
+	args[0] = trace_integer(program);
+	args[1] = trace_integer(index);
+	args[2] = trace_integer(bufSize);
+	args[3] = 0;
+	args[4] = 0;
+	args[5] = 0;
+	args[6] = 0;
+	glad_trace_real.glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+	trace_record(GLAD_TRACE_ID_glGetActiveAttrib, args, 7, NULL);
+}
+static void APIENTRY glad_trace_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	uint64_t args[7];
+	args[0] = trace_integer(program);
+	args[1] = trace_integer(index);
+	args[2] = trace_integer(bufSize);
+	args[3] = 0;
+	args[4] = 0;
+	args[5] = 0;
+	args[6] = 0;
+	glad_trace_real.glGetActiveUniform(program, index, bufSize, length, size, type, name);
+	trace_record(GLAD_TRACE_ID_glGetActiveUniform, args, 7, NULL);
+}
+static void APIENTRY glad_trace_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+	uint64_t args[4];
+	args[0] = trace_integer(program);
+	args[1] = trace_integer(maxCount);
+	args[2] = 0;
+	args[3] = 0;
+	glad_trace_real.glGetAttachedShaders(program, maxCount, count, shaders);
+	trace_record(GLAD_TRACE_ID_glGetAttachedShaders, args, 4, NULL);
+}
+static GLint APIENTRY glad_trace_glGetAttribLocation(GLuint program, const GLchar *name) {
+	uint64_t args[2];
+	GLint result;
+	uint64_t traced;
+	args[0] = trace_integer(program);
+	args[1] = trace_blob(name, strlen(name) + 1);
+	result = glad_trace_real.glGetAttribLocation(program, name);
+	traced = trace_integer(result);
+	trace_record(GLAD_TRACE_ID_glGetAttribLocation, args, 2, &traced);
+	return result;
+}
+static void APIENTRY glad_trace_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(program);
+	args[1] = trace_integer(pname);
+	args[2] = 0;
+	glad_trace_real.glGetProgramiv(program, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetProgramiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	uint64_t args[4];
+	args[0] = trace_integer(program);
+	args[1] = trace_integer(bufSize);
+	args[2] = 0;
+	args[3] = 0;
+	glad_trace_real.glGetProgramInfoLog(program, bufSize, length, infoLog);
+	trace_record(GLAD_TRACE_ID_glGetProgramInfoLog, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(shader);
+	args[1] = trace_integer(pname);
+	args[2] = 0;
+	glad_trace_real.glGetShaderiv(shader, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetShaderiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	uint64_t args[4];
+	args[0] = trace_integer(shader);
+	args[1] = trace_integer(bufSize);
+	args[2] = 0;
+	args[3] = 0;
+	glad_trace_real.glGetShaderInfoLog(shader, bufSize, length, infoLog);
+	trace_record(GLAD_TRACE_ID_glGetShaderInfoLog, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+	uint64_t args[4];
+	args[0] = trace_integer(shader);
+	args[1] = trace_integer(bufSize);
+	args[2] = 0;
+	args[3] = 0;
+	glad_trace_real.glGetShaderSource(shader, bufSize, length, source);
+	trace_record(GLAD_TRACE_ID_glGetShaderSource, args, 4, NULL);
+}
+static GLint APIENTRY glad_trace_glGetUniformLocation(GLuint program, const GLchar *name) {
+	uint64_t args[2];
+	GLint result;
+	uint64_t traced;
+	args[0] = trace_integer(program);
+	args[1] = trace_blob(name, strlen(name) + 1);
+	result = glad_trace_real.glGetUniformLocation(program, name);
+	traced = trace_integer(result);
+	trace_record(GLAD_TRACE_ID_glGetUniformLocation, args, 2, &traced);
+	return result;
+}
+static void APIENTRY glad_trace_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(program);
+	args[1] = trace_integer(location);
+	args[2] = 0;
+	glad_trace_real.glGetUniformfv(program, location, params);
+	trace_record(GLAD_TRACE_ID_glGetUniformfv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(program);
+	args[1] = trace_integer(location);
+	args[2] = 0;
+	glad_trace_real.glGetUniformiv(program, location, params);
+	trace_record(GLAD_TRACE_ID_glGetUniformiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(pname);
+	args[2] = 0;
+	glad_trace_real.glGetVertexAttribdv(index, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetVertexAttribdv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(pname);
+	args[2] = 0;
+	glad_trace_real.glGetVertexAttribfv(index, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetVertexAttribfv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(pname);
+	args[2] = 0;
+	glad_trace_real.glGetVertexAttribiv(index, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetVertexAttribiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+	uint64_t args[3];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(pname);
+	args[2] = 0;
+	glad_trace_real.glGetVertexAttribPointerv(index, pname, pointer);
+	trace_record(GLAD_TRACE_ID_glGetVertexAttribPointerv, args, 3, NULL);
+}
+static GLboolean APIENTRY glad_trace_glIsProgram(GLuint program) {
+	uint64_t args[1];
+	GLboolean result;
+	uint64_t traced;
+	args[0] = trace_integer(program);
+	result = glad_trace_real.glIsProgram(program);
+	traced = trace_integer(result);
+	trace_record(GLAD_TRACE_ID_glIsProgram, args, 1, &traced);
+	return result;
+}
+static GLboolean APIENTRY glad_trace_glIsShader(GLuint shader) {
+	uint64_t args[1];
+	GLboolean result;
+	uint64_t traced;
+	args[0] = trace_integer(shader);
+	result = glad_trace_real.glIsShader(shader);
+	traced = trace_integer(result);
+	trace_record(GLAD_TRACE_ID_glIsShader, args, 1, &traced);
+	return result;
+}
+static void APIENTRY glad_trace_glLinkProgram(GLuint program) {
+	uint64_t args[1];
+	args[0] = trace_integer(program);
+	glad_trace_real.glLinkProgram(program);
+	trace_record(GLAD_TRACE_ID_glLinkProgram, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+	uint64_t args[4];
+	args[0] = trace_integer(shader);
+	args[1] = trace_integer(count);
+	args[2] = trace_strings(count, string, length);
+	args[3] = 0;
+	glad_trace_real.glShaderSource(shader, count, string, length);
+	trace_record(GLAD_TRACE_ID_glShaderSource, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glUseProgram(GLuint program) {
+	uint64_t args[1];
+	args[0] = trace_integer(program);
+	glad_trace_real.glUseProgram(program);
+	trace_record(GLAD_TRACE_ID_glUseProgram, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glUniform1f(GLint location, GLfloat v0) {
+	uint64_t args[2];
+	args[0] = trace_integer(location);
+	args[1] = trace_float(v0);
+	glad_trace_real.glUniform1f(location, v0);
+	trace_record(GLAD_TRACE_ID_glUniform1f, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+	uint64_t args[3];
+	args[0] = trace_integer(location);
+	args[1] = trace_float(v0);
+	args[2] = trace_float(v1);
+	glad_trace_real.glUniform2f(location, v0, v1);
+	trace_record(GLAD_TRACE_ID_glUniform2f, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	uint64_t args[4];
+	args[0] = trace_integer(location);
+	args[1] = trace_float(v0);
+	args[2] = trace_float(v1);
+	args[3] = trace_float(v2);
+	glad_trace_real.glUniform3f(location, v0, v1, v2);
+	trace_record(GLAD_TRACE_ID_glUniform3f, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	uint64_t args[5];
+	args[0] = trace_integer(location);
+	args[1] = trace_float(v0);
+	args[2] = trace_float(v1);
+	args[3] = trace_float(v2);
+	args[4] = trace_float(v3);
+	glad_trace_real.glUniform4f(location, v0, v1, v2, v3);
+	trace_record(GLAD_TRACE_ID_glUniform4f, args, 5, NULL);
+}
+static void APIENTRY glad_trace_glUniform1i(GLint location, GLint v0) {
+	uint64_t args[2];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(v0);
+	glad_trace_real.glUniform1i(location, v0);
+	trace_record(GLAD_TRACE_ID_glUniform1i, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glUniform2i(GLint location, GLint v0, GLint v1) {
+	uint64_t args[3];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(v0);
+	args[2] = trace_integer(v1);
+	glad_trace_real.glUniform2i(location, v0, v1);
+	trace_record(GLAD_TRACE_ID_glUniform2i, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+	uint64_t args[4];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(v0);
+	args[2] = trace_integer(v1);
+	args[3] = trace_integer(v2);
+	glad_trace_real.glUniform3i(location, v0, v1, v2);
+	trace_record(GLAD_TRACE_ID_glUniform3i, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	uint64_t args[5];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(v0);
+	args[2] = trace_integer(v1);
+	args[3] = trace_integer(v2);
+	args[4] = trace_integer(v3);
+	glad_trace_real.glUniform4i(location, v0, v1, v2, v3);
+	trace_record(GLAD_TRACE_ID_glUniform4i, args, 5, NULL);
+}
+static void APIENTRY glad_trace_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+	uint64_t args[3];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(count);
+	args[2] = trace_blob(value, (size_t)(count) * 1 * 4);
+	glad_trace_real.glUniform1fv(location, count, value);
+	trace_record(GLAD_TRACE_ID_glUniform1fv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+	uint64_t args[3];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(count);
+	args[2] = trace_blob(value, (size_t)(count) * 2 * 4);
+	glad_trace_real.glUniform2fv(location, count, value);
+	trace_record(GLAD_TRACE_ID_glUniform2fv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+	uint64_t args[3];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(count);
+	args[2] = trace_blob(value, (size_t)(count) * 3 * 4);
+	glad_trace_real.glUniform3fv(location, count, value);
+	trace_record(GLAD_TRACE_ID_glUniform3fv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+	uint64_t args[3];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(count);
+	args[2] = trace_blob(value, (size_t)(count) * 4 * 4);
+	glad_trace_real.glUniform4fv(location, count, value);
+	trace_record(GLAD_TRACE_ID_glUniform4fv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+	uint64_t args[3];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(count);
+	args[2] = trace_blob(value, (size_t)(count) * 1 * 4);
+	glad_trace_real.glUniform1iv(location, count, value);
+	trace_record(GLAD_TRACE_ID_glUniform1iv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+	uint64_t args[3];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(count);
+	args[2] = trace_blob(value, (size_t)(count) * 2 * 4);
+	glad_trace_real.glUniform2iv(location, count, value);
+	trace_record(GLAD_TRACE_ID_glUniform2iv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+	uint64_t args[3];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(count);
+	args[2] = trace_blob(value, (size_t)(count) * 3 * 4);
+	glad_trace_real.glUniform3iv(location, count, value);
+	trace_record(GLAD_TRACE_ID_glUniform3iv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+	uint64_t args[3];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(count);
+	args[2] = trace_blob(value, (size_t)(count) * 4 * 4);
+	glad_trace_real.glUniform4iv(location, count, value);
+	trace_record(GLAD_TRACE_ID_glUniform4iv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	uint64_t args[4];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(count);
+	args[2] = trace_integer(transpose);
+	args[3] = trace_blob(value, (size_t)(count) * 4 * 4);
+	glad_trace_real.glUniformMatrix2fv(location, count, transpose, value);
+	trace_record(GLAD_TRACE_ID_glUniformMatrix2fv, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	uint64_t args[4];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(count);
+	args[2] = trace_integer(transpose);
+	args[3] = trace_blob(value, (size_t)(count) * 9 * 4);
+	glad_trace_real.glUniformMatrix3fv(location, count, transpose, value);
+	trace_record(GLAD_TRACE_ID_glUniformMatrix3fv, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	uint64_t args[4];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(count);
+	args[2] = trace_integer(transpose);
+	args[3] = trace_blob(value, (size_t)(count) * 16 * 4);
+	glad_trace_real.glUniformMatrix4fv(location, count, transpose, value);
+	trace_record(GLAD_TRACE_ID_glUniformMatrix4fv, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glValidateProgram(GLuint program) {
+	uint64_t args[1];
+	args[0] = trace_integer(program);
+	glad_trace_real.glValidateProgram(program);
+	trace_record(GLAD_TRACE_ID_glValidateProgram, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib1d(GLuint index, GLdouble x) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_double(x);
+	glad_trace_real.glVertexAttrib1d(index, x);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib1d, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 1 * 8);
+	glad_trace_real.glVertexAttrib1dv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib1dv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib1f(GLuint index, GLfloat x) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_float(x);
+	glad_trace_real.glVertexAttrib1f(index, x);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib1f, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 1 * 4);
+	glad_trace_real.glVertexAttrib1fv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib1fv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib1s(GLuint index, GLshort x) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(x);
+	glad_trace_real.glVertexAttrib1s(index, x);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib1s, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 1 * 2);
+	glad_trace_real.glVertexAttrib1sv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib1sv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+	uint64_t args[3];
+	args[0] = trace_integer(index);
+	args[1] = trace_double(x);
+	args[2] = trace_double(y);
+	glad_trace_real.glVertexAttrib2d(index, x, y);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib2d, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 2 * 8);
+	glad_trace_real.glVertexAttrib2dv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib2dv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+	uint64_t args[3];
+	args[0] = trace_integer(index);
+	args[1] = trace_float(x);
+	args[2] = trace_float(y);
+	glad_trace_real.glVertexAttrib2f(index, x, y);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib2f, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 2 * 4);
+	glad_trace_real.glVertexAttrib2fv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib2fv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+	uint64_t args[3];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(x);
+	args[2] = trace_integer(y);
+	glad_trace_real.glVertexAttrib2s(index, x, y);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib2s, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 2 * 2);
+	glad_trace_real.glVertexAttrib2sv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib2sv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	uint64_t args[4];
+	args[0] = trace_integer(index);
+	args[1] = trace_double(x);
+	args[2] = trace_double(y);
+	args[3] = trace_double(z);
+	glad_trace_real.glVertexAttrib3d(index, x, y, z);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib3d, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 3 * 8);
+	glad_trace_real.glVertexAttrib3dv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib3dv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+	uint64_t args[4];
+	args[0] = trace_integer(index);
+	args[1] = trace_float(x);
+	args[2] = trace_float(y);
+	args[3] = trace_float(z);
+	glad_trace_real.glVertexAttrib3f(index, x, y, z);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib3f, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 3 * 4);
+	glad_trace_real.glVertexAttrib3fv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib3fv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+	uint64_t args[4];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(x);
+	args[2] = trace_integer(y);
+	args[3] = trace_integer(z);
+	glad_trace_real.glVertexAttrib3s(index, x, y, z);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib3s, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 3 * 2);
+	glad_trace_real.glVertexAttrib3sv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib3sv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 4 * 1);
+	glad_trace_real.glVertexAttrib4Nbv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib4Nbv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 4 * 4);
+	glad_trace_real.glVertexAttrib4Niv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib4Niv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 4 * 2);
+	glad_trace_real.glVertexAttrib4Nsv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib4Nsv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+	uint64_t args[5];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(x);
+	args[2] = trace_integer(y);
+	args[3] = trace_integer(z);
+	args[4] = trace_integer(w);
+	glad_trace_real.glVertexAttrib4Nub(index, x, y, z, w);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib4Nub, args, 5, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 4 * 1);
+	glad_trace_real.glVertexAttrib4Nubv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib4Nubv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 4 * 4);
+	glad_trace_real.glVertexAttrib4Nuiv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib4Nuiv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 4 * 2);
+	glad_trace_real.glVertexAttrib4Nusv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib4Nusv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 4 * 1);
+	glad_trace_real.glVertexAttrib4bv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib4bv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	uint64_t args[5];
+	args[0] = trace_integer(index);
+	args[1] = trace_double(x);
+	args[2] = trace_double(y);
+	args[3] = trace_double(z);
+	args[4] = trace_double(w);
+	glad_trace_real.glVertexAttrib4d(index, x, y, z, w);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib4d, args, 5, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 4 * 8);
+	glad_trace_real.glVertexAttrib4dv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib4dv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	uint64_t args[5];
+	args[0] = trace_integer(index);
+	args[1] = trace_float(x);
+	args[2] = trace_float(y);
+	args[3] = trace_float(z);
+	args[4] = trace_float(w);
+	glad_trace_real.glVertexAttrib4f(index, x, y, z, w);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib4f, args, 5, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 4 * 4);
+	glad_trace_real.glVertexAttrib4fv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib4fv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib4iv(GLuint index, const GLint *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 4 * 4);
+	glad_trace_real.glVertexAttrib4iv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib4iv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+	uint64_t args[5];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(x);
+	args[2] = trace_integer(y);
+	args[3] = trace_integer(z);
+	args[4] = trace_integer(w);
+	glad_trace_real.glVertexAttrib4s(index, x, y, z, w);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib4s, args, 5, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 4 * 2);
+	glad_trace_real.glVertexAttrib4sv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib4sv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 4 * 1);
+	glad_trace_real.glVertexAttrib4ubv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib4ubv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 4 * 4);
+	glad_trace_real.glVertexAttrib4uiv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib4uiv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 4 * 2);
+	glad_trace_real.glVertexAttrib4usv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttrib4usv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+	uint64_t args[6];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(size);
+	args[2] = trace_integer(type);
+	args[3] = trace_integer(normalized);
+	args[4] = trace_integer(stride);
+	args[5] = trace_pointer(pointer);
+	glad_trace_real.glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+	trace_record(GLAD_TRACE_ID_glVertexAttribPointer, args, 6, NULL);
+}
+static void APIENTRY glad_trace_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	uint64_t args[4];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(count);
+	args[2] = trace_integer(transpose);
+	args[3] = trace_blob(value, (size_t)(count) * 6 * 4);
+	glad_trace_real.glUniformMatrix2x3fv(location, count, transpose, value);
+	trace_record(GLAD_TRACE_ID_glUniformMatrix2x3fv, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	uint64_t args[4];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(count);
+	args[2] = trace_integer(transpose);
+	args[3] = trace_blob(value, (size_t)(count) * 6 * 4);
+	glad_trace_real.glUniformMatrix3x2fv(location, count, transpose, value);
+	trace_record(GLAD_TRACE_ID_glUniformMatrix3x2fv, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	uint64_t args[4];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(count);
+	args[2] = trace_integer(transpose);
+	args[3] = trace_blob(value, (size_t)(count) * 8 * 4);
+	glad_trace_real.glUniformMatrix2x4fv(location, count, transpose, value);
+	trace_record(GLAD_TRACE_ID_glUniformMatrix2x4fv, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	uint64_t args[4];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(count);
+	args[2] = trace_integer(transpose);
+	args[3] = trace_blob(value, (size_t)(count) * 8 * 4);
+	glad_trace_real.glUniformMatrix4x2fv(location, count, transpose, value);
+	trace_record(GLAD_TRACE_ID_glUniformMatrix4x2fv, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	uint64_t args[4];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(count);
+	args[2] = trace_integer(transpose);
+	args[3] = trace_blob(value, (size_t)(count) * 12 * 4);
+	glad_trace_real.glUniformMatrix3x4fv(location, count, transpose, value);
+	trace_record(GLAD_TRACE_ID_glUniformMatrix3x4fv, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	uint64_t args[4];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(count);
+	args[2] = trace_integer(transpose);
+	args[3] = trace_blob(value, (size_t)(count) * 12 * 4);
+	glad_trace_real.glUniformMatrix4x3fv(location, count, transpose, value);
+	trace_record(GLAD_TRACE_ID_glUniformMatrix4x3fv, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+	uint64_t args[5];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(r);
+	args[2] = trace_integer(g);
+	args[3] = trace_integer(b);
+	args[4] = trace_integer(a);
+	glad_trace_real.glColorMaski(index, r, g, b, a);
+	trace_record(GLAD_TRACE_ID_glColorMaski, args, 5, NULL);
+}
+static void APIENTRY glad_trace_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+	uint64_t args[3];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(index);
+	args[2] = 0;
+	glad_trace_real.glGetBooleani_v(target, index, data);
+	trace_record(GLAD_TRACE_ID_glGetBooleani_v, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+	uint64_t args[3];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(index);
+	args[2] = 0;
+	glad_trace_real.glGetIntegeri_v(target, index, data);
+	trace_record(GLAD_TRACE_ID_glGetIntegeri_v, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glEnablei(GLenum target, GLuint index) {
+	uint64_t args[2];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(index);
+	glad_trace_real.glEnablei(target, index);
+	trace_record(GLAD_TRACE_ID_glEnablei, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glDisablei(GLenum target, GLuint index) {
+	uint64_t args[2];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(index);
+	glad_trace_real.glDisablei(target, index);
+	trace_record(GLAD_TRACE_ID_glDisablei, args, 2, NULL);
+}
+static GLboolean APIENTRY glad_trace_glIsEnabledi(GLenum target, GLuint index) {
+	uint64_t args[2];
+	GLboolean result;
+	uint64_t traced;
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(index);
+	result = glad_trace_real.glIsEnabledi(target, index);
+	traced = trace_integer(result);
+	trace_record(GLAD_TRACE_ID_glIsEnabledi, args, 2, &traced);
+	return result;
+}
+static void APIENTRY glad_trace_glBeginTransformFeedback(GLenum primitiveMode) {
+	uint64_t args[1];
+	args[0] = trace_integer(primitiveMode);
+	glad_trace_real.glBeginTransformFeedback(primitiveMode);
+	trace_record(GLAD_TRACE_ID_glBeginTransformFeedback, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glEndTransformFeedback(void) {
+	glad_trace_real.glEndTransformFeedback();
+	trace_record(GLAD_TRACE_ID_glEndTransformFeedback, NULL, 0, NULL);
+}
+static void APIENTRY glad_trace_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	uint64_t args[5];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(index);
+	args[2] = trace_integer(buffer);
+	args[3] = trace_integer(offset);
+	args[4] = trace_integer(size);
+	glad_trace_real.glBindBufferRange(target, index, buffer, offset, size);
+	trace_record(GLAD_TRACE_ID_glBindBufferRange, args, 5, NULL);
+}
+static void APIENTRY glad_trace_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+	uint64_t args[3];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(index);
+	args[2] = trace_integer(buffer);
+	glad_trace_real.glBindBufferBase(target, index, buffer);
+	trace_record(GLAD_TRACE_ID_glBindBufferBase, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+	uint64_t args[4];
+	args[0] = trace_integer(program);
+	args[1] = trace_integer(count);
+	args[2] = trace_strings(count, varyings, NULL);
+	args[3] = trace_integer(bufferMode);
+	glad_trace_real.glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+	trace_record(GLAD_TRACE_ID_glTransformFeedbackVaryings, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+	uint64_t args[7];
+	args[0] = trace_integer(program);
+	args[1] = trace_integer(index);
+	args[2] = trace_integer(bufSize);
+	args[3] = 0;
+	args[4] = 0;
+	args[5] = 0;
+	args[6] = 0;
+	glad_trace_real.glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+	trace_record(GLAD_TRACE_ID_glGetTransformFeedbackVarying, args, 7, NULL);
+}
+static void APIENTRY glad_trace_glClampColor(GLenum target, GLenum clamp) {
+	uint64_t args[2];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(clamp);
+	glad_trace_real.glClampColor(target, clamp);
+	trace_record(GLAD_TRACE_ID_glClampColor, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glBeginConditionalRender(GLuint id, GLenum mode) {
+	uint64_t args[2];
+	args[0] = trace_integer(id);
+	args[1] = trace_integer(mode);
+	glad_trace_real.glBeginConditionalRender(id, mode);
+	trace_record(GLAD_TRACE_ID_glBeginConditionalRender, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glEndConditionalRender(void) {
+	glad_trace_real.glEndConditionalRender();
+	trace_record(GLAD_TRACE_ID_glEndConditionalRender, NULL, 0, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	uint64_t args[5];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(size);
+	args[2] = trace_integer(type);
+	args[3] = trace_integer(stride);
+	args[4] = trace_pointer(pointer);
+	glad_trace_real.glVertexAttribIPointer(index, size, type, stride, pointer);
+	trace_record(GLAD_TRACE_ID_glVertexAttribIPointer, args, 5, NULL);
+}
+static void APIENTRY glad_trace_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(pname);
+	args[2] = 0;
+	glad_trace_real.glGetVertexAttribIiv(index, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetVertexAttribIiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(pname);
+	args[2] = 0;
+	glad_trace_real.glGetVertexAttribIuiv(index, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetVertexAttribIuiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribI1i(GLuint index, GLint x) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(x);
+	glad_trace_real.glVertexAttribI1i(index, x);
+	trace_record(GLAD_TRACE_ID_glVertexAttribI1i, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+	uint64_t args[3];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(x);
+	args[2] = trace_integer(y);
+	glad_trace_real.glVertexAttribI2i(index, x, y);
+	trace_record(GLAD_TRACE_ID_glVertexAttribI2i, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+	uint64_t args[4];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(x);
+	args[2] = trace_integer(y);
+	args[3] = trace_integer(z);
+	glad_trace_real.glVertexAttribI3i(index, x, y, z);
+	trace_record(GLAD_TRACE_ID_glVertexAttribI3i, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	uint64_t args[5];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(x);
+	args[2] = trace_integer(y);
+	args[3] = trace_integer(z);
+	args[4] = trace_integer(w);
+	glad_trace_real.glVertexAttribI4i(index, x, y, z, w);
+	trace_record(GLAD_TRACE_ID_glVertexAttribI4i, args, 5, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribI1ui(GLuint index, GLuint x) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(x);
+	glad_trace_real.glVertexAttribI1ui(index, x);
+	trace_record(GLAD_TRACE_ID_glVertexAttribI1ui, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+	uint64_t args[3];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(x);
+	args[2] = trace_integer(y);
+	glad_trace_real.glVertexAttribI2ui(index, x, y);
+	trace_record(GLAD_TRACE_ID_glVertexAttribI2ui, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+	uint64_t args[4];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(x);
+	args[2] = trace_integer(y);
+	args[3] = trace_integer(z);
+	glad_trace_real.glVertexAttribI3ui(index, x, y, z);
+	trace_record(GLAD_TRACE_ID_glVertexAttribI3ui, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	uint64_t args[5];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(x);
+	args[2] = trace_integer(y);
+	args[3] = trace_integer(z);
+	args[4] = trace_integer(w);
+	glad_trace_real.glVertexAttribI4ui(index, x, y, z, w);
+	trace_record(GLAD_TRACE_ID_glVertexAttribI4ui, args, 5, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribI1iv(GLuint index, const GLint *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 1 * 4);
+	glad_trace_real.glVertexAttribI1iv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttribI1iv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribI2iv(GLuint index, const GLint *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 2 * 4);
+	glad_trace_real.glVertexAttribI2iv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttribI2iv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribI3iv(GLuint index, const GLint *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 3 * 4);
+	glad_trace_real.glVertexAttribI3iv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttribI3iv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribI4iv(GLuint index, const GLint *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 4 * 4);
+	glad_trace_real.glVertexAttribI4iv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttribI4iv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 1 * 4);
+	glad_trace_real.glVertexAttribI1uiv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttribI1uiv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 2 * 4);
+	glad_trace_real.glVertexAttribI2uiv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttribI2uiv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 3 * 4);
+	glad_trace_real.glVertexAttribI3uiv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttribI3uiv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 4 * 4);
+	glad_trace_real.glVertexAttribI4uiv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttribI4uiv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 4 * 1);
+	glad_trace_real.glVertexAttribI4bv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttribI4bv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 4 * 2);
+	glad_trace_real.glVertexAttribI4sv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttribI4sv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 4 * 1);
+	glad_trace_real.glVertexAttribI4ubv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttribI4ubv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_blob(v, 4 * 2);
+	glad_trace_real.glVertexAttribI4usv(index, v);
+	trace_record(GLAD_TRACE_ID_glVertexAttribI4usv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(program);
+	args[1] = trace_integer(location);
+	args[2] = 0;
+	glad_trace_real.glGetUniformuiv(program, location, params);
+	trace_record(GLAD_TRACE_ID_glGetUniformuiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+	uint64_t args[3];
+	args[0] = trace_integer(program);
+	args[1] = trace_integer(color);
+	args[2] = trace_blob(name, strlen(name) + 1);
+	glad_trace_real.glBindFragDataLocation(program, color, name);
+	trace_record(GLAD_TRACE_ID_glBindFragDataLocation, args, 3, NULL);
+}
+static GLint APIENTRY glad_trace_glGetFragDataLocation(GLuint program, const GLchar *name) {
+	uint64_t args[2];
+	GLint result;
+	uint64_t traced;
+	args[0] = trace_integer(program);
+	args[1] = trace_blob(name, strlen(name) + 1);
+	result = glad_trace_real.glGetFragDataLocation(program, name);
+	traced = trace_integer(result);
+	trace_record(GLAD_TRACE_ID_glGetFragDataLocation, args, 2, &traced);
+	return result;
+}
+static void APIENTRY glad_trace_glUniform1ui(GLint location, GLuint v0) {
+	uint64_t args[2];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(v0);
+	glad_trace_real.glUniform1ui(location, v0);
+	trace_record(GLAD_TRACE_ID_glUniform1ui, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+	uint64_t args[3];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(v0);
+	args[2] = trace_integer(v1);
+	glad_trace_real.glUniform2ui(location, v0, v1);
+	trace_record(GLAD_TRACE_ID_glUniform2ui, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	uint64_t args[4];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(v0);
+	args[2] = trace_integer(v1);
+	args[3] = trace_integer(v2);
+	glad_trace_real.glUniform3ui(location, v0, v1, v2);
+	trace_record(GLAD_TRACE_ID_glUniform3ui, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	uint64_t args[5];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(v0);
+	args[2] = trace_integer(v1);
+	args[3] = trace_integer(v2);
+	args[4] = trace_integer(v3);
+	glad_trace_real.glUniform4ui(location, v0, v1, v2, v3);
+	trace_record(GLAD_TRACE_ID_glUniform4ui, args, 5, NULL);
+}
+static void APIENTRY glad_trace_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+	uint64_t args[3];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(count);
+	args[2] = trace_blob(value, (size_t)(count) * 1 * 4);
+	glad_trace_real.glUniform1uiv(location, count, value);
+	trace_record(GLAD_TRACE_ID_glUniform1uiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+	uint64_t args[3];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(count);
+	args[2] = trace_blob(value, (size_t)(count) * 2 * 4);
+	glad_trace_real.glUniform2uiv(location, count, value);
+	trace_record(GLAD_TRACE_ID_glUniform2uiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+	uint64_t args[3];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(count);
+	args[2] = trace_blob(value, (size_t)(count) * 3 * 4);
+	glad_trace_real.glUniform3uiv(location, count, value);
+	trace_record(GLAD_TRACE_ID_glUniform3uiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+	uint64_t args[3];
+	args[0] = trace_integer(location);
+	args[1] = trace_integer(count);
+	args[2] = trace_blob(value, (size_t)(count) * 4 * 4);
+	glad_trace_real.glUniform4uiv(location, count, value);
+	trace_record(GLAD_TRACE_ID_glUniform4uiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(pname);
+	args[2] = trace_blob(params, (pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1) * 4);
+	glad_trace_real.glTexParameterIiv(target, pname, params);
+	trace_record(GLAD_TRACE_ID_glTexParameterIiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(pname);
+	args[2] = trace_blob(params, (pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1) * 4);
+	glad_trace_real.glTexParameterIuiv(target, pname, params);
+	trace_record(GLAD_TRACE_ID_glTexParameterIuiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(pname);
+	args[2] = 0;
+	glad_trace_real.glGetTexParameterIiv(target, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetTexParameterIiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(pname);
+	args[2] = 0;
+	glad_trace_real.glGetTexParameterIuiv(target, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetTexParameterIuiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+	uint64_t args[3];
+	args[0] = trace_integer(buffer);
+	args[1] = trace_integer(drawbuffer);
+	args[2] = trace_blob(value, (buffer == GL_DEPTH || buffer == GL_STENCIL ? 1 : 4) * 4);
+	glad_trace_real.glClearBufferiv(buffer, drawbuffer, value);
+	trace_record(GLAD_TRACE_ID_glClearBufferiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	uint64_t args[3];
+	args[0] = trace_integer(buffer);
+	args[1] = trace_integer(drawbuffer);
+	args[2] = trace_blob(value, (buffer == GL_DEPTH || buffer == GL_STENCIL ? 1 : 4) * 4);
+	glad_trace_real.glClearBufferuiv(buffer, drawbuffer, value);
+	trace_record(GLAD_TRACE_ID_glClearBufferuiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	uint64_t args[3];
+	args[0] = trace_integer(buffer);
+	args[1] = trace_integer(drawbuffer);
+	args[2] = trace_blob(value, (buffer == GL_DEPTH || buffer == GL_STENCIL ? 1 : 4) * 4);
+	glad_trace_real.glClearBufferfv(buffer, drawbuffer, value);
+	trace_record(GLAD_TRACE_ID_glClearBufferfv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	uint64_t args[4];
+	args[0] = trace_integer(buffer);
+	args[1] = trace_integer(drawbuffer);
+	args[2] = trace_float(depth);
+	args[3] = trace_integer(stencil);
+	glad_trace_real.glClearBufferfi(buffer, drawbuffer, depth, stencil);
+	trace_record(GLAD_TRACE_ID_glClearBufferfi, args, 4, NULL);
+}
+static const GLubyte * APIENTRY glad_trace_glGetStringi(GLenum name, GLuint index) {
+	uint64_t args[2];
+	const GLubyte * result;
+	uint64_t traced;
+	args[0] = trace_integer(name);
+	args[1] = trace_integer(index);
+	result = glad_trace_real.glGetStringi(name, index);
+	traced = trace_pointer(result);
+	trace_record(GLAD_TRACE_ID_glGetStringi, args, 2, &traced);
+	return result;
+}
+static GLboolean APIENTRY glad_trace_glIsRenderbuffer(GLuint renderbuffer) {
+	uint64_t args[1];
+	GLboolean result;
+	uint64_t traced;
+	args[0] = trace_integer(renderbuffer);
+	result = glad_trace_real.glIsRenderbuffer(renderbuffer);
+	traced = trace_integer(result);
+	trace_record(GLAD_TRACE_ID_glIsRenderbuffer, args, 1, &traced);
+	return result;
+}
+static void APIENTRY glad_trace_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+	uint64_t args[2];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(renderbuffer);
+	glad_trace_real.glBindRenderbuffer(target, renderbuffer);
+	trace_record(GLAD_TRACE_ID_glBindRenderbuffer, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+	uint64_t args[2];
+	args[0] = trace_integer(n);
+	args[1] = trace_blob(renderbuffers, (size_t)(n) * sizeof(GLuint));
+	glad_trace_real.glDeleteRenderbuffers(n, renderbuffers);
+	trace_record(GLAD_TRACE_ID_glDeleteRenderbuffers, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	uint64_t args[2];
+	args[0] = trace_integer(n);
+	args[1] = 0;
+	glad_trace_real.glGenRenderbuffers(n, renderbuffers);
+	args[1] = trace_blob(renderbuffers, (size_t)(n) * sizeof(GLuint));
+	trace_record(GLAD_TRACE_ID_glGenRenderbuffers, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+	uint64_t args[4];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(internalformat);
+	args[2] = trace_integer(width);
+	args[3] = trace_integer(height);
+	glad_trace_real.glRenderbufferStorage(target, internalformat, width, height);
+	trace_record(GLAD_TRACE_ID_glRenderbufferStorage, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(pname);
+	args[2] = 0;
+	glad_trace_real.glGetRenderbufferParameteriv(target, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetRenderbufferParameteriv, args, 3, NULL);
+}
+static GLboolean APIENTRY glad_trace_glIsFramebuffer(GLuint framebuffer) {
+	uint64_t args[1];
+	GLboolean result;
+	uint64_t traced;
+	args[0] = trace_integer(framebuffer);
+	result = glad_trace_real.glIsFramebuffer(framebuffer);
+	traced = trace_integer(result);
+	trace_record(GLAD_TRACE_ID_glIsFramebuffer, args, 1, &traced);
+	return result;
+}
+static void APIENTRY glad_trace_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+	uint64_t args[2];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(framebuffer);
+	glad_trace_real.glBindFramebuffer(target, framebuffer);
+	trace_record(GLAD_TRACE_ID_glBindFramebuffer, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+	uint64_t args[2];
+	args[0] = trace_integer(n);
+	args[1] = trace_blob(framebuffers, (size_t)(n) * sizeof(GLuint));
+	glad_trace_real.glDeleteFramebuffers(n, framebuffers);
+	trace_record(GLAD_TRACE_ID_glDeleteFramebuffers, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+	uint64_t args[2];
+	args[0] = trace_integer(n);
+	args[1] = 0;
+	glad_trace_real.glGenFramebuffers(n, framebuffers);
+	args[1] = trace_blob(framebuffers, (size_t)(n) * sizeof(GLuint));
+	trace_record(GLAD_TRACE_ID_glGenFramebuffers, args, 2, NULL);
+}
+static GLenum APIENTRY glad_trace_glCheckFramebufferStatus(GLenum target) {
+	uint64_t args[1];
+	GLenum result;
+	uint64_t traced;
+	args[0] = trace_integer(target);
+	result = glad_trace_real.glCheckFramebufferStatus(target);
+	traced = trace_integer(result);
+	trace_record(GLAD_TRACE_ID_glCheckFramebufferStatus, args, 1, &traced);
+	return result;
+}
+static void APIENTRY glad_trace_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	uint64_t args[5];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(attachment);
+	args[2] = trace_integer(textarget);
+	args[3] = trace_integer(texture);
+	args[4] = trace_integer(level);
+	glad_trace_real.glFramebufferTexture1D(target, attachment, textarget, texture, level);
+	trace_record(GLAD_TRACE_ID_glFramebufferTexture1D, args, 5, NULL);
+}
+static void APIENTRY glad_trace_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	uint64_t args[5];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(attachment);
+	args[2] = trace_integer(textarget);
+	args[3] = trace_integer(texture);
+	args[4] = trace_integer(level);
+	glad_trace_real.glFramebufferTexture2D(target, attachment, textarget, texture, level);
+	trace_record(GLAD_TRACE_ID_glFramebufferTexture2D, args, 5, NULL);
+}
+static void APIENTRY glad_trace_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+	uint64_t args[6];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(attachment);
+	args[2] = trace_integer(textarget);
+	args[3] = trace_integer(texture);
+	args[4] = trace_integer(level);
+	args[5] = trace_integer(zoffset);
+	glad_trace_real.glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+	trace_record(GLAD_TRACE_ID_glFramebufferTexture3D, args, 6, NULL);
+}
+static void APIENTRY glad_trace_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	uint64_t args[4];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(attachment);
+	args[2] = trace_integer(renderbuffertarget);
+	args[3] = trace_integer(renderbuffer);
+	glad_trace_real.glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+	trace_record(GLAD_TRACE_ID_glFramebufferRenderbuffer, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+	uint64_t args[4];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(attachment);
+	args[2] = trace_integer(pname);
+	args[3] = 0;
+	glad_trace_real.glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetFramebufferAttachmentParameteriv, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glGenerateMipmap(GLenum target) {
+	uint64_t args[1];
+	args[0] = trace_integer(target);
+	glad_trace_real.glGenerateMipmap(target);
+	trace_record(GLAD_TRACE_ID_glGenerateMipmap, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	uint64_t args[10];
+	args[0] = trace_integer(srcX0);
+	args[1] = trace_integer(srcY0);
+	args[2] = trace_integer(srcX1);
+	args[3] = trace_integer(srcY1);
+	args[4] = trace_integer(dstX0);
+	args[5] = trace_integer(dstY0);
+	args[6] = trace_integer(dstX1);
+	args[7] = trace_integer(dstY1);
+	args[8] = trace_integer(mask);
+	args[9] = trace_integer(filter);
+	glad_trace_real.glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+	trace_record(GLAD_TRACE_ID_glBlitFramebuffer, args, 10, NULL);
+}
+static void APIENTRY glad_trace_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	uint64_t args[5];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(samples);
+	args[2] = trace_integer(internalformat);
+	args[3] = trace_integer(width);
+	args[4] = trace_integer(height);
+	glad_trace_real.glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+	trace_record(GLAD_TRACE_ID_glRenderbufferStorageMultisample, args, 5, NULL);
+}
+static void APIENTRY glad_trace_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	uint64_t args[5];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(attachment);
+	args[2] = trace_integer(texture);
+	args[3] = trace_integer(level);
+	args[4] = trace_integer(layer);
+	glad_trace_real.glFramebufferTextureLayer(target, attachment, texture, level, layer);
+	trace_record(GLAD_TRACE_ID_glFramebufferTextureLayer, args, 5, NULL);
+}
+static void * APIENTRY glad_trace_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	uint64_t args[4];
+	void * result;
+	uint64_t traced;
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(offset);
+	args[2] = trace_integer(length);
+	args[3] = trace_integer(access);
+	result = glad_trace_real.glMapBufferRange(target, offset, length, access);
+	trace_map(target, result, (size_t)length, access);
+	traced = trace_pointer(result);
+	trace_record(GLAD_TRACE_ID_glMapBufferRange, args, 4, &traced);
+	return result;
+}
+static void APIENTRY glad_trace_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+	uint64_t args[3];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(offset);
+	args[2] = trace_integer(length);
+	trace_mapped_write(target, offset, length);
+	glad_trace_real.glFlushMappedBufferRange(target, offset, length);
+	trace_record(GLAD_TRACE_ID_glFlushMappedBufferRange, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glBindVertexArray(GLuint array) {
+	uint64_t args[1];
+	args[0] = trace_integer(array);
+	glad_trace_real.glBindVertexArray(array);
+	trace_record(GLAD_TRACE_ID_glBindVertexArray, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+	uint64_t args[2];
+	args[0] = trace_integer(n);
+	args[1] = trace_blob(arrays, (size_t)(n) * sizeof(GLuint));
+	glad_trace_real.glDeleteVertexArrays(n, arrays);
+	trace_record(GLAD_TRACE_ID_glDeleteVertexArrays, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+	uint64_t args[2];
+	args[0] = trace_integer(n);
+	args[1] = 0;
+	glad_trace_real.glGenVertexArrays(n, arrays);
+	args[1] = trace_blob(arrays, (size_t)(n) * sizeof(GLuint));
+	trace_record(GLAD_TRACE_ID_glGenVertexArrays, args, 2, NULL);
+}
+static GLboolean APIENTRY glad_trace_glIsVertexArray(GLuint array) {
+	uint64_t args[1];
+	GLboolean result;
+	uint64_t traced;
+	args[0] = trace_integer(array);
+	result = glad_trace_real.glIsVertexArray(array);
+	traced = trace_integer(result);
+	trace_record(GLAD_TRACE_ID_glIsVertexArray, args, 1, &traced);
+	return result;
+}
+static void APIENTRY glad_trace_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+	uint64_t args[4];
+	args[0] = trace_integer(mode);
+	args[1] = trace_integer(first);
+	args[2] = trace_integer(count);
+	args[3] = trace_integer(instancecount);
+	glad_trace_real.glDrawArraysInstanced(mode, first, count, instancecount);
+	trace_record(GLAD_TRACE_ID_glDrawArraysInstanced, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+	uint64_t args[5];
+	args[0] = trace_integer(mode);
+	args[1] = trace_integer(count);
+	args[2] = trace_integer(type);
+	args[3] = trace_pointer(indices);
+	args[4] = trace_integer(instancecount);
+	glad_trace_real.glDrawElementsInstanced(mode, count, type, indices, instancecount);
+	trace_record(GLAD_TRACE_ID_glDrawElementsInstanced, args, 5, NULL);
+}
+static void APIENTRY glad_trace_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+	uint64_t args[3];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(internalformat);
+	args[2] = trace_integer(buffer);
+	glad_trace_real.glTexBuffer(target, internalformat, buffer);
+	trace_record(GLAD_TRACE_ID_glTexBuffer, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glPrimitiveRestartIndex(GLuint index) {
+	uint64_t args[1];
+	args[0] = trace_integer(index);
+	glad_trace_real.glPrimitiveRestartIndex(index);
+	trace_record(GLAD_TRACE_ID_glPrimitiveRestartIndex, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	uint64_t args[5];
+	args[0] = trace_integer(readTarget);
+	args[1] = trace_integer(writeTarget);
+	args[2] = trace_integer(readOffset);
+	args[3] = trace_integer(writeOffset);
+	args[4] = trace_integer(size);
+	glad_trace_real.glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+	trace_record(GLAD_TRACE_ID_glCopyBufferSubData, args, 5, NULL);
+}
+static void APIENTRY glad_trace_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+	uint64_t args[4];
+	args[0] = trace_integer(program);
+	args[1] = trace_integer(uniformCount);
+	args[2] = trace_strings(uniformCount, uniformNames, NULL);
+	args[3] = 0;
+	glad_trace_real.glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+	trace_record(GLAD_TRACE_ID_glGetUniformIndices, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+	uint64_t args[5];
+	args[0] = trace_integer(program);
+	args[1] = trace_integer(uniformCount);
+	args[2] = trace_blob(uniformIndices, (size_t)(uniformCount) * 4);
+	args[3] = trace_integer(pname);
+	args[4] = 0;
+	glad_trace_real.glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetActiveUniformsiv, args, 5, NULL);
+}
+static void APIENTRY glad_trace_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+	uint64_t args[5];
+	args[0] = trace_integer(program);
+	args[1] = trace_integer(uniformIndex);
+	args[2] = trace_integer(bufSize);
+	args[3] = 0;
+	args[4] = 0;
+	glad_trace_real.glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+	trace_record(GLAD_TRACE_ID_glGetActiveUniformName, args, 5, NULL);
+}
+static GLuint APIENTRY glad_trace_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+	uint64_t args[2];
+	GLuint result;
+	uint64_t traced;
+	args[0] = trace_integer(program);
+	args[1] = trace_blob(uniformBlockName, strlen(uniformBlockName) + 1);
+	result = glad_trace_real.glGetUniformBlockIndex(program, uniformBlockName);
+	traced = trace_integer(result);
+	trace_record(GLAD_TRACE_ID_glGetUniformBlockIndex, args, 2, &traced);
+	return result;
+}
+static void APIENTRY glad_trace_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+	uint64_t args[4];
+	args[0] = trace_integer(program);
+	args[1] = trace_integer(uniformBlockIndex);
+	args[2] = trace_integer(pname);
+	args[3] = 0;
+	glad_trace_real.glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetActiveUniformBlockiv, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+	uint64_t args[5];
+	args[0] = trace_integer(program);
+	args[1] = trace_integer(uniformBlockIndex);
+	args[2] = trace_integer(bufSize);
+	args[3] = 0;
+	args[4] = 0;
+	glad_trace_real.glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+	trace_record(GLAD_TRACE_ID_glGetActiveUniformBlockName, args, 5, NULL);
+}
+static void APIENTRY glad_trace_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+	uint64_t args[3];
+	args[0] = trace_integer(program);
+	args[1] = trace_integer(uniformBlockIndex);
+	args[2] = trace_integer(uniformBlockBinding);
+	glad_trace_real.glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+	trace_record(GLAD_TRACE_ID_glUniformBlockBinding, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	uint64_t args[5];
+	args[0] = trace_integer(mode);
+	args[1] = trace_integer(count);
+	args[2] = trace_integer(type);
+	args[3] = trace_pointer(indices);
+	args[4] = trace_integer(basevertex);
+	glad_trace_real.glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+	trace_record(GLAD_TRACE_ID_glDrawElementsBaseVertex, args, 5, NULL);
+}
+static void APIENTRY glad_trace_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	uint64_t args[7];
+	args[0] = trace_integer(mode);
+	args[1] = trace_integer(start);
+	args[2] = trace_integer(end);
+	args[3] = trace_integer(count);
+	args[4] = trace_integer(type);
+	args[5] = trace_pointer(indices);
+	args[6] = trace_integer(basevertex);
+	glad_trace_real.glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+	trace_record(GLAD_TRACE_ID_glDrawRangeElementsBaseVertex, args, 7, NULL);
+}
+static void APIENTRY glad_trace_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+	uint64_t args[6];
+	args[0] = trace_integer(mode);
+	args[1] = trace_integer(count);
+	args[2] = trace_integer(type);
+	args[3] = trace_pointer(indices);
+	args[4] = trace_integer(instancecount);
+	args[5] = trace_integer(basevertex);
+	glad_trace_real.glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+	trace_record(GLAD_TRACE_ID_glDrawElementsInstancedBaseVertex, args, 6, NULL);
+}
+static void APIENTRY glad_trace_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+	uint64_t args[6];
+	args[0] = trace_integer(mode);
+	args[1] = trace_blob(count, (size_t)(drawcount) * 4);
+	args[2] = trace_integer(type);
+	args[3] = trace_blob(indices, (size_t)(drawcount) * sizeof(void *));
+	args[4] = trace_integer(drawcount);
+	args[5] = trace_blob(basevertex, (size_t)(drawcount) * 4);
+	glad_trace_real.glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+	trace_record(GLAD_TRACE_ID_glMultiDrawElementsBaseVertex, args, 6, NULL);
+}
+static void APIENTRY glad_trace_glProvokingVertex(GLenum mode) {
+	uint64_t args[1];
+	args[0] = trace_integer(mode);
+	glad_trace_real.glProvokingVertex(mode);
+	trace_record(GLAD_TRACE_ID_glProvokingVertex, args, 1, NULL);
+}
+static GLsync APIENTRY glad_trace_glFenceSync(GLenum condition, GLbitfield flags) {
+	uint64_t args[2];
+	GLsync result;
+	uint64_t traced;
+	args[0] = trace_integer(condition);
+	args[1] = trace_integer(flags);
+	result = glad_trace_real.glFenceSync(condition, flags);
+	traced = trace_pointer(result);
+	trace_record(GLAD_TRACE_ID_glFenceSync, args, 2, &traced);
+	return result;
+}
+static GLboolean APIENTRY glad_trace_glIsSync(GLsync sync) {
+	uint64_t args[1];
+	GLboolean result;
+	uint64_t traced;
+	args[0] = trace_pointer(sync);
+	result = glad_trace_real.glIsSync(sync);
+	traced = trace_integer(result);
+	trace_record(GLAD_TRACE_ID_glIsSync, args, 1, &traced);
+	return result;
+}
+static void APIENTRY glad_trace_glDeleteSync(GLsync sync) {
+	uint64_t args[1];
+	args[0] = trace_pointer(sync);
+	glad_trace_real.glDeleteSync(sync);
+	trace_record(GLAD_TRACE_ID_glDeleteSync, args, 1, NULL);
+}
+static GLenum APIENTRY glad_trace_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	uint64_t args[3];
+	GLenum result;
+	uint64_t traced;
+	args[0] = trace_pointer(sync);
+	args[1] = trace_integer(flags);
+	args[2] = trace_integer(timeout);
+	result = glad_trace_real.glClientWaitSync(sync, flags, timeout);
+	traced = trace_integer(result);
+	trace_record(GLAD_TRACE_ID_glClientWaitSync, args, 3, &traced);
+	return result;
+}
+static void APIENTRY glad_trace_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	uint64_t args[3];
+	args[0] = trace_pointer(sync);
+	args[1] = trace_integer(flags);
+	args[2] = trace_integer(timeout);
+	glad_trace_real.glWaitSync(sync, flags, timeout);
+	trace_record(GLAD_TRACE_ID_glWaitSync, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glGetInteger64v(GLenum pname, GLint64 *data) {
+	uint64_t args[2];
+	args[0] = trace_integer(pname);
+	args[1] = 0;
+	glad_trace_real.glGetInteger64v(pname, data);
+	trace_record(GLAD_TRACE_ID_glGetInteger64v, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) {
+	uint64_t args[5];
+	args[0] = trace_pointer(sync);
+	args[1] = trace_integer(pname);
+	args[2] = trace_integer(count);
+	args[3] = 0;
+	args[4] = 0;
+	glad_trace_real.glGetSynciv(sync, pname, count, length, values);
+	trace_record(GLAD_TRACE_ID_glGetSynciv, args, 5, NULL);
+}
+static void APIENTRY glad_trace_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+	uint64_t args[3];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(index);
+	args[2] = 0;
+	glad_trace_real.glGetInteger64i_v(target, index, data);
+	trace_record(GLAD_TRACE_ID_glGetInteger64i_v, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(pname);
+	args[2] = 0;
+	glad_trace_real.glGetBufferParameteri64v(target, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetBufferParameteri64v, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+	uint64_t args[4];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(attachment);
+	args[2] = trace_integer(texture);
+	args[3] = trace_integer(level);
+	glad_trace_real.glFramebufferTexture(target, attachment, texture, level);
+	trace_record(GLAD_TRACE_ID_glFramebufferTexture, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	uint64_t args[6];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(samples);
+	args[2] = trace_integer(internalformat);
+	args[3] = trace_integer(width);
+	args[4] = trace_integer(height);
+	args[5] = trace_integer(fixedsamplelocations);
+	glad_trace_real.glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+	trace_record(GLAD_TRACE_ID_glTexImage2DMultisample, args, 6, NULL);
+}
+static void APIENTRY glad_trace_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	uint64_t args[7];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(samples);
+	args[2] = trace_integer(internalformat);
+	args[3] = trace_integer(width);
+	args[4] = trace_integer(height);
+	args[5] = trace_integer(depth);
+	args[6] = trace_integer(fixedsamplelocations);
+	glad_trace_real.glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+	trace_record(GLAD_TRACE_ID_glTexImage3DMultisample, args, 7, NULL);
+}
+static void APIENTRY glad_trace_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+	uint64_t args[3];
+	args[0] = trace_integer(pname);
+	args[1] = trace_integer(index);
+	args[2] = 0;
+	glad_trace_real.glGetMultisamplefv(pname, index, val);
+	trace_record(GLAD_TRACE_ID_glGetMultisamplefv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+	uint64_t args[2];
+	args[0] = trace_integer(maskNumber);
+	args[1] = trace_integer(mask);
+	glad_trace_real.glSampleMaski(maskNumber, mask);
+	trace_record(GLAD_TRACE_ID_glSampleMaski, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+	uint64_t args[4];
+	args[0] = trace_integer(program);
+	args[1] = trace_integer(colorNumber);
+	args[2] = trace_integer(index);
+	args[3] = trace_blob(name, strlen(name) + 1);
+	glad_trace_real.glBindFragDataLocationIndexed(program, colorNumber, index, name);
+	trace_record(GLAD_TRACE_ID_glBindFragDataLocationIndexed, args, 4, NULL);
+}
+static GLint APIENTRY glad_trace_glGetFragDataIndex(GLuint program, const GLchar *name) {
+	uint64_t args[2];
+	GLint result;
+	uint64_t traced;
+	args[0] = trace_integer(program);
+	args[1] = trace_blob(name, strlen(name) + 1);
+	result = glad_trace_real.glGetFragDataIndex(program, name);
+	traced = trace_integer(result);
+	trace_record(GLAD_TRACE_ID_glGetFragDataIndex, args, 2, &traced);
+	return result;
+}
+static void APIENTRY glad_trace_glGenSamplers(GLsizei count, GLuint *samplers) {
+	uint64_t args[2];
+	args[0] = trace_integer(count);
+	args[1] = 0;
+	glad_trace_real.glGenSamplers(count, samplers);
+	args[1] = trace_blob(samplers, (size_t)(count) * sizeof(GLuint));
+	trace_record(GLAD_TRACE_ID_glGenSamplers, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+	uint64_t args[2];
+	args[0] = trace_integer(count);
+	args[1] = trace_blob(samplers, (size_t)(count) * sizeof(GLuint));
+	glad_trace_real.glDeleteSamplers(count, samplers);
+	trace_record(GLAD_TRACE_ID_glDeleteSamplers, args, 2, NULL);
+}
+static GLboolean APIENTRY glad_trace_glIsSampler(GLuint sampler) {
+	uint64_t args[1];
+	GLboolean result;
+	uint64_t traced;
+	args[0] = trace_integer(sampler);
+	result = glad_trace_real.glIsSampler(sampler);
+	traced = trace_integer(result);
+	trace_record(GLAD_TRACE_ID_glIsSampler, args, 1, &traced);
+	return result;
+}
+static void APIENTRY glad_trace_glBindSampler(GLuint unit, GLuint sampler) {
+	uint64_t args[2];
+	args[0] = trace_integer(unit);
+	args[1] = trace_integer(sampler);
+	glad_trace_real.glBindSampler(unit, sampler);
+	trace_record(GLAD_TRACE_ID_glBindSampler, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+	uint64_t args[3];
+	args[0] = trace_integer(sampler);
+	args[1] = trace_integer(pname);
+	args[2] = trace_integer(param);
+	glad_trace_real.glSamplerParameteri(sampler, pname, param);
+	trace_record(GLAD_TRACE_ID_glSamplerParameteri, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+	uint64_t args[3];
+	args[0] = trace_integer(sampler);
+	args[1] = trace_integer(pname);
+	args[2] = trace_blob(param, (pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1) * 4);
+	glad_trace_real.glSamplerParameteriv(sampler, pname, param);
+	trace_record(GLAD_TRACE_ID_glSamplerParameteriv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+	uint64_t args[3];
+	args[0] = trace_integer(sampler);
+	args[1] = trace_integer(pname);
+	args[2] = trace_float(param);
+	glad_trace_real.glSamplerParameterf(sampler, pname, param);
+	trace_record(GLAD_TRACE_ID_glSamplerParameterf, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+	uint64_t args[3];
+	args[0] = trace_integer(sampler);
+	args[1] = trace_integer(pname);
+	args[2] = trace_blob(param, (pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1) * 4);
+	glad_trace_real.glSamplerParameterfv(sampler, pname, param);
+	trace_record(GLAD_TRACE_ID_glSamplerParameterfv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+	uint64_t args[3];
+	args[0] = trace_integer(sampler);
+	args[1] = trace_integer(pname);
+	args[2] = trace_blob(param, (pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1) * 4);
+	glad_trace_real.glSamplerParameterIiv(sampler, pname, param);
+	trace_record(GLAD_TRACE_ID_glSamplerParameterIiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+	uint64_t args[3];
+	args[0] = trace_integer(sampler);
+	args[1] = trace_integer(pname);
+	args[2] = trace_blob(param, (pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1) * 4);
+	glad_trace_real.glSamplerParameterIuiv(sampler, pname, param);
+	trace_record(GLAD_TRACE_ID_glSamplerParameterIuiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(sampler);
+	args[1] = trace_integer(pname);
+	args[2] = 0;
+	glad_trace_real.glGetSamplerParameteriv(sampler, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetSamplerParameteriv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(sampler);
+	args[1] = trace_integer(pname);
+	args[2] = 0;
+	glad_trace_real.glGetSamplerParameterIiv(sampler, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetSamplerParameterIiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(sampler);
+	args[1] = trace_integer(pname);
+	args[2] = 0;
+	glad_trace_real.glGetSamplerParameterfv(sampler, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetSamplerParameterfv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(sampler);
+	args[1] = trace_integer(pname);
+	args[2] = 0;
+	glad_trace_real.glGetSamplerParameterIuiv(sampler, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetSamplerParameterIuiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glQueryCounter(GLuint id, GLenum target) {
+	uint64_t args[2];
+	args[0] = trace_integer(id);
+	args[1] = trace_integer(target);
+	glad_trace_real.glQueryCounter(id, target);
+	trace_record(GLAD_TRACE_ID_glQueryCounter, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(id);
+	args[1] = trace_integer(pname);
+	args[2] = 0;
+	glad_trace_real.glGetQueryObjecti64v(id, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetQueryObjecti64v, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+	uint64_t args[3];
+	args[0] = trace_integer(id);
+	args[1] = trace_integer(pname);
+	args[2] = 0;
+	glad_trace_real.glGetQueryObjectui64v(id, pname, params);
+	trace_record(GLAD_TRACE_ID_glGetQueryObjectui64v, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+	uint64_t args[2];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(divisor);
+	glad_trace_real.glVertexAttribDivisor(index, divisor);
+	trace_record(GLAD_TRACE_ID_glVertexAttribDivisor, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	uint64_t args[4];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(type);
+	args[2] = trace_integer(normalized);
+	args[3] = trace_integer(value);
+	glad_trace_real.glVertexAttribP1ui(index, type, normalized, value);
+	trace_record(GLAD_TRACE_ID_glVertexAttribP1ui, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	uint64_t args[4];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(type);
+	args[2] = trace_integer(normalized);
+	args[3] = trace_blob(value, 4);
+	glad_trace_real.glVertexAttribP1uiv(index, type, normalized, value);
+	trace_record(GLAD_TRACE_ID_glVertexAttribP1uiv, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	uint64_t args[4];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(type);
+	args[2] = trace_integer(normalized);
+	args[3] = trace_integer(value);
+	glad_trace_real.glVertexAttribP2ui(index, type, normalized, value);
+	trace_record(GLAD_TRACE_ID_glVertexAttribP2ui, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	uint64_t args[4];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(type);
+	args[2] = trace_integer(normalized);
+	args[3] = trace_blob(value, 4);
+	glad_trace_real.glVertexAttribP2uiv(index, type, normalized, value);
+	trace_record(GLAD_TRACE_ID_glVertexAttribP2uiv, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	uint64_t args[4];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(type);
+	args[2] = trace_integer(normalized);
+	args[3] = trace_integer(value);
+	glad_trace_real.glVertexAttribP3ui(index, type, normalized, value);
+	trace_record(GLAD_TRACE_ID_glVertexAttribP3ui, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	uint64_t args[4];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(type);
+	args[2] = trace_integer(normalized);
+	args[3] = trace_blob(value, 4);
+	glad_trace_real.glVertexAttribP3uiv(index, type, normalized, value);
+	trace_record(GLAD_TRACE_ID_glVertexAttribP3uiv, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	uint64_t args[4];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(type);
+	args[2] = trace_integer(normalized);
+	args[3] = trace_integer(value);
+	glad_trace_real.glVertexAttribP4ui(index, type, normalized, value);
+	trace_record(GLAD_TRACE_ID_glVertexAttribP4ui, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	uint64_t args[4];
+	args[0] = trace_integer(index);
+	args[1] = trace_integer(type);
+	args[2] = trace_integer(normalized);
+	args[3] = trace_blob(value, 4);
+	glad_trace_real.glVertexAttribP4uiv(index, type, normalized, value);
+	trace_record(GLAD_TRACE_ID_glVertexAttribP4uiv, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glVertexP2ui(GLenum type, GLuint value) {
+	uint64_t args[2];
+	args[0] = trace_integer(type);
+	args[1] = trace_integer(value);
+	glad_trace_real.glVertexP2ui(type, value);
+	trace_record(GLAD_TRACE_ID_glVertexP2ui, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexP2uiv(GLenum type, const GLuint *value) {
+	uint64_t args[2];
+	args[0] = trace_integer(type);
+	args[1] = trace_blob(value, 4);
+	glad_trace_real.glVertexP2uiv(type, value);
+	trace_record(GLAD_TRACE_ID_glVertexP2uiv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexP3ui(GLenum type, GLuint value) {
+	uint64_t args[2];
+	args[0] = trace_integer(type);
+	args[1] = trace_integer(value);
+	glad_trace_real.glVertexP3ui(type, value);
+	trace_record(GLAD_TRACE_ID_glVertexP3ui, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexP3uiv(GLenum type, const GLuint *value) {
+	uint64_t args[2];
+	args[0] = trace_integer(type);
+	args[1] = trace_blob(value, 4);
+	glad_trace_real.glVertexP3uiv(type, value);
+	trace_record(GLAD_TRACE_ID_glVertexP3uiv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexP4ui(GLenum type, GLuint value) {
+	uint64_t args[2];
+	args[0] = trace_integer(type);
+	args[1] = trace_integer(value);
+	glad_trace_real.glVertexP4ui(type, value);
+	trace_record(GLAD_TRACE_ID_glVertexP4ui, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glVertexP4uiv(GLenum type, const GLuint *value) {
+	uint64_t args[2];
+	args[0] = trace_integer(type);
+	args[1] = trace_blob(value, 4);
+	glad_trace_real.glVertexP4uiv(type, value);
+	trace_record(GLAD_TRACE_ID_glVertexP4uiv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glTexCoordP1ui(GLenum type, GLuint coords) {
+	uint64_t args[2];
+	args[0] = trace_integer(type);
+	args[1] = trace_integer(coords);
+	glad_trace_real.glTexCoordP1ui(type, coords);
+	trace_record(GLAD_TRACE_ID_glTexCoordP1ui, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+	uint64_t args[2];
+	args[0] = trace_integer(type);
+	args[1] = trace_blob(coords, 4);
+	glad_trace_real.glTexCoordP1uiv(type, coords);
+	trace_record(GLAD_TRACE_ID_glTexCoordP1uiv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glTexCoordP2ui(GLenum type, GLuint coords) {
+	uint64_t args[2];
+	args[0] = trace_integer(type);
+	args[1] = trace_integer(coords);
+	glad_trace_real.glTexCoordP2ui(type, coords);
+	trace_record(GLAD_TRACE_ID_glTexCoordP2ui, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+	uint64_t args[2];
+	args[0] = trace_integer(type);
+	args[1] = trace_blob(coords, 4);
+	glad_trace_real.glTexCoordP2uiv(type, coords);
+	trace_record(GLAD_TRACE_ID_glTexCoordP2uiv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glTexCoordP3ui(GLenum type, GLuint coords) {
+	uint64_t args[2];
+	args[0] = trace_integer(type);
+	args[1] = trace_integer(coords);
+	glad_trace_real.glTexCoordP3ui(type, coords);
+	trace_record(GLAD_TRACE_ID_glTexCoordP3ui, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+	uint64_t args[2];
+	args[0] = trace_integer(type);
+	args[1] = trace_blob(coords, 4);
+	glad_trace_real.glTexCoordP3uiv(type, coords);
+	trace_record(GLAD_TRACE_ID_glTexCoordP3uiv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glTexCoordP4ui(GLenum type, GLuint coords) {
+	uint64_t args[2];
+	args[0] = trace_integer(type);
+	args[1] = trace_integer(coords);
+	glad_trace_real.glTexCoordP4ui(type, coords);
+	trace_record(GLAD_TRACE_ID_glTexCoordP4ui, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+	uint64_t args[2];
+	args[0] = trace_integer(type);
+	args[1] = trace_blob(coords, 4);
+	glad_trace_real.glTexCoordP4uiv(type, coords);
+	trace_record(GLAD_TRACE_ID_glTexCoordP4uiv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+	uint64_t args[3];
+	args[0] = trace_integer(texture);
+	args[1] = trace_integer(type);
+	args[2] = trace_integer(coords);
+	glad_trace_real.glMultiTexCoordP1ui(texture, type, coords);
+	trace_record(GLAD_TRACE_ID_glMultiTexCoordP1ui, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	uint64_t args[3];
+	args[0] = trace_integer(texture);
+	args[1] = trace_integer(type);
+	args[2] = trace_blob(coords, 4);
+	glad_trace_real.glMultiTexCoordP1uiv(texture, type, coords);
+	trace_record(GLAD_TRACE_ID_glMultiTexCoordP1uiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+	uint64_t args[3];
+	args[0] = trace_integer(texture);
+	args[1] = trace_integer(type);
+	args[2] = trace_integer(coords);
+	glad_trace_real.glMultiTexCoordP2ui(texture, type, coords);
+	trace_record(GLAD_TRACE_ID_glMultiTexCoordP2ui, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	uint64_t args[3];
+	args[0] = trace_integer(texture);
+	args[1] = trace_integer(type);
+	args[2] = trace_blob(coords, 4);
+	glad_trace_real.glMultiTexCoordP2uiv(texture, type, coords);
+	trace_record(GLAD_TRACE_ID_glMultiTexCoordP2uiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+	uint64_t args[3];
+	args[0] = trace_integer(texture);
+	args[1] = trace_integer(type);
+	args[2] = trace_integer(coords);
+	glad_trace_real.glMultiTexCoordP3ui(texture, type, coords);
+	trace_record(GLAD_TRACE_ID_glMultiTexCoordP3ui, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	uint64_t args[3];
+	args[0] = trace_integer(texture);
+	args[1] = trace_integer(type);
+	args[2] = trace_blob(coords, 4);
+	glad_trace_real.glMultiTexCoordP3uiv(texture, type, coords);
+	trace_record(GLAD_TRACE_ID_glMultiTexCoordP3uiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+	uint64_t args[3];
+	args[0] = trace_integer(texture);
+	args[1] = trace_integer(type);
+	args[2] = trace_integer(coords);
+	glad_trace_real.glMultiTexCoordP4ui(texture, type, coords);
+	trace_record(GLAD_TRACE_ID_glMultiTexCoordP4ui, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	uint64_t args[3];
+	args[0] = trace_integer(texture);
+	args[1] = trace_integer(type);
+	args[2] = trace_blob(coords, 4);
+	glad_trace_real.glMultiTexCoordP4uiv(texture, type, coords);
+	trace_record(GLAD_TRACE_ID_glMultiTexCoordP4uiv, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glNormalP3ui(GLenum type, GLuint coords) {
+	uint64_t args[2];
+	args[0] = trace_integer(type);
+	args[1] = trace_integer(coords);
+	glad_trace_real.glNormalP3ui(type, coords);
+	trace_record(GLAD_TRACE_ID_glNormalP3ui, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glNormalP3uiv(GLenum type, const GLuint *coords) {
+	uint64_t args[2];
+	args[0] = trace_integer(type);
+	args[1] = trace_blob(coords, 4);
+	glad_trace_real.glNormalP3uiv(type, coords);
+	trace_record(GLAD_TRACE_ID_glNormalP3uiv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glColorP3ui(GLenum type, GLuint color) {
+	uint64_t args[2];
+	args[0] = trace_integer(type);
+	args[1] = trace_integer(color);
+	glad_trace_real.glColorP3ui(type, color);
+	trace_record(GLAD_TRACE_ID_glColorP3ui, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glColorP3uiv(GLenum type, const GLuint *color) {
+	uint64_t args[2];
+	args[0] = trace_integer(type);
+	args[1] = trace_blob(color, 4);
+	glad_trace_real.glColorP3uiv(type, color);
+	trace_record(GLAD_TRACE_ID_glColorP3uiv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glColorP4ui(GLenum type, GLuint color) {
+	uint64_t args[2];
+	args[0] = trace_integer(type);
+	args[1] = trace_integer(color);
+	glad_trace_real.glColorP4ui(type, color);
+	trace_record(GLAD_TRACE_ID_glColorP4ui, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glColorP4uiv(GLenum type, const GLuint *color) {
+	uint64_t args[2];
+	args[0] = trace_integer(type);
+	args[1] = trace_blob(color, 4);
+	glad_trace_real.glColorP4uiv(type, color);
+	trace_record(GLAD_TRACE_ID_glColorP4uiv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glSecondaryColorP3ui(GLenum type, GLuint color) {
+	uint64_t args[2];
+	args[0] = trace_integer(type);
+	args[1] = trace_integer(color);
+	glad_trace_real.glSecondaryColorP3ui(type, color);
+	trace_record(GLAD_TRACE_ID_glSecondaryColorP3ui, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+	uint64_t args[2];
+	args[0] = trace_integer(type);
+	args[1] = trace_blob(color, 4);
+	glad_trace_real.glSecondaryColorP3uiv(type, color);
+	trace_record(GLAD_TRACE_ID_glSecondaryColorP3uiv, args, 2, NULL);
+}
+static void APIENTRY glad_trace_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) {
+	uint64_t args[5];
+	args[0] = trace_integer(program);
+	args[1] = trace_integer(bufSize);
+	args[2] = 0;
+	args[3] = 0;
+	args[4] = 0;
+	glad_trace_real.glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+	trace_record(GLAD_TRACE_ID_glGetProgramBinary, args, 5, NULL);
+}
+static void APIENTRY glad_trace_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+	uint64_t args[4];
+	args[0] = trace_integer(program);
+	args[1] = trace_integer(binaryFormat);
+	args[2] = trace_blob(binary, (size_t)(length));
+	args[3] = trace_integer(length);
+	glad_trace_real.glProgramBinary(program, binaryFormat, binary, length);
+	trace_record(GLAD_TRACE_ID_glProgramBinary, args, 4, NULL);
+}
+static void APIENTRY glad_trace_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+	uint64_t args[3];
+	args[0] = trace_integer(program);
+	args[1] = trace_integer(pname);
+	args[2] = trace_integer(value);
+	glad_trace_real.glProgramParameteri(program, pname, value);
+	trace_record(GLAD_TRACE_ID_glProgramParameteri, args, 3, NULL);
+}
+static void APIENTRY glad_trace_glMaxShaderCompilerThreadsKHR(GLuint count) {
+	uint64_t args[1];
+	args[0] = trace_integer(count);
+	glad_trace_real.glMaxShaderCompilerThreadsKHR(count);
+	trace_record(GLAD_TRACE_ID_glMaxShaderCompilerThreadsKHR, args, 1, NULL);
+}
+static void APIENTRY glad_trace_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+	uint64_t args[4];
+	args[0] = trace_integer(target);
+	args[1] = trace_integer(size);
+	args[2] = trace_blob(data, (size_t)(size));
+	args[3] = trace_integer(flags);
+	glad_trace_real.glBufferStorage(target, size, data, flags);
+	trace_record(GLAD_TRACE_ID_glBufferStorage, args, 4, NULL);
+}
+
+static void trace_install(void) {
+	glad_trace_real.glCullFace = glad_glCullFace;
+	if(glad_glCullFace != NULL) glad_glCullFace = glad_trace_glCullFace;
+	glad_trace_real.glFrontFace = glad_glFrontFace;
+	if(glad_glFrontFace != NULL) glad_glFrontFace = glad_trace_glFrontFace;
+	glad_trace_real.glHint = glad_glHint;
+	if(glad_glHint != NULL) glad_glHint = glad_trace_glHint;
+	glad_trace_real.glLineWidth = glad_glLineWidth;
+	if(glad_glLineWidth != NULL) glad_glLineWidth = glad_trace_glLineWidth;
+	glad_trace_real.glPointSize = glad_glPointSize;
+	if(glad_glPointSize != NULL) glad_glPointSize = glad_trace_glPointSize;
+	glad_trace_real.glPolygonMode = glad_glPolygonMode;
+	if(glad_glPolygonMode != NULL) glad_glPolygonMode = glad_trace_glPolygonMode;
+	glad_trace_real.glScissor = glad_glScissor;
+	if(glad_glScissor != NULL) glad_glScissor = glad_trace_glScissor;
+	glad_trace_real.glTexParameterf = glad_glTexParameterf;
+	if(glad_glTexParameterf != NULL) glad_glTexParameterf = glad_trace_glTexParameterf;
+	glad_trace_real.glTexParameterfv = glad_glTexParameterfv;
+	if(glad_glTexParameterfv != NULL) glad_glTexParameterfv = glad_trace_glTexParameterfv;
+	glad_trace_real.glTexParameteri = glad_glTexParameteri;
+	if(glad_glTexParameteri != NULL) glad_glTexParameteri = glad_trace_glTexParameteri;
+	glad_trace_real.glTexParameteriv = glad_glTexParameteriv;
+	if(glad_glTexParameteriv != NULL) glad_glTexParameteriv = glad_trace_glTexParameteriv;
+	glad_trace_real.glTexImage1D = glad_glTexImage1D;
+	if(glad_glTexImage1D != NULL) glad_glTexImage1D = glad_trace_glTexImage1D;
+	glad_trace_real.glTexImage2D = glad_glTexImage2D;
+	if(glad_glTexImage2D != NULL) glad_glTexImage2D = glad_trace_glTexImage2D;
+	glad_trace_real.glDrawBuffer = glad_glDrawBuffer;
+	if(glad_glDrawBuffer != NULL) glad_glDrawBuffer = glad_trace_glDrawBuffer;
+	glad_trace_real.glClear = glad_glClear;
+	if(glad_glClear != NULL) glad_glClear = glad_trace_glClear;
+	glad_trace_real.glClearColor = glad_glClearColor;
+	if(glad_glClearColor != NULL) glad_glClearColor = glad_trace_glClearColor;
+	glad_trace_real.glClearStencil = glad_glClearStencil;
+	if(glad_glClearStencil != NULL) glad_glClearStencil = glad_trace_glClearStencil;
+	glad_trace_real.glClearDepth = glad_glClearDepth;
+	if(glad_glClearDepth != NULL) glad_glClearDepth = glad_trace_glClearDepth;
+	glad_trace_real.glStencilMask = glad_glStencilMask;
+	if(glad_glStencilMask != NULL) glad_glStencilMask = glad_trace_glStencilMask;
+	glad_trace_real.glColorMask = glad_glColorMask;
+	if(glad_glColorMask != NULL) glad_glColorMask = glad_trace_glColorMask;
+	glad_trace_real.glDepthMask = glad_glDepthMask;
+	if(glad_glDepthMask != NULL) glad_glDepthMask = glad_trace_glDepthMask;
+	glad_trace_real.glDisable = glad_glDisable;
+	if(glad_glDisable != NULL) glad_glDisable = glad_trace_glDisable;
+	glad_trace_real.glEnable = glad_glEnable;
+	if(glad_glEnable != NULL) glad_glEnable = glad_trace_glEnable;
+	glad_trace_real.glFinish = glad_glFinish;
+	if(glad_glFinish != NULL) glad_glFinish = glad_trace_glFinish;
+	glad_trace_real.glFlush = glad_glFlush;
+	if(glad_glFlush != NULL) glad_glFlush = glad_trace_glFlush;
+	glad_trace_real.glBlendFunc = glad_glBlendFunc;
+	if(glad_glBlendFunc != NULL) glad_glBlendFunc = glad_trace_glBlendFunc;
+	glad_trace_real.glLogicOp = glad_glLogicOp;
+	if(glad_glLogicOp != NULL) glad_glLogicOp = glad_trace_glLogicOp;
+	glad_trace_real.glStencilFunc = glad_glStencilFunc;
+	if(glad_glStencilFunc != NULL) glad_glStencilFunc = glad_trace_glStencilFunc;
+	glad_trace_real.glStencilOp = glad_glStencilOp;
+	if(glad_glStencilOp != NULL) glad_glStencilOp = glad_trace_glStencilOp;
+	glad_trace_real.glDepthFunc = glad_glDepthFunc;
+	if(glad_glDepthFunc != NULL) glad_glDepthFunc = glad_trace_glDepthFunc;
+	glad_trace_real.glPixelStoref = glad_glPixelStoref;
+	if(glad_glPixelStoref != NULL) glad_glPixelStoref = glad_trace_glPixelStoref;
+	glad_trace_real.glPixelStorei = glad_glPixelStorei;
+	if(glad_glPixelStorei != NULL) glad_glPixelStorei = glad_trace_glPixelStorei;
+	glad_trace_real.glReadBuffer = glad_glReadBuffer;
+	if(glad_glReadBuffer != NULL) glad_glReadBuffer = glad_trace_glReadBuffer;
+	glad_trace_real.glReadPixels = glad_glReadPixels;
+	if(glad_glReadPixels != NULL) glad_glReadPixels = glad_trace_glReadPixels;
+	glad_trace_real.glGetBooleanv = glad_glGetBooleanv;
+	if(glad_glGetBooleanv != NULL) glad_glGetBooleanv = glad_trace_glGetBooleanv;
+	glad_trace_real.glGetDoublev = glad_glGetDoublev;
+	if(glad_glGetDoublev != NULL) glad_glGetDoublev = glad_trace_glGetDoublev;
+	glad_trace_real.glGetError = glad_glGetError;
+	if(glad_glGetError != NULL) glad_glGetError = glad_trace_glGetError;
+	glad_trace_real.glGetFloatv = glad_glGetFloatv;
+	if(glad_glGetFloatv != NULL) glad_glGetFloatv = glad_trace_glGetFloatv;
+	glad_trace_real.glGetIntegerv = glad_glGetIntegerv;
+	if(glad_glGetIntegerv != NULL) glad_glGetIntegerv = glad_trace_glGetIntegerv;
+	glad_trace_real.glGetString = glad_glGetString;
+	if(glad_glGetString != NULL) glad_glGetString = glad_trace_glGetString;
+	glad_trace_real.glGetTexImage = glad_glGetTexImage;
+	if(glad_glGetTexImage != NULL) glad_glGetTexImage = glad_trace_glGetTexImage;
+	glad_trace_real.glGetTexParameterfv = glad_glGetTexParameterfv;
+	if(glad_glGetTexParameterfv != NULL) glad_glGetTexParameterfv = glad_trace_glGetTexParameterfv;
+	glad_trace_real.glGetTexParameteriv = glad_glGetTexParameteriv;
+	if(glad_glGetTexParameteriv != NULL) glad_glGetTexParameteriv = glad_trace_glGetTexParameteriv;
+	glad_trace_real.glGetTexLevelParameterfv = glad_glGetTexLevelParameterfv;
+	if(glad_glGetTexLevelParameterfv != NULL) glad_glGetTexLevelParameterfv = glad_trace_glGetTexLevelParameterfv;
+	glad_trace_real.glGetTexLevelParameteriv = glad_glGetTexLevelParameteriv;
+	if(glad_glGetTexLevelParameteriv != NULL) glad_glGetTexLevelParameteriv = glad_trace_glGetTexLevelParameteriv;
+	glad_trace_real.glIsEnabled = glad_glIsEnabled;
+	if(glad_glIsEnabled != NULL) glad_glIsEnabled = glad_trace_glIsEnabled;
+	glad_trace_real.glDepthRange = glad_glDepthRange;
+	if(glad_glDepthRange != NULL) glad_glDepthRange = glad_trace_glDepthRange;
+	glad_trace_real.glViewport = glad_glViewport;
+	if(glad_glViewport != NULL) glad_glViewport = glad_trace_glViewport;
+	glad_trace_real.glDrawArrays = glad_glDrawArrays;
+	if(glad_glDrawArrays != NULL) glad_glDrawArrays = glad_trace_glDrawArrays;
+	glad_trace_real.glDrawElements = glad_glDrawElements;
+	if(glad_glDrawElements != NULL) glad_glDrawElements = glad_trace_glDrawElements;
+	glad_trace_real.glPolygonOffset = glad_glPolygonOffset;
+	if(glad_glPolygonOffset != NULL) glad_glPolygonOffset = glad_trace_glPolygonOffset;
+	glad_trace_real.glCopyTexImage1D = glad_glCopyTexImage1D;
+	if(glad_glCopyTexImage1D != NULL) glad_glCopyTexImage1D = glad_trace_glCopyTexImage1D;
+	glad_trace_real.glCopyTexImage2D = glad_glCopyTexImage2D;
+	if(glad_glCopyTexImage2D != NULL) glad_glCopyTexImage2D = glad_trace_glCopyTexImage2D;
+	glad_trace_real.glCopyTexSubImage1D = glad_glCopyTexSubImage1D;
+	if(glad_glCopyTexSubImage1D != NULL) glad_glCopyTexSubImage1D = glad_trace_glCopyTexSubImage1D;
+	glad_trace_real.glCopyTexSubImage2D = glad_glCopyTexSubImage2D;
+	if(glad_glCopyTexSubImage2D != NULL) glad_glCopyTexSubImage2D = glad_trace_glCopyTexSubImage2D;
+	glad_trace_real.glTexSubImage1D = glad_glTexSubImage1D;
+	if(glad_glTexSubImage1D != NULL) glad_glTexSubImage1D = glad_trace_glTexSubImage1D;
+	glad_trace_real.glTexSubImage2D = glad_glTexSubImage2D;
+	if(glad_glTexSubImage2D != NULL) glad_glTexSubImage2D = glad_trace_glTexSubImage2D;
+	glad_trace_real.glBindTexture = glad_glBindTexture;
+	if(glad_glBindTexture != NULL) glad_glBindTexture = glad_trace_glBindTexture;
+	glad_trace_real.glDeleteTextures = glad_glDeleteTextures;
+	if(glad_glDeleteTextures != NULL) glad_glDeleteTextures = glad_trace_glDeleteTextures;
+	glad_trace_real.glGenTextures = glad_glGenTextures;
+	if(glad_glGenTextures != NULL) glad_glGenTextures = glad_trace_glGenTextures;
+	glad_trace_real.glIsTexture = glad_glIsTexture;
+	if(glad_glIsTexture != NULL) glad_glIsTexture = glad_trace_glIsTexture;
+	glad_trace_real.glDrawRangeElements = glad_glDrawRangeElements;
+	if(glad_glDrawRangeElements != NULL) glad_glDrawRangeElements = glad_trace_glDrawRangeElements;
+	glad_trace_real.glTexImage3D = glad_glTexImage3D;
+	if(glad_glTexImage3D != NULL) glad_glTexImage3D = glad_trace_glTexImage3D;
+	glad_trace_real.glTexSubImage3D = glad_glTexSubImage3D;
+	if(glad_glTexSubImage3D != NULL) glad_glTexSubImage3D = glad_trace_glTexSubImage3D;
+	glad_trace_real.glCopyTexSubImage3D = glad_glCopyTexSubImage3D;
+	if(glad_glCopyTexSubImage3D != NULL) glad_glCopyTexSubImage3D = glad_trace_glCopyTexSubImage3D;
+	glad_trace_real.glActiveTexture = glad_glActiveTexture;
+	if(glad_glActiveTexture != NULL) glad_glActiveTexture = glad_trace_glActiveTexture;
+	glad_trace_real.glSampleCoverage = glad_glSampleCoverage;
+	if(glad_glSampleCoverage != NULL) glad_glSampleCoverage = glad_trace_glSampleCoverage;
+	glad_trace_real.glCompressedTexImage3D = glad_glCompressedTexImage3D;
+	if(glad_glCompressedTexImage3D != NULL) glad_glCompressedTexImage3D = glad_trace_glCompressedTexImage3D;
+	glad_trace_real.glCompressedTexImage2D = glad_glCompressedTexImage2D;
+	if(glad_glCompressedTexImage2D != NULL) glad_glCompressedTexImage2D = glad_trace_glCompressedTexImage2D;
+	glad_trace_real.glCompressedTexImage1D = glad_glCompressedTexImage1D;
+	if(glad_glCompressedTexImage1D != NULL) glad_glCompressedTexImage1D = glad_trace_glCompressedTexImage1D;
+	glad_trace_real.glCompressedTexSubImage3D = glad_glCompressedTexSubImage3D;
+	if(glad_glCompressedTexSubImage3D != NULL) glad_glCompressedTexSubImage3D = glad_trace_glCompressedTexSubImage3D;
+	glad_trace_real.glCompressedTexSubImage2D = glad_glCompressedTexSubImage2D;
+	if(glad_glCompressedTexSubImage2D != NULL) glad_glCompressedTexSubImage2D = glad_trace_glCompressedTexSubImage2D;
+	glad_trace_real.glCompressedTexSubImage1D = glad_glCompressedTexSubImage1D;
+	if(glad_glCompressedTexSubImage1D != NULL) glad_glCompressedTexSubImage1D = glad_trace_glCompressedTexSubImage1D;
+	glad_trace_real.glGetCompressedTexImage = glad_glGetCompressedTexImage;
+	if(glad_glGetCompressedTexImage != NULL) glad_glGetCompressedTexImage = glad_trace_glGetCompressedTexImage;
+	glad_trace_real.glBlendFuncSeparate = glad_glBlendFuncSeparate;
+	if(glad_glBlendFuncSeparate != NULL) glad_glBlendFuncSeparate = glad_trace_glBlendFuncSeparate;
+	glad_trace_real.glMultiDrawArrays = glad_glMultiDrawArrays;
+	if(glad_glMultiDrawArrays != NULL) glad_glMultiDrawArrays = glad_trace_glMultiDrawArrays;
+	glad_trace_real.glMultiDrawElements = glad_glMultiDrawElements;
+	if(glad_glMultiDrawElements != NULL) glad_glMultiDrawElements = glad_trace_glMultiDrawElements;
+	glad_trace_real.glPointParameterf = glad_glPointParameterf;
+	if(glad_glPointParameterf != NULL) glad_glPointParameterf = glad_trace_glPointParameterf;
+	glad_trace_real.glPointParameterfv = glad_glPointParameterfv;
+	if(glad_glPointParameterfv != NULL) glad_glPointParameterfv = glad_trace_glPointParameterfv;
+	glad_trace_real.glPointParameteri = glad_glPointParameteri;
+	if(glad_glPointParameteri != NULL) glad_glPointParameteri = glad_trace_glPointParameteri;
+	glad_trace_real.glPointParameteriv = glad_glPointParameteriv;
+	if(glad_glPointParameteriv != NULL) glad_glPointParameteriv = glad_trace_glPointParameteriv;
+	glad_trace_real.glBlendColor = glad_glBlendColor;
+	if(glad_glBlendColor != NULL) glad_glBlendColor = glad_trace_glBlendColor;
+	glad_trace_real.glBlendEquation = glad_glBlendEquation;
+	if(glad_glBlendEquation != NULL) glad_glBlendEquation = glad_trace_glBlendEquation;
+	glad_trace_real.glGenQueries = glad_glGenQueries;
+	if(glad_glGenQueries != NULL) glad_glGenQueries = glad_trace_glGenQueries;
+	glad_trace_real.glDeleteQueries = glad_glDeleteQueries;
+	if(glad_glDeleteQueries != NULL) glad_glDeleteQueries = glad_trace_glDeleteQueries;
+	glad_trace_real.glIsQuery = glad_glIsQuery;
+	if(glad_glIsQuery != NULL) glad_glIsQuery = glad_trace_glIsQuery;
+	glad_trace_real.glBeginQuery = glad_glBeginQuery;
+	if(glad_glBeginQuery != NULL) glad_glBeginQuery = glad_trace_glBeginQuery;
+	glad_trace_real.glEndQuery = glad_glEndQuery;
+	if(glad_glEndQuery != NULL) glad_glEndQuery = glad_trace_glEndQuery;
+	glad_trace_real.glGetQueryiv = glad_glGetQueryiv;
+	if(glad_glGetQueryiv != NULL) glad_glGetQueryiv = glad_trace_glGetQueryiv;
+	glad_trace_real.glGetQueryObjectiv = glad_glGetQueryObjectiv;
+	if(glad_glGetQueryObjectiv != NULL) glad_glGetQueryObjectiv = glad_trace_glGetQueryObjectiv;
+	glad_trace_real.glGetQueryObjectuiv = glad_glGetQueryObjectuiv;
+	if(glad_glGetQueryObjectuiv != NULL) glad_glGetQueryObjectuiv = glad_trace_glGetQueryObjectuiv;
+	glad_trace_real.glBindBuffer = glad_glBindBuffer;
+	if(glad_glBindBuffer != NULL) glad_glBindBuffer = glad_trace_glBindBuffer;
+	glad_trace_real.glDeleteBuffers = glad_glDeleteBuffers;
+	if(glad_glDeleteBuffers != NULL) glad_glDeleteBuffers = glad_trace_glDeleteBuffers;
+	glad_trace_real.glGenBuffers = glad_glGenBuffers;
+	if(glad_glGenBuffers != NULL) glad_glGenBuffers = glad_trace_glGenBuffers;
+	glad_trace_real.glIsBuffer = glad_glIsBuffer;
+	if(glad_glIsBuffer != NULL) glad_glIsBuffer = glad_trace_glIsBuffer;
+	glad_trace_real.glBufferData = glad_glBufferData;
+	if(glad_glBufferData != NULL) glad_glBufferData = glad_trace_glBufferData;
+	glad_trace_real.glBufferSubData = glad_glBufferSubData;
+	if(glad_glBufferSubData != NULL) glad_glBufferSubData = glad_trace_glBufferSubData;
+	glad_trace_real.glGetBufferSubData = glad_glGetBufferSubData;
+	if(glad_glGetBufferSubData != NULL) glad_glGetBufferSubData = glad_trace_glGetBufferSubData;
+	glad_trace_real.glMapBuffer = glad_glMapBuffer;
+	if(glad_glMapBuffer != NULL) glad_glMapBuffer = glad_trace_glMapBuffer;
+	glad_trace_real.glUnmapBuffer = glad_glUnmapBuffer;
+	if(glad_glUnmapBuffer != NULL) glad_glUnmapBuffer = glad_trace_glUnmapBuffer;
+	glad_trace_real.glGetBufferParameteriv = glad_glGetBufferParameteriv;
+	if(glad_glGetBufferParameteriv != NULL) glad_glGetBufferParameteriv = glad_trace_glGetBufferParameteriv;
+	glad_trace_real.glGetBufferPointerv = glad_glGetBufferPointerv;
+	if(glad_glGetBufferPointerv != NULL) glad_glGetBufferPointerv = glad_trace_glGetBufferPointerv;
+	glad_trace_real.glBlendEquationSeparate = glad_glBlendEquationSeparate;
+	if(glad_glBlendEquationSeparate != NULL) glad_glBlendEquationSeparate = glad_trace_glBlendEquationSeparate;
+	glad_trace_real.glDrawBuffers = glad_glDrawBuffers;
+	if(glad_glDrawBuffers != NULL) glad_glDrawBuffers = glad_trace_glDrawBuffers;
+	glad_trace_real.glStencilOpSeparate = glad_glStencilOpSeparate;
+	if(glad_glStencilOpSeparate != NULL) glad_glStencilOpSeparate = glad_trace_glStencilOpSeparate;
+	glad_trace_real.glStencilFuncSeparate = glad_glStencilFuncSeparate;
+	if(glad_glStencilFuncSeparate != NULL) glad_glStencilFuncSeparate = glad_trace_glStencilFuncSeparate;
+	glad_trace_real.glStencilMaskSeparate = glad_glStencilMaskSeparate;
+	if(glad_glStencilMaskSeparate != NULL) glad_glStencilMaskSeparate = glad_trace_glStencilMaskSeparate;
+	glad_trace_real.glAttachShader = glad_glAttachShader;
+	if(glad_glAttachShader != NULL) glad_glAttachShader = glad_trace_glAttachShader;
+	glad_trace_real.glBindAttribLocation = glad_glBindAttribLocation;
+	if(glad_glBindAttribLocation != NULL) glad_glBindAttribLocation = glad_trace_glBindAttribLocation;
+	glad_trace_real.glCompileShader = glad_glCompileShader;
+	if(glad_glCompileShader != NULL) glad_glCompileShader = glad_trace_glCompileShader;
+	glad_trace_real.glCreateProgram = glad_glCreateProgram;
+	if(glad_glCreateProgram != NULL) glad_glCreateProgram = glad_trace_glCreateProgram;
+	glad_trace_real.glCreateShader = glad_glCreateShader;
+	if(glad_glCreateShader != NULL) glad_glCreateShader = glad_trace_glCreateShader;
+	glad_trace_real.glDeleteProgram = glad_glDeleteProgram;
+	if(glad_glDeleteProgram != NULL) glad_glDeleteProgram = glad_trace_glDeleteProgram;
+	glad_trace_real.glDeleteShader = glad_glDeleteShader;
+	if(glad_glDeleteShader != NULL) glad_glDeleteShader = glad_trace_glDeleteShader;
+	glad_trace_real.glDetachShader = glad_glDetachShader;
+	if(glad_glDetachShader != NULL) glad_glDetachShader = glad_trace_glDetachShader;
+	glad_trace_real.glDisableVertexAttribArray = glad_glDisableVertexAttribArray;
+	if(glad_glDisableVertexAttribArray != NULL) glad_glDisableVertexAttribArray = glad_trace_glDisableVertexAttribArray;
+	glad_trace_real.glEnableVertexAttribArray = glad_glEnableVertexAttribArray;
+	if(glad_glEnableVertexAttribArray != NULL) glad_glEnableVertexAttribArray = glad_trace_glEnableVertexAttribArray;
+	glad_trace_real.glGetActiveAttrib = glad_glGetActiveAttrib;
+	if(glad_glGetActiveAttrib != NULL) glad_glGetActiveAttrib = glad_trace_glGetActiveAttrib;
+	glad_trace_real.glGetActiveUniform = glad_glGetActiveUniform;
+	if(glad_glGetActiveUniform != NULL) glad_glGetActiveUniform = glad_trace_glGetActiveUniform;
+	glad_trace_real.glGetAttachedShaders = glad_glGetAttachedShaders;
+	if(glad_glGetAttachedShaders != NULL) glad_glGetAttachedShaders = glad_trace_glGetAttachedShaders;
+	glad_trace_real.glGetAttribLocation = glad_glGetAttribLocation;
+	if(glad_glGetAttribLocation != NULL) glad_glGetAttribLocation = glad_trace_glGetAttribLocation;
+	glad_trace_real.glGetProgramiv = glad_glGetProgramiv;
+	if(glad_glGetProgramiv != NULL) glad_glGetProgramiv = glad_trace_glGetProgramiv;
+	glad_trace_real.glGetProgramInfoLog = glad_glGetProgramInfoLog;
+	if(glad_glGetProgramInfoLog != NULL) glad_glGetProgramInfoLog = glad_trace_glGetProgramInfoLog;
+	glad_trace_real.glGetShaderiv = glad_glGetShaderiv;
+	if(glad_glGetShaderiv != NULL) glad_glGetShaderiv = glad_trace_glGetShaderiv;
+	glad_trace_real.glGetShaderInfoLog = glad_glGetShaderInfoLog;
+	if(glad_glGetShaderInfoLog != NULL) glad_glGetShaderInfoLog = glad_trace_glGetShaderInfoLog;
+	glad_trace_real.glGetShaderSource = glad_glGetShaderSource;
+	if(glad_glGetShaderSource != NULL) glad_glGetShaderSource = glad_trace_glGetShaderSource;
+	glad_trace_real.glGetUniformLocation = glad_glGetUniformLocation;
+	if(glad_glGetUniformLocation != NULL) glad_glGetUniformLocation = glad_trace_glGetUniformLocation;
+	glad_trace_real.glGetUniformfv = glad_glGetUniformfv;
+	if(glad_glGetUniformfv != NULL) glad_glGetUniformfv = glad_trace_glGetUniformfv;
+	glad_trace_real.glGetUniformiv = glad_glGetUniformiv;
+	if(glad_glGetUniformiv != NULL) glad_glGetUniformiv = glad_trace_glGetUniformiv;
+	glad_trace_real.glGetVertexAttribdv = glad_glGetVertexAttribdv;
+	if(glad_glGetVertexAttribdv != NULL) glad_glGetVertexAttribdv = glad_trace_glGetVertexAttribdv;
+	glad_trace_real.glGetVertexAttribfv = glad_glGetVertexAttribfv;
+	if(glad_glGetVertexAttribfv != NULL) glad_glGetVertexAttribfv = glad_trace_glGetVertexAttribfv;
+	glad_trace_real.glGetVertexAttribiv = glad_glGetVertexAttribiv;
+	if(glad_glGetVertexAttribiv != NULL) glad_glGetVertexAttribiv = glad_trace_glGetVertexAttribiv;
+	glad_trace_real.glGetVertexAttribPointerv = glad_glGetVertexAttribPointerv;
+	if(glad_glGetVertexAttribPointerv != NULL) glad_glGetVertexAttribPointerv = glad_trace_glGetVertexAttribPointerv;
+	glad_trace_real.glIsProgram = glad_glIsProgram;
+	if(glad_glIsProgram != NULL) glad_glIsProgram = glad_trace_glIsProgram;
+	glad_trace_real.glIsShader = glad_glIsShader;
+	if(glad_glIsShader != NULL) glad_glIsShader = glad_trace_glIsShader;
+	glad_trace_real.glLinkProgram = glad_glLinkProgram;
+	if(glad_glLinkProgram != NULL) glad_glLinkProgram = glad_trace_glLinkProgram;
+	glad_trace_real.glShaderSource = glad_glShaderSource;
+	if(glad_glShaderSource != NULL) glad_glShaderSource = glad_trace_glShaderSource;
+	glad_trace_real.glUseProgram = glad_glUseProgram;
+	if(glad_glUseProgram != NULL) glad_glUseProgram = glad_trace_glUseProgram;
+	glad_trace_real.glUniform1f = glad_glUniform1f;
+	if(glad_glUniform1f != NULL) glad_glUniform1f = glad_trace_glUniform1f;
+	glad_trace_real.glUniform2f = glad_glUniform2f;
+	if(glad_glUniform2f != NULL) glad_glUniform2f = glad_trace_glUniform2f;
+	glad_trace_real.glUniform3f = glad_glUniform3f;
+	if(glad_glUniform3f != NULL) glad_glUniform3f = glad_trace_glUniform3f;
+	glad_trace_real.glUniform4f = glad_glUniform4f;
+	if(glad_glUniform4f != NULL) glad_glUniform4f = glad_trace_glUniform4f;
+	glad_trace_real.glUniform1i = glad_glUniform1i;
+	if(glad_glUniform1i != NULL) glad_glUniform1i = glad_trace_glUniform1i;
+	glad_trace_real.glUniform2i = glad_glUniform2i;
+	if(glad_glUniform2i != NULL) glad_glUniform2i = glad_trace_glUniform2i;
+	glad_trace_real.glUniform3i = glad_glUniform3i;
+	if(glad_glUniform3i != NULL) glad_glUniform3i = glad_trace_glUniform3i;
+	glad_trace_real.glUniform4i = glad_glUniform4i;
+	if(glad_glUniform4i != NULL) glad_glUniform4i = glad_trace_glUniform4i;
+	glad_trace_real.glUniform1fv = glad_glUniform1fv;
+	if(glad_glUniform1fv != NULL) glad_glUniform1fv = glad_trace_glUniform1fv;
+	glad_trace_real.glUniform2fv = glad_glUniform2fv;
+	if(glad_glUniform2fv != NULL) glad_glUniform2fv = glad_trace_glUniform2fv;
+	glad_trace_real.glUniform3fv = glad_glUniform3fv;
+	if(glad_glUniform3fv != NULL) glad_glUniform3fv = glad_trace_glUniform3fv;
+	glad_trace_real.glUniform4fv = glad_glUniform4fv;
+	if(glad_glUniform4fv != NULL) glad_glUniform4fv = glad_trace_glUniform4fv;
+	glad_trace_real.glUniform1iv = glad_glUniform1iv;
+	if(glad_glUniform1iv != NULL) glad_glUniform1iv = glad_trace_glUniform1iv;
+	glad_trace_real.glUniform2iv = glad_glUniform2iv;
+	if(glad_glUniform2iv != NULL) glad_glUniform2iv = glad_trace_glUniform2iv;
+	glad_trace_real.glUniform3iv = glad_glUniform3iv;
+	if(glad_glUniform3iv != NULL) glad_glUniform3iv = glad_trace_glUniform3iv;
+	glad_trace_real.glUniform4iv = glad_glUniform4iv;
+	if(glad_glUniform4iv != NULL) glad_glUniform4iv = glad_trace_glUniform4iv;
+	glad_trace_real.glUniformMatrix2fv = glad_glUniformMatrix2fv;
+	if(glad_glUniformMatrix2fv != NULL) glad_glUniformMatrix2fv = glad_trace_glUniformMatrix2fv;
+	glad_trace_real.glUniformMatrix3fv = glad_glUniformMatrix3fv;
+	if(glad_glUniformMatrix3fv != NULL) glad_glUniformMatrix3fv = glad_trace_glUniformMatrix3fv;
+	glad_trace_real.glUniformMatrix4fv = glad_glUniformMatrix4fv;
+	if(glad_glUniformMatrix4fv != NULL) glad_glUniformMatrix4fv = glad_trace_glUniformMatrix4fv;
+	glad_trace_real.glValidateProgram = glad_glValidateProgram;
+	if(glad_glValidateProgram != NULL) glad_glValidateProgram = glad_trace_glValidateProgram;
+	glad_trace_real.glVertexAttrib1d = glad_glVertexAttrib1d;
+	if(glad_glVertexAttrib1d != NULL) glad_glVertexAttrib1d = glad_trace_glVertexAttrib1d;
+	glad_trace_real.glVertexAttrib1dv = glad_glVertexAttrib1dv;
+	if(glad_glVertexAttrib1dv != NULL) glad_glVertexAttrib1dv = glad_trace_glVertexAttrib1dv;
+	glad_trace_real.glVertexAttrib1f = glad_glVertexAttrib1f;
+	if(glad_glVertexAttrib1f != NULL) glad_glVertexAttrib1f = glad_trace_glVertexAttrib1f;
+	glad_trace_real.glVertexAttrib1fv = glad_glVertexAttrib1fv;
+	if(glad_glVertexAttrib1fv != NULL) glad_glVertexAttrib1fv = glad_trace_glVertexAttrib1fv;
+	glad_trace_real.glVertexAttrib1s = glad_glVertexAttrib1s;
+	if(glad_glVertexAttrib1s != NULL) glad_glVertexAttrib1s = glad_trace_glVertexAttrib1s;
+	glad_trace_real.glVertexAttrib1sv = glad_glVertexAttrib1sv;
+	if(glad_glVertexAttrib1sv != NULL) glad_glVertexAttrib1sv = glad_trace_glVertexAttrib1sv;
+	glad_trace_real.glVertexAttrib2d = glad_glVertexAttrib2d;
+	if(glad_glVertexAttrib2d != NULL) glad_glVertexAttrib2d = glad_trace_glVertexAttrib2d;
+	glad_trace_real.glVertexAttrib2dv = glad_glVertexAttrib2dv;
+	if(glad_glVertexAttrib2dv != NULL) glad_glVertexAttrib2dv = glad_trace_glVertexAttrib2dv;
+	glad_trace_real.glVertexAttrib2f = glad_glVertexAttrib2f;
+	if(glad_glVertexAttrib2f != NULL) glad_glVertexAttrib2f = glad_trace_glVertexAttrib2f;
+	glad_trace_real.glVertexAttrib2fv = glad_glVertexAttrib2fv;
+	if(glad_glVertexAttrib2fv != NULL) glad_glVertexAttrib2fv = glad_trace_glVertexAttrib2fv;
+	glad_trace_real.glVertexAttrib2s = glad_glVertexAttrib2s;
+	if(glad_glVertexAttrib2s != NULL) glad_glVertexAttrib2s = glad_trace_glVertexAttrib2s;
+	glad_trace_real.glVertexAttrib2sv = glad_glVertexAttrib2sv;
+	if(glad_glVertexAttrib2sv != NULL) glad_glVertexAttrib2sv = glad_trace_glVertexAttrib2sv;
+	glad_trace_real.glVertexAttrib3d = glad_glVertexAttrib3d;
+	if(glad_glVertexAttrib3d != NULL) glad_glVertexAttrib3d = glad_trace_glVertexAttrib3d;
+	glad_trace_real.glVertexAttrib3dv = glad_glVertexAttrib3dv;
+	if(glad_glVertexAttrib3dv != NULL) glad_glVertexAttrib3dv = glad_trace_glVertexAttrib3dv;
+	glad_trace_real.glVertexAttrib3f = glad_glVertexAttrib3f;
+	if(glad_glVertexAttrib3f != NULL) glad_glVertexAttrib3f = glad_trace_glVertexAttrib3f;
+	glad_trace_real.glVertexAttrib3fv = glad_glVertexAttrib3fv;
+	if(glad_glVertexAttrib3fv != NULL) glad_glVertexAttrib3fv = glad_trace_glVertexAttrib3fv;
+	glad_trace_real.glVertexAttrib3s = glad_glVertexAttrib3s;
+	if(glad_glVertexAttrib3s != NULL) glad_glVertexAttrib3s = glad_trace_glVertexAttrib3s;
+	glad_trace_real.glVertexAttrib3sv = glad_glVertexAttrib3sv;
+	if(glad_glVertexAttrib3sv != NULL) glad_glVertexAttrib3sv = glad_trace_glVertexAttrib3sv;
+	glad_trace_real.glVertexAttrib4Nbv = glad_glVertexAttrib4Nbv;
+	if(glad_glVertexAttrib4Nbv != NULL) glad_glVertexAttrib4Nbv = glad_trace_glVertexAttrib4Nbv;
+	glad_trace_real.glVertexAttrib4Niv = glad_glVertexAttrib4Niv;
+	if(glad_glVertexAttrib4Niv != NULL) glad_glVertexAttrib4Niv = glad_trace_glVertexAttrib4Niv;
+	glad_trace_real.glVertexAttrib4Nsv = glad_glVertexAttrib4Nsv;
+	if(glad_glVertexAttrib4Nsv != NULL) glad_glVertexAttrib4Nsv = glad_trace_glVertexAttrib4Nsv;
+	glad_trace_real.glVertexAttrib4Nub = glad_glVertexAttrib4Nub;
+	if(glad_glVertexAttrib4Nub != NULL) glad_glVertexAttrib4Nub = glad_trace_glVertexAttrib4Nub;
+	glad_trace_real.glVertexAttrib4Nubv = glad_glVertexAttrib4Nubv;
+	if(glad_glVertexAttrib4Nubv != NULL) glad_glVertexAttrib4Nubv = glad_trace_glVertexAttrib4Nubv;
+	glad_trace_real.glVertexAttrib4Nuiv = glad_glVertexAttrib4Nuiv;
+	if(glad_glVertexAttrib4Nuiv != NULL) glad_glVertexAttrib4Nuiv = glad_trace_glVertexAttrib4Nuiv;
+	glad_trace_real.glVertexAttrib4Nusv = glad_glVertexAttrib4Nusv;
+	if(glad_glVertexAttrib4Nusv != NULL) glad_glVertexAttrib4Nusv = glad_trace_glVertexAttrib4Nusv;
+	glad_trace_real.glVertexAttrib4bv = glad_glVertexAttrib4bv;
+	if(glad_glVertexAttrib4bv != NULL) glad_glVertexAttrib4bv = glad_trace_glVertexAttrib4bv;
+	glad_trace_real.glVertexAttrib4d = glad_glVertexAttrib4d;
+	if(glad_glVertexAttrib4d != NULL) glad_glVertexAttrib4d = glad_trace_glVertexAttrib4d;
+	glad_trace_real.glVertexAttrib4dv = glad_glVertexAttrib4dv;
+	if(glad_glVertexAttrib4dv != NULL) glad_glVertexAttrib4dv = glad_trace_glVertexAttrib4dv;
+	glad_trace_real.glVertexAttrib4f = glad_glVertexAttrib4f;
+	if(glad_glVertexAttrib4f != NULL) glad_glVertexAttrib4f = glad_trace_glVertexAttrib4f;
+	glad_trace_real.glVertexAttrib4fv = glad_glVertexAttrib4fv;
+	if(glad_glVertexAttrib4fv != NULL) glad_glVertexAttrib4fv = glad_trace_glVertexAttrib4fv;
+	glad_trace_real.glVertexAttrib4iv = glad_glVertexAttrib4iv;
+	if(glad_glVertexAttrib4iv != NULL) glad_glVertexAttrib4iv = glad_trace_glVertexAttrib4iv;
+	glad_trace_real.glVertexAttrib4s = glad_glVertexAttrib4s;
+	if(glad_glVertexAttrib4s != NULL) glad_glVertexAttrib4s = glad_trace_glVertexAttrib4s;
+	glad_trace_real.glVertexAttrib4sv = glad_glVertexAttrib4sv;
+	if(glad_glVertexAttrib4sv != NULL) glad_glVertexAttrib4sv = glad_trace_glVertexAttrib4sv;
+	glad_trace_real.glVertexAttrib4ubv = glad_glVertexAttrib4ubv;
+	if(glad_glVertexAttrib4ubv != NULL) glad_glVertexAttrib4ubv = glad_trace_glVertexAttrib4ubv;
+	glad_trace_real.glVertexAttrib4uiv = glad_glVertexAttrib4uiv;
+	if(glad_glVertexAttrib4uiv != NULL) glad_glVertexAttrib4uiv = glad_trace_glVertexAttrib4uiv;
+	glad_trace_real.glVertexAttrib4usv = glad_glVertexAttrib4usv;
+	if(glad_glVertexAttrib4usv != NULL) glad_glVertexAttrib4usv = glad_trace_glVertexAttrib4usv;
+	glad_trace_real.glVertexAttribPointer = glad_glVertexAttribPointer;
+	if(glad_glVertexAttribPointer != NULL) glad_glVertexAttribPointer = glad_trace_glVertexAttribPointer;
+	glad_trace_real.glUniformMatrix2x3fv = glad_glUniformMatrix2x3fv;
+	if(glad_glUniformMatrix2x3fv != NULL) glad_glUniformMatrix2x3fv = glad_trace_glUniformMatrix2x3fv;
+	glad_trace_real.glUniformMatrix3x2fv = glad_glUniformMatrix3x2fv;
+	if(glad_glUniformMatrix3x2fv != NULL) glad_glUniformMatrix3x2fv = glad_trace_glUniformMatrix3x2fv;
+	glad_trace_real.glUniformMatrix2x4fv = glad_glUniformMatrix2x4fv;
+	if(glad_glUniformMatrix2x4fv != NULL) glad_glUniformMatrix2x4fv = glad_trace_glUniformMatrix2x4fv;
+	glad_trace_real.glUniformMatrix4x2fv = glad_glUniformMatrix4x2fv;
+	if(glad_glUniformMatrix4x2fv != NULL) glad_glUniformMatrix4x2fv = glad_trace_glUniformMatrix4x2fv;
+	glad_trace_real.glUniformMatrix3x4fv = glad_glUniformMatrix3x4fv;
+	if(glad_glUniformMatrix3x4fv != NULL) glad_glUniformMatrix3x4fv = glad_trace_glUniformMatrix3x4fv;
+	glad_trace_real.glUniformMatrix4x3fv = glad_glUniformMatrix4x3fv;
+	if(glad_glUniformMatrix4x3fv != NULL) glad_glUniformMatrix4x3fv = glad_trace_glUniformMatrix4x3fv;
+	glad_trace_real.glColorMaski = glad_glColorMaski;
+	if(glad_glColorMaski != NULL) glad_glColorMaski = glad_trace_glColorMaski;
+	glad_trace_real.glGetBooleani_v = glad_glGetBooleani_v;
+	if(glad_glGetBooleani_v != NULL) glad_glGetBooleani_v = glad_trace_glGetBooleani_v;
+	glad_trace_real.glGetIntegeri_v = glad_glGetIntegeri_v;
+	if(glad_glGetIntegeri_v != NULL) glad_glGetIntegeri_v = glad_trace_glGetIntegeri_v;
+	glad_trace_real.glEnablei = glad_glEnablei;
+	if(glad_glEnablei != NULL) glad_glEnablei = glad_trace_glEnablei;
+	glad_trace_real.glDisablei = glad_glDisablei;
+	if(glad_glDisablei != NULL) glad_glDisablei = glad_trace_glDisablei;
+	glad_trace_real.glIsEnabledi = glad_glIsEnabledi;
+	if(glad_glIsEnabledi != NULL) glad_glIsEnabledi = glad_trace_glIsEnabledi;
+	glad_trace_real.glBeginTransformFeedback = glad_glBeginTransformFeedback;
+	if(glad_glBeginTransformFeedback != NULL) glad_glBeginTransformFeedback = glad_trace_glBeginTransformFeedback;
+	glad_trace_real.glEndTransformFeedback = glad_glEndTransformFeedback;
+	if(glad_glEndTransformFeedback != NULL) glad_glEndTransformFeedback = glad_trace_glEndTransformFeedback;
+	glad_trace_real.glBindBufferRange = glad_glBindBufferRange;
+	if(glad_glBindBufferRange != NULL) glad_glBindBufferRange = glad_trace_glBindBufferRange;
+	glad_trace_real.glBindBufferBase = glad_glBindBufferBase;
+	if(glad_glBindBufferBase != NULL) glad_glBindBufferBase = glad_trace_glBindBufferBase;
+	glad_trace_real.glTransformFeedbackVaryings = glad_glTransformFeedbackVaryings;
+	if(glad_glTransformFeedbackVaryings != NULL) glad_glTransformFeedbackVaryings = glad_trace_glTransformFeedbackVaryings;
+	glad_trace_real.glGetTransformFeedbackVarying = glad_glGetTransformFeedbackVarying;
+	if(glad_glGetTransformFeedbackVarying != NULL) glad_glGetTransformFeedbackVarying = glad_trace_glGetTransformFeedbackVarying;
+	glad_trace_real.glClampColor = glad_glClampColor;
+	if(glad_glClampColor != NULL) glad_glClampColor = glad_trace_glClampColor;
+	glad_trace_real.glBeginConditionalRender = glad_glBeginConditionalRender;
+	if(glad_glBeginConditionalRender != NULL) glad_glBeginConditionalRender = glad_trace_glBeginConditionalRender;
+	glad_trace_real.glEndConditionalRender = glad_glEndConditionalRender;
+	if(glad_glEndConditionalRender != NULL) glad_glEndConditionalRender = glad_trace_glEndConditionalRender;
+	glad_trace_real.glVertexAttribIPointer = glad_glVertexAttribIPointer;
+	if(glad_glVertexAttribIPointer != NULL) glad_glVertexAttribIPointer = glad_trace_glVertexAttribIPointer;
+	glad_trace_real.glGetVertexAttribIiv = glad_glGetVertexAttribIiv;
+	if(glad_glGetVertexAttribIiv != NULL) glad_glGetVertexAttribIiv = glad_trace_glGetVertexAttribIiv;
+	glad_trace_real.glGetVertexAttribIuiv = glad_glGetVertexAttribIuiv;
+	if(glad_glGetVertexAttribIuiv != NULL) glad_glGetVertexAttribIuiv = glad_trace_glGetVertexAttribIuiv;
+	glad_trace_real.glVertexAttribI1i = glad_glVertexAttribI1i;
+	if(glad_glVertexAttribI1i != NULL) glad_glVertexAttribI1i = glad_trace_glVertexAttribI1i;
+	glad_trace_real.glVertexAttribI2i = glad_glVertexAttribI2i;
+	if(glad_glVertexAttribI2i != NULL) glad_glVertexAttribI2i = glad_trace_glVertexAttribI2i;
+	glad_trace_real.glVertexAttribI3i = glad_glVertexAttribI3i;
+	if(glad_glVertexAttribI3i != NULL) glad_glVertexAttribI3i = glad_trace_glVertexAttribI3i;
+	glad_trace_real.glVertexAttribI4i = glad_glVertexAttribI4i;
+	if(glad_glVertexAttribI4i != NULL) glad_glVertexAttribI4i = glad_trace_glVertexAttribI4i;
+	glad_trace_real.glVertexAttribI1ui = glad_glVertexAttribI1ui;
+	if(glad_glVertexAttribI1ui != NULL) glad_glVertexAttribI1ui = glad_trace_glVertexAttribI1ui;
+	glad_trace_real.glVertexAttribI2ui = glad_glVertexAttribI2ui;
+	if(glad_glVertexAttribI2ui != NULL) glad_glVertexAttribI2ui = glad_trace_glVertexAttribI2ui;
+	glad_trace_real.glVertexAttribI3ui = glad_glVertexAttribI3ui;
+	if(glad_glVertexAttribI3ui != NULL) glad_glVertexAttribI3ui = glad_trace_glVertexAttribI3ui;
+	glad_trace_real.glVertexAttribI4ui = glad_glVertexAttribI4ui;
+	if(glad_glVertexAttribI4ui != NULL) glad_glVertexAttribI4ui = glad_trace_glVertexAttribI4ui;
+	glad_trace_real.glVertexAttribI1iv = glad_glVertexAttribI1iv;
+	if(glad_glVertexAttribI1iv != NULL) glad_glVertexAttribI1iv = glad_trace_glVertexAttribI1iv;
+	glad_trace_real.glVertexAttribI2iv = glad_glVertexAttribI2iv;
+	if(glad_glVertexAttribI2iv != NULL) glad_glVertexAttribI2iv = glad_trace_glVertexAttribI2iv;
+	glad_trace_real.glVertexAttribI3iv = glad_glVertexAttribI3iv;
+	if(glad_glVertexAttribI3iv != NULL) glad_glVertexAttribI3iv = glad_trace_glVertexAttribI3iv;
+	glad_trace_real.glVertexAttribI4iv = glad_glVertexAttribI4iv;
+	if(glad_glVertexAttribI4iv != NULL) glad_glVertexAttribI4iv = glad_trace_glVertexAttribI4iv;
+	glad_trace_real.glVertexAttribI1uiv = glad_glVertexAttribI1uiv;
+	if(glad_glVertexAttribI1uiv != NULL) glad_glVertexAttribI1uiv = glad_trace_glVertexAttribI1uiv;
+	glad_trace_real.glVertexAttribI2uiv = glad_glVertexAttribI2uiv;
+	if(glad_glVertexAttribI2uiv != NULL) glad_glVertexAttribI2uiv = glad_trace_glVertexAttribI2uiv;
+	glad_trace_real.glVertexAttribI3uiv = glad_glVertexAttribI3uiv;
+	if(glad_glVertexAttribI3uiv != NULL) glad_glVertexAttribI3uiv = glad_trace_glVertexAttribI3uiv;
+	glad_trace_real.glVertexAttribI4uiv = glad_glVertexAttribI4uiv;
+	if(glad_glVertexAttribI4uiv != NULL) glad_glVertexAttribI4uiv = glad_trace_glVertexAttribI4uiv;
+	glad_trace_real.glVertexAttribI4bv = glad_glVertexAttribI4bv;
+	if(glad_glVertexAttribI4bv != NULL) glad_glVertexAttribI4bv = glad_trace_glVertexAttribI4bv;
+	glad_trace_real.glVertexAttribI4sv = glad_glVertexAttribI4sv;
+	if(glad_glVertexAttribI4sv != NULL) glad_glVertexAttribI4sv = glad_trace_glVertexAttribI4sv;
+	glad_trace_real.glVertexAttribI4ubv = glad_glVertexAttribI4ubv;
+	if(glad_glVertexAttribI4ubv != NULL) glad_glVertexAttribI4ubv = glad_trace_glVertexAttribI4ubv;
+	glad_trace_real.glVertexAttribI4usv = glad_glVertexAttribI4usv;
+	if(glad_glVertexAttribI4usv != NULL) glad_glVertexAttribI4usv = glad_trace_glVertexAttribI4usv;
+	glad_trace_real.glGetUniformuiv = glad_glGetUniformuiv;
+	if(glad_glGetUniformuiv != NULL) glad_glGetUniformuiv = glad_trace_glGetUniformuiv;
+	glad_trace_real.glBindFragDataLocation = glad_glBindFragDataLocation;
+	if(glad_glBindFragDataLocation != NULL) glad_glBindFragDataLocation = glad_trace_glBindFragDataLocation;
+	glad_trace_real.glGetFragDataLocation = glad_glGetFragDataLocation;
+	if(glad_glGetFragDataLocation != NULL) glad_glGetFragDataLocation = glad_trace_glGetFragDataLocation;
+	glad_trace_real.glUniform1ui = glad_glUniform1ui;
+	if(glad_glUniform1ui != NULL) glad_glUniform1ui = glad_trace_glUniform1ui;
+	glad_trace_real.glUniform2ui = glad_glUniform2ui;
+	if(glad_glUniform2ui != NULL) glad_glUniform2ui = glad_trace_glUniform2ui;
+	glad_trace_real.glUniform3ui = glad_glUniform3ui;
+	if(glad_glUniform3ui != NULL) glad_glUniform3ui = glad_trace_glUniform3ui;
+	glad_trace_real.glUniform4ui = glad_glUniform4ui;
+	if(glad_glUniform4ui != NULL) glad_glUniform4ui = glad_trace_glUniform4ui;
+	glad_trace_real.glUniform1uiv = glad_glUniform1uiv;
+	if(glad_glUniform1uiv != NULL) glad_glUniform1uiv = glad_trace_glUniform1uiv;
+	glad_trace_real.glUniform2uiv = glad_glUniform2uiv;
+	if(glad_glUniform2uiv != NULL) glad_glUniform2uiv = glad_trace_glUniform2uiv;
+	glad_trace_real.glUniform3uiv = glad_glUniform3uiv;
+	if(glad_glUniform3uiv != NULL) glad_glUniform3uiv = glad_trace_glUniform3uiv;
+	glad_trace_real.glUniform4uiv = glad_glUniform4uiv;
+	if(glad_glUniform4uiv != NULL) glad_glUniform4uiv = glad_trace_glUniform4uiv;
+	glad_trace_real.glTexParameterIiv = glad_glTexParameterIiv;
+	if(glad_glTexParameterIiv != NULL) glad_glTexParameterIiv = glad_trace_glTexParameterIiv;
+	glad_trace_real.glTexParameterIuiv = glad_glTexParameterIuiv;
+	if(glad_glTexParameterIuiv != NULL) glad_glTexParameterIuiv = glad_trace_glTexParameterIuiv;
+	glad_trace_real.glGetTexParameterIiv = glad_glGetTexParameterIiv;
+	if(glad_glGetTexParameterIiv != NULL) glad_glGetTexParameterIiv = glad_trace_glGetTexParameterIiv;
+	glad_trace_real.glGetTexParameterIuiv = glad_glGetTexParameterIuiv;
+	if(glad_glGetTexParameterIuiv != NULL) glad_glGetTexParameterIuiv = glad_trace_glGetTexParameterIuiv;
+	glad_trace_real.glClearBufferiv = glad_glClearBufferiv;
+	if(glad_glClearBufferiv != NULL) glad_glClearBufferiv = glad_trace_glClearBufferiv;
+	glad_trace_real.glClearBufferuiv = glad_glClearBufferuiv;
+	if(glad_glClearBufferuiv != NULL) glad_glClearBufferuiv = glad_trace_glClearBufferuiv;
+	glad_trace_real.glClearBufferfv = glad_glClearBufferfv;
+	if(glad_glClearBufferfv != NULL) glad_glClearBufferfv = glad_trace_glClearBufferfv;
+	glad_trace_real.glClearBufferfi = glad_glClearBufferfi;
+	if(glad_glClearBufferfi != NULL) glad_glClearBufferfi = glad_trace_glClearBufferfi;
+	glad_trace_real.glGetStringi = glad_glGetStringi;
+	if(glad_glGetStringi != NULL) glad_glGetStringi = glad_trace_glGetStringi;
+	glad_trace_real.glIsRenderbuffer = glad_glIsRenderbuffer;
+	if(glad_glIsRenderbuffer != NULL) glad_glIsRenderbuffer = glad_trace_glIsRenderbuffer;
+	glad_trace_real.glBindRenderbuffer = glad_glBindRenderbuffer;
+	if(glad_glBindRenderbuffer != NULL) glad_glBindRenderbuffer = glad_trace_glBindRenderbuffer;
+	glad_trace_real.glDeleteRenderbuffers = glad_glDeleteRenderbuffers;
+	if(glad_glDeleteRenderbuffers != NULL) glad_glDeleteRenderbuffers = glad_trace_glDeleteRenderbuffers;
+	glad_trace_real.glGenRenderbuffers = glad_glGenRenderbuffers;
+	if(glad_glGenRenderbuffers != NULL) glad_glGenRenderbuffers = glad_trace_glGenRenderbuffers;
+	glad_trace_real.glRenderbufferStorage = glad_glRenderbufferStorage;
+	if(glad_glRenderbufferStorage != NULL) glad_glRenderbufferStorage = glad_trace_glRenderbufferStorage;
+	glad_trace_real.glGetRenderbufferParameteriv = glad_glGetRenderbufferParameteriv;
+	if(glad_glGetRenderbufferParameteriv != NULL) glad_glGetRenderbufferParameteriv = glad_trace_glGetRenderbufferParameteriv;
+	glad_trace_real.glIsFramebuffer = glad_glIsFramebuffer;
+	if(glad_glIsFramebuffer != NULL) glad_glIsFramebuffer = glad_trace_glIsFramebuffer;
+	glad_trace_real.glBindFramebuffer = glad_glBindFramebuffer;
+	if(glad_glBindFramebuffer != NULL) glad_glBindFramebuffer = glad_trace_glBindFramebuffer;
+	glad_trace_real.glDeleteFramebuffers = glad_glDeleteFramebuffers;
+	if(glad_glDeleteFramebuffers != NULL) glad_glDeleteFramebuffers = glad_trace_glDeleteFramebuffers;
+	glad_trace_real.glGenFramebuffers = glad_glGenFramebuffers;
+	if(glad_glGenFramebuffers != NULL) glad_glGenFramebuffers = glad_trace_glGenFramebuffers;
+	glad_trace_real.glCheckFramebufferStatus = glad_glCheckFramebufferStatus;
+	if(glad_glCheckFramebufferStatus != NULL) glad_glCheckFramebufferStatus = glad_trace_glCheckFramebufferStatus;
+	glad_trace_real.glFramebufferTexture1D = glad_glFramebufferTexture1D;
+	if(glad_glFramebufferTexture1D != NULL) glad_glFramebufferTexture1D = glad_trace_glFramebufferTexture1D;
+	glad_trace_real.glFramebufferTexture2D = glad_glFramebufferTexture2D;
+	if(glad_glFramebufferTexture2D != NULL) glad_glFramebufferTexture2D = glad_trace_glFramebufferTexture2D;
+	glad_trace_real.glFramebufferTexture3D = glad_glFramebufferTexture3D;
+	if(glad_glFramebufferTexture3D != NULL) glad_glFramebufferTexture3D = glad_trace_glFramebufferTexture3D;
+	glad_trace_real.glFramebufferRenderbuffer = glad_glFramebufferRenderbuffer;
+	if(glad_glFramebufferRenderbuffer != NULL) glad_glFramebufferRenderbuffer = glad_trace_glFramebufferRenderbuffer;
+	glad_trace_real.glGetFramebufferAttachmentParameteriv = glad_glGetFramebufferAttachmentParameteriv;
+	if(glad_glGetFramebufferAttachmentParameteriv != NULL) glad_glGetFramebufferAttachmentParameteriv = glad_trace_glGetFramebufferAttachmentParameteriv;
+	glad_trace_real.glGenerateMipmap = glad_glGenerateMipmap;
+	if(glad_glGenerateMipmap != NULL) glad_glGenerateMipmap = glad_trace_glGenerateMipmap;
+	glad_trace_real.glBlitFramebuffer = glad_glBlitFramebuffer;
+	if(glad_glBlitFramebuffer != NULL) glad_glBlitFramebuffer = glad_trace_glBlitFramebuffer;
+	glad_trace_real.glRenderbufferStorageMultisample = glad_glRenderbufferStorageMultisample;
+	if(glad_glRenderbufferStorageMultisample != NULL) glad_glRenderbufferStorageMultisample = glad_trace_glRenderbufferStorageMultisample;
+	glad_trace_real.glFramebufferTextureLayer = glad_glFramebufferTextureLayer;
+	if(glad_glFramebufferTextureLayer != NULL) glad_glFramebufferTextureLayer = glad_trace_glFramebufferTextureLayer;
+	glad_trace_real.glMapBufferRange = glad_glMapBufferRange;
+	if(glad_glMapBufferRange != NULL) glad_glMapBufferRange = glad_trace_glMapBufferRange;
+	glad_trace_real.glFlushMappedBufferRange = glad_glFlushMappedBufferRange;
+	if(glad_glFlushMappedBufferRange != NULL) glad_glFlushMappedBufferRange = glad_trace_glFlushMappedBufferRange;
+	glad_trace_real.glBindVertexArray = glad_glBindVertexArray;
+	if(glad_glBindVertexArray != NULL) glad_glBindVertexArray = glad_trace_glBindVertexArray;
+	glad_trace_real.glDeleteVertexArrays = glad_glDeleteVertexArrays;
+	if(glad_glDeleteVertexArrays != NULL) glad_glDeleteVertexArrays = glad_trace_glDeleteVertexArrays;
+	glad_trace_real.glGenVertexArrays = glad_glGenVertexArrays;
+	if(glad_glGenVertexArrays != NULL) glad_glGenVertexArrays = glad_trace_glGenVertexArrays;
+	glad_trace_real.glIsVertexArray = glad_glIsVertexArray;
+	if(glad_glIsVertexArray != NULL) glad_glIsVertexArray = glad_trace_glIsVertexArray;
+	glad_trace_real.glDrawArraysInstanced = glad_glDrawArraysInstanced;
+	if(glad_glDrawArraysInstanced != NULL) glad_glDrawArraysInstanced = glad_trace_glDrawArraysInstanced;
+	glad_trace_real.glDrawElementsInstanced = glad_glDrawElementsInstanced;
+	if(glad_glDrawElementsInstanced != NULL) glad_glDrawElementsInstanced = glad_trace_glDrawElementsInstanced;
+	glad_trace_real.glTexBuffer = glad_glTexBuffer;
+	if(glad_glTexBuffer != NULL) glad_glTexBuffer = glad_trace_glTexBuffer;
+	glad_trace_real.glPrimitiveRestartIndex = glad_glPrimitiveRestartIndex;
+	if(glad_glPrimitiveRestartIndex != NULL) glad_glPrimitiveRestartIndex = glad_trace_glPrimitiveRestartIndex;
+	glad_trace_real.glCopyBufferSubData = glad_glCopyBufferSubData;
+	if(glad_glCopyBufferSubData != NULL) glad_glCopyBufferSubData = glad_trace_glCopyBufferSubData;
+	glad_trace_real.glGetUniformIndices = glad_glGetUniformIndices;
+	if(glad_glGetUniformIndices != NULL) glad_glGetUniformIndices = glad_trace_glGetUniformIndices;
+	glad_trace_real.glGetActiveUniformsiv = glad_glGetActiveUniformsiv;
+	if(glad_glGetActiveUniformsiv != NULL) glad_glGetActiveUniformsiv = glad_trace_glGetActiveUniformsiv;
+	glad_trace_real.glGetActiveUniformName = glad_glGetActiveUniformName;
+	if(glad_glGetActiveUniformName != NULL) glad_glGetActiveUniformName = glad_trace_glGetActiveUniformName;
+	glad_trace_real.glGetUniformBlockIndex = glad_glGetUniformBlockIndex;
+	if(glad_glGetUniformBlockIndex != NULL) glad_glGetUniformBlockIndex = glad_trace_glGetUniformBlockIndex;
+	glad_trace_real.glGetActiveUniformBlockiv = glad_glGetActiveUniformBlockiv;
+	if(glad_glGetActiveUniformBlockiv != NULL) glad_glGetActiveUniformBlockiv = glad_trace_glGetActiveUniformBlockiv;
+	glad_trace_real.glGetActiveUniformBlockName = glad_glGetActiveUniformBlockName;
+	if(glad_glGetActiveUniformBlockName != NULL) glad_glGetActiveUniformBlockName = glad_trace_glGetActiveUniformBlockName;
+	glad_trace_real.glUniformBlockBinding = glad_glUniformBlockBinding;
+	if(glad_glUniformBlockBinding != NULL) glad_glUniformBlockBinding = glad_trace_glUniformBlockBinding;
+	glad_trace_real.glDrawElementsBaseVertex = glad_glDrawElementsBaseVertex;
+	if(glad_glDrawElementsBaseVertex != NULL) glad_glDrawElementsBaseVertex = glad_trace_glDrawElementsBaseVertex;
+	glad_trace_real.glDrawRangeElementsBaseVertex = glad_glDrawRangeElementsBaseVertex;
+	if(glad_glDrawRangeElementsBaseVertex != NULL) glad_glDrawRangeElementsBaseVertex = glad_trace_glDrawRangeElementsBaseVertex;
+	glad_trace_real.glDrawElementsInstancedBaseVertex = glad_glDrawElementsInstancedBaseVertex;
+	if(glad_glDrawElementsInstancedBaseVertex != NULL) glad_glDrawElementsInstancedBaseVertex = glad_trace_glDrawElementsInstancedBaseVertex;
+	glad_trace_real.glMultiDrawElementsBaseVertex = glad_glMultiDrawElementsBaseVertex;
+	if(glad_glMultiDrawElementsBaseVertex != NULL) glad_glMultiDrawElementsBaseVertex = glad_trace_glMultiDrawElementsBaseVertex;
+	glad_trace_real.glProvokingVertex = glad_glProvokingVertex;
+	if(glad_glProvokingVertex != NULL) glad_glProvokingVertex = glad_trace_glProvokingVertex;
+	glad_trace_real.glFenceSync = glad_glFenceSync;
+	if(glad_glFenceSync != NULL) glad_glFenceSync = glad_trace_glFenceSync;
+	glad_trace_real.glIsSync = glad_glIsSync;
+	if(glad_glIsSync != NULL) glad_glIsSync = glad_trace_glIsSync;
+	glad_trace_real.glDeleteSync = glad_glDeleteSync;
+	if(glad_glDeleteSync != NULL) glad_glDeleteSync = glad_trace_glDeleteSync;
+	glad_trace_real.glClientWaitSync = glad_glClientWaitSync;
+	if(glad_glClientWaitSync != NULL) glad_glClientWaitSync = glad_trace_glClientWaitSync;
+	glad_trace_real.glWaitSync = glad_glWaitSync;
+	if(glad_glWaitSync != NULL) glad_glWaitSync = glad_trace_glWaitSync;
+	glad_trace_real.glGetInteger64v = glad_glGetInteger64v;
+	if(glad_glGetInteger64v != NULL) glad_glGetInteger64v = glad_trace_glGetInteger64v;
+	glad_trace_real.glGetSynciv = glad_glGetSynciv;
+	if(glad_glGetSynciv != NULL) glad_glGetSynciv = glad_trace_glGetSynciv;
+	glad_trace_real.glGetInteger64i_v = glad_glGetInteger64i_v;
+	if(glad_glGetInteger64i_v != NULL) glad_glGetInteger64i_v = glad_trace_glGetInteger64i_v;
+	glad_trace_real.glGetBufferParameteri64v = glad_glGetBufferParameteri64v;
+	if(glad_glGetBufferParameteri64v != NULL) glad_glGetBufferParameteri64v = glad_trace_glGetBufferParameteri64v;
+	glad_trace_real.glFramebufferTexture = glad_glFramebufferTexture;
+	if(glad_glFramebufferTexture != NULL) glad_glFramebufferTexture = glad_trace_glFramebufferTexture;
+	glad_trace_real.glTexImage2DMultisample = glad_glTexImage2DMultisample;
+	if(glad_glTexImage2DMultisample != NULL) glad_glTexImage2DMultisample = glad_trace_glTexImage2DMultisample;
+	glad_trace_real.glTexImage3DMultisample = glad_glTexImage3DMultisample;
+	if(glad_glTexImage3DMultisample != NULL) glad_glTexImage3DMultisample = glad_trace_glTexImage3DMultisample;
+	glad_trace_real.glGetMultisamplefv = glad_glGetMultisamplefv;
+	if(glad_glGetMultisamplefv != NULL) glad_glGetMultisamplefv = glad_trace_glGetMultisamplefv;
+	glad_trace_real.glSampleMaski = glad_glSampleMaski;
+	if(glad_glSampleMaski != NULL) glad_glSampleMaski = glad_trace_glSampleMaski;
+	glad_trace_real.glBindFragDataLocationIndexed = glad_glBindFragDataLocationIndexed;
+	if(glad_glBindFragDataLocationIndexed != NULL) glad_glBindFragDataLocationIndexed = glad_trace_glBindFragDataLocationIndexed;
+	glad_trace_real.glGetFragDataIndex = glad_glGetFragDataIndex;
+	if(glad_glGetFragDataIndex != NULL) glad_glGetFragDataIndex = glad_trace_glGetFragDataIndex;
+	glad_trace_real.glGenSamplers = glad_glGenSamplers;
+	if(glad_glGenSamplers != NULL) glad_glGenSamplers = glad_trace_glGenSamplers;
+	glad_trace_real.glDeleteSamplers = glad_glDeleteSamplers;
+	if(glad_glDeleteSamplers != NULL) glad_glDeleteSamplers = glad_trace_glDeleteSamplers;
+	glad_trace_real.glIsSampler = glad_glIsSampler;
+	if(glad_glIsSampler != NULL) glad_glIsSampler = glad_trace_glIsSampler;
+	glad_trace_real.glBindSampler = glad_glBindSampler;
+	if(glad_glBindSampler != NULL) glad_glBindSampler = glad_trace_glBindSampler;
+	glad_trace_real.glSamplerParameteri = glad_glSamplerParameteri;
+	if(glad_glSamplerParameteri != NULL) glad_glSamplerParameteri = glad_trace_glSamplerParameteri;
+	glad_trace_real.glSamplerParameteriv = glad_glSamplerParameteriv;
+	if(glad_glSamplerParameteriv != NULL) glad_glSamplerParameteriv = glad_trace_glSamplerParameteriv;
+	glad_trace_real.glSamplerParameterf = glad_glSamplerParameterf;
+	if(glad_glSamplerParameterf != NULL) glad_glSamplerParameterf = glad_trace_glSamplerParameterf;
+	glad_trace_real.glSamplerParameterfv = glad_glSamplerParameterfv;
+	if(glad_glSamplerParameterfv != NULL) glad_glSamplerParameterfv = glad_trace_glSamplerParameterfv;
+	glad_trace_real.glSamplerParameterIiv = glad_glSamplerParameterIiv;
+	if(glad_glSamplerParameterIiv != NULL) glad_glSamplerParameterIiv = glad_trace_glSamplerParameterIiv;
+	glad_trace_real.glSamplerParameterIuiv = glad_glSamplerParameterIuiv;
+	if(glad_glSamplerParameterIuiv != NULL) glad_glSamplerParameterIuiv = glad_trace_glSamplerParameterIuiv;
+	glad_trace_real.glGetSamplerParameteriv = glad_glGetSamplerParameteriv;
+	if(glad_glGetSamplerParameteriv != NULL) glad_glGetSamplerParameteriv = glad_trace_glGetSamplerParameteriv;
+	glad_trace_real.glGetSamplerParameterIiv = glad_glGetSamplerParameterIiv;
+	if(glad_glGetSamplerParameterIiv != NULL) glad_glGetSamplerParameterIiv = glad_trace_glGetSamplerParameterIiv;
+	glad_trace_real.glGetSamplerParameterfv = glad_glGetSamplerParameterfv;
+	if(glad_glGetSamplerParameterfv != NULL) glad_glGetSamplerParameterfv = glad_trace_glGetSamplerParameterfv;
+	glad_trace_real.glGetSamplerParameterIuiv = glad_glGetSamplerParameterIuiv;
+	if(glad_glGetSamplerParameterIuiv != NULL) glad_glGetSamplerParameterIuiv = glad_trace_glGetSamplerParameterIuiv;
+	glad_trace_real.glQueryCounter = glad_glQueryCounter;
+	if(glad_glQueryCounter != NULL) glad_glQueryCounter = glad_trace_glQueryCounter;
+	glad_trace_real.glGetQueryObjecti64v = glad_glGetQueryObjecti64v;
+	if(glad_glGetQueryObjecti64v != NULL) glad_glGetQueryObjecti64v = glad_trace_glGetQueryObjecti64v;
+	glad_trace_real.glGetQueryObjectui64v = glad_glGetQueryObjectui64v;
+	if(glad_glGetQueryObjectui64v != NULL) glad_glGetQueryObjectui64v = glad_trace_glGetQueryObjectui64v;
+	glad_trace_real.glVertexAttribDivisor = glad_glVertexAttribDivisor;
+	if(glad_glVertexAttribDivisor != NULL) glad_glVertexAttribDivisor = glad_trace_glVertexAttribDivisor;
+	glad_trace_real.glVertexAttribP1ui = glad_glVertexAttribP1ui;
+	if(glad_glVertexAttribP1ui != NULL) glad_glVertexAttribP1ui = glad_trace_glVertexAttribP1ui;
+	glad_trace_real.glVertexAttribP1uiv = glad_glVertexAttribP1uiv;
+	if(glad_glVertexAttribP1uiv != NULL) glad_glVertexAttribP1uiv = glad_trace_glVertexAttribP1uiv;
+	glad_trace_real.glVertexAttribP2ui = glad_glVertexAttribP2ui;
+	if(glad_glVertexAttribP2ui != NULL) glad_glVertexAttribP2ui = glad_trace_glVertexAttribP2ui;
+	glad_trace_real.glVertexAttribP2uiv = glad_glVertexAttribP2uiv;
+	if(glad_glVertexAttribP2uiv != NULL) glad_glVertexAttribP2uiv = glad_trace_glVertexAttribP2uiv;
+	glad_trace_real.glVertexAttribP3ui = glad_glVertexAttribP3ui;
+	if(glad_glVertexAttribP3ui != NULL) glad_glVertexAttribP3ui = glad_trace_glVertexAttribP3ui;
+	glad_trace_real.glVertexAttribP3uiv = glad_glVertexAttribP3uiv;
+	if(glad_glVertexAttribP3uiv != NULL) glad_glVertexAttribP3uiv = glad_trace_glVertexAttribP3uiv;
+	glad_trace_real.glVertexAttribP4ui = glad_glVertexAttribP4ui;
+	if(glad_glVertexAttribP4ui != NULL) glad_glVertexAttribP4ui = glad_trace_glVertexAttribP4ui;
+	glad_trace_real.glVertexAttribP4uiv = glad_glVertexAttribP4uiv;
+	if(glad_glVertexAttribP4uiv != NULL) glad_glVertexAttribP4uiv = glad_trace_glVertexAttribP4uiv;
+	glad_trace_real.glVertexP2ui = glad_glVertexP2ui;
+	if(glad_glVertexP2ui != NULL) glad_glVertexP2ui = glad_trace_glVertexP2ui;
+	glad_trace_real.glVertexP2uiv = glad_glVertexP2uiv;
+	if(glad_glVertexP2uiv != NULL) glad_glVertexP2uiv = glad_trace_glVertexP2uiv;
+	glad_trace_real.glVertexP3ui = glad_glVertexP3ui;
+	if(glad_glVertexP3ui != NULL) glad_glVertexP3ui = glad_trace_glVertexP3ui;
+	glad_trace_real.glVertexP3uiv = glad_glVertexP3uiv;
+	if(glad_glVertexP3uiv != NULL) glad_glVertexP3uiv = glad_trace_glVertexP3uiv;
+	glad_trace_real.glVertexP4ui = glad_glVertexP4ui;
+	if(glad_glVertexP4ui != NULL) glad_glVertexP4ui = glad_trace_glVertexP4ui;
+	glad_trace_real.glVertexP4uiv = glad_glVertexP4uiv;
+	if(glad_glVertexP4uiv != NULL) glad_glVertexP4uiv = glad_trace_glVertexP4uiv;
+	glad_trace_real.glTexCoordP1ui = glad_glTexCoordP1ui;
+	if(glad_glTexCoordP1ui != NULL) glad_glTexCoordP1ui = glad_trace_glTexCoordP1ui;
+	glad_trace_real.glTexCoordP1uiv = glad_glTexCoordP1uiv;
+	if(glad_glTexCoordP1uiv != NULL) glad_glTexCoordP1uiv = glad_trace_glTexCoordP1uiv;
+	glad_trace_real.glTexCoordP2ui = glad_glTexCoordP2ui;
+	if(glad_glTexCoordP2ui != NULL) glad_glTexCoordP2ui = glad_trace_glTexCoordP2ui;
+	glad_trace_real.glTexCoordP2uiv = glad_glTexCoordP2uiv;
+	if(glad_glTexCoordP2uiv != NULL) glad_glTexCoordP2uiv = glad_trace_glTexCoordP2uiv;
+	glad_trace_real.glTexCoordP3ui = glad_glTexCoordP3ui;
+	if(glad_glTexCoordP3ui != NULL) glad_glTexCoordP3ui = glad_trace_glTexCoordP3ui;
+	glad_trace_real.glTexCoordP3uiv = glad_glTexCoordP3uiv;
+	if(glad_glTexCoordP3uiv != NULL) glad_glTexCoordP3uiv = glad_trace_glTexCoordP3uiv;
+	glad_trace_real.glTexCoordP4ui = glad_glTexCoordP4ui;
+	if(glad_glTexCoordP4ui != NULL) glad_glTexCoordP4ui = glad_trace_glTexCoordP4ui;
+	glad_trace_real.glTexCoordP4uiv = glad_glTexCoordP4uiv;
+	if(glad_glTexCoordP4uiv != NULL) glad_glTexCoordP4uiv = glad_trace_glTexCoordP4uiv;
+	glad_trace_real.glMultiTexCoordP1ui = glad_glMultiTexCoordP1ui;
+	if(glad_glMultiTexCoordP1ui != NULL) glad_glMultiTexCoordP1ui = glad_trace_glMultiTexCoordP1ui;
+	glad_trace_real.glMultiTexCoordP1uiv = glad_glMultiTexCoordP1uiv;
+	if(glad_glMultiTexCoordP1uiv != NULL) glad_glMultiTexCoordP1uiv = glad_trace_glMultiTexCoordP1uiv;
+	glad_trace_real.glMultiTexCoordP2ui = glad_glMultiTexCoordP2ui;
+	if(glad_glMultiTexCoordP2ui != NULL) glad_glMultiTexCoordP2ui = glad_trace_glMultiTexCoordP2ui;
+	glad_trace_real.glMultiTexCoordP2uiv = glad_glMultiTexCoordP2uiv;
+	if(glad_glMultiTexCoordP2uiv != NULL) glad_glMultiTexCoordP2uiv = glad_trace_glMultiTexCoordP2uiv;
+	glad_trace_real.glMultiTexCoordP3ui = glad_glMultiTexCoordP3ui;
+	if(glad_glMultiTexCoordP3ui != NULL) glad_glMultiTexCoordP3ui = glad_trace_glMultiTexCoordP3ui;
+	glad_trace_real.glMultiTexCoordP3uiv = glad_glMultiTexCoordP3uiv;
+	if(glad_glMultiTexCoordP3uiv != NULL) glad_glMultiTexCoordP3uiv = glad_trace_glMultiTexCoordP3uiv;
+	glad_trace_real.glMultiTexCoordP4ui = glad_glMultiTexCoordP4ui;
+	if(glad_glMultiTexCoordP4ui != NULL) glad_glMultiTexCoordP4ui = glad_trace_glMultiTexCoordP4ui;
+	glad_trace_real.glMultiTexCoordP4uiv = glad_glMultiTexCoordP4uiv;
+	if(glad_glMultiTexCoordP4uiv != NULL) glad_glMultiTexCoordP4uiv = glad_trace_glMultiTexCoordP4uiv;
+	glad_trace_real.glNormalP3ui = glad_glNormalP3ui;
+	if(glad_glNormalP3ui != NULL) glad_glNormalP3ui = glad_trace_glNormalP3ui;
+	glad_trace_real.glNormalP3uiv = glad_glNormalP3uiv;
+	if(glad_glNormalP3uiv != NULL) glad_glNormalP3uiv = glad_trace_glNormalP3uiv;
+	glad_trace_real.glColorP3ui = glad_glColorP3ui;
+	if(glad_glColorP3ui != NULL) glad_glColorP3ui = glad_trace_glColorP3ui;
+	glad_trace_real.glColorP3uiv = glad_glColorP3uiv;
+	if(glad_glColorP3uiv != NULL) glad_glColorP3uiv = glad_trace_glColorP3uiv;
+	glad_trace_real.glColorP4ui = glad_glColorP4ui;
+	if(glad_glColorP4ui != NULL) glad_glColorP4ui = glad_trace_glColorP4ui;
+	glad_trace_real.glColorP4uiv = glad_glColorP4uiv;
+	if(glad_glColorP4uiv != NULL) glad_glColorP4uiv = glad_trace_glColorP4uiv;
+	glad_trace_real.glSecondaryColorP3ui = glad_glSecondaryColorP3ui;
+	if(glad_glSecondaryColorP3ui != NULL) glad_glSecondaryColorP3ui = glad_trace_glSecondaryColorP3ui;
+	glad_trace_real.glSecondaryColorP3uiv = glad_glSecondaryColorP3uiv;
+	if(glad_glSecondaryColorP3uiv != NULL) glad_glSecondaryColorP3uiv = glad_trace_glSecondaryColorP3uiv;
+	glad_trace_real.glGetProgramBinary = glad_glGetProgramBinary;
+	if(glad_glGetProgramBinary != NULL) glad_glGetProgramBinary = glad_trace_glGetProgramBinary;
+	glad_trace_real.glProgramBinary = glad_glProgramBinary;
+	if(glad_glProgramBinary != NULL) glad_glProgramBinary = glad_trace_glProgramBinary;
+	glad_trace_real.glProgramParameteri = glad_glProgramParameteri;
+	if(glad_glProgramParameteri != NULL) glad_glProgramParameteri = glad_trace_glProgramParameteri;
+	glad_trace_real.glMaxShaderCompilerThreadsKHR = glad_glMaxShaderCompilerThreadsKHR;
+	if(glad_glMaxShaderCompilerThreadsKHR != NULL) glad_glMaxShaderCompilerThreadsKHR = glad_trace_glMaxShaderCompilerThreadsKHR;
+	glad_trace_real.glBufferStorage = glad_glBufferStorage;
+	if(glad_glBufferStorage != NULL) glad_glBufferStorage = glad_trace_glBufferStorage;
+}
+
+static void trace_uninstall(void) {
+	if(glad_glCullFace == glad_trace_glCullFace) glad_glCullFace = glad_trace_real.glCullFace;
+	if(glad_glFrontFace == glad_trace_glFrontFace) glad_glFrontFace = glad_trace_real.glFrontFace;
+	if(glad_glHint == glad_trace_glHint) glad_glHint = glad_trace_real.glHint;
+	if(glad_glLineWidth == glad_trace_glLineWidth) glad_glLineWidth = glad_trace_real.glLineWidth;
+	if(glad_glPointSize == glad_trace_glPointSize) glad_glPointSize = glad_trace_real.glPointSize;
+	if(glad_glPolygonMode == glad_trace_glPolygonMode) glad_glPolygonMode = glad_trace_real.glPolygonMode;
+	if(glad_glScissor == glad_trace_glScissor) glad_glScissor = glad_trace_real.glScissor;
+	if(glad_glTexParameterf == glad_trace_glTexParameterf) glad_glTexParameterf = glad_trace_real.glTexParameterf;
+	if(glad_glTexParameterfv == glad_trace_glTexParameterfv) glad_glTexParameterfv = glad_trace_real.glTexParameterfv;
+	if(glad_glTexParameteri == glad_trace_glTexParameteri) glad_glTexParameteri = glad_trace_real.glTexParameteri;
+	if(glad_glTexParameteriv == glad_trace_glTexParameteriv) glad_glTexParameteriv = glad_trace_real.glTexParameteriv;
+	if(glad_glTexImage1D == glad_trace_glTexImage1D) glad_glTexImage1D = glad_trace_real.glTexImage1D;
+	if(glad_glTexImage2D == glad_trace_glTexImage2D) glad_glTexImage2D = glad_trace_real.glTexImage2D;
+	if(glad_glDrawBuffer == glad_trace_glDrawBuffer) glad_glDrawBuffer = glad_trace_real.glDrawBuffer;
+	if(glad_glClear == glad_trace_glClear) glad_glClear = glad_trace_real.glClear;
+	if(glad_glClearColor == glad_trace_glClearColor) glad_glClearColor = glad_trace_real.glClearColor;
+	if(glad_glClearStencil == glad_trace_glClearStencil) glad_glClearStencil = glad_trace_real.glClearStencil;
+	if(glad_glClearDepth == glad_trace_glClearDepth) glad_glClearDepth = glad_trace_real.glClearDepth;
+	if(glad_glStencilMask == glad_trace_glStencilMask) glad_glStencilMask = glad_trace_real.glStencilMask;
+	if(glad_glColorMask == glad_trace_glColorMask) glad_glColorMask = glad_trace_real.glColorMask;
+	if(glad_glDepthMask == glad_trace_glDepthMask) glad_glDepthMask = glad_trace_real.glDepthMask;
+	if(glad_glDisable == glad_trace_glDisable) glad_glDisable = glad_trace_real.glDisable;
+	if(glad_glEnable == glad_trace_glEnable) glad_glEnable = glad_trace_real.glEnable;
+	if(glad_glFinish == glad_trace_glFinish) glad_glFinish = glad_trace_real.glFinish;
+	if(glad_glFlush == glad_trace_glFlush) glad_glFlush = glad_trace_real.glFlush;
+	if(glad_glBlendFunc == glad_trace_glBlendFunc) glad_glBlendFunc = glad_trace_real.glBlendFunc;
+	if(glad_glLogicOp == glad_trace_glLogicOp) glad_glLogicOp = glad_trace_real.glLogicOp;
+	if(glad_glStencilFunc == glad_trace_glStencilFunc) glad_glStencilFunc = glad_trace_real.glStencilFunc;
+	if(glad_glStencilOp == glad_trace_glStencilOp) glad_glStencilOp = glad_trace_real.glStencilOp;
+	if(glad_glDepthFunc == glad_trace_glDepthFunc) glad_glDepthFunc = glad_trace_real.glDepthFunc;
+	if(glad_glPixelStoref == glad_trace_glPixelStoref) glad_glPixelStoref = glad_trace_real.glPixelStoref;
+	if(glad_glPixelStorei == glad_trace_glPixelStorei) glad_glPixelStorei = glad_trace_real.glPixelStorei;
+	if(glad_glReadBuffer == glad_trace_glReadBuffer) glad_glReadBuffer = glad_trace_real.glReadBuffer;
+	if(glad_glReadPixels == glad_trace_glReadPixels) glad_glReadPixels = glad_trace_real.glReadPixels;
+	if(glad_glGetBooleanv == glad_trace_glGetBooleanv) glad_glGetBooleanv = glad_trace_real.glGetBooleanv;
+	if(glad_glGetDoublev == glad_trace_glGetDoublev) glad_glGetDoublev = glad_trace_real.glGetDoublev;
+	if(glad_glGetError == glad_trace_glGetError) glad_glGetError = glad_trace_real.glGetError;
+	if(glad_glGetFloatv == glad_trace_glGetFloatv) glad_glGetFloatv = glad_trace_real.glGetFloatv;
+	if(glad_glGetIntegerv == glad_trace_glGetIntegerv) glad_glGetIntegerv = glad_trace_real.glGetIntegerv;
+	if(glad_glGetString == glad_trace_glGetString) glad_glGetString = glad_trace_real.glGetString;
+	if(glad_glGetTexImage == glad_trace_glGetTexImage) glad_glGetTexImage = glad_trace_real.glGetTexImage;
+	if(glad_glGetTexParameterfv == glad_trace_glGetTexParameterfv) glad_glGetTexParameterfv = glad_trace_real.glGetTexParameterfv;
+	if(glad_glGetTexParameteriv == glad_trace_glGetTexParameteriv) glad_glGetTexParameteriv = glad_trace_real.glGetTexParameteriv;
+	if(glad_glGetTexLevelParameterfv == glad_trace_glGetTexLevelParameterfv) glad_glGetTexLevelParameterfv = glad_trace_real.glGetTexLevelParameterfv;
+	if(glad_glGetTexLevelParameteriv == glad_trace_glGetTexLevelParameteriv) glad_glGetTexLevelParameteriv = glad_trace_real.glGetTexLevelParameteriv;
+	if(glad_glIsEnabled == glad_trace_glIsEnabled) glad_glIsEnabled = glad_trace_real.glIsEnabled;
+	if(glad_glDepthRange == glad_trace_glDepthRange) glad_glDepthRange = glad_trace_real.glDepthRange;
+	if(glad_glViewport == glad_trace_glViewport) glad_glViewport = glad_trace_real.glViewport;
+	if(glad_glDrawArrays == glad_trace_glDrawArrays) glad_glDrawArrays = glad_trace_real.glDrawArrays;
+	if(glad_glDrawElements == glad_trace_glDrawElements) glad_glDrawElements = glad_trace_real.glDrawElements;
+	if(glad_glPolygonOffset == glad_trace_glPolygonOffset) glad_glPolygonOffset = glad_trace_real.glPolygonOffset;
+	if(glad_glCopyTexImage1D == glad_trace_glCopyTexImage1D) glad_glCopyTexImage1D = glad_trace_real.glCopyTexImage1D;
+	if(glad_glCopyTexImage2D == glad_trace_glCopyTexImage2D) glad_glCopyTexImage2D = glad_trace_real.glCopyTexImage2D;
+	if(glad_glCopyTexSubImage1D == glad_trace_glCopyTexSubImage1D) glad_glCopyTexSubImage1D = glad_trace_real.glCopyTexSubImage1D;
+	if(glad_glCopyTexSubImage2D == glad_trace_glCopyTexSubImage2D) glad_glCopyTexSubImage2D = glad_trace_real.glCopyTexSubImage2D;
+	if(glad_glTexSubImage1D == glad_trace_glTexSubImage1D) glad_glTexSubImage1D = glad_trace_real.glTexSubImage1D;
+	if(glad_glTexSubImage2D == glad_trace_glTexSubImage2D) glad_glTexSubImage2D = glad_trace_real.glTexSubImage2D;
+	if(glad_glBindTexture == glad_trace_glBindTexture) glad_glBindTexture = glad_trace_real.glBindTexture;
+	if(glad_glDeleteTextures == glad_trace_glDeleteTextures) glad_glDeleteTextures = glad_trace_real.glDeleteTextures;
+	if(glad_glGenTextures == glad_trace_glGenTextures) glad_glGenTextures = glad_trace_real.glGenTextures;
+	if(glad_glIsTexture == glad_trace_glIsTexture) glad_glIsTexture = glad_trace_real.glIsTexture;
+	if(glad_glDrawRangeElements == glad_trace_glDrawRangeElements) glad_glDrawRangeElements = glad_trace_real.glDrawRangeElements;
+	if(glad_glTexImage3D == glad_trace_glTexImage3D) glad_glTexImage3D = glad_trace_real.glTexImage3D;
+	if(glad_glTexSubImage3D == glad_trace_glTexSubImage3D) glad_glTexSubImage3D = glad_trace_real.glTexSubImage3D;
+	if(glad_glCopyTexSubImage3D == glad_trace_glCopyTexSubImage3D) glad_glCopyTexSubImage3D = glad_trace_real.glCopyTexSubImage3D;
+	if(glad_glActiveTexture == glad_trace_glActiveTexture) glad_glActiveTexture = glad_trace_real.glActiveTexture;
+	if(glad_glSampleCoverage == glad_trace_glSampleCoverage) glad_glSampleCoverage = glad_trace_real.glSampleCoverage;
+	if(glad_glCompressedTexImage3D == glad_trace_glCompressedTexImage3D) glad_glCompressedTexImage3D = glad_trace_real.glCompressedTexImage3D;
+	if(glad_glCompressedTexImage2D == glad_trace_glCompressedTexImage2D) glad_glCompressedTexImage2D = glad_trace_real.glCompressedTexImage2D;
+	if(glad_glCompressedTexImage1D == glad_trace_glCompressedTexImage1D) glad_glCompressedTexImage1D = glad_trace_real.glCompressedTexImage1D;
+	if(glad_glCompressedTexSubImage3D == glad_trace_glCompressedTexSubImage3D) glad_glCompressedTexSubImage3D = glad_trace_real.glCompressedTexSubImage3D;
+	if(glad_glCompressedTexSubImage2D == glad_trace_glCompressedTexSubImage2D) glad_glCompressedTexSubImage2D = glad_trace_real.glCompressedTexSubImage2D;
+	if(glad_glCompressedTexSubImage1D == glad_trace_glCompressedTexSubImage1D) glad_glCompressedTexSubImage1D = glad_trace_real.glCompressedTexSubImage1D;
+	if(glad_glGetCompressedTexImage == glad_trace_glGetCompressedTexImage) glad_glGetCompressedTexImage = glad_trace_real.glGetCompressedTexImage;
+	if(glad_glBlendFuncSeparate == glad_trace_glBlendFuncSeparate) glad_glBlendFuncSeparate = glad_trace_real.glBlendFuncSeparate;
+	if(glad_glMultiDrawArrays == glad_trace_glMultiDrawArrays) glad_glMultiDrawArrays = glad_trace_real.glMultiDrawArrays;
+	if(glad_glMultiDrawElements == glad_trace_glMultiDrawElements) glad_glMultiDrawElements = glad_trace_real.glMultiDrawElements;
+	if(glad_glPointParameterf == glad_trace_glPointParameterf) glad_glPointParameterf = glad_trace_real.glPointParameterf;
+	if(glad_glPointParameterfv == glad_trace_glPointParameterfv) glad_glPointParameterfv = glad_trace_real.glPointParameterfv;
+	if(glad_glPointParameteri == glad_trace_glPointParameteri) glad_glPointParameteri = glad_trace_real.glPointParameteri;
+	if(glad_glPointParameteriv == glad_trace_glPointParameteriv) glad_glPointParameteriv = glad_trace_real.glPointParameteriv;
+	if(glad_glBlendColor == glad_trace_glBlendColor) glad_glBlendColor = glad_trace_real.glBlendColor;
+	if(glad_glBlendEquation == glad_trace_glBlendEquation) glad_glBlendEquation = glad_trace_real.glBlendEquation;
+	if(glad_glGenQueries == glad_trace_glGenQueries) glad_glGenQueries = glad_trace_real.glGenQueries;
+	if(glad_glDeleteQueries == glad_trace_glDeleteQueries) glad_glDeleteQueries = glad_trace_real.glDeleteQueries;
+	if(glad_glIsQuery == glad_trace_glIsQuery) glad_glIsQuery = glad_trace_real.glIsQuery;
+	if(glad_glBeginQuery == glad_trace_glBeginQuery) glad_glBeginQuery = glad_trace_real.glBeginQuery;
+	if(glad_glEndQuery == glad_trace_glEndQuery) glad_glEndQuery = glad_trace_real.glEndQuery;
+	if(glad_glGetQueryiv == glad_trace_glGetQueryiv) glad_glGetQueryiv = glad_trace_real.glGetQueryiv;
+	if(glad_glGetQueryObjectiv == glad_trace_glGetQueryObjectiv) glad_glGetQueryObjectiv = glad_trace_real.glGetQueryObjectiv;
+	if(glad_glGetQueryObjectuiv == glad_trace_glGetQueryObjectuiv) glad_glGetQueryObjectuiv = glad_trace_real.glGetQueryObjectuiv;
+	if(glad_glBindBuffer == glad_trace_glBindBuffer) glad_glBindBuffer = glad_trace_real.glBindBuffer;
+	if(glad_glDeleteBuffers == glad_trace_glDeleteBuffers) glad_glDeleteBuffers = glad_trace_real.glDeleteBuffers;
+	if(glad_glGenBuffers == glad_trace_glGenBuffers) glad_glGenBuffers = glad_trace_real.glGenBuffers;
+	if(glad_glIsBuffer == glad_trace_glIsBuffer) glad_glIsBuffer = glad_trace_real.glIsBuffer;
+	if(glad_glBufferData == glad_trace_glBufferData) glad_glBufferData = glad_trace_real.glBufferData;
+	if(glad_glBufferSubData == glad_trace_glBufferSubData) glad_glBufferSubData = glad_trace_real.glBufferSubData;
+	if(glad_glGetBufferSubData == glad_trace_glGetBufferSubData) glad_glGetBufferSubData = glad_trace_real.glGetBufferSubData;
+	if(glad_glMapBuffer == glad_trace_glMapBuffer) glad_glMapBuffer = glad_trace_real.glMapBuffer;
+	if(glad_glUnmapBuffer == glad_trace_glUnmapBuffer) glad_glUnmapBuffer = glad_trace_real.glUnmapBuffer;
+	if(glad_glGetBufferParameteriv == glad_trace_glGetBufferParameteriv) glad_glGetBufferParameteriv = glad_trace_real.glGetBufferParameteriv;
+	if(glad_glGetBufferPointerv == glad_trace_glGetBufferPointerv) glad_glGetBufferPointerv = glad_trace_real.glGetBufferPointerv;
+	if(glad_glBlendEquationSeparate == glad_trace_glBlendEquationSeparate) glad_glBlendEquationSeparate = glad_trace_real.glBlendEquationSeparate;
+	if(glad_glDrawBuffers == glad_trace_glDrawBuffers) glad_glDrawBuffers = glad_trace_real.glDrawBuffers;
+	if(glad_glStencilOpSeparate == glad_trace_glStencilOpSeparate) glad_glStencilOpSeparate = glad_trace_real.glStencilOpSeparate;
+	if(glad_glStencilFuncSeparate == glad_trace_glStencilFuncSeparate) glad_glStencilFuncSeparate = glad_trace_real.glStencilFuncSeparate;
+	if(glad_glStencilMaskSeparate == glad_trace_glStencilMaskSeparate) glad_glStencilMaskSeparate = glad_trace_real.glStencilMaskSeparate;
+	if(glad_glAttachShader == glad_trace_glAttachShader) glad_glAttachShader = glad_trace_real.glAttachShader;
+	if(glad_glBindAttribLocation == glad_trace_glBindAttribLocation) glad_glBindAttribLocation = glad_trace_real.glBindAttribLocation;
+	if(glad_glCompileShader == glad_trace_glCompileShader) glad_glCompileShader = glad_trace_real.glCompileShader;
+	if(glad_glCreateProgram == glad_trace_glCreateProgram) glad_glCreateProgram = glad_trace_real.glCreateProgram;
+	if(glad_glCreateShader == glad_trace_glCreateShader) glad_glCreateShader = glad_trace_real.glCreateShader;
+	if(glad_glDeleteProgram == glad_trace_glDeleteProgram) glad_glDeleteProgram = glad_trace_real.glDeleteProgram;
+	if(glad_glDeleteShader == glad_trace_glDeleteShader) glad_glDeleteShader = glad_trace_real.glDeleteShader;
+	if(glad_glDetachShader == glad_trace_glDetachShader) glad_glDetachShader = glad_trace_real.glDetachShader;
+	if(glad_glDisableVertexAttribArray == glad_trace_glDisableVertexAttribArray) glad_glDisableVertexAttribArray = glad_trace_real.glDisableVertexAttribArray;
+	if(glad_glEnableVertexAttribArray == glad_trace_glEnableVertexAttribArray) glad_glEnableVertexAttribArray = glad_trace_real.glEnableVertexAttribArray;
+	if(glad_glGetActiveAttrib == glad_trace_glGetActiveAttrib) glad_glGetActiveAttrib = glad_trace_real.glGetActiveAttrib;
+	if(glad_glGetActiveUniform == glad_trace_glGetActiveUniform) glad_glGetActiveUniform = glad_trace_real.glGetActiveUniform;
+	if(glad_glGetAttachedShaders == glad_trace_glGetAttachedShaders) glad_glGetAttachedShaders = glad_trace_real.glGetAttachedShaders;
+	if(glad_glGetAttribLocation == glad_trace_glGetAttribLocation) glad_glGetAttribLocation = glad_trace_real.glGetAttribLocation;
+	if(glad_glGetProgramiv == glad_trace_glGetProgramiv) glad_glGetProgramiv = glad_trace_real.glGetProgramiv;
+	if(glad_glGetProgramInfoLog == glad_trace_glGetProgramInfoLog) glad_glGetProgramInfoLog = glad_trace_real.glGetProgramInfoLog;
+	if(glad_glGetShaderiv == glad_trace_glGetShaderiv) glad_glGetShaderiv = glad_trace_real.glGetShaderiv;
+	if(glad_glGetShaderInfoLog == glad_trace_glGetShaderInfoLog) glad_glGetShaderInfoLog = glad_trace_real.glGetShaderInfoLog;
+	if(glad_glGetShaderSource == glad_trace_glGetShaderSource) glad_glGetShaderSource = glad_trace_real.glGetShaderSource;
+	if(glad_glGetUniformLocation == glad_trace_glGetUniformLocation) glad_glGetUniformLocation = glad_trace_real.glGetUniformLocation;
+	if(glad_glGetUniformfv == glad_trace_glGetUniformfv) glad_glGetUniformfv = glad_trace_real.glGetUniformfv;
+	if(glad_glGetUniformiv == glad_trace_glGetUniformiv) glad_glGetUniformiv = glad_trace_real.glGetUniformiv;
+	if(glad_glGetVertexAttribdv == glad_trace_glGetVertexAttribdv) glad_glGetVertexAttribdv = glad_trace_real.glGetVertexAttribdv;
+	if(glad_glGetVertexAttribfv == glad_trace_glGetVertexAttribfv) glad_glGetVertexAttribfv = glad_trace_real.glGetVertexAttribfv;
+	if(glad_glGetVertexAttribiv == glad_trace_glGetVertexAttribiv) glad_glGetVertexAttribiv = glad_trace_real.glGetVertexAttribiv;
+	if(glad_glGetVertexAttribPointerv == glad_trace_glGetVertexAttribPointerv) glad_glGetVertexAttribPointerv = glad_trace_real.glGetVertexAttribPointerv;
+	if(glad_glIsProgram == glad_trace_glIsProgram) glad_glIsProgram = glad_trace_real.glIsProgram;
+	if(glad_glIsShader == glad_trace_glIsShader) glad_glIsShader = glad_trace_real.glIsShader;
+	if(glad_glLinkProgram == glad_trace_glLinkProgram) glad_glLinkProgram = glad_trace_real.glLinkProgram;
+	if(glad_glShaderSource == glad_trace_glShaderSource) glad_glShaderSource = glad_trace_real.glShaderSource;
+	if(glad_glUseProgram == glad_trace_glUseProgram) glad_glUseProgram = glad_trace_real.glUseProgram;
+	if(glad_glUniform1f == glad_trace_glUniform1f) glad_glUniform1f = glad_trace_real.glUniform1f;
+	if(glad_glUniform2f == glad_trace_glUniform2f) glad_glUniform2f = glad_trace_real.glUniform2f;
+	if(glad_glUniform3f == glad_trace_glUniform3f) glad_glUniform3f = glad_trace_real.glUniform3f;
+	if(glad_glUniform4f == glad_trace_glUniform4f) glad_glUniform4f = glad_trace_real.glUniform4f;
+	if(glad_glUniform1i == glad_trace_glUniform1i) glad_glUniform1i = glad_trace_real.glUniform1i;
+	if(glad_glUniform2i == glad_trace_glUniform2i) glad_glUniform2i = glad_trace_real.glUniform2i;
+	if(glad_glUniform3i == glad_trace_glUniform3i) glad_glUniform3i = glad_trace_real.glUniform3i;
+	if(glad_glUniform4i == glad_trace_glUniform4i) glad_glUniform4i = glad_trace_real.glUniform4i;
+	if(glad_glUniform1fv == glad_trace_glUniform1fv) glad_glUniform1fv = glad_trace_real.glUniform1fv;
+	if(glad_glUniform2fv == glad_trace_glUniform2fv) glad_glUniform2fv = glad_trace_real.glUniform2fv;
+	if(glad_glUniform3fv == glad_trace_glUniform3fv) glad_glUniform3fv = glad_trace_real.glUniform3fv;
+	if(glad_glUniform4fv == glad_trace_glUniform4fv) glad_glUniform4fv = glad_trace_real.glUniform4fv;
+	if(glad_glUniform1iv == glad_trace_glUniform1iv) glad_glUniform1iv = glad_trace_real.glUniform1iv;
+	if(glad_glUniform2iv == glad_trace_glUniform2iv) glad_glUniform2iv = glad_trace_real.glUniform2iv;
+	if(glad_glUniform3iv == glad_trace_glUniform3iv) glad_glUniform3iv = glad_trace_real.glUniform3iv;
+	if(glad_glUniform4iv == glad_trace_glUniform4iv) glad_glUniform4iv = glad_trace_real.glUniform4iv;
+	if(glad_glUniformMatrix2fv == glad_trace_glUniformMatrix2fv) glad_glUniformMatrix2fv = glad_trace_real.glUniformMatrix2fv;
+	if(glad_glUniformMatrix3fv == glad_trace_glUniformMatrix3fv) glad_glUniformMatrix3fv = glad_trace_real.glUniformMatrix3fv;
+	if(glad_glUniformMatrix4fv == glad_trace_glUniformMatrix4fv) glad_glUniformMatrix4fv = glad_trace_real.glUniformMatrix4fv;
+	if(glad_glValidateProgram == glad_trace_glValidateProgram) glad_glValidateProgram = glad_trace_real.glValidateProgram;
+	if(glad_glVertexAttrib1d == glad_trace_glVertexAttrib1d) glad_glVertexAttrib1d = glad_trace_real.glVertexAttrib1d;
+	if(glad_glVertexAttrib1dv == glad_trace_glVertexAttrib1dv) glad_glVertexAttrib1dv = glad_trace_real.glVertexAttrib1dv;
+	if(glad_glVertexAttrib1f == glad_trace_glVertexAttrib1f) glad_glVertexAttrib1f = glad_trace_real.glVertexAttrib1f;
+	if(glad_glVertexAttrib1fv == glad_trace_glVertexAttrib1fv) glad_glVertexAttrib1fv = glad_trace_real.glVertexAttrib1fv;
+	if(glad_glVertexAttrib1s == glad_trace_glVertexAttrib1s) glad_glVertexAttrib1s = glad_trace_real.glVertexAttrib1s;
+	if(glad_glVertexAttrib1sv == glad_trace_glVertexAttrib1sv) glad_glVertexAttrib1sv = glad_trace_real.glVertexAttrib1sv;
+	if(glad_glVertexAttrib2d == glad_trace_glVertexAttrib2d) glad_glVertexAttrib2d = glad_trace_real.glVertexAttrib2d;
+	if(glad_glVertexAttrib2dv == glad_trace_glVertexAttrib2dv) glad_glVertexAttrib2dv = glad_trace_real.glVertexAttrib2dv;
+	if(glad_glVertexAttrib2f == glad_trace_glVertexAttrib2f) glad_glVertexAttrib2f = glad_trace_real.glVertexAttrib2f;
+	if(glad_glVertexAttrib2fv == glad_trace_glVertexAttrib2fv) glad_glVertexAttrib2fv = glad_trace_real.glVertexAttrib2fv;
+	if(glad_glVertexAttrib2s == glad_trace_glVertexAttrib2s) glad_glVertexAttrib2s = glad_trace_real.glVertexAttrib2s;
+	if(glad_glVertexAttrib2sv == glad_trace_glVertexAttrib2sv) glad_glVertexAttrib2sv = glad_trace_real.glVertexAttrib2sv;
+	if(glad_glVertexAttrib3d == glad_trace_glVertexAttrib3d) glad_glVertexAttrib3d = glad_trace_real.glVertexAttrib3d;
+	if(glad_glVertexAttrib3dv == glad_trace_glVertexAttrib3dv) glad_glVertexAttrib3dv = glad_trace_real.glVertexAttrib3dv;
+	if(glad_glVertexAttrib3f == glad_trace_glVertexAttrib3f) glad_glVertexAttrib3f = glad_trace_real.glVertexAttrib3f;
+	if(glad_glVertexAttrib3fv == glad_trace_glVertexAttrib3fv) glad_glVertexAttrib3fv = glad_trace_real.glVertexAttrib3fv;
+	if(glad_glVertexAttrib3s == glad_trace_glVertexAttrib3s) glad_glVertexAttrib3s = glad_trace_real.glVertexAttrib3s;
+	if(glad_glVertexAttrib3sv == glad_trace_glVertexAttrib3sv) glad_glVertexAttrib3sv = glad_trace_real.glVertexAttrib3sv;
+	if(glad_glVertexAttrib4Nbv == glad_trace_glVertexAttrib4Nbv) glad_glVertexAttrib4Nbv = glad_trace_real.glVertexAttrib4Nbv;
+	if(glad_glVertexAttrib4Niv == glad_trace_glVertexAttrib4Niv) glad_glVertexAttrib4Niv = glad_trace_real.glVertexAttrib4Niv;
+	if(glad_glVertexAttrib4Nsv == glad_trace_glVertexAttrib4Nsv) glad_glVertexAttrib4Nsv = glad_trace_real.glVertexAttrib4Nsv;
+	if(glad_glVertexAttrib4Nub == glad_trace_glVertexAttrib4Nub) glad_glVertexAttrib4Nub = glad_trace_real.glVertexAttrib4Nub;
+	if(glad_glVertexAttrib4Nubv == glad_trace_glVertexAttrib4Nubv) glad_glVertexAttrib4Nubv = glad_trace_real.glVertexAttrib4Nubv;
+	if(glad_glVertexAttrib4Nuiv == glad_trace_glVertexAttrib4Nuiv) glad_glVertexAttrib4Nuiv = glad_trace_real.glVertexAttrib4Nuiv;
+	if(glad_glVertexAttrib4Nusv == glad_trace_glVertexAttrib4Nusv) glad_glVertexAttrib4Nusv = glad_trace_real.glVertexAttrib4Nusv;
+	if(glad_glVertexAttrib4bv == glad_trace_glVertexAttrib4bv) glad_glVertexAttrib4bv = glad_trace_real.glVertexAttrib4bv;
+	if(glad_glVertexAttrib4d == glad_trace_glVertexAttrib4d) glad_glVertexAttrib4d = glad_trace_real.glVertexAttrib4d;
+	if(glad_glVertexAttrib4dv == glad_trace_glVertexAttrib4dv) glad_glVertexAttrib4dv = glad_trace_real.glVertexAttrib4dv;
+	if(glad_glVertexAttrib4f == glad_trace_glVertexAttrib4f) glad_glVertexAttrib4f = glad_trace_real.glVertexAttrib4f;
+	if(glad_glVertexAttrib4fv == glad_trace_glVertexAttrib4fv) glad_glVertexAttrib4fv = glad_trace_real.glVertexAttrib4fv;
+	if(glad_glVertexAttrib4iv == glad_trace_glVertexAttrib4iv) glad_glVertexAttrib4iv = glad_trace_real.glVertexAttrib4iv;
+	if(glad_glVertexAttrib4s == glad_trace_glVertexAttrib4s) glad_glVertexAttrib4s = glad_trace_real.glVertexAttrib4s;
+	if(glad_glVertexAttrib4sv == glad_trace_glVertexAttrib4sv) glad_glVertexAttrib4sv = glad_trace_real.glVertexAttrib4sv;
+	if(glad_glVertexAttrib4ubv == glad_trace_glVertexAttrib4ubv) glad_glVertexAttrib4ubv = glad_trace_real.glVertexAttrib4ubv;
+	if(glad_glVertexAttrib4uiv == glad_trace_glVertexAttrib4uiv) glad_glVertexAttrib4uiv = glad_trace_real.glVertexAttrib4uiv;
+	if(glad_glVertexAttrib4usv == glad_trace_glVertexAttrib4usv) glad_glVertexAttrib4usv = glad_trace_real.glVertexAttrib4usv;
+	if(glad_glVertexAttribPointer == glad_trace_glVertexAttribPointer) glad_glVertexAttribPointer = glad_trace_real.glVertexAttribPointer;
+	if(glad_glUniformMatrix2x3fv == glad_trace_glUniformMatrix2x3fv) glad_glUniformMatrix2x3fv = glad_trace_real.glUniformMatrix2x3fv;
+	if(glad_glUniformMatrix3x2fv == glad_trace_glUniformMatrix3x2fv) glad_glUniformMatrix3x2fv = glad_trace_real.glUniformMatrix3x2fv;
+	if(glad_glUniformMatrix2x4fv == glad_trace_glUniformMatrix2x4fv) glad_glUniformMatrix2x4fv = glad_trace_real.glUniformMatrix2x4fv;
+	if(glad_glUniformMatrix4x2fv == glad_trace_glUniformMatrix4x2fv) glad_glUniformMatrix4x2fv = glad_trace_real.glUniformMatrix4x2fv;
+	if(glad_glUniformMatrix3x4fv == glad_trace_glUniformMatrix3x4fv) glad_glUniformMatrix3x4fv = glad_trace_real.glUniformMatrix3x4fv;
+	if(glad_glUniformMatrix4x3fv == glad_trace_glUniformMatrix4x3fv) glad_glUniformMatrix4x3fv = glad_trace_real.glUniformMatrix4x3fv;
+	if(glad_glColorMaski == glad_trace_glColorMaski) glad_glColorMaski = glad_trace_real.glColorMaski;
+	if(glad_glGetBooleani_v == glad_trace_glGetBooleani_v) glad_glGetBooleani_v = glad_trace_real.glGetBooleani_v;
+	if(glad_glGetIntegeri_v == glad_trace_glGetIntegeri_v) glad_glGetIntegeri_v = glad_trace_real.glGetIntegeri_v;
+	if(glad_glEnablei == glad_trace_glEnablei) glad_glEnablei = glad_trace_real.glEnablei;
+	if(glad_glDisablei == glad_trace_glDisablei) glad_glDisablei = glad_trace_real.glDisablei;
+	if(glad_glIsEnabledi == glad_trace_glIsEnabledi) glad_glIsEnabledi = glad_trace_real.glIsEnabledi;
+	if(glad_glBeginTransformFeedback == glad_trace_glBeginTransformFeedback) glad_glBeginTransformFeedback = glad_trace_real.glBeginTransformFeedback;
+	if(glad_glEndTransformFeedback == glad_trace_glEndTransformFeedback) glad_glEndTransformFeedback = glad_trace_real.glEndTransformFeedback;
+	if(glad_glBindBufferRange == glad_trace_glBindBufferRange) glad_glBindBufferRange = glad_trace_real.glBindBufferRange;
+	if(glad_glBindBufferBase == glad_trace_glBindBufferBase) glad_glBindBufferBase = glad_trace_real.glBindBufferBase;
+	if(glad_glTransformFeedbackVaryings == glad_trace_glTransformFeedbackVaryings) glad_glTransformFeedbackVaryings = glad_trace_real.glTransformFeedbackVaryings;
+	if(glad_glGetTransformFeedbackVarying == glad_trace_glGetTransformFeedbackVarying) glad_glGetTransformFeedbackVarying = glad_trace_real.glGetTransformFeedbackVarying;
+	if(glad_glClampColor == glad_trace_glClampColor) glad_glClampColor = glad_trace_real.glClampColor;
+	if(glad_glBeginConditionalRender == glad_trace_glBeginConditionalRender) glad_glBeginConditionalRender = glad_trace_real.glBeginConditionalRender;
+	if(glad_glEndConditionalRender == glad_trace_glEndConditionalRender) glad_glEndConditionalRender = glad_trace_real.glEndConditionalRender;
+	if(glad_glVertexAttribIPointer == glad_trace_glVertexAttribIPointer) glad_glVertexAttribIPointer = glad_trace_real.glVertexAttribIPointer;
+	if(glad_glGetVertexAttribIiv == glad_trace_glGetVertexAttribIiv) glad_glGetVertexAttribIiv = glad_trace_real.glGetVertexAttribIiv;
+	if(glad_glGetVertexAttribIuiv == glad_trace_glGetVertexAttribIuiv) glad_glGetVertexAttribIuiv = glad_trace_real.glGetVertexAttribIuiv;
+	if(glad_glVertexAttribI1i == glad_trace_glVertexAttribI1i) glad_glVertexAttribI1i = glad_trace_real.glVertexAttribI1i;
+	if(glad_glVertexAttribI2i == glad_trace_glVertexAttribI2i) glad_glVertexAttribI2i = glad_trace_real.glVertexAttribI2i;
+	if(glad_glVertexAttribI3i == glad_trace_glVertexAttribI3i) glad_glVertexAttribI3i = glad_trace_real.glVertexAttribI3i;
+	if(glad_glVertexAttribI4i == glad_trace_glVertexAttribI4i) glad_glVertexAttribI4i = glad_trace_real.glVertexAttribI4i;
+	if(glad_glVertexAttribI1ui == glad_trace_glVertexAttribI1ui) glad_glVertexAttribI1ui = glad_trace_real.glVertexAttribI1ui;
+	if(glad_glVertexAttribI2ui == glad_trace_glVertexAttribI2ui) glad_glVertexAttribI2ui = glad_trace_real.glVertexAttribI2ui;
+	if(glad_glVertexAttribI3ui == glad_trace_glVertexAttribI3ui) glad_glVertexAttribI3ui = glad_trace_real.glVertexAttribI3ui;
+	if(glad_glVertexAttribI4ui == glad_trace_glVertexAttribI4ui) glad_glVertexAttribI4ui = glad_trace_real.glVertexAttribI4ui;
+	if(glad_glVertexAttribI1iv == glad_trace_glVertexAttribI1iv) glad_glVertexAttribI1iv = glad_trace_real.glVertexAttribI1iv;
+	if(glad_glVertexAttribI2iv == glad_trace_glVertexAttribI2iv) glad_glVertexAttribI2iv = glad_trace_real.glVertexAttribI2iv;
+	if(glad_glVertexAttribI3iv == glad_trace_glVertexAttribI3iv) glad_glVertexAttribI3iv = glad_trace_real.glVertexAttribI3iv;
+	if(glad_glVertexAttribI4iv == glad_trace_glVertexAttribI4iv) glad_glVertexAttribI4iv = glad_trace_real.glVertexAttribI4iv;
+	if(glad_glVertexAttribI1uiv == glad_trace_glVertexAttribI1uiv) glad_glVertexAttribI1uiv = glad_trace_real.glVertexAttribI1uiv;
+	if(glad_glVertexAttribI2uiv == glad_trace_glVertexAttribI2uiv) glad_glVertexAttribI2uiv = glad_trace_real.glVertexAttribI2uiv;
+	if(glad_glVertexAttribI3uiv == glad_trace_glVertexAttribI3uiv) glad_glVertexAttribI3uiv = glad_trace_real.glVertexAttribI3uiv;
+	if(glad_glVertexAttribI4uiv == glad_trace_glVertexAttribI4uiv) glad_glVertexAttribI4uiv = glad_trace_real.glVertexAttribI4uiv;
+	if(glad_glVertexAttribI4bv == glad_trace_glVertexAttribI4bv) glad_glVertexAttribI4bv = glad_trace_real.glVertexAttribI4bv;
+	if(glad_glVertexAttribI4sv == glad_trace_glVertexAttribI4sv) glad_glVertexAttribI4sv = glad_trace_real.glVertexAttribI4sv;
+	if(glad_glVertexAttribI4ubv == glad_trace_glVertexAttribI4ubv) glad_glVertexAttribI4ubv = glad_trace_real.glVertexAttribI4ubv;
+	if(glad_glVertexAttribI4usv == glad_trace_glVertexAttribI4usv) glad_glVertexAttribI4usv = glad_trace_real.glVertexAttribI4usv;
+	if(glad_glGetUniformuiv == glad_trace_glGetUniformuiv) glad_glGetUniformuiv = glad_trace_real.glGetUniformuiv;
+	if(glad_glBindFragDataLocation == glad_trace_glBindFragDataLocation) glad_glBindFragDataLocation = glad_trace_real.glBindFragDataLocation;
+	if(glad_glGetFragDataLocation == glad_trace_glGetFragDataLocation) glad_glGetFragDataLocation = glad_trace_real.glGetFragDataLocation;
+	if(glad_glUniform1ui == glad_trace_glUniform1ui) glad_glUniform1ui = glad_trace_real.glUniform1ui;
+	if(glad_glUniform2ui == glad_trace_glUniform2ui) glad_glUniform2ui = glad_trace_real.glUniform2ui;
+	if(glad_glUniform3ui == glad_trace_glUniform3ui) glad_glUniform3ui = glad_trace_real.glUniform3ui;
+	if(glad_glUniform4ui == glad_trace_glUniform4ui) glad_glUniform4ui = glad_trace_real.glUniform4ui;
+	if(glad_glUniform1uiv == glad_trace_glUniform1uiv) glad_glUniform1uiv = glad_trace_real.glUniform1uiv;
+	if(glad_glUniform2uiv == glad_trace_glUniform2uiv) glad_glUniform2uiv = glad_trace_real.glUniform2uiv;
+	if(glad_glUniform3uiv == glad_trace_glUniform3uiv) glad_glUniform3uiv = glad_trace_real.glUniform3uiv;
+	if(glad_glUniform4uiv == glad_trace_glUniform4uiv) glad_glUniform4uiv = glad_trace_real.glUniform4uiv;
+	if(glad_glTexParameterIiv == glad_trace_glTexParameterIiv) glad_glTexParameterIiv = glad_trace_real.glTexParameterIiv;
+	if(glad_glTexParameterIuiv == glad_trace_glTexParameterIuiv) glad_glTexParameterIuiv = glad_trace_real.glTexParameterIuiv;
+	if(glad_glGetTexParameterIiv == glad_trace_glGetTexParameterIiv) glad_glGetTexParameterIiv = glad_trace_real.glGetTexParameterIiv;
+	if(glad_glGetTexParameterIuiv == glad_trace_glGetTexParameterIuiv) glad_glGetTexParameterIuiv = glad_trace_real.glGetTexParameterIuiv;
+	if(glad_glClearBufferiv == glad_trace_glClearBufferiv) glad_glClearBufferiv = glad_trace_real.glClearBufferiv;
+	if(glad_glClearBufferuiv == glad_trace_glClearBufferuiv) glad_glClearBufferuiv = glad_trace_real.glClearBufferuiv;
+	if(glad_glClearBufferfv == glad_trace_glClearBufferfv) glad_glClearBufferfv = glad_trace_real.glClearBufferfv;
+	if(glad_glClearBufferfi == glad_trace_glClearBufferfi) glad_glClearBufferfi = glad_trace_real.glClearBufferfi;
+	if(glad_glGetStringi == glad_trace_glGetStringi) glad_glGetStringi = glad_trace_real.glGetStringi;
+	if(glad_glIsRenderbuffer == glad_trace_glIsRenderbuffer) glad_glIsRenderbuffer = glad_trace_real.glIsRenderbuffer;
+	if(glad_glBindRenderbuffer == glad_trace_glBindRenderbuffer) glad_glBindRenderbuffer = glad_trace_real.glBindRenderbuffer;
+	if(glad_glDeleteRenderbuffers == glad_trace_glDeleteRenderbuffers) glad_glDeleteRenderbuffers = glad_trace_real.glDeleteRenderbuffers;
+	if(glad_glGenRenderbuffers == glad_trace_glGenRenderbuffers) glad_glGenRenderbuffers = glad_trace_real.glGenRenderbuffers;
+	if(glad_glRenderbufferStorage == glad_trace_glRenderbufferStorage) glad_glRenderbufferStorage = glad_trace_real.glRenderbufferStorage;
+	if(glad_glGetRenderbufferParameteriv == glad_trace_glGetRenderbufferParameteriv) glad_glGetRenderbufferParameteriv = glad_trace_real.glGetRenderbufferParameteriv;
+	if(glad_glIsFramebuffer == glad_trace_glIsFramebuffer) glad_glIsFramebuffer = glad_trace_real.glIsFramebuffer;
+	if(glad_glBindFramebuffer == glad_trace_glBindFramebuffer) glad_glBindFramebuffer = glad_trace_real.glBindFramebuffer;
+	if(glad_glDeleteFramebuffers == glad_trace_glDeleteFramebuffers) glad_glDeleteFramebuffers = glad_trace_real.glDeleteFramebuffers;
+	if(glad_glGenFramebuffers == glad_trace_glGenFramebuffers) glad_glGenFramebuffers = glad_trace_real.glGenFramebuffers;
+	if(glad_glCheckFramebufferStatus == glad_trace_glCheckFramebufferStatus) glad_glCheckFramebufferStatus = glad_trace_real.glCheckFramebufferStatus;
+	if(glad_glFramebufferTexture1D == glad_trace_glFramebufferTexture1D) glad_glFramebufferTexture1D = glad_trace_real.glFramebufferTexture1D;
+	if(glad_glFramebufferTexture2D == glad_trace_glFramebufferTexture2D) glad_glFramebufferTexture2D = glad_trace_real.glFramebufferTexture2D;
+	if(glad_glFramebufferTexture3D == glad_trace_glFramebufferTexture3D) glad_glFramebufferTexture3D = glad_trace_real.glFramebufferTexture3D;
+	if(glad_glFramebufferRenderbuffer == glad_trace_glFramebufferRenderbuffer) glad_glFramebufferRenderbuffer = glad_trace_real.glFramebufferRenderbuffer;
+	if(glad_glGetFramebufferAttachmentParameteriv == glad_trace_glGetFramebufferAttachmentParameteriv) glad_glGetFramebufferAttachmentParameteriv = glad_trace_real.glGetFramebufferAttachmentParameteriv;
+	if(glad_glGenerateMipmap == glad_trace_glGenerateMipmap) glad_glGenerateMipmap = glad_trace_real.glGenerateMipmap;
+	if(glad_glBlitFramebuffer == glad_trace_glBlitFramebuffer) glad_glBlitFramebuffer = glad_trace_real.glBlitFramebuffer;
+	if(glad_glRenderbufferStorageMultisample == glad_trace_glRenderbufferStorageMultisample) glad_glRenderbufferStorageMultisample = glad_trace_real.glRenderbufferStorageMultisample;
+	if(glad_glFramebufferTextureLayer == glad_trace_glFramebufferTextureLayer) glad_glFramebufferTextureLayer = glad_trace_real.glFramebufferTextureLayer;
+	if(glad_glMapBufferRange == glad_trace_glMapBufferRange) glad_glMapBufferRange = glad_trace_real.glMapBufferRange;
+	if(glad_glFlushMappedBufferRange == glad_trace_glFlushMappedBufferRange) glad_glFlushMappedBufferRange = glad_trace_real.glFlushMappedBufferRange;
+	if(glad_glBindVertexArray == glad_trace_glBindVertexArray) glad_glBindVertexArray = glad_trace_real.glBindVertexArray;
+	if(glad_glDeleteVertexArrays == glad_trace_glDeleteVertexArrays) glad_glDeleteVertexArrays = glad_trace_real.glDeleteVertexArrays;
+	if(glad_glGenVertexArrays == glad_trace_glGenVertexArrays) glad_glGenVertexArrays = glad_trace_real.glGenVertexArrays;
+	if(glad_glIsVertexArray == glad_trace_glIsVertexArray) glad_glIsVertexArray = glad_trace_real.glIsVertexArray;
+	if(glad_glDrawArraysInstanced == glad_trace_glDrawArraysInstanced) glad_glDrawArraysInstanced = glad_trace_real.glDrawArraysInstanced;
+	if(glad_glDrawElementsInstanced == glad_trace_glDrawElementsInstanced) glad_glDrawElementsInstanced = glad_trace_real.glDrawElementsInstanced;
+	if(glad_glTexBuffer == glad_trace_glTexBuffer) glad_glTexBuffer = glad_trace_real.glTexBuffer;
+	if(glad_glPrimitiveRestartIndex == glad_trace_glPrimitiveRestartIndex) glad_glPrimitiveRestartIndex = glad_trace_real.glPrimitiveRestartIndex;
+	if(glad_glCopyBufferSubData == glad_trace_glCopyBufferSubData) glad_glCopyBufferSubData = glad_trace_real.glCopyBufferSubData;
+	if(glad_glGetUniformIndices == glad_trace_glGetUniformIndices) glad_glGetUniformIndices = glad_trace_real.glGetUniformIndices;
+	if(glad_glGetActiveUniformsiv == glad_trace_glGetActiveUniformsiv) glad_glGetActiveUniformsiv = glad_trace_real.glGetActiveUniformsiv;
+	if(glad_glGetActiveUniformName == glad_trace_glGetActiveUniformName) glad_glGetActiveUniformName = glad_trace_real.glGetActiveUniformName;
+	if(glad_glGetUniformBlockIndex == glad_trace_glGetUniformBlockIndex) glad_glGetUniformBlockIndex = glad_trace_real.glGetUniformBlockIndex;
+	if(glad_glGetActiveUniformBlockiv == glad_trace_glGetActiveUniformBlockiv) glad_glGetActiveUniformBlockiv = glad_trace_real.glGetActiveUniformBlockiv;
+	if(glad_glGetActiveUniformBlockName == glad_trace_glGetActiveUniformBlockName) glad_glGetActiveUniformBlockName = glad_trace_real.glGetActiveUniformBlockName;
+	if(glad_glUniformBlockBinding == glad_trace_glUniformBlockBinding) glad_glUniformBlockBinding = glad_trace_real.glUniformBlockBinding;
+	if(glad_glDrawElementsBaseVertex == glad_trace_glDrawElementsBaseVertex) glad_glDrawElementsBaseVertex = glad_trace_real.glDrawElementsBaseVertex;
+	if(glad_glDrawRangeElementsBaseVertex == glad_trace_glDrawRangeElementsBaseVertex) glad_glDrawRangeElementsBaseVertex = glad_trace_real.glDrawRangeElementsBaseVertex;
+	if(glad_glDrawElementsInstancedBaseVertex == glad_trace_glDrawElementsInstancedBaseVertex) glad_glDrawElementsInstancedBaseVertex = glad_trace_real.glDrawElementsInstancedBaseVertex;
+	if(glad_glMultiDrawElementsBaseVertex == glad_trace_glMultiDrawElementsBaseVertex) glad_glMultiDrawElementsBaseVertex = glad_trace_real.glMultiDrawElementsBaseVertex;
+	if(glad_glProvokingVertex == glad_trace_glProvokingVertex) glad_glProvokingVertex = glad_trace_real.glProvokingVertex;
+	if(glad_glFenceSync == glad_trace_glFenceSync) glad_glFenceSync = glad_trace_real.glFenceSync;
+	if(glad_glIsSync == glad_trace_glIsSync) glad_glIsSync = glad_trace_real.glIsSync;
+	if(glad_glDeleteSync == glad_trace_glDeleteSync) glad_glDeleteSync = glad_trace_real.glDeleteSync;
+	if(glad_glClientWaitSync == glad_trace_glClientWaitSync) glad_glClientWaitSync = glad_trace_real.glClientWaitSync;
+	if(glad_glWaitSync == glad_trace_glWaitSync) glad_glWaitSync = glad_trace_real.glWaitSync;
+	if(glad_glGetInteger64v == glad_trace_glGetInteger64v) glad_glGetInteger64v = glad_trace_real.glGetInteger64v;
+	if(glad_glGetSynciv == glad_trace_glGetSynciv) glad_glGetSynciv = glad_trace_real.glGetSynciv;
+	if(glad_glGetInteger64i_v == glad_trace_glGetInteger64i_v) glad_glGetInteger64i_v = glad_trace_real.glGetInteger64i_v;
+	if(glad_glGetBufferParameteri64v == glad_trace_glGetBufferParameteri64v) glad_glGetBufferParameteri64v = glad_trace_real.glGetBufferParameteri64v;
+	if(glad_glFramebufferTexture == glad_trace_glFramebufferTexture) glad_glFramebufferTexture = glad_trace_real.glFramebufferTexture;
+	if(glad_glTexImage2DMultisample == glad_trace_glTexImage2DMultisample) glad_glTexImage2DMultisample = glad_trace_real.glTexImage2DMultisample;
+	if(glad_glTexImage3DMultisample == glad_trace_glTexImage3DMultisample) glad_glTexImage3DMultisample = glad_trace_real.glTexImage3DMultisample;
+	if(glad_glGetMultisamplefv == glad_trace_glGetMultisamplefv) glad_glGetMultisamplefv = glad_trace_real.glGetMultisamplefv;
+	if(glad_glSampleMaski == glad_trace_glSampleMaski) glad_glSampleMaski = glad_trace_real.glSampleMaski;
+	if(glad_glBindFragDataLocationIndexed == glad_trace_glBindFragDataLocationIndexed) glad_glBindFragDataLocationIndexed = glad_trace_real.glBindFragDataLocationIndexed;
+	if(glad_glGetFragDataIndex == glad_trace_glGetFragDataIndex) glad_glGetFragDataIndex = glad_trace_real.glGetFragDataIndex;
+	if(glad_glGenSamplers == glad_trace_glGenSamplers) glad_glGenSamplers = glad_trace_real.glGenSamplers;
+	if(glad_glDeleteSamplers == glad_trace_glDeleteSamplers) glad_glDeleteSamplers = glad_trace_real.glDeleteSamplers;
+	if(glad_glIsSampler == glad_trace_glIsSampler) glad_glIsSampler = glad_trace_real.glIsSampler;
+	if(glad_glBindSampler == glad_trace_glBindSampler) glad_glBindSampler = glad_trace_real.glBindSampler;
+	if(glad_glSamplerParameteri == glad_trace_glSamplerParameteri) glad_glSamplerParameteri = glad_trace_real.glSamplerParameteri;
+	if(glad_glSamplerParameteriv == glad_trace_glSamplerParameteriv) glad_glSamplerParameteriv = glad_trace_real.glSamplerParameteriv;
+	if(glad_glSamplerParameterf == glad_trace_glSamplerParameterf) glad_glSamplerParameterf = glad_trace_real.glSamplerParameterf;
+	if(glad_glSamplerParameterfv == glad_trace_glSamplerParameterfv) glad_glSamplerParameterfv = glad_trace_real.glSamplerParameterfv;
+	if(glad_glSamplerParameterIiv == glad_trace_glSamplerParameterIiv) glad_glSamplerParameterIiv = glad_trace_real.glSamplerParameterIiv;
+	if(glad_glSamplerParameterIuiv == glad_trace_glSamplerParameterIuiv) glad_glSamplerParameterIuiv = glad_trace_real.glSamplerParameterIuiv;
+	if(glad_glGetSamplerParameteriv == glad_trace_glGetSamplerParameteriv) glad_glGetSamplerParameteriv = glad_trace_real.glGetSamplerParameteriv;
+	if(glad_glGetSamplerParameterIiv == glad_trace_glGetSamplerParameterIiv) glad_glGetSamplerParameterIiv = glad_trace_real.glGetSamplerParameterIiv;
+	if(glad_glGetSamplerParameterfv == glad_trace_glGetSamplerParameterfv) glad_glGetSamplerParameterfv = glad_trace_real.glGetSamplerParameterfv;
+	if(glad_glGetSamplerParameterIuiv == glad_trace_glGetSamplerParameterIuiv) glad_glGetSamplerParameterIuiv = glad_trace_real.glGetSamplerParameterIuiv;
+	if(glad_glQueryCounter == glad_trace_glQueryCounter) glad_glQueryCounter = glad_trace_real.glQueryCounter;
+	if(glad_glGetQueryObjecti64v == glad_trace_glGetQueryObjecti64v) glad_glGetQueryObjecti64v = glad_trace_real.glGetQueryObjecti64v;
+	if(glad_glGetQueryObjectui64v == glad_trace_glGetQueryObjectui64v) glad_glGetQueryObjectui64v = glad_trace_real.glGetQueryObjectui64v;
+	if(glad_glVertexAttribDivisor == glad_trace_glVertexAttribDivisor) glad_glVertexAttribDivisor = glad_trace_real.glVertexAttribDivisor;
+	if(glad_glVertexAttribP1ui == glad_trace_glVertexAttribP1ui) glad_glVertexAttribP1ui = glad_trace_real.glVertexAttribP1ui;
+	if(glad_glVertexAttribP1uiv == glad_trace_glVertexAttribP1uiv) glad_glVertexAttribP1uiv = glad_trace_real.glVertexAttribP1uiv;
+	if(glad_glVertexAttribP2ui == glad_trace_glVertexAttribP2ui) glad_glVertexAttribP2ui = glad_trace_real.glVertexAttribP2ui;
+	if(glad_glVertexAttribP2uiv == glad_trace_glVertexAttribP2uiv) glad_glVertexAttribP2uiv = glad_trace_real.glVertexAttribP2uiv;
+	if(glad_glVertexAttribP3ui == glad_trace_glVertexAttribP3ui) glad_glVertexAttribP3ui = glad_trace_real.glVertexAttribP3ui;
+	if(glad_glVertexAttribP3uiv == glad_trace_glVertexAttribP3uiv) glad_glVertexAttribP3uiv = glad_trace_real.glVertexAttribP3uiv;
+	if(glad_glVertexAttribP4ui == glad_trace_glVertexAttribP4ui) glad_glVertexAttribP4ui = glad_trace_real.glVertexAttribP4ui;
+	if(glad_glVertexAttribP4uiv == glad_trace_glVertexAttribP4uiv) glad_glVertexAttribP4uiv = glad_trace_real.glVertexAttribP4uiv;
+	if(glad_glVertexP2ui == glad_trace_glVertexP2ui) glad_glVertexP2ui = glad_trace_real.glVertexP2ui;
+	if(glad_glVertexP2uiv == glad_trace_glVertexP2uiv) glad_glVertexP2uiv = glad_trace_real.glVertexP2uiv;
+	if(glad_glVertexP3ui == glad_trace_glVertexP3ui) glad_glVertexP3ui = glad_trace_real.glVertexP3ui;
+	if(glad_glVertexP3uiv == glad_trace_glVertexP3uiv) glad_glVertexP3uiv = glad_trace_real.glVertexP3uiv;
+	if(glad_glVertexP4ui == glad_trace_glVertexP4ui) glad_glVertexP4ui = glad_trace_real.glVertexP4ui;
+	if(glad_glVertexP4uiv == glad_trace_glVertexP4uiv) glad_glVertexP4uiv = glad_trace_real.glVertexP4uiv;
+	if(glad_glTexCoordP1ui == glad_trace_glTexCoordP1ui) glad_glTexCoordP1ui = glad_trace_real.glTexCoordP1ui;
+	if(glad_glTexCoordP1uiv == glad_trace_glTexCoordP1uiv) glad_glTexCoordP1uiv = glad_trace_real.glTexCoordP1uiv;
+	if(glad_glTexCoordP2ui == glad_trace_glTexCoordP2ui) glad_glTexCoordP2ui = glad_trace_real.glTexCoordP2ui;
+	if(glad_glTexCoordP2uiv == glad_trace_glTexCoordP2uiv) glad_glTexCoordP2uiv = glad_trace_real.glTexCoordP2uiv;
+	if(glad_glTexCoordP3ui == glad_trace_glTexCoordP3ui) glad_glTexCoordP3ui = glad_trace_real.glTexCoordP3ui;
+	if(glad_glTexCoordP3uiv == glad_trace_glTexCoordP3uiv) glad_glTexCoordP3uiv = glad_trace_real.glTexCoordP3uiv;
+	if(glad_glTexCoordP4ui == glad_trace_glTexCoordP4ui) glad_glTexCoordP4ui = glad_trace_real.glTexCoordP4ui;
+	if(glad_glTexCoordP4uiv == glad_trace_glTexCoordP4uiv) glad_glTexCoordP4uiv = glad_trace_real.glTexCoordP4uiv;
+	if(glad_glMultiTexCoordP1ui == glad_trace_glMultiTexCoordP1ui) glad_glMultiTexCoordP1ui = glad_trace_real.glMultiTexCoordP1ui;
+	if(glad_glMultiTexCoordP1uiv == glad_trace_glMultiTexCoordP1uiv) glad_glMultiTexCoordP1uiv = glad_trace_real.glMultiTexCoordP1uiv;
+	if(glad_glMultiTexCoordP2ui == glad_trace_glMultiTexCoordP2ui) glad_glMultiTexCoordP2ui = glad_trace_real.glMultiTexCoordP2ui;
+	if(glad_glMultiTexCoordP2uiv == glad_trace_glMultiTexCoordP2uiv) glad_glMultiTexCoordP2uiv = glad_trace_real.glMultiTexCoordP2uiv;
+	if(glad_glMultiTexCoordP3ui == glad_trace_glMultiTexCoordP3ui) glad_glMultiTexCoordP3ui = glad_trace_real.glMultiTexCoordP3ui;
+	if(glad_glMultiTexCoordP3uiv == glad_trace_glMultiTexCoordP3uiv) glad_glMultiTexCoordP3uiv = glad_trace_real.glMultiTexCoordP3uiv;
+	if(glad_glMultiTexCoordP4ui == glad_trace_glMultiTexCoordP4ui) glad_glMultiTexCoordP4ui = glad_trace_real.glMultiTexCoordP4ui;
+	if(glad_glMultiTexCoordP4uiv == glad_trace_glMultiTexCoordP4uiv) glad_glMultiTexCoordP4uiv = glad_trace_real.glMultiTexCoordP4uiv;
+	if(glad_glNormalP3ui == glad_trace_glNormalP3ui) glad_glNormalP3ui = glad_trace_real.glNormalP3ui;
+	if(glad_glNormalP3uiv == glad_trace_glNormalP3uiv) glad_glNormalP3uiv = glad_trace_real.glNormalP3uiv;
+	if(glad_glColorP3ui == glad_trace_glColorP3ui) glad_glColorP3ui = glad_trace_real.glColorP3ui;
+	if(glad_glColorP3uiv == glad_trace_glColorP3uiv) glad_glColorP3uiv = glad_trace_real.glColorP3uiv;
+	if(glad_glColorP4ui == glad_trace_glColorP4ui) glad_glColorP4ui = glad_trace_real.glColorP4ui;
+	if(glad_glColorP4uiv == glad_trace_glColorP4uiv) glad_glColorP4uiv = glad_trace_real.glColorP4uiv;
+	if(glad_glSecondaryColorP3ui == glad_trace_glSecondaryColorP3ui) glad_glSecondaryColorP3ui = glad_trace_real.glSecondaryColorP3ui;
+	if(glad_glSecondaryColorP3uiv == glad_trace_glSecondaryColorP3uiv) glad_glSecondaryColorP3uiv = glad_trace_real.glSecondaryColorP3uiv;
+	if(glad_glGetProgramBinary == glad_trace_glGetProgramBinary) glad_glGetProgramBinary = glad_trace_real.glGetProgramBinary;
+	if(glad_glProgramBinary == glad_trace_glProgramBinary) glad_glProgramBinary = glad_trace_real.glProgramBinary;
+	if(glad_glProgramParameteri == glad_trace_glProgramParameteri) glad_glProgramParameteri = glad_trace_real.glProgramParameteri;
+	if(glad_glMaxShaderCompilerThreadsKHR == glad_trace_glMaxShaderCompilerThreadsKHR) glad_glMaxShaderCompilerThreadsKHR = glad_trace_real.glMaxShaderCompilerThreadsKHR;
+	if(glad_glBufferStorage == glad_trace_glBufferStorage) glad_glBufferStorage = glad_trace_real.glBufferStorage;
+}
+
+static const GladTraceParam glad_trace_params_glCullFace[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glFrontFace[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glHint[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glLineWidth[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glPointSize[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glPolygonMode[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glScissor[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glTexParameterf[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glTexParameterfv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glTexParameteri[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glTexParameteriv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glTexImage1D[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_UNSUPPORTED, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glTexImage2D[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_UNSUPPORTED, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glDrawBuffer[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glClear[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glClearColor[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glClearStencil[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glClearDepth[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glStencilMask[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glColorMask[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glDepthMask[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glDisable[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glEnable[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glBlendFunc[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glLogicOp[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glStencilFunc[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glStencilOp[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glDepthFunc[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glPixelStoref[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glPixelStorei[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glReadBuffer[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glReadPixels[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetBooleanv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetDoublev[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetFloatv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetIntegerv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetString[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetTexImage[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetTexParameterfv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetTexParameteriv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetTexLevelParameterfv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetTexLevelParameteriv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glIsEnabled[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glDepthRange[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glViewport[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glDrawArrays[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glDrawElements[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OFFSET, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glPolygonOffset[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glCopyTexImage1D[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glCopyTexImage2D[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glCopyTexSubImage1D[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glCopyTexSubImage2D[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glTexSubImage1D[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_UNSUPPORTED, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glTexSubImage2D[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_UNSUPPORTED, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glBindTexture[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_TEXTURE } };
+static const GladTraceParam glad_trace_params_glDeleteTextures[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_NAMES_IN, GLAD_TRACE_OBJECT_TEXTURE } };
+static const GladTraceParam glad_trace_params_glGenTextures[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_NAMES_OUT, GLAD_TRACE_OBJECT_TEXTURE } };
+static const GladTraceParam glad_trace_params_glIsTexture[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_TEXTURE } };
+static const GladTraceParam glad_trace_params_glDrawRangeElements[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OFFSET, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glTexImage3D[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_UNSUPPORTED, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glTexSubImage3D[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_UNSUPPORTED, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glCopyTexSubImage3D[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glActiveTexture[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_TEXTURE } };
+static const GladTraceParam glad_trace_params_glSampleCoverage[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glCompressedTexImage3D[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glCompressedTexImage2D[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glCompressedTexImage1D[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glCompressedTexSubImage3D[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glCompressedTexSubImage2D[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glCompressedTexSubImage1D[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetCompressedTexImage[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glBlendFuncSeparate[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glMultiDrawArrays[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glMultiDrawElements[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glPointParameterf[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glPointParameterfv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glPointParameteri[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glPointParameteriv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glBlendColor[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glBlendEquation[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGenQueries[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_NAMES_OUT, GLAD_TRACE_OBJECT_QUERY } };
+static const GladTraceParam glad_trace_params_glDeleteQueries[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_NAMES_IN, GLAD_TRACE_OBJECT_QUERY } };
+static const GladTraceParam glad_trace_params_glIsQuery[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_QUERY } };
+static const GladTraceParam glad_trace_params_glBeginQuery[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_QUERY } };
+static const GladTraceParam glad_trace_params_glEndQuery[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetQueryiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetQueryObjectiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_QUERY }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetQueryObjectuiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_QUERY }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glBindBuffer[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_BUFFER } };
+static const GladTraceParam glad_trace_params_glDeleteBuffers[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_NAMES_IN, GLAD_TRACE_OBJECT_BUFFER } };
+static const GladTraceParam glad_trace_params_glGenBuffers[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_NAMES_OUT, GLAD_TRACE_OBJECT_BUFFER } };
+static const GladTraceParam glad_trace_params_glIsBuffer[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_BUFFER } };
+static const GladTraceParam glad_trace_params_glBufferData[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glBufferSubData[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetBufferSubData[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glMapBuffer[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUnmapBuffer[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetBufferParameteriv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetBufferPointerv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glBlendEquationSeparate[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glDrawBuffers[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glStencilOpSeparate[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glStencilFuncSeparate[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glStencilMaskSeparate[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glAttachShader[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_SHADER } };
+static const GladTraceParam glad_trace_params_glBindAttribLocation[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glCompileShader[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_SHADER } };
+static const GladTraceParam glad_trace_params_glCreateShader[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glDeleteProgram[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM } };
+static const GladTraceParam glad_trace_params_glDeleteShader[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_SHADER } };
+static const GladTraceParam glad_trace_params_glDetachShader[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_SHADER } };
+static const GladTraceParam glad_trace_params_glDisableVertexAttribArray[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glEnableVertexAttribArray[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetActiveAttrib[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetActiveUniform[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetAttachedShaders[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetAttribLocation[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetProgramiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetProgramInfoLog[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetShaderiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_SHADER }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetShaderInfoLog[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_SHADER }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetShaderSource[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_SHADER }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetUniformLocation[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetUniformfv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetUniformiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetVertexAttribdv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetVertexAttribfv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetVertexAttribiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetVertexAttribPointerv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glIsProgram[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM } };
+static const GladTraceParam glad_trace_params_glIsShader[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_SHADER } };
+static const GladTraceParam glad_trace_params_glLinkProgram[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM } };
+static const GladTraceParam glad_trace_params_glShaderSource[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_SHADER }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_STRINGS, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_UNUSED, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUseProgram[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM } };
+static const GladTraceParam glad_trace_params_glUniform1f[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniform2f[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniform3f[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniform4f[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniform1i[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniform2i[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniform3i[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniform4i[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniform1fv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniform2fv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniform3fv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniform4fv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniform1iv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniform2iv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniform3iv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniform4iv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniformMatrix2fv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniformMatrix3fv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniformMatrix4fv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glValidateProgram[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM } };
+static const GladTraceParam glad_trace_params_glVertexAttrib1d[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib1dv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib1f[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib1fv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib1s[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib1sv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib2d[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib2dv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib2f[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib2fv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib2s[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib2sv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib3d[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib3dv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib3f[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib3fv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib3s[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib3sv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib4Nbv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib4Niv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib4Nsv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib4Nub[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib4Nubv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib4Nuiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib4Nusv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib4bv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib4d[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib4dv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib4f[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib4fv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib4iv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib4s[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib4sv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib4ubv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib4uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttrib4usv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribPointer[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OFFSET, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniformMatrix2x3fv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniformMatrix3x2fv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniformMatrix2x4fv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniformMatrix4x2fv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniformMatrix3x4fv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniformMatrix4x3fv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glColorMaski[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetBooleani_v[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetIntegeri_v[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glEnablei[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glDisablei[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glIsEnabledi[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glBeginTransformFeedback[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glBindBufferRange[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_BUFFER }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glBindBufferBase[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_BUFFER } };
+static const GladTraceParam glad_trace_params_glTransformFeedbackVaryings[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_STRINGS, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetTransformFeedbackVarying[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glClampColor[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glBeginConditionalRender[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribIPointer[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OFFSET, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetVertexAttribIiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetVertexAttribIuiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribI1i[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribI2i[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribI3i[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribI4i[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribI1ui[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribI2ui[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribI3ui[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribI4ui[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribI1iv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribI2iv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribI3iv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribI4iv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribI1uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribI2uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribI3uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribI4uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribI4bv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribI4sv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribI4ubv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribI4usv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetUniformuiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glBindFragDataLocation[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetFragDataLocation[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniform1ui[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniform2ui[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniform3ui[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniform4ui[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniform1uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniform2uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniform3uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniform4uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_LOCATION }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glTexParameterIiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glTexParameterIuiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetTexParameterIiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetTexParameterIuiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glClearBufferiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_BUFFER }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glClearBufferuiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_BUFFER }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glClearBufferfv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_BUFFER }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glClearBufferfi[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_BUFFER }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetStringi[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glIsRenderbuffer[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_RENDERBUFFER } };
+static const GladTraceParam glad_trace_params_glBindRenderbuffer[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_RENDERBUFFER } };
+static const GladTraceParam glad_trace_params_glDeleteRenderbuffers[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_NAMES_IN, GLAD_TRACE_OBJECT_RENDERBUFFER } };
+static const GladTraceParam glad_trace_params_glGenRenderbuffers[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_NAMES_OUT, GLAD_TRACE_OBJECT_RENDERBUFFER } };
+static const GladTraceParam glad_trace_params_glRenderbufferStorage[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetRenderbufferParameteriv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glIsFramebuffer[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_FRAMEBUFFER } };
+static const GladTraceParam glad_trace_params_glBindFramebuffer[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_FRAMEBUFFER } };
+static const GladTraceParam glad_trace_params_glDeleteFramebuffers[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_NAMES_IN, GLAD_TRACE_OBJECT_FRAMEBUFFER } };
+static const GladTraceParam glad_trace_params_glGenFramebuffers[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_NAMES_OUT, GLAD_TRACE_OBJECT_FRAMEBUFFER } };
+static const GladTraceParam glad_trace_params_glCheckFramebufferStatus[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glFramebufferTexture1D[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_TEXTURE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glFramebufferTexture2D[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_TEXTURE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glFramebufferTexture3D[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_TEXTURE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glFramebufferRenderbuffer[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_RENDERBUFFER } };
+static const GladTraceParam glad_trace_params_glGetFramebufferAttachmentParameteriv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGenerateMipmap[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glBlitFramebuffer[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glRenderbufferStorageMultisample[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glFramebufferTextureLayer[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_TEXTURE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glMapBufferRange[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glFlushMappedBufferRange[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glBindVertexArray[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_VERTEX_ARRAY } };
+static const GladTraceParam glad_trace_params_glDeleteVertexArrays[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_NAMES_IN, GLAD_TRACE_OBJECT_VERTEX_ARRAY } };
+static const GladTraceParam glad_trace_params_glGenVertexArrays[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_NAMES_OUT, GLAD_TRACE_OBJECT_VERTEX_ARRAY } };
+static const GladTraceParam glad_trace_params_glIsVertexArray[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_VERTEX_ARRAY } };
+static const GladTraceParam glad_trace_params_glDrawArraysInstanced[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glDrawElementsInstanced[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OFFSET, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glTexBuffer[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_BUFFER } };
+static const GladTraceParam glad_trace_params_glPrimitiveRestartIndex[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glCopyBufferSubData[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetUniformIndices[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_STRINGS, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetActiveUniformsiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetActiveUniformName[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetUniformBlockIndex[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetActiveUniformBlockiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_BLOCK_INDEX }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetActiveUniformBlockName[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_BLOCK_INDEX }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glUniformBlockBinding[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_BLOCK_INDEX }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glDrawElementsBaseVertex[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OFFSET, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glDrawRangeElementsBaseVertex[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OFFSET, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glDrawElementsInstancedBaseVertex[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OFFSET, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glMultiDrawElementsBaseVertex[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glProvokingVertex[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glFenceSync[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glIsSync[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_SYNC } };
+static const GladTraceParam glad_trace_params_glDeleteSync[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_SYNC } };
+static const GladTraceParam glad_trace_params_glClientWaitSync[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_SYNC }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glWaitSync[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_SYNC }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetInteger64v[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetSynciv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_SYNC }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetInteger64i_v[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetBufferParameteri64v[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glFramebufferTexture[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_TEXTURE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glTexImage2DMultisample[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glTexImage3DMultisample[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetMultisamplefv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glSampleMaski[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glBindFragDataLocationIndexed[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetFragDataIndex[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGenSamplers[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_NAMES_OUT, GLAD_TRACE_OBJECT_SAMPLER } };
+static const GladTraceParam glad_trace_params_glDeleteSamplers[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_NAMES_IN, GLAD_TRACE_OBJECT_SAMPLER } };
+static const GladTraceParam glad_trace_params_glIsSampler[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_SAMPLER } };
+static const GladTraceParam glad_trace_params_glBindSampler[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_SAMPLER } };
+static const GladTraceParam glad_trace_params_glSamplerParameteri[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_SAMPLER }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glSamplerParameteriv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_SAMPLER }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glSamplerParameterf[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_SAMPLER }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glSamplerParameterfv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_SAMPLER }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glSamplerParameterIiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_SAMPLER }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glSamplerParameterIuiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_SAMPLER }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetSamplerParameteriv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_SAMPLER }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetSamplerParameterIiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_SAMPLER }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetSamplerParameterfv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_SAMPLER }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetSamplerParameterIuiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_SAMPLER }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glQueryCounter[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_QUERY }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetQueryObjecti64v[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_QUERY }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetQueryObjectui64v[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_QUERY }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribDivisor[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribP1ui[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribP1uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribP2ui[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribP2uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribP3ui[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribP3uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribP4ui[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexAttribP4uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexP2ui[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexP2uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexP3ui[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexP3uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexP4ui[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glVertexP4uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glTexCoordP1ui[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glTexCoordP1uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glTexCoordP2ui[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glTexCoordP2uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glTexCoordP3ui[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glTexCoordP3uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glTexCoordP4ui[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glTexCoordP4uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glMultiTexCoordP1ui[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_TEXTURE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glMultiTexCoordP1uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_TEXTURE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glMultiTexCoordP2ui[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_TEXTURE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glMultiTexCoordP2uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_TEXTURE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glMultiTexCoordP3ui[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_TEXTURE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glMultiTexCoordP3uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_TEXTURE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glMultiTexCoordP4ui[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_TEXTURE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glMultiTexCoordP4uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_TEXTURE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glNormalP3ui[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glNormalP3uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glColorP3ui[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glColorP3uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glColorP4ui[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glColorP4uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glSecondaryColorP3ui[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glSecondaryColorP3uiv[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glGetProgramBinary[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_OUT, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glProgramBinary[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glProgramParameteri[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_PROGRAM }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glMaxShaderCompilerThreadsKHR[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+static const GladTraceParam glad_trace_params_glBufferStorage[] = { { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_BLOB, GLAD_TRACE_OBJECT_NONE }, { GLAD_TRACE_SCALAR, GLAD_TRACE_OBJECT_NONE } };
+
+static const GladTraceFunction glad_trace_functions[] = {
+	{ "glCullFace", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glCullFace },
+	{ "glFrontFace", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glFrontFace },
+	{ "glHint", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glHint },
+	{ "glLineWidth", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glLineWidth },
+	{ "glPointSize", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glPointSize },
+	{ "glPolygonMode", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glPolygonMode },
+	{ "glScissor", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glScissor },
+	{ "glTexParameterf", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glTexParameterf },
+	{ "glTexParameterfv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glTexParameterfv },
+	{ "glTexParameteri", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glTexParameteri },
+	{ "glTexParameteriv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glTexParameteriv },
+	{ "glTexImage1D", 8, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glTexImage1D },
+	{ "glTexImage2D", 9, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glTexImage2D },
+	{ "glDrawBuffer", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glDrawBuffer },
+	{ "glClear", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glClear },
+	{ "glClearColor", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glClearColor },
+	{ "glClearStencil", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glClearStencil },
+	{ "glClearDepth", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glClearDepth },
+	{ "glStencilMask", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glStencilMask },
+	{ "glColorMask", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glColorMask },
+	{ "glDepthMask", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glDepthMask },
+	{ "glDisable", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glDisable },
+	{ "glEnable", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glEnable },
+	{ "glFinish", 0, 0, GLAD_TRACE_OBJECT_NONE, NULL },
+	{ "glFlush", 0, 0, GLAD_TRACE_OBJECT_NONE, NULL },
+	{ "glBlendFunc", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glBlendFunc },
+	{ "glLogicOp", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glLogicOp },
+	{ "glStencilFunc", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glStencilFunc },
+	{ "glStencilOp", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glStencilOp },
+	{ "glDepthFunc", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glDepthFunc },
+	{ "glPixelStoref", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glPixelStoref },
+	{ "glPixelStorei", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glPixelStorei },
+	{ "glReadBuffer", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glReadBuffer },
+	{ "glReadPixels", 7, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glReadPixels },
+	{ "glGetBooleanv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetBooleanv },
+	{ "glGetDoublev", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetDoublev },
+	{ "glGetError", 0, 1, GLAD_TRACE_OBJECT_NONE, NULL },
+	{ "glGetFloatv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetFloatv },
+	{ "glGetIntegerv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetIntegerv },
+	{ "glGetString", 1, 1, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetString },
+	{ "glGetTexImage", 5, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetTexImage },
+	{ "glGetTexParameterfv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetTexParameterfv },
+	{ "glGetTexParameteriv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetTexParameteriv },
+	{ "glGetTexLevelParameterfv", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetTexLevelParameterfv },
+	{ "glGetTexLevelParameteriv", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetTexLevelParameteriv },
+	{ "glIsEnabled", 1, 1, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glIsEnabled },
+	{ "glDepthRange", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glDepthRange },
+	{ "glViewport", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glViewport },
+	{ "glDrawArrays", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glDrawArrays },
+	{ "glDrawElements", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glDrawElements },
+	{ "glPolygonOffset", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glPolygonOffset },
+	{ "glCopyTexImage1D", 7, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glCopyTexImage1D },
+	{ "glCopyTexImage2D", 8, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glCopyTexImage2D },
+	{ "glCopyTexSubImage1D", 6, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glCopyTexSubImage1D },
+	{ "glCopyTexSubImage2D", 8, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glCopyTexSubImage2D },
+	{ "glTexSubImage1D", 7, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glTexSubImage1D },
+	{ "glTexSubImage2D", 9, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glTexSubImage2D },
+	{ "glBindTexture", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glBindTexture },
+	{ "glDeleteTextures", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glDeleteTextures },
+	{ "glGenTextures", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGenTextures },
+	{ "glIsTexture", 1, 1, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glIsTexture },
+	{ "glDrawRangeElements", 6, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glDrawRangeElements },
+	{ "glTexImage3D", 10, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glTexImage3D },
+	{ "glTexSubImage3D", 11, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glTexSubImage3D },
+	{ "glCopyTexSubImage3D", 9, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glCopyTexSubImage3D },
+	{ "glActiveTexture", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glActiveTexture },
+	{ "glSampleCoverage", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glSampleCoverage },
+	{ "glCompressedTexImage3D", 9, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glCompressedTexImage3D },
+	{ "glCompressedTexImage2D", 8, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glCompressedTexImage2D },
+	{ "glCompressedTexImage1D", 7, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glCompressedTexImage1D },
+	{ "glCompressedTexSubImage3D", 11, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glCompressedTexSubImage3D },
+	{ "glCompressedTexSubImage2D", 9, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glCompressedTexSubImage2D },
+	{ "glCompressedTexSubImage1D", 7, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glCompressedTexSubImage1D },
+	{ "glGetCompressedTexImage", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetCompressedTexImage },
+	{ "glBlendFuncSeparate", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glBlendFuncSeparate },
+	{ "glMultiDrawArrays", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glMultiDrawArrays },
+	{ "glMultiDrawElements", 5, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glMultiDrawElements },
+	{ "glPointParameterf", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glPointParameterf },
+	{ "glPointParameterfv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glPointParameterfv },
+	{ "glPointParameteri", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glPointParameteri },
+	{ "glPointParameteriv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glPointParameteriv },
+	{ "glBlendColor", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glBlendColor },
+	{ "glBlendEquation", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glBlendEquation },
+	{ "glGenQueries", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGenQueries },
+	{ "glDeleteQueries", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glDeleteQueries },
+	{ "glIsQuery", 1, 1, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glIsQuery },
+	{ "glBeginQuery", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glBeginQuery },
+	{ "glEndQuery", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glEndQuery },
+	{ "glGetQueryiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetQueryiv },
+	{ "glGetQueryObjectiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetQueryObjectiv },
+	{ "glGetQueryObjectuiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetQueryObjectuiv },
+	{ "glBindBuffer", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glBindBuffer },
+	{ "glDeleteBuffers", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glDeleteBuffers },
+	{ "glGenBuffers", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGenBuffers },
+	{ "glIsBuffer", 1, 1, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glIsBuffer },
+	{ "glBufferData", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glBufferData },
+	{ "glBufferSubData", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glBufferSubData },
+	{ "glGetBufferSubData", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetBufferSubData },
+	{ "glMapBuffer", 2, 1, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glMapBuffer },
+	{ "glUnmapBuffer", 1, 1, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUnmapBuffer },
+	{ "glGetBufferParameteriv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetBufferParameteriv },
+	{ "glGetBufferPointerv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetBufferPointerv },
+	{ "glBlendEquationSeparate", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glBlendEquationSeparate },
+	{ "glDrawBuffers", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glDrawBuffers },
+	{ "glStencilOpSeparate", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glStencilOpSeparate },
+	{ "glStencilFuncSeparate", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glStencilFuncSeparate },
+	{ "glStencilMaskSeparate", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glStencilMaskSeparate },
+	{ "glAttachShader", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glAttachShader },
+	{ "glBindAttribLocation", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glBindAttribLocation },
+	{ "glCompileShader", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glCompileShader },
+	{ "glCreateProgram", 0, 1, GLAD_TRACE_OBJECT_PROGRAM, NULL },
+	{ "glCreateShader", 1, 1, GLAD_TRACE_OBJECT_SHADER, glad_trace_params_glCreateShader },
+	{ "glDeleteProgram", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glDeleteProgram },
+	{ "glDeleteShader", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glDeleteShader },
+	{ "glDetachShader", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glDetachShader },
+	{ "glDisableVertexAttribArray", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glDisableVertexAttribArray },
+	{ "glEnableVertexAttribArray", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glEnableVertexAttribArray },
+	{ "glGetActiveAttrib", 7, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetActiveAttrib },
+	{ "glGetActiveUniform", 7, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetActiveUniform },
+	{ "glGetAttachedShaders", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetAttachedShaders },
+	{ "glGetAttribLocation", 2, 1, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetAttribLocation },
+	{ "glGetProgramiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetProgramiv },
+	{ "glGetProgramInfoLog", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetProgramInfoLog },
+	{ "glGetShaderiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetShaderiv },
+	{ "glGetShaderInfoLog", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetShaderInfoLog },
+	{ "glGetShaderSource", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetShaderSource },
+	{ "glGetUniformLocation", 2, 1, GLAD_TRACE_OBJECT_LOCATION, glad_trace_params_glGetUniformLocation },
+	{ "glGetUniformfv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetUniformfv },
+	{ "glGetUniformiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetUniformiv },
+	{ "glGetVertexAttribdv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetVertexAttribdv },
+	{ "glGetVertexAttribfv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetVertexAttribfv },
+	{ "glGetVertexAttribiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetVertexAttribiv },
+	{ "glGetVertexAttribPointerv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetVertexAttribPointerv },
+	{ "glIsProgram", 1, 1, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glIsProgram },
+	{ "glIsShader", 1, 1, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glIsShader },
+	{ "glLinkProgram", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glLinkProgram },
+	{ "glShaderSource", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glShaderSource },
+	{ "glUseProgram", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUseProgram },
+	{ "glUniform1f", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniform1f },
+	{ "glUniform2f", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniform2f },
+	{ "glUniform3f", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniform3f },
+	{ "glUniform4f", 5, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniform4f },
+	{ "glUniform1i", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniform1i },
+	{ "glUniform2i", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniform2i },
+	{ "glUniform3i", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniform3i },
+	{ "glUniform4i", 5, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniform4i },
+	{ "glUniform1fv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniform1fv },
+	{ "glUniform2fv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniform2fv },
+	{ "glUniform3fv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniform3fv },
+	{ "glUniform4fv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniform4fv },
+	{ "glUniform1iv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniform1iv },
+	{ "glUniform2iv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniform2iv },
+	{ "glUniform3iv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniform3iv },
+	{ "glUniform4iv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniform4iv },
+	{ "glUniformMatrix2fv", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniformMatrix2fv },
+	{ "glUniformMatrix3fv", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniformMatrix3fv },
+	{ "glUniformMatrix4fv", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniformMatrix4fv },
+	{ "glValidateProgram", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glValidateProgram },
+	{ "glVertexAttrib1d", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib1d },
+	{ "glVertexAttrib1dv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib1dv },
+	{ "glVertexAttrib1f", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib1f },
+	{ "glVertexAttrib1fv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib1fv },
+	{ "glVertexAttrib1s", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib1s },
+	{ "glVertexAttrib1sv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib1sv },
+	{ "glVertexAttrib2d", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib2d },
+	{ "glVertexAttrib2dv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib2dv },
+	{ "glVertexAttrib2f", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib2f },
+	{ "glVertexAttrib2fv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib2fv },
+	{ "glVertexAttrib2s", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib2s },
+	{ "glVertexAttrib2sv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib2sv },
+	{ "glVertexAttrib3d", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib3d },
+	{ "glVertexAttrib3dv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib3dv },
+	{ "glVertexAttrib3f", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib3f },
+	{ "glVertexAttrib3fv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib3fv },
+	{ "glVertexAttrib3s", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib3s },
+	{ "glVertexAttrib3sv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib3sv },
+	{ "glVertexAttrib4Nbv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib4Nbv },
+	{ "glVertexAttrib4Niv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib4Niv },
+	{ "glVertexAttrib4Nsv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib4Nsv },
+	{ "glVertexAttrib4Nub", 5, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib4Nub },
+	{ "glVertexAttrib4Nubv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib4Nubv },
+	{ "glVertexAttrib4Nuiv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib4Nuiv },
+	{ "glVertexAttrib4Nusv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib4Nusv },
+	{ "glVertexAttrib4bv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib4bv },
+	{ "glVertexAttrib4d", 5, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib4d },
+	{ "glVertexAttrib4dv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib4dv },
+	{ "glVertexAttrib4f", 5, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib4f },
+	{ "glVertexAttrib4fv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib4fv },
+	{ "glVertexAttrib4iv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib4iv },
+	{ "glVertexAttrib4s", 5, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib4s },
+	{ "glVertexAttrib4sv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib4sv },
+	{ "glVertexAttrib4ubv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib4ubv },
+	{ "glVertexAttrib4uiv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib4uiv },
+	{ "glVertexAttrib4usv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttrib4usv },
+	{ "glVertexAttribPointer", 6, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribPointer },
+	{ "glUniformMatrix2x3fv", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniformMatrix2x3fv },
+	{ "glUniformMatrix3x2fv", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniformMatrix3x2fv },
+	{ "glUniformMatrix2x4fv", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniformMatrix2x4fv },
+	{ "glUniformMatrix4x2fv", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniformMatrix4x2fv },
+	{ "glUniformMatrix3x4fv", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniformMatrix3x4fv },
+	{ "glUniformMatrix4x3fv", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniformMatrix4x3fv },
+	{ "glColorMaski", 5, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glColorMaski },
+	{ "glGetBooleani_v", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetBooleani_v },
+	{ "glGetIntegeri_v", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetIntegeri_v },
+	{ "glEnablei", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glEnablei },
+	{ "glDisablei", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glDisablei },
+	{ "glIsEnabledi", 2, 1, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glIsEnabledi },
+	{ "glBeginTransformFeedback", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glBeginTransformFeedback },
+	{ "glEndTransformFeedback", 0, 0, GLAD_TRACE_OBJECT_NONE, NULL },
+	{ "glBindBufferRange", 5, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glBindBufferRange },
+	{ "glBindBufferBase", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glBindBufferBase },
+	{ "glTransformFeedbackVaryings", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glTransformFeedbackVaryings },
+	{ "glGetTransformFeedbackVarying", 7, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetTransformFeedbackVarying },
+	{ "glClampColor", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glClampColor },
+	{ "glBeginConditionalRender", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glBeginConditionalRender },
+	{ "glEndConditionalRender", 0, 0, GLAD_TRACE_OBJECT_NONE, NULL },
+	{ "glVertexAttribIPointer", 5, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribIPointer },
+	{ "glGetVertexAttribIiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetVertexAttribIiv },
+	{ "glGetVertexAttribIuiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetVertexAttribIuiv },
+	{ "glVertexAttribI1i", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribI1i },
+	{ "glVertexAttribI2i", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribI2i },
+	{ "glVertexAttribI3i", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribI3i },
+	{ "glVertexAttribI4i", 5, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribI4i },
+	{ "glVertexAttribI1ui", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribI1ui },
+	{ "glVertexAttribI2ui", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribI2ui },
+	{ "glVertexAttribI3ui", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribI3ui },
+	{ "glVertexAttribI4ui", 5, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribI4ui },
+	{ "glVertexAttribI1iv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribI1iv },
+	{ "glVertexAttribI2iv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribI2iv },
+	{ "glVertexAttribI3iv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribI3iv },
+	{ "glVertexAttribI4iv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribI4iv },
+	{ "glVertexAttribI1uiv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribI1uiv },
+	{ "glVertexAttribI2uiv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribI2uiv },
+	{ "glVertexAttribI3uiv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribI3uiv },
+	{ "glVertexAttribI4uiv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribI4uiv },
+	{ "glVertexAttribI4bv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribI4bv },
+	{ "glVertexAttribI4sv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribI4sv },
+	{ "glVertexAttribI4ubv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribI4ubv },
+	{ "glVertexAttribI4usv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribI4usv },
+	{ "glGetUniformuiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetUniformuiv },
+	{ "glBindFragDataLocation", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glBindFragDataLocation },
+	{ "glGetFragDataLocation", 2, 1, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetFragDataLocation },
+	{ "glUniform1ui", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniform1ui },
+	{ "glUniform2ui", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniform2ui },
+	{ "glUniform3ui", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniform3ui },
+	{ "glUniform4ui", 5, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniform4ui },
+	{ "glUniform1uiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniform1uiv },
+	{ "glUniform2uiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniform2uiv },
+	{ "glUniform3uiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniform3uiv },
+	{ "glUniform4uiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniform4uiv },
+	{ "glTexParameterIiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glTexParameterIiv },
+	{ "glTexParameterIuiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glTexParameterIuiv },
+	{ "glGetTexParameterIiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetTexParameterIiv },
+	{ "glGetTexParameterIuiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetTexParameterIuiv },
+	{ "glClearBufferiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glClearBufferiv },
+	{ "glClearBufferuiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glClearBufferuiv },
+	{ "glClearBufferfv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glClearBufferfv },
+	{ "glClearBufferfi", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glClearBufferfi },
+	{ "glGetStringi", 2, 1, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetStringi },
+	{ "glIsRenderbuffer", 1, 1, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glIsRenderbuffer },
+	{ "glBindRenderbuffer", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glBindRenderbuffer },
+	{ "glDeleteRenderbuffers", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glDeleteRenderbuffers },
+	{ "glGenRenderbuffers", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGenRenderbuffers },
+	{ "glRenderbufferStorage", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glRenderbufferStorage },
+	{ "glGetRenderbufferParameteriv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetRenderbufferParameteriv },
+	{ "glIsFramebuffer", 1, 1, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glIsFramebuffer },
+	{ "glBindFramebuffer", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glBindFramebuffer },
+	{ "glDeleteFramebuffers", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glDeleteFramebuffers },
+	{ "glGenFramebuffers", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGenFramebuffers },
+	{ "glCheckFramebufferStatus", 1, 1, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glCheckFramebufferStatus },
+	{ "glFramebufferTexture1D", 5, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glFramebufferTexture1D },
+	{ "glFramebufferTexture2D", 5, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glFramebufferTexture2D },
+	{ "glFramebufferTexture3D", 6, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glFramebufferTexture3D },
+	{ "glFramebufferRenderbuffer", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glFramebufferRenderbuffer },
+	{ "glGetFramebufferAttachmentParameteriv", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetFramebufferAttachmentParameteriv },
+	{ "glGenerateMipmap", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGenerateMipmap },
+	{ "glBlitFramebuffer", 10, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glBlitFramebuffer },
+	{ "glRenderbufferStorageMultisample", 5, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glRenderbufferStorageMultisample },
+	{ "glFramebufferTextureLayer", 5, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glFramebufferTextureLayer },
+	{ "glMapBufferRange", 4, 1, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glMapBufferRange },
+	{ "glFlushMappedBufferRange", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glFlushMappedBufferRange },
+	{ "glBindVertexArray", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glBindVertexArray },
+	{ "glDeleteVertexArrays", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glDeleteVertexArrays },
+	{ "glGenVertexArrays", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGenVertexArrays },
+	{ "glIsVertexArray", 1, 1, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glIsVertexArray },
+	{ "glDrawArraysInstanced", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glDrawArraysInstanced },
+	{ "glDrawElementsInstanced", 5, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glDrawElementsInstanced },
+	{ "glTexBuffer", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glTexBuffer },
+	{ "glPrimitiveRestartIndex", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glPrimitiveRestartIndex },
+	{ "glCopyBufferSubData", 5, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glCopyBufferSubData },
+	{ "glGetUniformIndices", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetUniformIndices },
+	{ "glGetActiveUniformsiv", 5, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetActiveUniformsiv },
+	{ "glGetActiveUniformName", 5, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetActiveUniformName },
+	{ "glGetUniformBlockIndex", 2, 1, GLAD_TRACE_OBJECT_BLOCK_INDEX, glad_trace_params_glGetUniformBlockIndex },
+	{ "glGetActiveUniformBlockiv", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetActiveUniformBlockiv },
+	{ "glGetActiveUniformBlockName", 5, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetActiveUniformBlockName },
+	{ "glUniformBlockBinding", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glUniformBlockBinding },
+	{ "glDrawElementsBaseVertex", 5, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glDrawElementsBaseVertex },
+	{ "glDrawRangeElementsBaseVertex", 7, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glDrawRangeElementsBaseVertex },
+	{ "glDrawElementsInstancedBaseVertex", 6, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glDrawElementsInstancedBaseVertex },
+	{ "glMultiDrawElementsBaseVertex", 6, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glMultiDrawElementsBaseVertex },
+	{ "glProvokingVertex", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glProvokingVertex },
+	{ "glFenceSync", 2, 1, GLAD_TRACE_OBJECT_SYNC, glad_trace_params_glFenceSync },
+	{ "glIsSync", 1, 1, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glIsSync },
+	{ "glDeleteSync", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glDeleteSync },
+	{ "glClientWaitSync", 3, 1, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glClientWaitSync },
+	{ "glWaitSync", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glWaitSync },
+	{ "glGetInteger64v", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetInteger64v },
+	{ "glGetSynciv", 5, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetSynciv },
+	{ "glGetInteger64i_v", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetInteger64i_v },
+	{ "glGetBufferParameteri64v", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetBufferParameteri64v },
+	{ "glFramebufferTexture", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glFramebufferTexture },
+	{ "glTexImage2DMultisample", 6, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glTexImage2DMultisample },
+	{ "glTexImage3DMultisample", 7, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glTexImage3DMultisample },
+	{ "glGetMultisamplefv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetMultisamplefv },
+	{ "glSampleMaski", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glSampleMaski },
+	{ "glBindFragDataLocationIndexed", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glBindFragDataLocationIndexed },
+	{ "glGetFragDataIndex", 2, 1, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetFragDataIndex },
+	{ "glGenSamplers", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGenSamplers },
+	{ "glDeleteSamplers", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glDeleteSamplers },
+	{ "glIsSampler", 1, 1, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glIsSampler },
+	{ "glBindSampler", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glBindSampler },
+	{ "glSamplerParameteri", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glSamplerParameteri },
+	{ "glSamplerParameteriv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glSamplerParameteriv },
+	{ "glSamplerParameterf", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glSamplerParameterf },
+	{ "glSamplerParameterfv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glSamplerParameterfv },
+	{ "glSamplerParameterIiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glSamplerParameterIiv },
+	{ "glSamplerParameterIuiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glSamplerParameterIuiv },
+	{ "glGetSamplerParameteriv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetSamplerParameteriv },
+	{ "glGetSamplerParameterIiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetSamplerParameterIiv },
+	{ "glGetSamplerParameterfv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetSamplerParameterfv },
+	{ "glGetSamplerParameterIuiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetSamplerParameterIuiv },
+	{ "glQueryCounter", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glQueryCounter },
+	{ "glGetQueryObjecti64v", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetQueryObjecti64v },
+	{ "glGetQueryObjectui64v", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetQueryObjectui64v },
+	{ "glVertexAttribDivisor", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribDivisor },
+	{ "glVertexAttribP1ui", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribP1ui },
+	{ "glVertexAttribP1uiv", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribP1uiv },
+	{ "glVertexAttribP2ui", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribP2ui },
+	{ "glVertexAttribP2uiv", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribP2uiv },
+	{ "glVertexAttribP3ui", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribP3ui },
+	{ "glVertexAttribP3uiv", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribP3uiv },
+	{ "glVertexAttribP4ui", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribP4ui },
+	{ "glVertexAttribP4uiv", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexAttribP4uiv },
+	{ "glVertexP2ui", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexP2ui },
+	{ "glVertexP2uiv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexP2uiv },
+	{ "glVertexP3ui", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexP3ui },
+	{ "glVertexP3uiv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexP3uiv },
+	{ "glVertexP4ui", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexP4ui },
+	{ "glVertexP4uiv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glVertexP4uiv },
+	{ "glTexCoordP1ui", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glTexCoordP1ui },
+	{ "glTexCoordP1uiv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glTexCoordP1uiv },
+	{ "glTexCoordP2ui", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glTexCoordP2ui },
+	{ "glTexCoordP2uiv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glTexCoordP2uiv },
+	{ "glTexCoordP3ui", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glTexCoordP3ui },
+	{ "glTexCoordP3uiv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glTexCoordP3uiv },
+	{ "glTexCoordP4ui", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glTexCoordP4ui },
+	{ "glTexCoordP4uiv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glTexCoordP4uiv },
+	{ "glMultiTexCoordP1ui", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glMultiTexCoordP1ui },
+	{ "glMultiTexCoordP1uiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glMultiTexCoordP1uiv },
+	{ "glMultiTexCoordP2ui", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glMultiTexCoordP2ui },
+	{ "glMultiTexCoordP2uiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glMultiTexCoordP2uiv },
+	{ "glMultiTexCoordP3ui", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glMultiTexCoordP3ui },
+	{ "glMultiTexCoordP3uiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glMultiTexCoordP3uiv },
+	{ "glMultiTexCoordP4ui", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glMultiTexCoordP4ui },
+	{ "glMultiTexCoordP4uiv", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glMultiTexCoordP4uiv },
+	{ "glNormalP3ui", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glNormalP3ui },
+	{ "glNormalP3uiv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glNormalP3uiv },
+	{ "glColorP3ui", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glColorP3ui },
+	{ "glColorP3uiv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glColorP3uiv },
+	{ "glColorP4ui", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glColorP4ui },
+	{ "glColorP4uiv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glColorP4uiv },
+	{ "glSecondaryColorP3ui", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glSecondaryColorP3ui },
+	{ "glSecondaryColorP3uiv", 2, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glSecondaryColorP3uiv },
+	{ "glGetProgramBinary", 5, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glGetProgramBinary },
+	{ "glProgramBinary", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glProgramBinary },
+	{ "glProgramParameteri", 3, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glProgramParameteri },
+	{ "glMaxShaderCompilerThreadsKHR", 1, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glMaxShaderCompilerThreadsKHR },
+	{ "glBufferStorage", 4, 0, GLAD_TRACE_OBJECT_NONE, glad_trace_params_glBufferStorage },
+};
+
+uint64_t gladTraceInvoke(unsigned int id, const uint64_t *args) {
+	switch(id) {
+	case GLAD_TRACE_ID_glCullFace: glad_glCullFace((GLenum)args[0]); return 0;
+	case GLAD_TRACE_ID_glFrontFace: glad_glFrontFace((GLenum)args[0]); return 0;
+	case GLAD_TRACE_ID_glHint: glad_glHint((GLenum)args[0], (GLenum)args[1]); return 0;
+	case GLAD_TRACE_ID_glLineWidth: glad_glLineWidth(replay_float(args[0])); return 0;
+	case GLAD_TRACE_ID_glPointSize: glad_glPointSize(replay_float(args[0])); return 0;
+	case GLAD_TRACE_ID_glPolygonMode: glad_glPolygonMode((GLenum)args[0], (GLenum)args[1]); return 0;
+	case GLAD_TRACE_ID_glScissor: glad_glScissor((GLint)args[0], (GLint)args[1], (GLsizei)args[2], (GLsizei)args[3]); return 0;
+	case GLAD_TRACE_ID_glTexParameterf: glad_glTexParameterf((GLenum)args[0], (GLenum)args[1], replay_float(args[2])); return 0;
+	case GLAD_TRACE_ID_glTexParameterfv: glad_glTexParameterfv((GLenum)args[0], (GLenum)args[1], (const GLfloat *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glTexParameteri: glad_glTexParameteri((GLenum)args[0], (GLenum)args[1], (GLint)args[2]); return 0;
+	case GLAD_TRACE_ID_glTexParameteriv: glad_glTexParameteriv((GLenum)args[0], (GLenum)args[1], (const GLint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glTexImage1D: glad_glTexImage1D((GLenum)args[0], (GLint)args[1], (GLint)args[2], (GLsizei)args[3], (GLint)args[4], (GLenum)args[5], (GLenum)args[6], (const void *)(uintptr_t)args[7]); return 0;
+	case GLAD_TRACE_ID_glTexImage2D: glad_glTexImage2D((GLenum)args[0], (GLint)args[1], (GLint)args[2], (GLsizei)args[3], (GLsizei)args[4], (GLint)args[5], (GLenum)args[6], (GLenum)args[7], (const void *)(uintptr_t)args[8]); return 0;
+	case GLAD_TRACE_ID_glDrawBuffer: glad_glDrawBuffer((GLenum)args[0]); return 0;
+	case GLAD_TRACE_ID_glClear: glad_glClear((GLbitfield)args[0]); return 0;
+	case GLAD_TRACE_ID_glClearColor: glad_glClearColor(replay_float(args[0]), replay_float(args[1]), replay_float(args[2]), replay_float(args[3])); return 0;
+	case GLAD_TRACE_ID_glClearStencil: glad_glClearStencil((GLint)args[0]); return 0;
+	case GLAD_TRACE_ID_glClearDepth: glad_glClearDepth(replay_double(args[0])); return 0;
+	case GLAD_TRACE_ID_glStencilMask: glad_glStencilMask((GLuint)args[0]); return 0;
+	case GLAD_TRACE_ID_glColorMask: glad_glColorMask((GLboolean)args[0], (GLboolean)args[1], (GLboolean)args[2], (GLboolean)args[3]); return 0;
+	case GLAD_TRACE_ID_glDepthMask: glad_glDepthMask((GLboolean)args[0]); return 0;
+	case GLAD_TRACE_ID_glDisable: glad_glDisable((GLenum)args[0]); return 0;
+	case GLAD_TRACE_ID_glEnable: glad_glEnable((GLenum)args[0]); return 0;
+	case GLAD_TRACE_ID_glFinish: glad_glFinish(); return 0;
+	case GLAD_TRACE_ID_glFlush: glad_glFlush(); return 0;
+	case GLAD_TRACE_ID_glBlendFunc: glad_glBlendFunc((GLenum)args[0], (GLenum)args[1]); return 0;
+	case GLAD_TRACE_ID_glLogicOp: glad_glLogicOp((GLenum)args[0]); return 0;
+	case GLAD_TRACE_ID_glStencilFunc: glad_glStencilFunc((GLenum)args[0], (GLint)args[1], (GLuint)args[2]); return 0;
+	case GLAD_TRACE_ID_glStencilOp: glad_glStencilOp((GLenum)args[0], (GLenum)args[1], (GLenum)args[2]); return 0;
+	case GLAD_TRACE_ID_glDepthFunc: glad_glDepthFunc((GLenum)args[0]); return 0;
+	case GLAD_TRACE_ID_glPixelStoref: glad_glPixelStoref((GLenum)args[0], replay_float(args[1])); return 0;
+	case GLAD_TRACE_ID_glPixelStorei: glad_glPixelStorei((GLenum)args[0], (GLint)args[1]); return 0;
+	case GLAD_TRACE_ID_glReadBuffer: glad_glReadBuffer((GLenum)args[0]); return 0;
+	case GLAD_TRACE_ID_glReadPixels: glad_glReadPixels((GLint)args[0], (GLint)args[1], (GLsizei)args[2], (GLsizei)args[3], (GLenum)args[4], (GLenum)args[5], (void *)(uintptr_t)args[6]); return 0;
+	case GLAD_TRACE_ID_glGetBooleanv: glad_glGetBooleanv((GLenum)args[0], (GLboolean *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glGetDoublev: glad_glGetDoublev((GLenum)args[0], (GLdouble *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glGetError: return trace_integer(glad_glGetError());
+	case GLAD_TRACE_ID_glGetFloatv: glad_glGetFloatv((GLenum)args[0], (GLfloat *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glGetIntegerv: glad_glGetIntegerv((GLenum)args[0], (GLint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glGetString: return trace_pointer(glad_glGetString((GLenum)args[0]));
+	case GLAD_TRACE_ID_glGetTexImage: glad_glGetTexImage((GLenum)args[0], (GLint)args[1], (GLenum)args[2], (GLenum)args[3], (void *)(uintptr_t)args[4]); return 0;
+	case GLAD_TRACE_ID_glGetTexParameterfv: glad_glGetTexParameterfv((GLenum)args[0], (GLenum)args[1], (GLfloat *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glGetTexParameteriv: glad_glGetTexParameteriv((GLenum)args[0], (GLenum)args[1], (GLint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glGetTexLevelParameterfv: glad_glGetTexLevelParameterfv((GLenum)args[0], (GLint)args[1], (GLenum)args[2], (GLfloat *)(uintptr_t)args[3]); return 0;
+	case GLAD_TRACE_ID_glGetTexLevelParameteriv: glad_glGetTexLevelParameteriv((GLenum)args[0], (GLint)args[1], (GLenum)args[2], (GLint *)(uintptr_t)args[3]); return 0;
+	case GLAD_TRACE_ID_glIsEnabled: return trace_integer(glad_glIsEnabled((GLenum)args[0]));
+	case GLAD_TRACE_ID_glDepthRange: glad_glDepthRange(replay_double(args[0]), replay_double(args[1])); return 0;
+	case GLAD_TRACE_ID_glViewport: glad_glViewport((GLint)args[0], (GLint)args[1], (GLsizei)args[2], (GLsizei)args[3]); return 0;
+	case GLAD_TRACE_ID_glDrawArrays: glad_glDrawArrays((GLenum)args[0], (GLint)args[1], (GLsizei)args[2]); return 0;
+	case GLAD_TRACE_ID_glDrawElements: glad_glDrawElements((GLenum)args[0], (GLsizei)args[1], (GLenum)args[2], (const void *)(uintptr_t)args[3]); return 0;
+	case GLAD_TRACE_ID_glPolygonOffset: glad_glPolygonOffset(replay_float(args[0]), replay_float(args[1])); return 0;
+	case GLAD_TRACE_ID_glCopyTexImage1D: glad_glCopyTexImage1D((GLenum)args[0], (GLint)args[1], (GLenum)args[2], (GLint)args[3], (GLint)args[4], (GLsizei)args[5], (GLint)args[6]); return 0;
+	case GLAD_TRACE_ID_glCopyTexImage2D: glad_glCopyTexImage2D((GLenum)args[0], (GLint)args[1], (GLenum)args[2], (GLint)args[3], (GLint)args[4], (GLsizei)args[5], (GLsizei)args[6], (GLint)args[7]); return 0;
+	case GLAD_TRACE_ID_glCopyTexSubImage1D: glad_glCopyTexSubImage1D((GLenum)args[0], (GLint)args[1], (GLint)args[2], (GLint)args[3], (GLint)args[4], (GLsizei)args[5]); return 0;
+	case GLAD_TRACE_ID_glCopyTexSubImage2D: glad_glCopyTexSubImage2D((GLenum)args[0], (GLint)args[1], (GLint)args[2], (GLint)args[3], (GLint)args[4], (GLint)args[5], (GLsizei)args[6], (GLsizei)args[7]); return 0;
+	case GLAD_TRACE_ID_glTexSubImage1D: glad_glTexSubImage1D((GLenum)args[0], (GLint)args[1], (GLint)args[2], (GLsizei)args[3], (GLenum)args[4], (GLenum)args[5], (const void *)(uintptr_t)args[6]); return 0;
+	case GLAD_TRACE_ID_glTexSubImage2D: glad_glTexSubImage2D((GLenum)args[0], (GLint)args[1], (GLint)args[2], (GLint)args[3], (GLsizei)args[4], (GLsizei)args[5], (GLenum)args[6], (GLenum)args[7], (const void *)(uintptr_t)args[8]); return 0;
+	case GLAD_TRACE_ID_glBindTexture: glad_glBindTexture((GLenum)args[0], (GLuint)args[1]); return 0;
+	case GLAD_TRACE_ID_glDeleteTextures: glad_glDeleteTextures((GLsizei)args[0], (const GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glGenTextures: glad_glGenTextures((GLsizei)args[0], (GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glIsTexture: return trace_integer(glad_glIsTexture((GLuint)args[0]));
+	case GLAD_TRACE_ID_glDrawRangeElements: glad_glDrawRangeElements((GLenum)args[0], (GLuint)args[1], (GLuint)args[2], (GLsizei)args[3], (GLenum)args[4], (const void *)(uintptr_t)args[5]); return 0;
+	case GLAD_TRACE_ID_glTexImage3D: glad_glTexImage3D((GLenum)args[0], (GLint)args[1], (GLint)args[2], (GLsizei)args[3], (GLsizei)args[4], (GLsizei)args[5], (GLint)args[6], (GLenum)args[7], (GLenum)args[8], (const void *)(uintptr_t)args[9]); return 0;
+	case GLAD_TRACE_ID_glTexSubImage3D: glad_glTexSubImage3D((GLenum)args[0], (GLint)args[1], (GLint)args[2], (GLint)args[3], (GLint)args[4], (GLsizei)args[5], (GLsizei)args[6], (GLsizei)args[7], (GLenum)args[8], (GLenum)args[9], (const void *)(uintptr_t)args[10]); return 0;
+	case GLAD_TRACE_ID_glCopyTexSubImage3D: glad_glCopyTexSubImage3D((GLenum)args[0], (GLint)args[1], (GLint)args[2], (GLint)args[3], (GLint)args[4], (GLint)args[5], (GLint)args[6], (GLsizei)args[7], (GLsizei)args[8]); return 0;
+	case GLAD_TRACE_ID_glActiveTexture: glad_glActiveTexture((GLenum)args[0]); return 0;
+	case GLAD_TRACE_ID_glSampleCoverage: glad_glSampleCoverage(replay_float(args[0]), (GLboolean)args[1]); return 0;
+	case GLAD_TRACE_ID_glCompressedTexImage3D: glad_glCompressedTexImage3D((GLenum)args[0], (GLint)args[1], (GLenum)args[2], (GLsizei)args[3], (GLsizei)args[4], (GLsizei)args[5], (GLint)args[6], (GLsizei)args[7], (const void *)(uintptr_t)args[8]); return 0;
+	case GLAD_TRACE_ID_glCompressedTexImage2D: glad_glCompressedTexImage2D((GLenum)args[0], (GLint)args[1], (GLenum)args[2], (GLsizei)args[3], (GLsizei)args[4], (GLint)args[5], (GLsizei)args[6], (const void *)(uintptr_t)args[7]); return 0;
+	case GLAD_TRACE_ID_glCompressedTexImage1D: glad_glCompressedTexImage1D((GLenum)args[0], (GLint)args[1], (GLenum)args[2], (GLsizei)args[3], (GLint)args[4], (GLsizei)args[5], (const void *)(uintptr_t)args[6]); return 0;
+	case GLAD_TRACE_ID_glCompressedTexSubImage3D: glad_glCompressedTexSubImage3D((GLenum)args[0], (GLint)args[1], (GLint)args[2], (GLint)args[3], (GLint)args[4], (GLsizei)args[5], (GLsizei)args[6], (GLsizei)args[7], (GLenum)args[8], (GLsizei)args[9], (const void *)(uintptr_t)args[10]); return 0;
+	case GLAD_TRACE_ID_glCompressedTexSubImage2D: glad_glCompressedTexSubImage2D((GLenum)args[0], (GLint)args[1], (GLint)args[2], (GLint)args[3], (GLsizei)args[4], (GLsizei)args[5], (GLenum)args[6], (GLsizei)args[7], (const void *)(uintptr_t)args[8]); return 0;
+	case GLAD_TRACE_ID_glCompressedTexSubImage1D: glad_glCompressedTexSubImage1D((GLenum)args[0], (GLint)args[1], (GLint)args[2], (GLsizei)args[3], (GLenum)args[4], (GLsizei)args[5], (const void *)(uintptr_t)args[6]); return 0;
+	case GLAD_TRACE_ID_glGetCompressedTexImage: glad_glGetCompressedTexImage((GLenum)args[0], (GLint)args[1], (void *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glBlendFuncSeparate: glad_glBlendFuncSeparate((GLenum)args[0], (GLenum)args[1], (GLenum)args[2], (GLenum)args[3]); return 0;
+	case GLAD_TRACE_ID_glMultiDrawArrays: glad_glMultiDrawArrays((GLenum)args[0], (const GLint *)(uintptr_t)args[1], (const GLsizei *)(uintptr_t)args[2], (GLsizei)args[3]); return 0;
+	case GLAD_TRACE_ID_glMultiDrawElements: glad_glMultiDrawElements((GLenum)args[0], (const GLsizei *)(uintptr_t)args[1], (GLenum)args[2], (const void *const*)(uintptr_t)args[3], (GLsizei)args[4]); return 0;
+	case GLAD_TRACE_ID_glPointParameterf: glad_glPointParameterf((GLenum)args[0], replay_float(args[1])); return 0;
+	case GLAD_TRACE_ID_glPointParameterfv: glad_glPointParameterfv((GLenum)args[0], (const GLfloat *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glPointParameteri: glad_glPointParameteri((GLenum)args[0], (GLint)args[1]); return 0;
+	case GLAD_TRACE_ID_glPointParameteriv: glad_glPointParameteriv((GLenum)args[0], (const GLint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glBlendColor: glad_glBlendColor(replay_float(args[0]), replay_float(args[1]), replay_float(args[2]), replay_float(args[3])); return 0;
+	case GLAD_TRACE_ID_glBlendEquation: glad_glBlendEquation((GLenum)args[0]); return 0;
+	case GLAD_TRACE_ID_glGenQueries: glad_glGenQueries((GLsizei)args[0], (GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glDeleteQueries: glad_glDeleteQueries((GLsizei)args[0], (const GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glIsQuery: return trace_integer(glad_glIsQuery((GLuint)args[0]));
+	case GLAD_TRACE_ID_glBeginQuery: glad_glBeginQuery((GLenum)args[0], (GLuint)args[1]); return 0;
+	case GLAD_TRACE_ID_glEndQuery: glad_glEndQuery((GLenum)args[0]); return 0;
+	case GLAD_TRACE_ID_glGetQueryiv: glad_glGetQueryiv((GLenum)args[0], (GLenum)args[1], (GLint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glGetQueryObjectiv: glad_glGetQueryObjectiv((GLuint)args[0], (GLenum)args[1], (GLint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glGetQueryObjectuiv: glad_glGetQueryObjectuiv((GLuint)args[0], (GLenum)args[1], (GLuint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glBindBuffer: glad_glBindBuffer((GLenum)args[0], (GLuint)args[1]); return 0;
+	case GLAD_TRACE_ID_glDeleteBuffers: glad_glDeleteBuffers((GLsizei)args[0], (const GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glGenBuffers: glad_glGenBuffers((GLsizei)args[0], (GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glIsBuffer: return trace_integer(glad_glIsBuffer((GLuint)args[0]));
+	case GLAD_TRACE_ID_glBufferData: glad_glBufferData((GLenum)args[0], (GLsizeiptr)args[1], (const void *)(uintptr_t)args[2], (GLenum)args[3]); return 0;
+	case GLAD_TRACE_ID_glBufferSubData: glad_glBufferSubData((GLenum)args[0], (GLintptr)args[1], (GLsizeiptr)args[2], (const void *)(uintptr_t)args[3]); return 0;
+	case GLAD_TRACE_ID_glGetBufferSubData: glad_glGetBufferSubData((GLenum)args[0], (GLintptr)args[1], (GLsizeiptr)args[2], (void *)(uintptr_t)args[3]); return 0;
+	case GLAD_TRACE_ID_glMapBuffer: return trace_pointer(glad_glMapBuffer((GLenum)args[0], (GLenum)args[1]));
+	case GLAD_TRACE_ID_glUnmapBuffer: return trace_integer(glad_glUnmapBuffer((GLenum)args[0]));
+	case GLAD_TRACE_ID_glGetBufferParameteriv: glad_glGetBufferParameteriv((GLenum)args[0], (GLenum)args[1], (GLint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glGetBufferPointerv: glad_glGetBufferPointerv((GLenum)args[0], (GLenum)args[1], (void **)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glBlendEquationSeparate: glad_glBlendEquationSeparate((GLenum)args[0], (GLenum)args[1]); return 0;
+	case GLAD_TRACE_ID_glDrawBuffers: glad_glDrawBuffers((GLsizei)args[0], (const GLenum *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glStencilOpSeparate: glad_glStencilOpSeparate((GLenum)args[0], (GLenum)args[1], (GLenum)args[2], (GLenum)args[3]); return 0;
+	case GLAD_TRACE_ID_glStencilFuncSeparate: glad_glStencilFuncSeparate((GLenum)args[0], (GLenum)args[1], (GLint)args[2], (GLuint)args[3]); return 0;
+	case GLAD_TRACE_ID_glStencilMaskSeparate: glad_glStencilMaskSeparate((GLenum)args[0], (GLuint)args[1]); return 0;
+	case GLAD_TRACE_ID_glAttachShader: glad_glAttachShader((GLuint)args[0], (GLuint)args[1]); return 0;
+	case GLAD_TRACE_ID_glBindAttribLocation: glad_glBindAttribLocation((GLuint)args[0], (GLuint)args[1], (const GLchar *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glCompileShader: glad_glCompileShader((GLuint)args[0]); return 0;
+	case GLAD_TRACE_ID_glCreateProgram: return trace_integer(glad_glCreateProgram());
+	case GLAD_TRACE_ID_glCreateShader: return trace_integer(glad_glCreateShader((GLenum)args[0]));
+	case GLAD_TRACE_ID_glDeleteProgram: glad_glDeleteProgram((GLuint)args[0]); return 0;
+	case GLAD_TRACE_ID_glDeleteShader: glad_glDeleteShader((GLuint)args[0]); return 0;
+	case GLAD_TRACE_ID_glDetachShader: glad_glDetachShader((GLuint)args[0], (GLuint)args[1]); return 0;
+	case GLAD_TRACE_ID_glDisableVertexAttribArray: glad_glDisableVertexAttribArray((GLuint)args[0]); return 0;
+	case GLAD_TRACE_ID_glEnableVertexAttribArray: glad_glEnableVertexAttribArray((GLuint)args[0]); return 0;
+	case GLAD_TRACE_ID_glGetActiveAttrib: glad_glGetActiveAttrib((GLuint)args[0], (GLuint)args[1], (GLsizei)args[2], (GLsizei *)(uintptr_t)args[3], (GLint *)(uintptr_t)args[4], (GLenum *)(uintptr_t)args[5], (GLchar *)(uintptr_t)args[6]); return 0;
+	case GLAD_TRACE_ID_glGetActiveUniform: glad_glGetActiveUniform((GLuint)args[0], (GLuint)args[1], (GLsizei)args[2], (GLsizei *)(uintptr_t)args[3], (GLint *)(uintptr_t)args[4], (GLenum *)(uintptr_t)args[5], (GLchar *)(uintptr_t)args[6]); return 0;
+	case GLAD_TRACE_ID_glGetAttachedShaders: glad_glGetAttachedShaders((GLuint)args[0], (GLsizei)args[1], (GLsizei *)(uintptr_t)args[2], (GLuint *)(uintptr_t)args[3]); return 0;
+	case GLAD_TRACE_ID_glGetAttribLocation: return trace_integer(glad_glGetAttribLocation((GLuint)args[0], (const GLchar *)(uintptr_t)args[1]));
+	case GLAD_TRACE_ID_glGetProgramiv: glad_glGetProgramiv((GLuint)args[0], (GLenum)args[1], (GLint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glGetProgramInfoLog: glad_glGetProgramInfoLog((GLuint)args[0], (GLsizei)args[1], (GLsizei *)(uintptr_t)args[2], (GLchar *)(uintptr_t)args[3]); return 0;
+	case GLAD_TRACE_ID_glGetShaderiv: glad_glGetShaderiv((GLuint)args[0], (GLenum)args[1], (GLint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glGetShaderInfoLog: glad_glGetShaderInfoLog((GLuint)args[0], (GLsizei)args[1], (GLsizei *)(uintptr_t)args[2], (GLchar *)(uintptr_t)args[3]); return 0;
+	case GLAD_TRACE_ID_glGetShaderSource: glad_glGetShaderSource((GLuint)args[0], (GLsizei)args[1], (GLsizei *)(uintptr_t)args[2], (GLchar *)(uintptr_t)args[3]); return 0;
+	case GLAD_TRACE_ID_glGetUniformLocation: return trace_integer(glad_glGetUniformLocation((GLuint)args[0], (const GLchar *)(uintptr_t)args[1]));
+	case GLAD_TRACE_ID_glGetUniformfv: glad_glGetUniformfv((GLuint)args[0], (GLint)args[1], (GLfloat *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glGetUniformiv: glad_glGetUniformiv((GLuint)args[0], (GLint)args[1], (GLint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glGetVertexAttribdv: glad_glGetVertexAttribdv((GLuint)args[0], (GLenum)args[1], (GLdouble *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glGetVertexAttribfv: glad_glGetVertexAttribfv((GLuint)args[0], (GLenum)args[1], (GLfloat *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glGetVertexAttribiv: glad_glGetVertexAttribiv((GLuint)args[0], (GLenum)args[1], (GLint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glGetVertexAttribPointerv: glad_glGetVertexAttribPointerv((GLuint)args[0], (GLenum)args[1], (void **)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glIsProgram: return trace_integer(glad_glIsProgram((GLuint)args[0]));
+	case GLAD_TRACE_ID_glIsShader: return trace_integer(glad_glIsShader((GLuint)args[0]));
+	case GLAD_TRACE_ID_glLinkProgram: glad_glLinkProgram((GLuint)args[0]); return 0;
+	case GLAD_TRACE_ID_glShaderSource: glad_glShaderSource((GLuint)args[0], (GLsizei)args[1], (const GLchar *const*)(uintptr_t)args[2], (const GLint *)(uintptr_t)args[3]); return 0;
+	case GLAD_TRACE_ID_glUseProgram: glad_glUseProgram((GLuint)args[0]); return 0;
+	case GLAD_TRACE_ID_glUniform1f: glad_glUniform1f((GLint)args[0], replay_float(args[1])); return 0;
+	case GLAD_TRACE_ID_glUniform2f: glad_glUniform2f((GLint)args[0], replay_float(args[1]), replay_float(args[2])); return 0;
+	case GLAD_TRACE_ID_glUniform3f: glad_glUniform3f((GLint)args[0], replay_float(args[1]), replay_float(args[2]), replay_float(args[3])); return 0;
+	case GLAD_TRACE_ID_glUniform4f: glad_glUniform4f((GLint)args[0], replay_float(args[1]), replay_float(args[2]), replay_float(args[3]), replay_float(args[4])); return 0;
+	case GLAD_TRACE_ID_glUniform1i: glad_glUniform1i((GLint)args[0], (GLint)args[1]); return 0;
+	case GLAD_TRACE_ID_glUniform2i: glad_glUniform2i((GLint)args[0], (GLint)args[1], (GLint)args[2]); return 0;
+	case GLAD_TRACE_ID_glUniform3i: glad_glUniform3i((GLint)args[0], (GLint)args[1], (GLint)args[2], (GLint)args[3]); return 0;
+	case GLAD_TRACE_ID_glUniform4i: glad_glUniform4i((GLint)args[0], (GLint)args[1], (GLint)args[2], (GLint)args[3], (GLint)args[4]); return 0;
+	case GLAD_TRACE_ID_glUniform1fv: glad_glUniform1fv((GLint)args[0], (GLsizei)args[1], (const GLfloat *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glUniform2fv: glad_glUniform2fv((GLint)args[0], (GLsizei)args[1], (const GLfloat *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glUniform3fv: glad_glUniform3fv((GLint)args[0], (GLsizei)args[1], (const GLfloat *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glUniform4fv: glad_glUniform4fv((GLint)args[0], (GLsizei)args[1], (const GLfloat *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glUniform1iv: glad_glUniform1iv((GLint)args[0], (GLsizei)args[1], (const GLint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glUniform2iv: glad_glUniform2iv((GLint)args[0], (GLsizei)args[1], (const GLint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glUniform3iv: glad_glUniform3iv((GLint)args[0], (GLsizei)args[1], (const GLint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glUniform4iv: glad_glUniform4iv((GLint)args[0], (GLsizei)args[1], (const GLint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glUniformMatrix2fv: glad_glUniformMatrix2fv((GLint)args[0], (GLsizei)args[1], (GLboolean)args[2], (const GLfloat *)(uintptr_t)args[3]); return 0;
+	case GLAD_TRACE_ID_glUniformMatrix3fv: glad_glUniformMatrix3fv((GLint)args[0], (GLsizei)args[1], (GLboolean)args[2], (const GLfloat *)(uintptr_t)args[3]); return 0;
+	case GLAD_TRACE_ID_glUniformMatrix4fv: glad_glUniformMatrix4fv((GLint)args[0], (GLsizei)args[1], (GLboolean)args[2], (const GLfloat *)(uintptr_t)args[3]); return 0;
+	case GLAD_TRACE_ID_glValidateProgram: glad_glValidateProgram((GLuint)args[0]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib1d: glad_glVertexAttrib1d((GLuint)args[0], replay_double(args[1])); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib1dv: glad_glVertexAttrib1dv((GLuint)args[0], (const GLdouble *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib1f: glad_glVertexAttrib1f((GLuint)args[0], replay_float(args[1])); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib1fv: glad_glVertexAttrib1fv((GLuint)args[0], (const GLfloat *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib1s: glad_glVertexAttrib1s((GLuint)args[0], (GLshort)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib1sv: glad_glVertexAttrib1sv((GLuint)args[0], (const GLshort *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib2d: glad_glVertexAttrib2d((GLuint)args[0], replay_double(args[1]), replay_double(args[2])); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib2dv: glad_glVertexAttrib2dv((GLuint)args[0], (const GLdouble *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib2f: glad_glVertexAttrib2f((GLuint)args[0], replay_float(args[1]), replay_float(args[2])); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib2fv: glad_glVertexAttrib2fv((GLuint)args[0], (const GLfloat *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib2s: glad_glVertexAttrib2s((GLuint)args[0], (GLshort)args[1], (GLshort)args[2]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib2sv: glad_glVertexAttrib2sv((GLuint)args[0], (const GLshort *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib3d: glad_glVertexAttrib3d((GLuint)args[0], replay_double(args[1]), replay_double(args[2]), replay_double(args[3])); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib3dv: glad_glVertexAttrib3dv((GLuint)args[0], (const GLdouble *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib3f: glad_glVertexAttrib3f((GLuint)args[0], replay_float(args[1]), replay_float(args[2]), replay_float(args[3])); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib3fv: glad_glVertexAttrib3fv((GLuint)args[0], (const GLfloat *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib3s: glad_glVertexAttrib3s((GLuint)args[0], (GLshort)args[1], (GLshort)args[2], (GLshort)args[3]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib3sv: glad_glVertexAttrib3sv((GLuint)args[0], (const GLshort *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib4Nbv: glad_glVertexAttrib4Nbv((GLuint)args[0], (const GLbyte *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib4Niv: glad_glVertexAttrib4Niv((GLuint)args[0], (const GLint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib4Nsv: glad_glVertexAttrib4Nsv((GLuint)args[0], (const GLshort *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib4Nub: glad_glVertexAttrib4Nub((GLuint)args[0], (GLubyte)args[1], (GLubyte)args[2], (GLubyte)args[3], (GLubyte)args[4]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib4Nubv: glad_glVertexAttrib4Nubv((GLuint)args[0], (const GLubyte *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib4Nuiv: glad_glVertexAttrib4Nuiv((GLuint)args[0], (const GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib4Nusv: glad_glVertexAttrib4Nusv((GLuint)args[0], (const GLushort *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib4bv: glad_glVertexAttrib4bv((GLuint)args[0], (const GLbyte *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib4d: glad_glVertexAttrib4d((GLuint)args[0], replay_double(args[1]), replay_double(args[2]), replay_double(args[3]), replay_double(args[4])); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib4dv: glad_glVertexAttrib4dv((GLuint)args[0], (const GLdouble *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib4f: glad_glVertexAttrib4f((GLuint)args[0], replay_float(args[1]), replay_float(args[2]), replay_float(args[3]), replay_float(args[4])); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib4fv: glad_glVertexAttrib4fv((GLuint)args[0], (const GLfloat *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib4iv: glad_glVertexAttrib4iv((GLuint)args[0], (const GLint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib4s: glad_glVertexAttrib4s((GLuint)args[0], (GLshort)args[1], (GLshort)args[2], (GLshort)args[3], (GLshort)args[4]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib4sv: glad_glVertexAttrib4sv((GLuint)args[0], (const GLshort *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib4ubv: glad_glVertexAttrib4ubv((GLuint)args[0], (const GLubyte *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib4uiv: glad_glVertexAttrib4uiv((GLuint)args[0], (const GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttrib4usv: glad_glVertexAttrib4usv((GLuint)args[0], (const GLushort *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribPointer: glad_glVertexAttribPointer((GLuint)args[0], (GLint)args[1], (GLenum)args[2], (GLboolean)args[3], (GLsizei)args[4], (const void *)(uintptr_t)args[5]); return 0;
+	case GLAD_TRACE_ID_glUniformMatrix2x3fv: glad_glUniformMatrix2x3fv((GLint)args[0], (GLsizei)args[1], (GLboolean)args[2], (const GLfloat *)(uintptr_t)args[3]); return 0;
+	case GLAD_TRACE_ID_glUniformMatrix3x2fv: glad_glUniformMatrix3x2fv((GLint)args[0], (GLsizei)args[1], (GLboolean)args[2], (const GLfloat *)(uintptr_t)args[3]); return 0;
+	case GLAD_TRACE_ID_glUniformMatrix2x4fv: glad_glUniformMatrix2x4fv((GLint)args[0], (GLsizei)args[1], (GLboolean)args[2], (const GLfloat *)(uintptr_t)args[3]); return 0;
+	case GLAD_TRACE_ID_glUniformMatrix4x2fv: glad_glUniformMatrix4x2fv((GLint)args[0], (GLsizei)args[1], (GLboolean)args[2], (const GLfloat *)(uintptr_t)args[3]); return 0;
+	case GLAD_TRACE_ID_glUniformMatrix3x4fv: glad_glUniformMatrix3x4fv((GLint)args[0], (GLsizei)args[1], (GLboolean)args[2], (const GLfloat *)(uintptr_t)args[3]); return 0;
+	case GLAD_TRACE_ID_glUniformMatrix4x3fv: glad_glUniformMatrix4x3fv((GLint)args[0], (GLsizei)args[1], (GLboolean)args[2], (const GLfloat *)(uintptr_t)args[3]); return 0;
+	case GLAD_TRACE_ID_glColorMaski: glad_glColorMaski((GLuint)args[0], (GLboolean)args[1], (GLboolean)args[2], (GLboolean)args[3], (GLboolean)args[4]); return 0;
+	case GLAD_TRACE_ID_glGetBooleani_v: glad_glGetBooleani_v((GLenum)args[0], (GLuint)args[1], (GLboolean *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glGetIntegeri_v: glad_glGetIntegeri_v((GLenum)args[0], (GLuint)args[1], (GLint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glEnablei: glad_glEnablei((GLenum)args[0], (GLuint)args[1]); return 0;
+	case GLAD_TRACE_ID_glDisablei: glad_glDisablei((GLenum)args[0], (GLuint)args[1]); return 0;
+	case GLAD_TRACE_ID_glIsEnabledi: return trace_integer(glad_glIsEnabledi((GLenum)args[0], (GLuint)args[1]));
+	case GLAD_TRACE_ID_glBeginTransformFeedback: glad_glBeginTransformFeedback((GLenum)args[0]); return 0;
+	case GLAD_TRACE_ID_glEndTransformFeedback: glad_glEndTransformFeedback(); return 0;
+	case GLAD_TRACE_ID_glBindBufferRange: glad_glBindBufferRange((GLenum)args[0], (GLuint)args[1], (GLuint)args[2], (GLintptr)args[3], (GLsizeiptr)args[4]); return 0;
+	case GLAD_TRACE_ID_glBindBufferBase: glad_glBindBufferBase((GLenum)args[0], (GLuint)args[1], (GLuint)args[2]); return 0;
+	case GLAD_TRACE_ID_glTransformFeedbackVaryings: glad_glTransformFeedbackVaryings((GLuint)args[0], (GLsizei)args[1], (const GLchar *const*)(uintptr_t)args[2], (GLenum)args[3]); return 0;
+	case GLAD_TRACE_ID_glGetTransformFeedbackVarying: glad_glGetTransformFeedbackVarying((GLuint)args[0], (GLuint)args[1], (GLsizei)args[2], (GLsizei *)(uintptr_t)args[3], (GLsizei *)(uintptr_t)args[4], (GLenum *)(uintptr_t)args[5], (GLchar *)(uintptr_t)args[6]); return 0;
+	case GLAD_TRACE_ID_glClampColor: glad_glClampColor((GLenum)args[0], (GLenum)args[1]); return 0;
+	case GLAD_TRACE_ID_glBeginConditionalRender: glad_glBeginConditionalRender((GLuint)args[0], (GLenum)args[1]); return 0;
+	case GLAD_TRACE_ID_glEndConditionalRender: glad_glEndConditionalRender(); return 0;
+	case GLAD_TRACE_ID_glVertexAttribIPointer: glad_glVertexAttribIPointer((GLuint)args[0], (GLint)args[1], (GLenum)args[2], (GLsizei)args[3], (const void *)(uintptr_t)args[4]); return 0;
+	case GLAD_TRACE_ID_glGetVertexAttribIiv: glad_glGetVertexAttribIiv((GLuint)args[0], (GLenum)args[1], (GLint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glGetVertexAttribIuiv: glad_glGetVertexAttribIuiv((GLuint)args[0], (GLenum)args[1], (GLuint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribI1i: glad_glVertexAttribI1i((GLuint)args[0], (GLint)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribI2i: glad_glVertexAttribI2i((GLuint)args[0], (GLint)args[1], (GLint)args[2]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribI3i: glad_glVertexAttribI3i((GLuint)args[0], (GLint)args[1], (GLint)args[2], (GLint)args[3]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribI4i: glad_glVertexAttribI4i((GLuint)args[0], (GLint)args[1], (GLint)args[2], (GLint)args[3], (GLint)args[4]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribI1ui: glad_glVertexAttribI1ui((GLuint)args[0], (GLuint)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribI2ui: glad_glVertexAttribI2ui((GLuint)args[0], (GLuint)args[1], (GLuint)args[2]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribI3ui: glad_glVertexAttribI3ui((GLuint)args[0], (GLuint)args[1], (GLuint)args[2], (GLuint)args[3]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribI4ui: glad_glVertexAttribI4ui((GLuint)args[0], (GLuint)args[1], (GLuint)args[2], (GLuint)args[3], (GLuint)args[4]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribI1iv: glad_glVertexAttribI1iv((GLuint)args[0], (const GLint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribI2iv: glad_glVertexAttribI2iv((GLuint)args[0], (const GLint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribI3iv: glad_glVertexAttribI3iv((GLuint)args[0], (const GLint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribI4iv: glad_glVertexAttribI4iv((GLuint)args[0], (const GLint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribI1uiv: glad_glVertexAttribI1uiv((GLuint)args[0], (const GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribI2uiv: glad_glVertexAttribI2uiv((GLuint)args[0], (const GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribI3uiv: glad_glVertexAttribI3uiv((GLuint)args[0], (const GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribI4uiv: glad_glVertexAttribI4uiv((GLuint)args[0], (const GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribI4bv: glad_glVertexAttribI4bv((GLuint)args[0], (const GLbyte *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribI4sv: glad_glVertexAttribI4sv((GLuint)args[0], (const GLshort *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribI4ubv: glad_glVertexAttribI4ubv((GLuint)args[0], (const GLubyte *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribI4usv: glad_glVertexAttribI4usv((GLuint)args[0], (const GLushort *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glGetUniformuiv: glad_glGetUniformuiv((GLuint)args[0], (GLint)args[1], (GLuint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glBindFragDataLocation: glad_glBindFragDataLocation((GLuint)args[0], (GLuint)args[1], (const GLchar *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glGetFragDataLocation: return trace_integer(glad_glGetFragDataLocation((GLuint)args[0], (const GLchar *)(uintptr_t)args[1]));
+	case GLAD_TRACE_ID_glUniform1ui: glad_glUniform1ui((GLint)args[0], (GLuint)args[1]); return 0;
+	case GLAD_TRACE_ID_glUniform2ui: glad_glUniform2ui((GLint)args[0], (GLuint)args[1], (GLuint)args[2]); return 0;
+	case GLAD_TRACE_ID_glUniform3ui: glad_glUniform3ui((GLint)args[0], (GLuint)args[1], (GLuint)args[2], (GLuint)args[3]); return 0;
+	case GLAD_TRACE_ID_glUniform4ui: glad_glUniform4ui((GLint)args[0], (GLuint)args[1], (GLuint)args[2], (GLuint)args[3], (GLuint)args[4]); return 0;
+	case GLAD_TRACE_ID_glUniform1uiv: glad_glUniform1uiv((GLint)args[0], (GLsizei)args[1], (const GLuint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glUniform2uiv: glad_glUniform2uiv((GLint)args[0], (GLsizei)args[1], (const GLuint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glUniform3uiv: glad_glUniform3uiv((GLint)args[0], (GLsizei)args[1], (const GLuint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glUniform4uiv: glad_glUniform4uiv((GLint)args[0], (GLsizei)args[1], (const GLuint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glTexParameterIiv: glad_glTexParameterIiv((GLenum)args[0], (GLenum)args[1], (const GLint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glTexParameterIuiv: glad_glTexParameterIuiv((GLenum)args[0], (GLenum)args[1], (const GLuint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glGetTexParameterIiv: glad_glGetTexParameterIiv((GLenum)args[0], (GLenum)args[1], (GLint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glGetTexParameterIuiv: glad_glGetTexParameterIuiv((GLenum)args[0], (GLenum)args[1], (GLuint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glClearBufferiv: glad_glClearBufferiv((GLenum)args[0], (GLint)args[1], (const GLint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glClearBufferuiv: glad_glClearBufferuiv((GLenum)args[0], (GLint)args[1], (const GLuint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glClearBufferfv: glad_glClearBufferfv((GLenum)args[0], (GLint)args[1], (const GLfloat *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glClearBufferfi: glad_glClearBufferfi((GLenum)args[0], (GLint)args[1], replay_float(args[2]), (GLint)args[3]); return 0;
+	case GLAD_TRACE_ID_glGetStringi: return trace_pointer(glad_glGetStringi((GLenum)args[0], (GLuint)args[1]));
+	case GLAD_TRACE_ID_glIsRenderbuffer: return trace_integer(glad_glIsRenderbuffer((GLuint)args[0]));
+	case GLAD_TRACE_ID_glBindRenderbuffer: glad_glBindRenderbuffer((GLenum)args[0], (GLuint)args[1]); return 0;
+	case GLAD_TRACE_ID_glDeleteRenderbuffers: glad_glDeleteRenderbuffers((GLsizei)args[0], (const GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glGenRenderbuffers: glad_glGenRenderbuffers((GLsizei)args[0], (GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glRenderbufferStorage: glad_glRenderbufferStorage((GLenum)args[0], (GLenum)args[1], (GLsizei)args[2], (GLsizei)args[3]); return 0;
+	case GLAD_TRACE_ID_glGetRenderbufferParameteriv: glad_glGetRenderbufferParameteriv((GLenum)args[0], (GLenum)args[1], (GLint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glIsFramebuffer: return trace_integer(glad_glIsFramebuffer((GLuint)args[0]));
+	case GLAD_TRACE_ID_glBindFramebuffer: glad_glBindFramebuffer((GLenum)args[0], (GLuint)args[1]); return 0;
+	case GLAD_TRACE_ID_glDeleteFramebuffers: glad_glDeleteFramebuffers((GLsizei)args[0], (const GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glGenFramebuffers: glad_glGenFramebuffers((GLsizei)args[0], (GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glCheckFramebufferStatus: return trace_integer(glad_glCheckFramebufferStatus((GLenum)args[0]));
+	case GLAD_TRACE_ID_glFramebufferTexture1D: glad_glFramebufferTexture1D((GLenum)args[0], (GLenum)args[1], (GLenum)args[2], (GLuint)args[3], (GLint)args[4]); return 0;
+	case GLAD_TRACE_ID_glFramebufferTexture2D: glad_glFramebufferTexture2D((GLenum)args[0], (GLenum)args[1], (GLenum)args[2], (GLuint)args[3], (GLint)args[4]); return 0;
+	case GLAD_TRACE_ID_glFramebufferTexture3D: glad_glFramebufferTexture3D((GLenum)args[0], (GLenum)args[1], (GLenum)args[2], (GLuint)args[3], (GLint)args[4], (GLint)args[5]); return 0;
+	case GLAD_TRACE_ID_glFramebufferRenderbuffer: glad_glFramebufferRenderbuffer((GLenum)args[0], (GLenum)args[1], (GLenum)args[2], (GLuint)args[3]); return 0;
+	case GLAD_TRACE_ID_glGetFramebufferAttachmentParameteriv: glad_glGetFramebufferAttachmentParameteriv((GLenum)args[0], (GLenum)args[1], (GLenum)args[2], (GLint *)(uintptr_t)args[3]); return 0;
+	case GLAD_TRACE_ID_glGenerateMipmap: glad_glGenerateMipmap((GLenum)args[0]); return 0;
+	case GLAD_TRACE_ID_glBlitFramebuffer: glad_glBlitFramebuffer((GLint)args[0], (GLint)args[1], (GLint)args[2], (GLint)args[3], (GLint)args[4], (GLint)args[5], (GLint)args[6], (GLint)args[7], (GLbitfield)args[8], (GLenum)args[9]); return 0;
+	case GLAD_TRACE_ID_glRenderbufferStorageMultisample: glad_glRenderbufferStorageMultisample((GLenum)args[0], (GLsizei)args[1], (GLenum)args[2], (GLsizei)args[3], (GLsizei)args[4]); return 0;
+	case GLAD_TRACE_ID_glFramebufferTextureLayer: glad_glFramebufferTextureLayer((GLenum)args[0], (GLenum)args[1], (GLuint)args[2], (GLint)args[3], (GLint)args[4]); return 0;
+	case GLAD_TRACE_ID_glMapBufferRange: return trace_pointer(glad_glMapBufferRange((GLenum)args[0], (GLintptr)args[1], (GLsizeiptr)args[2], (GLbitfield)args[3]));
+	case GLAD_TRACE_ID_glFlushMappedBufferRange: glad_glFlushMappedBufferRange((GLenum)args[0], (GLintptr)args[1], (GLsizeiptr)args[2]); return 0;
+	case GLAD_TRACE_ID_glBindVertexArray: glad_glBindVertexArray((GLuint)args[0]); return 0;
+	case GLAD_TRACE_ID_glDeleteVertexArrays: glad_glDeleteVertexArrays((GLsizei)args[0], (const GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glGenVertexArrays: glad_glGenVertexArrays((GLsizei)args[0], (GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glIsVertexArray: return trace_integer(glad_glIsVertexArray((GLuint)args[0]));
+	case GLAD_TRACE_ID_glDrawArraysInstanced: glad_glDrawArraysInstanced((GLenum)args[0], (GLint)args[1], (GLsizei)args[2], (GLsizei)args[3]); return 0;
+	case GLAD_TRACE_ID_glDrawElementsInstanced: glad_glDrawElementsInstanced((GLenum)args[0], (GLsizei)args[1], (GLenum)args[2], (const void *)(uintptr_t)args[3], (GLsizei)args[4]); return 0;
+	case GLAD_TRACE_ID_glTexBuffer: glad_glTexBuffer((GLenum)args[0], (GLenum)args[1], (GLuint)args[2]); return 0;
+	case GLAD_TRACE_ID_glPrimitiveRestartIndex: glad_glPrimitiveRestartIndex((GLuint)args[0]); return 0;
+	case GLAD_TRACE_ID_glCopyBufferSubData: glad_glCopyBufferSubData((GLenum)args[0], (GLenum)args[1], (GLintptr)args[2], (GLintptr)args[3], (GLsizeiptr)args[4]); return 0;
+	case GLAD_TRACE_ID_glGetUniformIndices: glad_glGetUniformIndices((GLuint)args[0], (GLsizei)args[1], (const GLchar *const*)(uintptr_t)args[2], (GLuint *)(uintptr_t)args[3]); return 0;
+	case GLAD_TRACE_ID_glGetActiveUniformsiv: glad_glGetActiveUniformsiv((GLuint)args[0], (GLsizei)args[1], (const GLuint *)(uintptr_t)args[2], (GLenum)args[3], (GLint *)(uintptr_t)args[4]); return 0;
+	case GLAD_TRACE_ID_glGetActiveUniformName: glad_glGetActiveUniformName((GLuint)args[0], (GLuint)args[1], (GLsizei)args[2], (GLsizei *)(uintptr_t)args[3], (GLchar *)(uintptr_t)args[4]); return 0;
+	case GLAD_TRACE_ID_glGetUniformBlockIndex: return trace_integer(glad_glGetUniformBlockIndex((GLuint)args[0], (const GLchar *)(uintptr_t)args[1]));
+	case GLAD_TRACE_ID_glGetActiveUniformBlockiv: glad_glGetActiveUniformBlockiv((GLuint)args[0], (GLuint)args[1], (GLenum)args[2], (GLint *)(uintptr_t)args[3]); return 0;
+	case GLAD_TRACE_ID_glGetActiveUniformBlockName: glad_glGetActiveUniformBlockName((GLuint)args[0], (GLuint)args[1], (GLsizei)args[2], (GLsizei *)(uintptr_t)args[3], (GLchar *)(uintptr_t)args[4]); return 0;
+	case GLAD_TRACE_ID_glUniformBlockBinding: glad_glUniformBlockBinding((GLuint)args[0], (GLuint)args[1], (GLuint)args[2]); return 0;
+	case GLAD_TRACE_ID_glDrawElementsBaseVertex: glad_glDrawElementsBaseVertex((GLenum)args[0], (GLsizei)args[1], (GLenum)args[2], (const void *)(uintptr_t)args[3], (GLint)args[4]); return 0;
+	case GLAD_TRACE_ID_glDrawRangeElementsBaseVertex: glad_glDrawRangeElementsBaseVertex((GLenum)args[0], (GLuint)args[1], (GLuint)args[2], (GLsizei)args[3], (GLenum)args[4], (const void *)(uintptr_t)args[5], (GLint)args[6]); return 0;
+	case GLAD_TRACE_ID_glDrawElementsInstancedBaseVertex: glad_glDrawElementsInstancedBaseVertex((GLenum)args[0], (GLsizei)args[1], (GLenum)args[2], (const void *)(uintptr_t)args[3], (GLsizei)args[4], (GLint)args[5]); return 0;
+	case GLAD_TRACE_ID_glMultiDrawElementsBaseVertex: glad_glMultiDrawElementsBaseVertex((GLenum)args[0], (const GLsizei *)(uintptr_t)args[1], (GLenum)args[2], (const void *const*)(uintptr_t)args[3], (GLsizei)args[4], (const GLint *)(uintptr_t)args[5]); return 0;
+	case GLAD_TRACE_ID_glProvokingVertex: glad_glProvokingVertex((GLenum)args[0]); return 0;
+	case GLAD_TRACE_ID_glFenceSync: return trace_pointer(glad_glFenceSync((GLenum)args[0], (GLbitfield)args[1]));
+	case GLAD_TRACE_ID_glIsSync: return trace_integer(glad_glIsSync((GLsync)(uintptr_t)args[0]));
+	case GLAD_TRACE_ID_glDeleteSync: glad_glDeleteSync((GLsync)(uintptr_t)args[0]); return 0;
+	case GLAD_TRACE_ID_glClientWaitSync: return trace_integer(glad_glClientWaitSync((GLsync)(uintptr_t)args[0], (GLbitfield)args[1], (GLuint64)args[2]));
+	case GLAD_TRACE_ID_glWaitSync: glad_glWaitSync((GLsync)(uintptr_t)args[0], (GLbitfield)args[1], (GLuint64)args[2]); return 0;
+	case GLAD_TRACE_ID_glGetInteger64v: glad_glGetInteger64v((GLenum)args[0], (GLint64 *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glGetSynciv: glad_glGetSynciv((GLsync)(uintptr_t)args[0], (GLenum)args[1], (GLsizei)args[2], (GLsizei *)(uintptr_t)args[3], (GLint *)(uintptr_t)args[4]); return 0;
+	case GLAD_TRACE_ID_glGetInteger64i_v: glad_glGetInteger64i_v((GLenum)args[0], (GLuint)args[1], (GLint64 *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glGetBufferParameteri64v: glad_glGetBufferParameteri64v((GLenum)args[0], (GLenum)args[1], (GLint64 *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glFramebufferTexture: glad_glFramebufferTexture((GLenum)args[0], (GLenum)args[1], (GLuint)args[2], (GLint)args[3]); return 0;
+	case GLAD_TRACE_ID_glTexImage2DMultisample: glad_glTexImage2DMultisample((GLenum)args[0], (GLsizei)args[1], (GLenum)args[2], (GLsizei)args[3], (GLsizei)args[4], (GLboolean)args[5]); return 0;
+	case GLAD_TRACE_ID_glTexImage3DMultisample: glad_glTexImage3DMultisample((GLenum)args[0], (GLsizei)args[1], (GLenum)args[2], (GLsizei)args[3], (GLsizei)args[4], (GLsizei)args[5], (GLboolean)args[6]); return 0;
+	case GLAD_TRACE_ID_glGetMultisamplefv: glad_glGetMultisamplefv((GLenum)args[0], (GLuint)args[1], (GLfloat *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glSampleMaski: glad_glSampleMaski((GLuint)args[0], (GLbitfield)args[1]); return 0;
+	case GLAD_TRACE_ID_glBindFragDataLocationIndexed: glad_glBindFragDataLocationIndexed((GLuint)args[0], (GLuint)args[1], (GLuint)args[2], (const GLchar *)(uintptr_t)args[3]); return 0;
+	case GLAD_TRACE_ID_glGetFragDataIndex: return trace_integer(glad_glGetFragDataIndex((GLuint)args[0], (const GLchar *)(uintptr_t)args[1]));
+	case GLAD_TRACE_ID_glGenSamplers: glad_glGenSamplers((GLsizei)args[0], (GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glDeleteSamplers: glad_glDeleteSamplers((GLsizei)args[0], (const GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glIsSampler: return trace_integer(glad_glIsSampler((GLuint)args[0]));
+	case GLAD_TRACE_ID_glBindSampler: glad_glBindSampler((GLuint)args[0], (GLuint)args[1]); return 0;
+	case GLAD_TRACE_ID_glSamplerParameteri: glad_glSamplerParameteri((GLuint)args[0], (GLenum)args[1], (GLint)args[2]); return 0;
+	case GLAD_TRACE_ID_glSamplerParameteriv: glad_glSamplerParameteriv((GLuint)args[0], (GLenum)args[1], (const GLint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glSamplerParameterf: glad_glSamplerParameterf((GLuint)args[0], (GLenum)args[1], replay_float(args[2])); return 0;
+	case GLAD_TRACE_ID_glSamplerParameterfv: glad_glSamplerParameterfv((GLuint)args[0], (GLenum)args[1], (const GLfloat *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glSamplerParameterIiv: glad_glSamplerParameterIiv((GLuint)args[0], (GLenum)args[1], (const GLint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glSamplerParameterIuiv: glad_glSamplerParameterIuiv((GLuint)args[0], (GLenum)args[1], (const GLuint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glGetSamplerParameteriv: glad_glGetSamplerParameteriv((GLuint)args[0], (GLenum)args[1], (GLint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glGetSamplerParameterIiv: glad_glGetSamplerParameterIiv((GLuint)args[0], (GLenum)args[1], (GLint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glGetSamplerParameterfv: glad_glGetSamplerParameterfv((GLuint)args[0], (GLenum)args[1], (GLfloat *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glGetSamplerParameterIuiv: glad_glGetSamplerParameterIuiv((GLuint)args[0], (GLenum)args[1], (GLuint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glQueryCounter: glad_glQueryCounter((GLuint)args[0], (GLenum)args[1]); return 0;
+	case GLAD_TRACE_ID_glGetQueryObjecti64v: glad_glGetQueryObjecti64v((GLuint)args[0], (GLenum)args[1], (GLint64 *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glGetQueryObjectui64v: glad_glGetQueryObjectui64v((GLuint)args[0], (GLenum)args[1], (GLuint64 *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribDivisor: glad_glVertexAttribDivisor((GLuint)args[0], (GLuint)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribP1ui: glad_glVertexAttribP1ui((GLuint)args[0], (GLenum)args[1], (GLboolean)args[2], (GLuint)args[3]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribP1uiv: glad_glVertexAttribP1uiv((GLuint)args[0], (GLenum)args[1], (GLboolean)args[2], (const GLuint *)(uintptr_t)args[3]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribP2ui: glad_glVertexAttribP2ui((GLuint)args[0], (GLenum)args[1], (GLboolean)args[2], (GLuint)args[3]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribP2uiv: glad_glVertexAttribP2uiv((GLuint)args[0], (GLenum)args[1], (GLboolean)args[2], (const GLuint *)(uintptr_t)args[3]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribP3ui: glad_glVertexAttribP3ui((GLuint)args[0], (GLenum)args[1], (GLboolean)args[2], (GLuint)args[3]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribP3uiv: glad_glVertexAttribP3uiv((GLuint)args[0], (GLenum)args[1], (GLboolean)args[2], (const GLuint *)(uintptr_t)args[3]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribP4ui: glad_glVertexAttribP4ui((GLuint)args[0], (GLenum)args[1], (GLboolean)args[2], (GLuint)args[3]); return 0;
+	case GLAD_TRACE_ID_glVertexAttribP4uiv: glad_glVertexAttribP4uiv((GLuint)args[0], (GLenum)args[1], (GLboolean)args[2], (const GLuint *)(uintptr_t)args[3]); return 0;
+	case GLAD_TRACE_ID_glVertexP2ui: glad_glVertexP2ui((GLenum)args[0], (GLuint)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexP2uiv: glad_glVertexP2uiv((GLenum)args[0], (const GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexP3ui: glad_glVertexP3ui((GLenum)args[0], (GLuint)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexP3uiv: glad_glVertexP3uiv((GLenum)args[0], (const GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexP4ui: glad_glVertexP4ui((GLenum)args[0], (GLuint)args[1]); return 0;
+	case GLAD_TRACE_ID_glVertexP4uiv: glad_glVertexP4uiv((GLenum)args[0], (const GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glTexCoordP1ui: glad_glTexCoordP1ui((GLenum)args[0], (GLuint)args[1]); return 0;
+	case GLAD_TRACE_ID_glTexCoordP1uiv: glad_glTexCoordP1uiv((GLenum)args[0], (const GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glTexCoordP2ui: glad_glTexCoordP2ui((GLenum)args[0], (GLuint)args[1]); return 0;
+	case GLAD_TRACE_ID_glTexCoordP2uiv: glad_glTexCoordP2uiv((GLenum)args[0], (const GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glTexCoordP3ui: glad_glTexCoordP3ui((GLenum)args[0], (GLuint)args[1]); return 0;
+	case GLAD_TRACE_ID_glTexCoordP3uiv: glad_glTexCoordP3uiv((GLenum)args[0], (const GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glTexCoordP4ui: glad_glTexCoordP4ui((GLenum)args[0], (GLuint)args[1]); return 0;
+	case GLAD_TRACE_ID_glTexCoordP4uiv: glad_glTexCoordP4uiv((GLenum)args[0], (const GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glMultiTexCoordP1ui: glad_glMultiTexCoordP1ui((GLenum)args[0], (GLenum)args[1], (GLuint)args[2]); return 0;
+	case GLAD_TRACE_ID_glMultiTexCoordP1uiv: glad_glMultiTexCoordP1uiv((GLenum)args[0], (GLenum)args[1], (const GLuint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glMultiTexCoordP2ui: glad_glMultiTexCoordP2ui((GLenum)args[0], (GLenum)args[1], (GLuint)args[2]); return 0;
+	case GLAD_TRACE_ID_glMultiTexCoordP2uiv: glad_glMultiTexCoordP2uiv((GLenum)args[0], (GLenum)args[1], (const GLuint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glMultiTexCoordP3ui: glad_glMultiTexCoordP3ui((GLenum)args[0], (GLenum)args[1], (GLuint)args[2]); return 0;
+	case GLAD_TRACE_ID_glMultiTexCoordP3uiv: glad_glMultiTexCoordP3uiv((GLenum)args[0], (GLenum)args[1], (const GLuint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glMultiTexCoordP4ui: glad_glMultiTexCoordP4ui((GLenum)args[0], (GLenum)args[1], (GLuint)args[2]); return 0;
+	case GLAD_TRACE_ID_glMultiTexCoordP4uiv: glad_glMultiTexCoordP4uiv((GLenum)args[0], (GLenum)args[1], (const GLuint *)(uintptr_t)args[2]); return 0;
+	case GLAD_TRACE_ID_glNormalP3ui: glad_glNormalP3ui((GLenum)args[0], (GLuint)args[1]); return 0;
+	case GLAD_TRACE_ID_glNormalP3uiv: glad_glNormalP3uiv((GLenum)args[0], (const GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glColorP3ui: glad_glColorP3ui((GLenum)args[0], (GLuint)args[1]); return 0;
+	case GLAD_TRACE_ID_glColorP3uiv: glad_glColorP3uiv((GLenum)args[0], (const GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glColorP4ui: glad_glColorP4ui((GLenum)args[0], (GLuint)args[1]); return 0;
+	case GLAD_TRACE_ID_glColorP4uiv: glad_glColorP4uiv((GLenum)args[0], (const GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glSecondaryColorP3ui: glad_glSecondaryColorP3ui((GLenum)args[0], (GLuint)args[1]); return 0;
+	case GLAD_TRACE_ID_glSecondaryColorP3uiv: glad_glSecondaryColorP3uiv((GLenum)args[0], (const GLuint *)(uintptr_t)args[1]); return 0;
+	case GLAD_TRACE_ID_glGetProgramBinary: glad_glGetProgramBinary((GLuint)args[0], (GLsizei)args[1], (GLsizei *)(uintptr_t)args[2], (GLenum *)(uintptr_t)args[3], (void *)(uintptr_t)args[4]); return 0;
+	case GLAD_TRACE_ID_glProgramBinary: glad_glProgramBinary((GLuint)args[0], (GLenum)args[1], (const void *)(uintptr_t)args[2], (GLsizei)args[3]); return 0;
+	case GLAD_TRACE_ID_glProgramParameteri: glad_glProgramParameteri((GLuint)args[0], (GLenum)args[1], (GLint)args[2]); return 0;
+	case GLAD_TRACE_ID_glMaxShaderCompilerThreadsKHR: glad_glMaxShaderCompilerThreadsKHR((GLuint)args[0]); return 0;
+	case GLAD_TRACE_ID_glBufferStorage: glad_glBufferStorage((GLenum)args[0], (GLsizeiptr)args[1], (const void *)(uintptr_t)args[2], (GLbitfield)args[3]); return 0;
+	default: return 0;
+	}
+}
+/* glad_extras.py: end trace */
+
+/* ----- the rest needs the real entry points */
+
+static void trace_map_buffer(GLenum target, void *data, GLenum access) {
+    GLint size = 0;
+    if(access == GL_READ_ONLY || glad_trace_real.glGetBufferParameteriv == NULL) return;
+    glad_trace_real.glGetBufferParameteriv(target, GL_BUFFER_SIZE, &size);
+    trace_map(target, data, (size_t)size, GL_MAP_WRITE_BIT);
+}
+
+/* a program that exits without gladTraceEnd still gets a trace with a header that matches its records */
+static void trace_at_exit(void) {
+    if(!trace_file.open) return;
+    fprintf(stderr, "glad trace: gladTraceEnd wasn't called before exit, finishing the trace now\n");
+    gladTraceEnd();
+}
+
+int gladTraceBegin(const char *path) {
+    static int exit_hook_installed = 0;
+    GladTraceHeader *header;
+
+    if(trace_file.open) return 0;
+    memset(&trace_file, 0, sizeof(trace_file));
+    memset(trace_mappings, 0, sizeof(trace_mappings));
+#if defined(_WIN32) || defined(__CYGWIN__)
+    trace_file.file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if(trace_file.file == INVALID_HANDLE_VALUE) {
+#else
+    trace_file.file = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if(trace_file.file < 0) {
+#endif
+        fprintf(stderr, "glad trace: can't create %s\n", path);
+        return 0;
+    }
+    if(!trace_map_file((size_t)16 << 20)) {
+        fprintf(stderr, "glad trace: can't map %s\n", path);
+#if defined(_WIN32) || defined(__CYGWIN__)
+        CloseHandle(trace_file.file);
+#else
+        close(trace_file.file);
+#endif
+        return 0;
+    }
+
+    trace_blobs.entries = (trace_blob_entry *)calloc(1024, sizeof(trace_blob_entry));
+    if(trace_blobs.entries == NULL) {
+        trace_unmap_file();
+#if defined(_WIN32) || defined(__CYGWIN__)
+        CloseHandle(trace_file.file);
+#else
+        close(trace_file.file);
+#endif
+        return 0;
+    }
+    trace_blobs.mask = 1023;
+    trace_blobs.count = 0;
+
+    header = (GladTraceHeader *)trace_file.data;
+    memcpy(header->magic, "GLTR", 4);
+    header->version = GLAD_TRACE_VERSION;
+    header->functionCount = GLAD_TRACE_ID_COUNT;
+    header->pointerSize = (uint32_t)sizeof(void *);
+    trace_file.used = sizeof(GladTraceHeader);
+    trace_sync_header();
+    trace_file.open = 1;
+    trace_file.active = 1;
+    if(!exit_hook_installed) {
+        atexit(trace_at_exit);
+        exit_hook_installed = 1;
+    }
+
+    /* what the application could write without the tracer seeing it, or what only replays on this driver */
+    GLAD_GL_ARB_buffer_storage = 0;
+    GLAD_GL_ARB_get_program_binary = 0;
+
+    trace_install();
+    return 1;
+}
+
+void gladTraceFrame(void) {
+    if(!trace_file.active) return;
+    trace_record(GLAD_TRACE_RECORD_FRAME, NULL, 0, NULL);
+    trace_file.frames++;
+    trace_sync_header();
+}
+
+void gladTraceEnd(void) {
+    size_t used = trace_file.used;
+
+    /* after a failed grow the file has no mapping left, but it still has to be truncated and closed */
+    if(!trace_file.open) return;
+    trace_uninstall();
+    trace_file.open = 0;
+    trace_file.active = 0;
+    if(trace_file.data != NULL) {
+        trace_sync_header();
+        trace_unmap_file();
+    }
+#if defined(_WIN32) || defined(__CYGWIN__)
+    {
+        LARGE_INTEGER end;
+        end.QuadPart = (LONGLONG)used;
+        SetFilePointerEx(trace_file.file, end, NULL, FILE_BEGIN);
+        SetEndOfFile(trace_file.file);
+        CloseHandle(trace_file.file);
+    }
+#else
+    if(ftruncate(trace_file.file, (off_t)used) != 0) {
+        fprintf(stderr, "glad trace: can't truncate the trace\n");
+    }
+    close(trace_file.file);
+#endif
+    free(trace_blobs.entries);
+    memset(&trace_blobs, 0, sizeof(trace_blobs));
+}
+
+unsigned int gladTraceFunctionCount(void) {
+    return GLAD_TRACE_ID_COUNT;
+}
+
+const GladTraceFunction *gladTraceFunction(unsigned int id) {
+    return id < GLAD_TRACE_ID_COUNT ? &glad_trace_functions[id] : NULL;
+}
@@ -0,0 +1,549 @@
+#!/usr/bin/env python3
+"""Generates what this project adds on top of the glad 0.1.36 loader.
+
+glad itself generated the PFN typedefs in glad.h and the load_GL_* functions in glad.c. Everything
+this script owns sits between "glad_extras.py: begin <section>" and "glad_extras.py: end <section>"
+marker comments, and is rebuilt from those two inputs:
+
+    glad.c   lazy      gladLoadGLLoaderLazy and one resolving stub per entry point
+    glad.h   context   the GladGLContext table and the GLAD_GL_CONTEXT_CALLS macro layer
+    glad.c   context   gladLoadGLContext and the thread's current table
+    glad_trace.c  trace  one tracing shim per entry point, glreplay's metadata and gladTraceInvoke
+
+Run it after regenerating glad or adding an extension (the build has a glad-generate target for
+that). With --check nothing is written; it exits non-zero if any section is out of date.
+"""
+
+import os
+import re
+import sys
+
+GLAD = os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir)
+HEADER = os.path.join(GLAD, 'include', 'glad', 'glad.h')
+SOURCE = os.path.join(GLAD, 'src', 'glad.c')
+TRACE = os.path.join(GLAD, 'src', 'glad_trace.c')
+
+
+class Feature:
+    """A GL version or extension glad loads, with its entry points in glad's order."""
+
+    def __init__(self, name, functions):
+        self.name = name            # e.g. GL_VERSION_3_3, GL_ARB_buffer_storage
+        self.functions = functions  # [(glName, PFN...PROC)]
+
+    @property
+    def short(self):
+        return self.name[3:]
+
+    @property
+    def is_version(self):
+        return self.name.startswith('GL_VERSION_')
+
+
+class Function:
+    def __init__(self, name, pfn, result, params):
+        self.name = name
+        self.pfn = pfn
+        self.result = result
+        self.params = params        # the parameter list exactly as glad.h spells it
+
+    @property
+    def arguments(self):
+        if self.params in ('void', ''):
+            return []
+        return [name for _, name in self.typed_params]
+
+    @property
+    def typed_params(self):
+        """[(type, name)], e.g. ('const GLchar *const*', 'string')"""
+        if self.params in ('void', ''):
+            return []
+        out = []
+        for param in self.params.split(','):
+            param = param.strip()
+            name = re.findall(r'\w+', param)[-1]
+            out.append((param[:param.rindex(name)].strip(), name))
+        return out
+
+
+def read(path):
+    with open(path, newline='') as file:
+        return file.read()
+
+
+def parse():
+    header = read(HEADER)
+    source = read(SOURCE)
+
+    prototypes = {}
+    for match in re.finditer(r'typedef (.+?) \(APIENTRYP (PFNGL\w+PROC)\)\((.*)\);', header):
+        prototypes[match.group(2)] = (match.group(1).strip(), match.group(3).strip())
+
+    features = []
+    functions = {}
+    for match in re.finditer(r'static void load_(GL_\w+)\(GLADloadproc load\) \{\n(.*?)\n\}', source, re.S):
+        loaded = re.findall(r'glad_(gl\w+) = \((PFN\w+)\)load\("gl\w+"\);', match.group(2))
+        features.append(Feature(match.group(1), loaded))
+        for name, pfn in loaded:
+            if name not in functions:
+                result, params = prototypes[pfn]
+                functions[name] = Function(name, pfn, result, params)
+
+    loader = re.search(r'int gladLoadGLLoader\(GLADloadproc load\) \{\n(.*?)\n\}', source, re.S).group(1)
+    return features, functions, loader
+
+
+# ----- glad.c: lazy binding
+
+def lazy_section(features, functions, loader):
+    out = ['''/* ----- lazy binding
+ * gladLoadGLLoaderLazy only finds the version and extensions; every glad_gl* pointer starts at a stub
+ * that looks the real entry point up on its first call and then points the glad_gl* pointer straight
+ * at it, so startup pays for the handful of functions a program uses instead of all of them.
+ * A stub only repoints the glad_gl* pointer while it still points at the stub, so whoever wrapped
+ * the pointer in between (a state cache, a tracer) keeps its wrapper and calls through the stub,
+ * which by then is one extra branch. Two threads resolving the same entry point store the same value.
+ */
+
+static GLADloadproc glad_lazy_load = NULL;
+
+/* the version or extension said the function is there; calling through NULL would only crash
+ * somewhere less obvious, so a driver that doesn't have it after all stops the program right here */
+static void *glad_lazy_resolve(const char *name) {
+	void *function = glad_lazy_load(name);
+	if(function == NULL) {
+		fprintf(stderr, "glad: %s was not found, the driver advertises it but can't load it\\n", name);
+		abort();
+	}
+	return function;
+}
+
+static struct {''']
+    for function in functions.values():
+        out.append('\t%s %s;' % (function.pfn, function.name))
+    out.append('} glad_lazy_slots;\n')
+    out.append('''#define GLAD_LAZY_BIND(name, proc) \\
+	if(glad_lazy_slots.name == NULL) glad_lazy_slots.name = (proc)glad_lazy_resolve(#name); \\
+	if(glad_##name == glad_lazy_##name) glad_##name = glad_lazy_slots.name
+''')
+    for function in functions.values():
+        call = 'glad_lazy_slots.%s(%s);' % (function.name, ', '.join(function.arguments))
+        if function.result != 'void':
+            call = 'return ' + call
+        out.append('static %s APIENTRY glad_lazy_%s(%s) {\n\tGLAD_LAZY_BIND(%s, %s);\n\t%s\n}'
+                   % (function.result, function.name, function.params, function.name, function.pfn, call))
+    out.append('')
+    for feature in features:
+        out.append('static void lazy_%s(void) {' % feature.name)
+        out.append('\tif(!GLAD_%s) return;' % feature.name)
+        for name, _ in feature.functions:
+            out.append('\tglad_%s = glad_lazy_%s;' % (name, name))
+        out.append('}')
+
+    # the same steps as gladLoadGLLoader, with stubs instead of lookups
+    body = loader.replace('\tglGetString = (PFNGLGETSTRINGPROC)load("glGetString");\n',
+                          '\tglad_lazy_load = load;\n\tmemset(&glad_lazy_slots, 0, sizeof(glad_lazy_slots));\n'
+                          '\tglGetString = (PFNGLGETSTRINGPROC)load("glGetString");\n')
+    body = re.sub(r'load_(GL_\w+)\(load\);', r'lazy_\1();', body)
+    out.append('\nint gladLoadGLLoaderLazy(GLADloadproc load) {\n' + body + '\n}')
+    return '\n'.join(out) + '\n'
+
+
+# ----- glad.h and glad.c: per-context dispatch
+
+def context_header_section(features, functions, loader):
+    out = ['''/* ----- per-context dispatch
+ * A GladGLContext holds one context's function pointers, version, extension set and flags, filled by
+ * gladLoadGLContext without touching the global glad_gl* pointers. gladSetGLContext makes a table
+ * current for the calling thread only, so threads driving different contexts (or drivers) never
+ * see each other's pointers. Translation units that define GLAD_GL_CONTEXT_CALLS before including
+ * this header keep writing glDrawArrays(...), GLVersion, gladHasExtension(...) and GLAD_GL_*, but
+ * all of them go through the current thread's table.
+ */
+typedef struct GladGLContext {
+    struct gladGLversionStruct version;
+    void *extensions; /* every extension the context has, owned by the table */''']
+    for feature in features:
+        out.append('    int %s;' % feature.short)
+    for function in functions.values():
+        out.append('    %s %s;' % (function.pfn, function.name[2:]))
+    out.append('''    void *userptr;
+} GladGLContext;
+
+/* fills context, which has to start out zeroed or unloaded (loading it again replaces everything it
+ * had); the context must be current while loading */
+GLAPI int gladLoadGLContext(GladGLContext *context, GLADloadproc load);
+/* frees the extension set and zeroes the table */
+GLAPI void gladUnloadGLContext(GladGLContext *context);
+GLAPI int gladContextHasExtension(const GladGLContext *context, const char *ext);
+/* the calling thread's current table, NULL until set */
+GLAPI void gladSetGLContext(GladGLContext *context);
+GLAPI GladGLContext *gladGetGLContext(void);
+
+#ifdef GLAD_GL_CONTEXT_CALLS
+#define GLVersion (gladGetGLContext()->version)
+#define gladHasExtension(ext) gladContextHasExtension(gladGetGLContext(), (ext))''')
+    for feature in features:
+        out.append('#define GLAD_%s (gladGetGLContext()->%s)' % (feature.name, feature.short))
+    for function in functions.values():
+        out.append('#undef %s\n#define %s (gladGetGLContext()->%s)' % (function.name, function.name, function.name[2:]))
+    out.append('#endif')
+    return '\n'.join(out) + '\n'
+
+
+def context_entries(features):
+    out = []
+    for feature in features:
+        for name, _ in feature.functions:
+            out.append('\t{ "%s", offsetof(GladGLContext, %s), offsetof(GladGLContext, %s) },' % (name, name[2:], feature.short))
+    return out
+
+
+def context_source_section(features, functions, loader):
+    versions = [feature for feature in features if feature.is_version]
+    extensions = [feature for feature in features if not feature.is_version]
+    out = ['''/* ----- per-context dispatch */
+
+#if defined(_MSC_VER)
+#define GLAD_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#define GLAD_THREAD_LOCAL __thread
+#else
+#define GLAD_THREAD_LOCAL _Thread_local
+#endif
+
+static GLAD_THREAD_LOCAL GladGLContext *glad_current_context = NULL;
+
+void gladSetGLContext(GladGLContext *context) {
+    glad_current_context = context;
+}
+
+GladGLContext *gladGetGLContext(void) {
+    return glad_current_context;
+}
+
+/* every entry point with the flag that has to be set for it to be loaded */
+typedef struct {
+    const char *name;
+    size_t function;
+    size_t feature;
+} glad_context_entry;
+
+static const glad_context_entry glad_context_versions[] = {''']
+    out += context_entries(versions)
+    out.append('};\n\nstatic const glad_context_entry glad_context_extensions[] = {')
+    out += context_entries(extensions)
+    out.append('};\n\nstatic const struct {\n    const char *name;\n    size_t feature;\n} glad_context_extension_names[] = {')
+    for feature in extensions:
+        out.append('\t{ "%s", offsetof(GladGLContext, %s) },' % (feature.name, feature.short))
+    out.append('};\n')
+    out.append('''static void load_context_entries(GladGLContext *context, GLADloadproc load, const glad_context_entry *entries, size_t count) {
+    size_t i;
+    for(i = 0; i < count; i++) {
+        void **function = (void **)((char *)context + entries[i].function);
+        if(*function == NULL && *(int *)((char *)context + entries[i].feature)) {
+            *function = load(entries[i].name);
+        }
+    }
+}
+
+int gladLoadGLContext(GladGLContext *context, GLADloadproc load) {
+    const char *version;
+    const char *prefixes[] = { "OpenGL ES-CM ", "OpenGL ES-CL ", "OpenGL ES ", NULL };
+    int i, major = 0, minor = 0;
+    size_t e;
+
+    gladUnloadGLContext(context);
+    context->GetString = (PFNGLGETSTRINGPROC)load("glGetString");
+    if(context->GetString == NULL) return 0;
+    version = (const char *)context->GetString(GL_VERSION);
+    if(version == NULL) return 0;
+
+    /* the same parsing as find_coreGL */
+    for(i = 0; prefixes[i]; i++) {
+        const size_t length = strlen(prefixes[i]);
+        if(strncmp(version, prefixes[i], length) == 0) {
+            version += length;
+            break;
+        }
+    }
+#ifdef _MSC_VER
+    sscanf_s(version, "%d.%d", &major, &minor);
+#else
+    sscanf(version, "%d.%d", &major, &minor);
+#endif
+    context->version.major = major; context->version.minor = minor;''')
+    for feature in versions:
+        major, minor = feature.name[len('GL_VERSION_'):].split('_')
+        out.append('\tcontext->%s = (major == %s && minor >= %s) || major > %s;' % (feature.short, major, minor, major))
+    out.append('''
+    load_context_entries(context, load, glad_context_versions, sizeof(glad_context_versions) / sizeof(glad_context_versions[0]));
+    context->extensions = build_exts(major, context->GetString, context->GetIntegerv, context->GetStringi);
+    if(context->extensions == NULL) return 0;
+    for(e = 0; e < sizeof(glad_context_extension_names) / sizeof(glad_context_extension_names[0]); e++) {
+        *(int *)((char *)context + glad_context_extension_names[e].feature) = find_ext(context->extensions, glad_context_extension_names[e].name);
+    }
+    load_context_entries(context, load, glad_context_extensions, sizeof(glad_context_extensions) / sizeof(glad_context_extensions[0]));
+    return major != 0 || minor != 0;
+}
+
+void gladUnloadGLContext(GladGLContext *context) {
+    free(context->extensions);
+    memset(context, 0, sizeof(*context));
+}
+
+int gladContextHasExtension(const GladGLContext *context, const char *ext) {
+    return context != NULL && find_ext(context->extensions, ext);
+}''')
+    return '\n'.join(out) + '\n'
+
+
+# ----- glad_trace.c: tracing shims
+
+# scalar parameters and return values by name, and the name arrays glGen*/glDelete* take
+TRACE_OBJECTS = {'buffer': 'BUFFER', 'program': 'PROGRAM', 'shader': 'SHADER', 'array': 'VERTEX_ARRAY',
+                 'framebuffer': 'FRAMEBUFFER', 'renderbuffer': 'RENDERBUFFER', 'texture': 'TEXTURE',
+                 'sampler': 'SAMPLER', 'sync': 'SYNC'}
+TRACE_NAME_ARRAYS = {'buffers': 'BUFFER', 'arrays': 'VERTEX_ARRAY', 'framebuffers': 'FRAMEBUFFER',
+                     'renderbuffers': 'RENDERBUFFER', 'textures': 'TEXTURE', 'ids': 'QUERY', 'samplers': 'SAMPLER'}
+TRACE_RESULT_OBJECTS = {'glCreateProgram': 'PROGRAM', 'glCreateShader': 'SHADER', 'glFenceSync': 'SYNC',
+                        'glGetUniformLocation': 'LOCATION', 'glGetUniformBlockIndex': 'BLOCK_INDEX'}
+TRACE_STRING_COUNTS = {'glShaderSource': 'count', 'glTransformFeedbackVaryings': 'count',
+                       'glGetUniformIndices': 'uniformCount'}
+SIZEOF = {'GLbyte': 1, 'GLubyte': 1, 'GLshort': 2, 'GLushort': 2, 'GLint': 4, 'GLuint': 4, 'GLfloat': 4,
+          'GLdouble': 8, 'GLenum': 4, 'GLsizei': 4}
+
+
+def base_type(type):
+    return type.replace('const', '').replace('*', '').strip()
+
+
+def classify(function, type, param):
+    """(GladTraceParamKind, GladTraceObject, how to record it) for one parameter"""
+    name = function.name
+    names = function.arguments
+    if '*' not in type:
+        object = 'NONE'
+        if param in TRACE_OBJECTS:
+            object = TRACE_OBJECTS[param]
+        elif param == 'id' and 'Quer' in name:
+            object = 'QUERY'
+        elif param == 'location' and name.startswith('glUniform'):
+            object = 'LOCATION'
+        elif param == 'uniformBlockIndex':
+            object = 'BLOCK_INDEX'
+        return 'SCALAR', object, None
+    if name.startswith('glDelete') and param in TRACE_NAME_ARRAYS:
+        return 'NAMES_IN', TRACE_NAME_ARRAYS[param], '(size_t)(%s) * sizeof(GLuint)' % names[0]
+    if name.startswith('glGen') and param in TRACE_NAME_ARRAYS:
+        return 'NAMES_OUT', TRACE_NAME_ARRAYS[param], '(size_t)(%s) * sizeof(GLuint)' % names[0]
+    if not type.startswith('const'):
+        return 'OUT', 'NONE', None
+    if '*const*' in type:
+        if param == 'indices':
+            return 'BLOB', 'NONE', '(size_t)(drawcount) * sizeof(void *)'
+        lengths = 'length' if name == 'glShaderSource' else 'NULL'
+        return 'STRINGS', 'NONE', (TRACE_STRING_COUNTS[name], lengths)
+    if param in ('indices', 'pointer'):
+        return 'OFFSET', 'NONE', None
+    if name == 'glShaderSource' and param == 'length':
+        return 'UNUSED', 'NONE', None
+    if param in ('name', 'uniformBlockName'):
+        return 'BLOB', 'NONE', 'strlen(%s) + 1' % param
+    if param == 'binary':
+        return 'BLOB', 'NONE', '(size_t)(length)'
+    if name in ('glBufferData', 'glBufferSubData', 'glBufferStorage'):
+        return 'BLOB', 'NONE', '(size_t)(size)'
+    if name.startswith('glCompressedTex'):
+        return 'BLOB', 'NONE', '(size_t)(imageSize)'
+    if param == 'pixels':
+        return 'UNSUPPORTED', 'NONE', None
+
+    size = SIZEOF[base_type(type)]
+    match = re.match(r'glUniform([1-4])(f|i|ui)v$', name)
+    if match:
+        return 'BLOB', 'NONE', '(size_t)(count) * %s * %d' % (match.group(1), size)
+    match = re.match(r'glUniformMatrix([2-4])(?:x([2-4]))?fv$', name)
+    if match:
+        columns, rows = int(match.group(1)), int(match.group(2) or match.group(1))
+        return 'BLOB', 'NONE', '(size_t)(count) * %d * %d' % (columns * rows, size)
+    if name.startswith('glClearBuffer'):
+        return 'BLOB', 'NONE', '(buffer == GL_DEPTH || buffer == GL_STENCIL ? 1 : 4) * %d' % size
+    if re.match(r'gl(Tex|Sampler)Parameter', name):
+        return 'BLOB', 'NONE', '(pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1) * %d' % size
+    if name.startswith('glPointParameter'):
+        return 'BLOB', 'NONE', '%d' % size
+    match = re.match(r'glVertexAttribI?([1-4])N?(b|d|f|i|s|ub|ui|us)v$', name)
+    if match:
+        return 'BLOB', 'NONE', '%s * %d' % (match.group(1), size)
+    if re.match(r'gl(VertexAttrib|Vertex|TexCoord|MultiTexCoord|Normal|Color|SecondaryColor)P[1-4]uiv$', name):
+        return 'BLOB', 'NONE', '%d' % size
+    if param in ('first', 'count', 'basevertex') and 'drawcount' in names:
+        return 'BLOB', 'NONE', '(size_t)(drawcount) * %d' % size
+    if param == 'uniformIndices':
+        return 'BLOB', 'NONE', '(size_t)(uniformCount) * %d' % size
+    if param == 'bufs':
+        return 'BLOB', 'NONE', '(size_t)(n) * %d' % size
+    raise SystemExit('glad_extras.py: no idea how to trace %s of %s (%s)' % (param, name, type))
+
+
+def encode(type, value):
+    base = base_type(type)
+    if '*' in type or base == 'GLsync':
+        return 'trace_pointer(%s)' % value
+    if base in ('GLfloat', 'GLclampf'):
+        return 'trace_float(%s)' % value
+    if base in ('GLdouble', 'GLclampd'):
+        return 'trace_double(%s)' % value
+    return 'trace_integer(%s)' % value
+
+
+def decode(type, slot):
+    base = base_type(type)
+    if '*' in type or base == 'GLsync':
+        return '(%s)(uintptr_t)args[%d]' % (type, slot)
+    if base in ('GLfloat', 'GLclampf'):
+        return 'replay_float(args[%d])' % slot
+    if base in ('GLdouble', 'GLclampd'):
+        return 'replay_double(args[%d])' % slot
+    return '(%s)args[%d]' % (type, slot)
+
+
+def trace_shim(function):
+    params = function.typed_params
+    kinds = [classify(function, type, param) for type, param in params]
+    returns = function.result != 'void'
+    body = []
+    if params:
+        body.append('\tuint64_t args[%d];' % len(params))
+    if returns:
+        body.append('\t%s result;' % function.result)
+        body.append('\tuint64_t traced;')
+    for slot, ((type, param), (kind, _, how)) in enumerate(zip(params, kinds)):
+        if kind == 'SCALAR':
+            body.append('\targs[%d] = %s;' % (slot, encode(type, param)))
+        elif kind == 'OFFSET':
+            body.append('\targs[%d] = trace_pointer(%s);' % (slot, param))
+        elif kind in ('BLOB', 'NAMES_IN'):
+            body.append('\targs[%d] = trace_blob(%s, %s);' % (slot, param, how))
+        elif kind == 'STRINGS':
+            body.append('\targs[%d] = trace_strings(%s, %s, %s);' % (slot, how[0], param, how[1]))
+        else:
+            body.append('\targs[%d] = 0;' % slot)
+    if function.name == 'glFlushMappedBufferRange':
+        body.append('\ttrace_mapped_write(target, offset, length);')
+    if function.name == 'glUnmapBuffer':
+        body.append('\ttrace_unmap(target);')
+
+    call = 'glad_trace_real.%s(%s)' % (function.name, ', '.join(function.arguments))
+    body.append(('\tresult = %s;' if returns else '\t%s;') % call)
+    for slot, ((type, param), (kind, _, how)) in enumerate(zip(params, kinds)):
+        if kind == 'NAMES_OUT':
+            body.append('\targs[%d] = trace_blob(%s, %s);' % (slot, param, how))
+    if function.name == 'glMapBufferRange':
+        body.append('\ttrace_map(target, result, (size_t)length, access);')
+    if function.name == 'glMapBuffer':
+        body.append('\ttrace_map_buffer(target, result, access);')
+
+    record = 'trace_record(GLAD_TRACE_ID_%s, %s, %d, %s);' % (function.name, 'args' if params else 'NULL',
+                                                              len(params), '&traced' if returns else 'NULL')
+    if returns:
+        body.append('\ttraced = %s;' % encode(function.result, 'result'))
+        body.append('\t' + record)
+        body.append('\treturn result;')
+    else:
+        body.append('\t' + record)
+    return 'static %s APIENTRY glad_trace_%s(%s) {\n%s\n}' % (function.result, function.name, function.params, '\n'.join(body))
+
+
+def trace_section(features, functions, loader):
+    out = ['/* ----- one shim per entry point, the metadata glreplay needs and the replay calls */\n']
+    out.append('enum {')
+    for id, name in enumerate(functions):
+        out.append('\tGLAD_TRACE_ID_%s = %d,' % (name, id))
+    out.append('\tGLAD_TRACE_ID_COUNT = %d\n};\n' % len(functions))
+    out.append('static struct {')
+    for function in functions.values():
+        out.append('\t%s %s;' % (function.pfn, function.name))
+    out.append('} glad_trace_real;\n')
+    for function in functions.values():
+        out.append(trace_shim(function))
+    out.append('')
+
+    out.append('static void trace_install(void) {')
+    for name in functions:
+        out.append('\tglad_trace_real.%s = glad_%s;\n\tif(glad_%s != NULL) glad_%s = glad_trace_%s;' % (name, name, name, name, name))
+    out.append('}\n')
+    out.append('static void trace_uninstall(void) {')
+    for name in functions:
+        out.append('\tif(glad_%s == glad_trace_%s) glad_%s = glad_trace_real.%s;' % (name, name, name, name))
+    out.append('}\n')
+
+    for function in functions.values():
+        params = function.typed_params
+        if not params:
+            continue
+        items = ['{ GLAD_TRACE_%s, GLAD_TRACE_OBJECT_%s }' % classify(function, type, param)[:2] for type, param in params]
+        out.append('static const GladTraceParam glad_trace_params_%s[] = { %s };' % (function.name, ', '.join(items)))
+    out.append('\nstatic const GladTraceFunction glad_trace_functions[] = {')
+    for function in functions.values():
+        params = function.typed_params
+        out.append('\t{ "%s", %d, %d, GLAD_TRACE_OBJECT_%s, %s },'
+                   % (function.name, len(params), function.result != 'void', TRACE_RESULT_OBJECTS.get(function.name, 'NONE'),
+                      'glad_trace_params_' + function.name if params else 'NULL'))
+    out.append('};\n')
+
+    out.append('uint64_t gladTraceInvoke(unsigned int id, const uint64_t *args) {')
+    out.append('\tswitch(id) {')
+    for function in functions.values():
+        call = 'glad_%s(%s)' % (function.name, ', '.join(decode(type, slot) for slot, (type, _) in enumerate(function.typed_params)))
+        if function.result == 'void':
+            out.append('\tcase GLAD_TRACE_ID_%s: %s; return 0;' % (function.name, call))
+        else:
+            out.append('\tcase GLAD_TRACE_ID_%s: return %s;' % (function.name, encode(function.result, call)))
+    out.append('\tdefault: return 0;\n\t}\n}')
+    return '\n'.join(out) + '\n'
+
+
+SECTIONS = [
+    (SOURCE, 'lazy', lazy_section),
+    (HEADER, 'context', context_header_section),
+    (SOURCE, 'context', context_source_section),
+    (TRACE, 'trace', trace_section),
+]
+
+
+def replace_section(text, section, generated):
+    begin = '/* glad_extras.py: begin %s */\n' % section
+    end = '/* glad_extras.py: end %s */\n' % section
+    start = text.find(begin)
+    stop = text.find(end)
+    if start < 0 or stop < start:
+        raise SystemExit('glad_extras.py: no "%s" markers' % section)
+    return text[:start + len(begin)] + generated + text[stop:]
+
+
+def main():
+    check = '--check' in sys.argv[1:]
+    features, functions, loader = parse()
+
+    files = {}
+    for path, section, generate in SECTIONS:
+        text = files.get(path, read(path))
+        files[path] = replace_section(text, section, generate(features, functions, loader))
+
+    stale = [path for path, text in files.items() if text != read(path)]
+    if check:
+        for path in stale:
+            print('%s is out of date, run glad/tools/glad_extras.py' % os.path.relpath(path))
+        return 1 if stale else 0
+
+    for path in stale:
+        with open(path, 'w', newline='') as file:
+            file.write(files[path])
+        print('updated %s' % os.path.relpath(path))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,268 @@
+#include <glad/glad.h>
+#include "asset-streaming.h"
+#include "mesh-file.h"
+#include "ring-buffer.h"
+#include "gpu-resources.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	struct LoadRequest
+	{
+		int handle;
+		std::string path;
+	};
+
+	// made on an IO thread, owned by the GL thread once it comes out of a ring
+	struct LoadedMesh
+	{
+		int handle;
+		bool valid;
+		MeshFile file;
+	};
+
+	struct StreamedAsset
+	{
+		std::string path;
+		AssetState state = AssetState::Loading;
+		std::unique_ptr<LoadedMesh> loaded;		// kept mapped until the upload is done
+		size_t uploadedBytes = 0;
+		int uploadFrames = 0;
+		GpuVertexArray vertexArray;
+		GpuBuffer vertexBuffer;
+		GpuBuffer indexBuffer;
+		StreamedMesh mesh = {};
+	};
+
+	using CompletedRing = RingBuffer<LoadedMesh*, 64>;
+
+	size_t uploadBudget = 0;
+	std::vector<StreamedAsset> assets;
+	std::deque<int> uploadQueue;
+	int pendingAssets = 0;
+
+	std::vector<std::thread> ioThreads;
+	std::vector<std::unique_ptr<CompletedRing>> completed;	// one per IO thread, so each ring has a single producer
+	std::mutex requestMutex;
+	std::condition_variable requestCondition;
+	std::deque<LoadRequest> requests;
+	std::atomic<bool> streaming{ false };
+
+	// reading a byte per page makes the IO thread take the page faults instead of the GL thread
+	void prefault(const void* data, size_t size)
+	{
+		const volatile char* bytes = static_cast<const char*>(data);
+		for (size_t offset = 0; offset < size; offset += 4096)
+			(void)bytes[offset];
+	}
+
+	void ioThread(int index)
+	{
+		CompletedRing& ring = *completed[index];
+		for (;;)
+		{
+			LoadRequest request;
+			{
+				std::unique_lock<std::mutex> lock(requestMutex);
+				requestCondition.wait(lock, [] { return !requests.empty() || !streaming; });
+				if (!streaming) return;
+				request = std::move(requests.front());
+				requests.pop_front();
+			}
+
+			LoadedMesh* loaded = new LoadedMesh{ request.handle, false, {} };
+			loaded->valid = loaded->file.open(request.path.c_str());
+			if (loaded->valid)
+			{
+				prefault(loaded->file.vertexData(), loaded->file.header().vertexDataSize);
+				prefault(loaded->file.indexData(), loaded->file.header().indexDataSize);
+			}
+
+			// the GL thread drains every frame, a full ring only means it's busy uploading
+			while (!ring.push(loaded))
+			{
+				if (!streaming)
+				{
+					delete loaded;
+					return;
+				}
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+		}
+	}
+
+	// copies as much of the blob as the budget allows; true once all of it is on the GPU
+	bool uploadPart(GpuHandle buffer, const void* data, size_t size, size_t& uploaded, size_t& budget)
+	{
+		if (uploaded >= size) return true;
+		if (budget == 0) return false;
+
+		size_t chunk = size - uploaded < budget ? size - uploaded : budget;
+		// GL_COPY_WRITE_BUFFER so that nothing touches the element binding of whatever VAO is bound
+		glBindBuffer(GL_COPY_WRITE_BUFFER, gpuName(buffer));
+		glBufferSubData(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(uploaded), static_cast<GLsizeiptr>(chunk),
+			static_cast<const char*>(data) + uploaded);
+		uploaded += chunk;
+		budget -= chunk;
+		return uploaded >= size;
+	}
+
+	// returns true when the asset is finished
+	bool uploadAsset(StreamedAsset& asset, size_t& budget)
+	{
+		const MeshFile& file = asset.loaded->file;
+		const MeshFileHeader& header = file.header();
+		size_t vertexBytes = header.vertexDataSize;
+		size_t indexBytes = header.indexDataSize;
+
+		if (asset.uploadFrames++ == 0)
+		{
+			asset.vertexBuffer = GpuBuffer::create();
+			asset.indexBuffer = GpuBuffer::create();
+			gpuBufferData(asset.vertexBuffer.handle(), GL_COPY_WRITE_BUFFER, vertexBytes, nullptr, GL_STATIC_DRAW);
+			gpuBufferData(asset.indexBuffer.handle(), GL_COPY_WRITE_BUFFER, indexBytes, nullptr, GL_STATIC_DRAW);
+		}
+
+		// the vertex blob first, then the indices continue where it left off
+		size_t vertexUploaded = asset.uploadedBytes < vertexBytes ? asset.uploadedBytes : vertexBytes;
+		size_t indexUploaded = asset.uploadedBytes - vertexUploaded;
+		bool done = uploadPart(asset.vertexBuffer.handle(), file.vertexData(), vertexBytes, vertexUploaded, budget)
+			&& uploadPart(asset.indexBuffer.handle(), file.indexData(), indexBytes, indexUploaded, budget);
+		asset.uploadedBytes = vertexUploaded + indexUploaded;
+		if (!done) return false;
+
+		asset.vertexArray = GpuVertexArray::create();
+		glBindVertexArray(asset.vertexArray.name());
+		glBindBuffer(GL_ARRAY_BUFFER, asset.vertexBuffer.name());
+		file.setupAttributes();
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, asset.indexBuffer.name());
+		glBindVertexArray(0);
+
+		StreamedMesh& mesh = asset.mesh;
+		mesh.vertexArray = asset.vertexArray.name();
+		mesh.indexType = header.indexType;
+		mesh.indexCount = static_cast<int>(header.indexCount);
+		mesh.quantizedPositions = (header.flags & MeshQuantizedPositions) != 0;
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			mesh.positionScale[axis] = header.positionScale[axis];
+			mesh.positionOffset[axis] = header.positionOffset[axis];
+		}
+
+		std::cout << "Streamed " << asset.path << ": " << asset.uploadedBytes << " bytes over " << asset.uploadFrames << " frame(s)\n";
+		asset.loaded.reset();	// unmaps the file
+		asset.state = AssetState::Ready;
+		return true;
+	}
+}
+
+
+void initAssetStreaming(int ioThreadCount, size_t uploadBytesPerFrame)
+{
+	uploadBudget = uploadBytesPerFrame > 0 ? uploadBytesPerFrame : 1;
+	streaming = true;
+
+	int count = ioThreadCount > 0 ? ioThreadCount : 1;
+	for (int i = 0; i < count; ++i)
+		completed.push_back(std::make_unique<CompletedRing>());
+	for (int i = 0; i < count; ++i)
+		ioThreads.emplace_back(ioThread, i);
+}
+
+int requestMeshAsset(const char* path)
+{
+	int handle = static_cast<int>(assets.size());
+	assets.emplace_back();
+	assets.back().path = path;
+
+	if (!streaming)
+	{
+		std::cout << "Asset streaming is not running, can't load " << path << "\n";
+		assets.back().state = AssetState::Failed;
+		return handle;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(requestMutex);
+		requests.push_back({ handle, path });
+	}
+	++pendingAssets;
+	requestCondition.notify_one();
+	return handle;
+}
+
+bool pumpAssetStreaming()
+{
+	for (auto& ring : completed)
+	{
+		LoadedMesh* loaded;
+		while (ring->pop(loaded))
+		{
+			StreamedAsset& asset = assets[loaded->handle];
+			if (!loaded->valid)
+			{
+				asset.state = AssetState::Failed;	// MeshFile::open already said why
+				--pendingAssets;
+				delete loaded;
+				continue;
+			}
+			asset.loaded.reset(loaded);
+			asset.state = AssetState::Uploading;
+			uploadQueue.push_back(loaded->handle);
+		}
+	}
+
+	size_t budget = uploadBudget;
+	while (!uploadQueue.empty() && budget > 0)
+	{
+		if (!uploadAsset(assets[uploadQueue.front()], budget)) break;
+		uploadQueue.pop_front();
+		--pendingAssets;
+	}
+	return pendingAssets > 0;
+}
+
+AssetState assetState(int handle)
+{
+	if (handle < 0 || handle >= static_cast<int>(assets.size())) return AssetState::Failed;
+	return assets[handle].state;
+}
+
+const StreamedMesh* streamedMesh(int handle)
+{
+	if (assetState(handle) != AssetState::Ready) return nullptr;
+	return &assets[handle].mesh;
+}
+
+void cleanUpAssetStreaming()
+{
+	{
+		std::lock_guard<std::mutex> lock(requestMutex);
+		streaming = false;
+		requests.clear();
+	}
+	requestCondition.notify_all();
+	for (std::thread& thread : ioThreads)
+		thread.join();
+	ioThreads.clear();
+
+	for (auto& ring : completed)
+	{
+		LoadedMesh* loaded;
+		while (ring->pop(loaded))
+			delete loaded;
+	}
+	completed.clear();
+
+	uploadQueue.clear();
+	pendingAssets = 0;
+	assets.clear();		// the GPU resources go through the registry's deferred deletion
+}
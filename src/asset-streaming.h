@@ -0,0 +1,39 @@
+#ifndef ASSET_STREAMING_H
+#define ASSET_STREAMING_H
+
+#include <cstddef>
+
+// Background asset loading. IO threads open and validate mesh files (see mesh-file.h) and fault
+// their pages in, then hand them to the GL thread through one lock-free ring per IO thread.
+// pumpAssetStreaming uploads from the mapped files in pieces, never more than the per-frame byte
+// budget, so a large asset arriving spreads over several frames instead of causing a hitch.
+// Everything but the IO threads themselves runs on the thread that owns the context.
+
+enum class AssetState
+{
+	Loading,		// queued or being read by an IO thread
+	Uploading,
+	Ready,
+	Failed
+};
+
+struct StreamedMesh
+{
+	unsigned int vertexArray;
+	unsigned int indexType;
+	int indexCount;
+	bool quantizedPositions;
+	float positionScale[3];
+	float positionOffset[3];
+};
+
+void initAssetStreaming(int ioThreadCount, size_t uploadBytesPerFrame);
+// returns a handle right away; the mesh shows up some frames later
+int requestMeshAsset(const char* path);
+// once per frame; true while anything is still loading or uploading
+bool pumpAssetStreaming();
+AssetState assetState(int handle);
+const StreamedMesh* streamedMesh(int handle);	// nullptr until Ready
+void cleanUpAssetStreaming();
+
+#endif
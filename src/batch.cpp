@@ -0,0 +1,177 @@
+#include <glad/glad.h>
+#include "batch.h"
+#include "shader.h"
+#include "gpu-resources.h"
+#include "stream-buffer.h"
+#include "vertex-format.h"
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+	const char* batchVertexShaderSource = "#version 330 core\n"
+		"layout(location = 0) in vec3 aPos;\n"
+		"layout(location = 1) in vec4 aColor;\n"
+		"out vec4 color;\n"
+		"void main()\n"
+		"{\n"
+		"gl_Position = vec4(aPos, 1.0);\n"
+		"color = aColor;\n"
+		"}\0";
+
+	const char* batchFragmentShaderSource = "#version 330 core\n"
+		"in vec4 color;\n"
+		"out vec4 FragmentColor;\n"
+		"void main()\n"
+		"{\n"
+		"FragmentColor = color;\n"
+		"}\0";
+
+	// 16 bytes per vertex: the color is normalized unsigned bytes, not 4 floats
+	struct BatchVertex
+	{
+		float x, y, z;
+		unsigned char r, g, b, a;
+	};
+
+	using BatchFormat = VertexFormat<attribute::Float<3>, attribute::Unorm8<4>>;
+	static_assert(sizeof(BatchVertex) == BatchFormat::stride && offsetof(BatchVertex, r) == BatchFormat::offsets[1],
+		"BatchVertex doesn't match BatchFormat");
+
+	std::vector<BatchVertex> vertices;
+	std::vector<GLint> firsts;		// glMultiDrawArrays wants two parallel arrays
+	std::vector<GLsizei> counts;
+
+	ShaderProgramHandle batchProgram;
+	GpuVertexArray batchVAO;
+	GpuBuffer batchVBO;
+
+	StreamBuffer streamBuffer;
+	GpuVertexArray streamVAO;
+	std::vector<GLint> streamFirsts;	// firsts shifted to wherever this frame's vertices landed
+
+	unsigned char toUnorm8(float value)
+	{
+		value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+		return static_cast<unsigned char>(value * 255.0f + 0.5f);
+	}
+}
+
+
+bool batchInit()
+{
+	batchProgram = ShaderProgramHandle(requestShaderProgram(batchVertexShaderSource, batchFragmentShaderSource, "Batch"));
+	if (batchProgram.get() == -1) return false;
+
+	batchVAO = GpuVertexArray::create();
+	batchVBO = GpuBuffer::create();
+
+	glBindVertexArray(batchVAO.name());
+	glBindBuffer(GL_ARRAY_BUFFER, batchVBO.name());
+	BatchFormat::setup();
+
+	glBindVertexArray(0);
+	return true;
+}
+
+int batchAddShape(const float* positions, int vertexCount, const float color[3])
+{
+	firsts.push_back(static_cast<GLint>(vertices.size()));
+	counts.push_back(vertexCount);
+
+	BatchVertex vertex;
+	vertex.r = toUnorm8(color[0]);
+	vertex.g = toUnorm8(color[1]);
+	vertex.b = toUnorm8(color[2]);
+	vertex.a = 255;
+
+	for (int i = 0; i < vertexCount; ++i)
+	{
+		vertex.x = positions[3 * i];
+		vertex.y = positions[3 * i + 1];
+		vertex.z = positions[3 * i + 2];
+		vertices.push_back(vertex);
+	}
+
+	return static_cast<int>(counts.size()) - 1;
+}
+
+void batchUpload()
+{
+	gpuBufferData(batchVBO.handle(), GL_ARRAY_BUFFER, vertices.size() * sizeof(BatchVertex), vertices.data(), GL_STATIC_DRAW);
+}
+
+void batchDraw()
+{
+	if (counts.empty()) return;
+
+	glUseProgram(batchProgram.program());
+	glBindVertexArray(batchVAO.name());
+	glMultiDrawArrays(GL_TRIANGLES, firsts.data(), counts.data(), static_cast<GLsizei>(counts.size()));
+}
+
+bool batchEnableStreaming()
+{
+	if (!streamBuffer.init(GL_ARRAY_BUFFER, vertices.size() * sizeof(BatchVertex))) return false;
+
+	// attributes point at the start of the buffer, each frame's region is reached through firsts
+	streamVAO = GpuVertexArray::create();
+	glBindVertexArray(streamVAO.name());
+	glBindBuffer(GL_ARRAY_BUFFER, streamBuffer.buffer());
+	BatchFormat::setup();
+	glBindVertexArray(0);
+
+	streamFirsts.resize(firsts.size());
+	return true;
+}
+
+void batchStreamDraw(float time)
+{
+	if (counts.empty()) return;
+
+	// vertex-size alignment keeps the region start a whole number of vertices into the buffer
+	StreamAllocation allocation = streamBuffer.allocate(vertices.size() * sizeof(BatchVertex), sizeof(BatchVertex));
+	if (allocation.data == nullptr) return;
+
+	BatchVertex* out = static_cast<BatchVertex*>(allocation.data);
+	for (size_t shape = 0; shape < counts.size(); ++shape)
+	{
+		float sway = 0.02f * std::sin(2.0f * time + 0.7f * shape);
+		for (GLint v = firsts[shape]; v < firsts[shape] + counts[shape]; ++v)
+		{
+			out[v] = vertices[v];
+			out[v].x += sway;
+		}
+	}
+	streamBuffer.commit(allocation);
+
+	GLint baseVertex = static_cast<GLint>(allocation.offset / sizeof(BatchVertex));
+	for (size_t shape = 0; shape < firsts.size(); ++shape)
+		streamFirsts[shape] = firsts[shape] + baseVertex;
+
+	glUseProgram(batchProgram.program());
+	glBindVertexArray(streamVAO.name());
+	glMultiDrawArrays(GL_TRIANGLES, streamFirsts.data(), counts.data(), static_cast<GLsizei>(counts.size()));
+
+	streamBuffer.endFrame();
+}
+
+int batchShapeCount()
+{
+	return static_cast<int>(counts.size());
+}
+
+void batchCleanUp()
+{
+	batchVAO.reset();
+	batchVBO.reset();
+	batchProgram.reset();
+	streamVAO.reset();
+	streamBuffer.destroy();
+	streamFirsts.clear();
+
+	vertices.clear();
+	firsts.clear();
+	counts.clear();
+}
@@ -0,0 +1,18 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+// Batch renderer: every shape lives in one shared vertex buffer with its color baked into
+// the vertices, so a whole batch is one program, one VAO and one glMultiDrawArrays call
+
+bool batchInit();
+// positions are xyz triples; returns the draw index of the shape inside the batch
+int batchAddShape(const float* positions, int vertexCount, const float color[3]);
+void batchUpload();		// (re)packs all added shapes into the shared buffer
+void batchDraw();
+// streaming variant: the vertices are rewritten (animated) every frame through a StreamBuffer
+bool batchEnableStreaming();
+void batchStreamDraw(float time);
+int batchShapeCount();
+void batchCleanUp();
+
+#endif
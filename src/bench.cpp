@@ -0,0 +1,621 @@
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include "triangle.h"
+#include "offscreen.h"
+#include "batch.h"
+#include "instancing.h"
+#include "shader.h"
+#include "shader-assets.h"
+#include "gpu-resources.h"
+#include "state-cache.h"
+#include "render-queue.h"
+#include "uniform-buffer.h"
+#include "mock-gl.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Headless render-loop benchmarks: the same init + per-frame work as main.cpp's renderLoop, on GLFW's
+// null platform with an OSMesa context (llvmpipe), for a handful of fixed scenes. Every scene reports
+// frames/s, the CPU time spent issuing its draws per shape drawn (so a batched draw of 100k shapes is
+// comparable to 100k separate draws) and the heap allocations per frame;
+// --json writes them out and --baseline compares against an earlier --json file. Before the scenes,
+// the eager and the lazy glad loader are timed against each other. With --mock-gl everything runs
+// against the mock GL driver instead, no GPU or window needed, and the cost model's GPU time and the
+// GL calls per frame are reported as well; those are what a mock run compares instead of the timings.
+
+namespace
+{
+	std::atomic<unsigned long long> allocationCount{ 0 };
+	int procLookups = 0;
+
+	enum class SceneKind
+	{
+		Separate,		// one draw per triangle through the render queue, like --mode separate
+		Batched,
+		Instanced
+	};
+
+	struct Scene
+	{
+		const char* name;
+		SceneKind kind;
+		int triangles;
+		int programs;		// separate scenes: how many distinct programs the draws cycle through
+	};
+
+	const Scene scenes[] = {
+		{ "triangles-1", SceneKind::Separate, 1, 1 },
+		{ "triangles-1k", SceneKind::Separate, 1000, 1 },
+		{ "triangles-100k", SceneKind::Separate, 100000, 1 },
+		{ "batched-100k", SceneKind::Batched, 100000, 1 },
+		{ "instanced-100k", SceneKind::Instanced, 100000, 1 },
+		{ "programs-64", SceneKind::Separate, 1000, 64 },
+	};
+
+	struct SceneResult
+	{
+		const char* name;
+		int triangles;
+		int drawsPerFrame;
+		int frames;
+		double framesPerSecond;
+		double nsPerShape;			// CPU time issuing the frame's draws over the shapes they drew
+		double allocationsPerFrame;
+		double gpuMsPerFrame;		// --mock-gl only, from the cost model
+		double glCallsPerFrame;		// --mock-gl only
+	};
+
+	struct LoaderResult
+	{
+		const char* name;
+		int lookups;			// glfwGetProcAddress calls made while loading
+		double microseconds;
+	};
+
+	const int loaderRuns = 50;
+
+	struct BenchOptions
+	{
+		int frames = 200;
+		int warmupFrames = 20;
+		const char* sceneFilter = nullptr;		// only scenes whose name contains this
+		const char* jsonPath = nullptr;
+		const char* baselinePath = nullptr;
+		double tolerance = 0.1;					// how much slower than the baseline still passes
+		bool stateCache = true;
+		bool lazyGlLoading = true;
+		bool mockGl = false;
+	};
+
+	const int width = 800;
+	const int height = 600;
+
+	const char* benchVertexShaderSource = "#version 330 core\n"
+		"layout(location = 0) in vec3 aPos;\n"
+		"void main()\n"
+		"{\n"
+		"gl_Position = vec4(aPos, 1.0);\n"
+		"}\n";
+
+	void printUsage(const char* program)
+	{
+		std::cout << "Usage: " << program << " [options]\n"
+			"  --frames N          measured frames per scene (default 200)\n"
+			"  --warmup N          frames rendered before measuring (default 20)\n"
+			"  --scene NAME        only run scenes whose name contains NAME\n"
+			"  --json FILE         write the results as JSON\n"
+			"  --baseline FILE     compare against an earlier --json file, exit with 1 on a regression\n"
+			"                      or if FILE is missing; with --mock-gl no timings are compared\n"
+			"  --tolerance PCT     allowed fps / ns per shape (mock GPU time) regression in percent, default 10\n"
+			"  --no-state-cache    issue every GL state change, like the example's --no-state-cache\n"
+			"  --eager-gl          run the scenes with every GL function looked up up front\n"
+			"  --mock-gl           run against the mock GL driver, no GPU or window needed\n";
+	}
+
+	bool parseBenchOptions(int argc, char** argv, BenchOptions& options)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			const char* arg = argv[i];
+			bool hasValue = i + 1 < argc;
+
+			if (std::strcmp(arg, "--frames") == 0 && hasValue)
+				options.frames = std::atoi(argv[++i]);
+			else if (std::strcmp(arg, "--warmup") == 0 && hasValue)
+				options.warmupFrames = std::atoi(argv[++i]);
+			else if (std::strcmp(arg, "--scene") == 0 && hasValue)
+				options.sceneFilter = argv[++i];
+			else if (std::strcmp(arg, "--json") == 0 && hasValue)
+				options.jsonPath = argv[++i];
+			else if (std::strcmp(arg, "--baseline") == 0 && hasValue)
+				options.baselinePath = argv[++i];
+			else if (std::strcmp(arg, "--tolerance") == 0 && hasValue)
+				options.tolerance = std::atof(argv[++i]) / 100.0;
+			else if (std::strcmp(arg, "--no-state-cache") == 0)
+				options.stateCache = false;
+			else if (std::strcmp(arg, "--eager-gl") == 0)
+				options.lazyGlLoading = false;
+			else if (std::strcmp(arg, "--mock-gl") == 0)
+				options.mockGl = true;
+			else
+			{
+				printUsage(argv[0]);
+				return false;
+			}
+		}
+
+		if (options.frames <= 0 || options.warmupFrames < 0 || options.tolerance < 0.0)
+		{
+			printUsage(argv[0]);
+			return false;
+		}
+		return true;
+	}
+
+	void* glfwProcAddress(const char* name)
+	{
+		return reinterpret_cast<void*>(glfwGetProcAddress(name));
+	}
+
+	GLADloadproc procAddress = glfwProcAddress;		// mockGlGetProcAddress with --mock-gl
+
+	void* countingGetProcAddress(const char* name)
+	{
+		++procLookups;
+		return procAddress(name);
+	}
+
+	LoaderResult timeLoader(const char* name, int (*loader)(GLADloadproc))
+	{
+		procLookups = 0;
+		auto start = std::chrono::steady_clock::now();
+		for (int run = 0; run < loaderRuns; ++run)
+			loader(countingGetProcAddress);
+		double elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+		return { name, procLookups / loaderRuns, elapsed / loaderRuns };
+	}
+
+	bool loadGl(const BenchOptions& options, std::vector<LoaderResult>& loaders)
+	{
+		loaders.push_back(timeLoader("loader-eager", gladLoadGLLoader));
+		loaders.push_back(timeLoader("loader-lazy", gladLoadGLLoaderLazy));
+
+		// the lookups made from here on are what lazy loading really costs over the run
+		procLookups = 0;
+		int loaded = options.lazyGlLoading ? gladLoadGLLoaderLazy(countingGetProcAddress) : gladLoadGLLoader(countingGetProcAddress);
+		if (!loaded)
+		{
+			std::cout << "Failed to initialize GLAD" << std::endl;
+			return false;
+		}
+		if (options.stateCache)
+			installStateCache();
+		return true;
+	}
+
+	GLFWwindow* headlessWindowInit(const BenchOptions& options, std::vector<LoaderResult>& loaders)
+	{
+		glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+		if (!glfwInit())
+		{
+			std::cout << "Failed to initialize GLFW" << std::endl;
+			return nullptr;
+		}
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+		glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+		glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+		glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+
+		GLFWwindow* window = glfwCreateWindow(width, height, "Benchmark", nullptr, nullptr);
+		if (window == nullptr)
+		{
+			std::cout << "Failed to create GLFW window" << std::endl;
+			return nullptr;
+		}
+		glfwMakeContextCurrent(window);
+		glfwSwapInterval(0);
+		return loadGl(options, loaders) ? window : nullptr;
+	}
+
+	// the benchmark measures drawing, not compiling, so wait for everything to be linked
+	void waitForPrograms()
+	{
+		while (shaderProgramsPending())
+		{
+			pollShaderPrograms();
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	}
+
+	// the triangle fragment shader, scaled by a per-program constant so no two programs are the same
+	std::vector<ShaderProgramHandle> requestProgramVariants(int count)
+	{
+		std::vector<ShaderProgramHandle> variants;
+		for (int i = 0; i < count; ++i)
+		{
+			std::ostringstream fragmentSource;
+			fragmentSource << "#version 330 core\n"
+				"out vec4 FragmentColor;\n"
+				"layout(std140) uniform Material\n"
+				"{\n"
+				"vec4 color;\n"
+				"};\n"
+				"void main()\n"
+				"{\n"
+				"FragmentColor = color * " << (i + 1.0f) / count << ";\n"
+				"}\n";
+			std::string name = "Benchmark program " + std::to_string(i);
+			variants.emplace_back(requestShaderProgram(benchVertexShaderSource, fragmentSource.str().c_str(), name.c_str()));
+		}
+		return variants;
+	}
+
+	// returns false if the scene couldn't be set up, result is left alone then
+	bool runScene(GLFWwindow* window, const Scene& scene, const BenchOptions& options, int triangleProgram, unsigned int VAOs[2],
+		SceneResult& result)
+	{
+		std::vector<ShaderProgramHandle> variants;
+		std::vector<int> programs(1, triangleProgram);
+		bool ready = true;
+		if (scene.kind == SceneKind::Separate && scene.programs > 1)
+		{
+			variants = requestProgramVariants(scene.programs);
+			programs.clear();
+			for (const ShaderProgramHandle& variant : variants)
+				programs.push_back(variant.get());
+		}
+		else if (scene.kind == SceneKind::Batched)
+			ready = initBatchedTriangles(scene.triangles);
+		else if (scene.kind == SceneKind::Instanced)
+			ready = initInstancedTriangles(scene.triangles);
+		if (!ready)
+		{
+			if (scene.kind == SceneKind::Batched)
+				batchCleanUp();
+			else
+				instancingCleanUp();
+			return false;
+		}
+		waitForPrograms();
+
+		RenderQueue renderQueue;
+		int drawsPerFrame = scene.kind == SceneKind::Separate ? scene.triangles : 1;
+		std::chrono::steady_clock::duration drawTime{};
+		unsigned long long allocationsBefore = 0;
+		MockGlStats mockBefore = {};
+		auto start = std::chrono::steady_clock::now();
+
+		for (int frame = 0; frame < options.warmupFrames + options.frames; ++frame)
+		{
+			if (frame == options.warmupFrames)
+			{
+				glFinish();		// nothing of the warmup may spill into the measured frames
+				drawTime = {};
+				allocationsBefore = allocationCount.load(std::memory_order_relaxed);
+				if (options.mockGl) mockBefore = mockGlStats();
+				start = std::chrono::steady_clock::now();
+			}
+
+			glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+			glClear(GL_COLOR_BUFFER_BIT);
+			uploadTriangleMaterials();
+
+			auto drawStart = std::chrono::steady_clock::now();
+			float time = static_cast<float>(frame) / 60.0f;		// animated scenes move the same way every run
+			if (scene.kind == SceneKind::Separate)
+			{
+				for (int i = 0; i < scene.triangles; ++i)
+					renderQueue.submit({ programs[i % programs.size()], VAOs[i % 2], triangleMaterial(i), GL_TRIANGLES, 0, 3 });
+				renderQueue.flush();
+			}
+			else if (scene.kind == SceneKind::Batched)
+				batchDraw();
+			else
+				drawInstancedTriangles(time);
+			drawTime += std::chrono::steady_clock::now() - drawStart;
+
+			uniformRingEndFrame();
+			if (window != nullptr)
+			{
+				glfwSwapBuffers(window);
+				glfwPollEvents();
+			}
+			flushGpuDeletions();
+		}
+
+		glFinish();
+		double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		unsigned long long allocations = allocationCount.load(std::memory_order_relaxed) - allocationsBefore;
+
+		if (scene.kind == SceneKind::Batched)
+			batchCleanUp();
+		else if (scene.kind == SceneKind::Instanced)
+			instancingCleanUp();
+
+		result.name = scene.name;
+		result.triangles = scene.triangles;
+		result.drawsPerFrame = drawsPerFrame;
+		result.frames = options.frames;
+		result.framesPerSecond = elapsed > 0.0 ? options.frames / elapsed : 0.0;
+		result.nsPerShape = std::chrono::duration<double, std::nano>(drawTime).count() / (static_cast<double>(options.frames) * scene.triangles);
+		result.allocationsPerFrame = static_cast<double>(allocations) / options.frames;
+		result.gpuMsPerFrame = 0.0;
+		result.glCallsPerFrame = 0.0;
+		if (options.mockGl)
+		{
+			MockGlStats mockAfter = mockGlStats();
+			result.gpuMsPerFrame = (mockAfter.gpuNanoseconds - mockBefore.gpuNanoseconds) / 1e6 / options.frames;
+			result.glCallsPerFrame = static_cast<double>(mockAfter.calls - mockBefore.calls) / options.frames;
+		}
+		return true;
+	}
+
+	bool writeJson(const char* path, const std::vector<LoaderResult>& loaders, const std::vector<SceneResult>& results, bool mockGl)
+	{
+		std::ofstream file(path);
+		if (!file)
+		{
+			std::cout << "Failed to open " << path << " for writing\n";
+			return false;
+		}
+
+		file << "{\n\t\"loaders\": [\n";
+		for (size_t i = 0; i < loaders.size(); ++i)
+		{
+			const LoaderResult& loader = loaders[i];
+			file << "\t\t{ \"name\": \"" << loader.name << "\", \"lookups\": " << loader.lookups << ", \"us\": " << loader.microseconds
+				<< " }" << (i + 1 < loaders.size() ? "," : "") << "\n";
+		}
+		file << "\t],\n\t\"scenes\": [\n";
+		for (size_t i = 0; i < results.size(); ++i)
+		{
+			const SceneResult& result = results[i];
+			file << "\t\t{ \"name\": \"" << result.name << "\", \"triangles\": " << result.triangles
+				<< ", \"drawsPerFrame\": " << result.drawsPerFrame << ", \"frames\": " << result.frames
+				<< ", \"fps\": " << result.framesPerSecond << ", \"nsPerShape\": " << result.nsPerShape
+				<< ", \"allocationsPerFrame\": " << result.allocationsPerFrame;
+			if (mockGl)
+				file << ", \"gpuMsPerFrame\": " << result.gpuMsPerFrame << ", \"glCallsPerFrame\": " << result.glCallsPerFrame;
+			file << " }" << (i + 1 < results.size() ? "," : "") << "\n";
+		}
+		file << "\t]\n}\n";
+		return true;
+	}
+
+	// not a JSON parser: it only reads back what writeJson wrote, one scene object per line
+	bool baselineValue(const std::string& baseline, const char* scene, const char* key, double& value)
+	{
+		size_t begin = baseline.find("\"name\": \"" + std::string(scene) + "\"");
+		if (begin == std::string::npos) return false;
+		size_t end = baseline.find('}', begin);
+		size_t field = baseline.find("\"" + std::string(key) + "\": ", begin);
+		if (field == std::string::npos || field > end) return false;
+
+		value = std::strtod(baseline.c_str() + field + std::strlen(key) + 4, nullptr);
+		return true;
+	}
+
+	// returns false if anything regressed beyond the tolerance or there is nothing to compare against. Timings
+	// only mean something against a baseline from the same machine; the mock driver's numbers are the same
+	// everywhere, so a --mock-gl run compares those (and the allocations and lookups) and no timings at all
+	bool compareWithBaseline(const char* path, const std::vector<LoaderResult>& loaders, const std::vector<SceneResult>& results, double tolerance,
+		bool mockGl)
+	{
+		std::ifstream file(path);
+		if (!file)
+		{
+			std::cout << "No baseline at " << path << ", store one with --json to compare future runs against\n";
+			return false;
+		}
+		std::stringstream contents;
+		contents << file.rdbuf();
+		const std::string baseline = contents.str();
+
+		bool passed = true;
+		for (const LoaderResult& loader : loaders)
+		{
+			double lookups, microseconds = 0.0;
+			if (!baselineValue(baseline, loader.name, "lookups", lookups) || (!mockGl && !baselineValue(baseline, loader.name, "us", microseconds)))
+			{
+				std::cout << loader.name << ": not in the baseline\n";
+				continue;
+			}
+
+			if (loader.lookups > lookups || (!mockGl && loader.microseconds > microseconds * (1.0 + tolerance)))
+			{
+				std::cout << loader.name << ": REGRESSION, baseline " << lookups << " lookups";
+				if (!mockGl)
+					std::cout << " in " << microseconds << " us";
+				std::cout << "\n";
+				passed = false;
+			}
+		}
+
+		for (const SceneResult& result : results)
+		{
+			double allocationsPerFrame, first, second;
+			const char* firstKey = mockGl ? "gpuMsPerFrame" : "fps";
+			const char* secondKey = mockGl ? "glCallsPerFrame" : "nsPerShape";
+			if (!baselineValue(baseline, result.name, "allocationsPerFrame", allocationsPerFrame)
+				|| !baselineValue(baseline, result.name, firstKey, first) || !baselineValue(baseline, result.name, secondKey, second))
+			{
+				std::cout << result.name << ": not in the baseline\n";
+				continue;
+			}
+
+			// allocations are deterministic, any new one per frame counts, and so do the mock's GL calls
+			bool allocates = result.allocationsPerFrame > allocationsPerFrame + 0.5;
+			if (mockGl)
+			{
+				bool gpuSlower = result.gpuMsPerFrame > first * (1.0 + tolerance);
+				bool moreCalls = result.glCallsPerFrame > second + 0.5;
+				if (gpuSlower || moreCalls || allocates)
+				{
+					std::cout << result.name << ": REGRESSION" << (gpuSlower ? " (mock GPU time)" : "") << (moreCalls ? " (GL calls)" : "")
+						<< (allocates ? " (allocations)" : "") << ", baseline " << first << " mock GPU ms per frame, " << second
+						<< " GL calls per frame, " << allocationsPerFrame << " allocations per frame\n";
+					passed = false;
+				}
+			}
+			else
+			{
+				bool slower = result.framesPerSecond < first * (1.0 - tolerance);
+				bool costlier = result.nsPerShape > second * (1.0 + tolerance);
+				if (slower || costlier || allocates)
+				{
+					std::cout << result.name << ": REGRESSION" << (slower ? " (frames/s)" : "") << (costlier ? " (ns per shape)" : "")
+						<< (allocates ? " (allocations)" : "") << ", baseline " << first << " frames/s, " << second << " ns per shape, "
+						<< allocationsPerFrame << " allocations per frame\n";
+					passed = false;
+				}
+			}
+		}
+		return passed;
+	}
+
+	// every clean-up copes with a partial init, so this is fine on the early returns too
+	void cleanUpBench()
+	{
+		cleanUpShaderAssets();
+		cleanUpShadersAndVAOs();
+		cleanUpOffscreenFramebuffer();
+		cleanUpShaderPipeline();
+		uniformRingCleanUp();
+		cleanUpGpuResources();
+	}
+}
+
+// every heap allocation made through new is counted, the benchmark reports them per frame
+void* operator new(size_t size)
+{
+	allocationCount.fetch_add(1, std::memory_order_relaxed);
+	if (void* memory = std::malloc(size > 0 ? size : 1))
+		return memory;
+	throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept
+{
+	std::free(memory);
+}
+
+
+
+int main(int argc, char** argv)
+{
+	BenchOptions options;
+	if (!parseBenchOptions(argc, argv, options)) return -1;
+
+	std::vector<LoaderResult> loaders;
+	GLFWwindow* window = nullptr;		// stays null with --mock-gl, there's nothing to swap
+	bool contextReady;
+	if (options.mockGl)
+	{
+		procAddress = mockGlGetProcAddress;
+		contextReady = loadGl(options, loaders);
+		if (contextReady)
+			glViewport(0, 0, width, height);	// a real context starts out with its window's size
+	}
+	else
+	{
+		window = headlessWindowInit(options, loaders);
+		contextReady = window != nullptr;
+	}
+	if (!contextReady)
+	{
+		glfwTerminate();
+		return -1;
+	}
+
+	// the shader files are found through their absolute path, wherever the benchmark is run from
+	initShaderAssets(SHADER_DIRECTORY, false);
+
+	int statusCode = 0;
+	int triangleProgram = -1;
+	if (initOffscreenFramebuffer(width, height) && initShaderPipeline() && uniformRingInit(64 * 1024))
+		triangleProgram = initShaders(statusCode).first;	// both triangles share it
+	if (triangleProgram == -1 || statusCode == -1)
+	{
+		cleanUpBench();
+		glfwTerminate();
+		return -1;
+	}
+	auto [VAO1, VAO2] = initVAOs();
+	unsigned int VAOs[2] = { VAO1, VAO2 };
+
+	for (const LoaderResult& loader : loaders)
+		std::printf("%-16s %8d lookups %10.1f us\n", loader.name, loader.lookups, loader.microseconds);
+
+	std::vector<SceneResult> results;
+	bool passed = true;
+	for (const Scene& scene : scenes)
+	{
+		if (options.sceneFilter != nullptr && std::strstr(scene.name, options.sceneFilter) == nullptr)
+			continue;
+
+		SceneResult result;
+		if (!runScene(window, scene, options, triangleProgram, VAOs, result))
+		{
+			std::printf("%-16s failed to set up\n", scene.name);
+			passed = false;
+			continue;
+		}
+		std::printf("%-16s %8.1f frames/s %10.1f ns/shape %8.2f allocations/frame\n", result.name, result.framesPerSecond,
+			result.nsPerShape, result.allocationsPerFrame);
+		if (options.mockGl)
+			std::printf("%-16s %8.3f mock GPU ms/frame %8.1f GL calls/frame\n", "", result.gpuMsPerFrame, result.glCallsPerFrame);
+		results.push_back(result);
+	}
+
+	if (options.lazyGlLoading)
+		std::printf("lazy loading looked up %d functions over the whole run\n", procLookups);
+
+	if (options.jsonPath != nullptr)
+		passed = writeJson(options.jsonPath, loaders, results, options.mockGl) && passed;
+	if (options.baselinePath != nullptr)
+		passed = compareWithBaseline(options.baselinePath, loaders, results, options.tolerance, options.mockGl) && passed;
+
+	cleanUpBench();
+
+	// a GL error is a bug in the code under test; objects left alive after clean-up are leaks
+	if (options.mockGl)
+	{
+		MockGlStats mock = mockGlStats();
+		std::printf("mock GL: %llu errors, %llu objects still alive\n", mock.errors, mock.liveObjects);
+		passed = passed && mock.errors == 0 && mock.liveObjects == 0;
+	}
+
+	glfwTerminate();
+	return passed ? 0 : 1;
+}
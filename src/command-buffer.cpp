@@ -0,0 +1,180 @@
+#include <glad/glad.h>
+#include "command-buffer.h"
+#include "shader.h"
+#include <cstring>
+
+namespace
+{
+	const size_t chunkSize = 64 * 1024;
+	const size_t commandAlignment = 8;
+
+	// every command starts with one of these, the payload follows right after it
+	struct CommandHeader
+	{
+		CommandType type;
+		std::uint32_t size;		// header + payload, padded to commandAlignment
+	};
+
+	struct ClearCommand { float color[4]; };
+	struct ViewportCommand { GLint x, y; GLsizei width, height; };
+	struct UseProgramCommand { int programHandle; };
+	struct BindVertexArrayCommand { GLuint vertexArray; };
+	struct DrawArraysCommand { GLenum mode; GLint first; GLsizei count; };
+	struct DrawElementsCommand { GLenum mode; GLsizei count; GLenum indexType; size_t indexOffset; };
+	struct CallbackCommand { void (*function)(const void*); size_t payloadSize; };
+
+	size_t alignUp(size_t value)
+	{
+		return (value + commandAlignment - 1) & ~(commandAlignment - 1);
+	}
+
+	const size_t headerSize = alignUp(sizeof(CommandHeader));
+}
+
+
+void* CommandBuffer::allocate(CommandType type, size_t payloadSize)
+{
+	size_t size = headerSize + alignUp(payloadSize);
+
+	while (currentChunk_ < chunks_.size() && chunks_[currentChunk_].used + size > chunks_[currentChunk_].capacity)
+		++currentChunk_;
+	if (currentChunk_ == chunks_.size())
+	{
+		Chunk chunk;
+		chunk.capacity = size > chunkSize ? size : chunkSize;
+		chunk.data.reset(new unsigned char[chunk.capacity]);
+		chunks_.push_back(std::move(chunk));
+	}
+
+	Chunk& chunk = chunks_[currentChunk_];
+	unsigned char* command = chunk.data.get() + chunk.used;
+	chunk.used += size;
+	++commandCount_;
+
+	CommandHeader* header = reinterpret_cast<CommandHeader*>(command);
+	header->type = type;
+	header->size = static_cast<std::uint32_t>(size);
+	return command + headerSize;
+}
+
+void CommandBuffer::clear(float red, float green, float blue, float alpha)
+{
+	auto* command = static_cast<ClearCommand*>(allocate(CommandType::Clear, sizeof(ClearCommand)));
+	command->color[0] = red;
+	command->color[1] = green;
+	command->color[2] = blue;
+	command->color[3] = alpha;
+}
+
+void CommandBuffer::viewport(int x, int y, int width, int height)
+{
+	auto* command = static_cast<ViewportCommand*>(allocate(CommandType::Viewport, sizeof(ViewportCommand)));
+	*command = { x, y, width, height };
+}
+
+void CommandBuffer::useProgram(int programHandle)
+{
+	auto* command = static_cast<UseProgramCommand*>(allocate(CommandType::UseProgram, sizeof(UseProgramCommand)));
+	command->programHandle = programHandle;
+}
+
+void CommandBuffer::bindVertexArray(unsigned int vertexArray)
+{
+	auto* command = static_cast<BindVertexArrayCommand*>(allocate(CommandType::BindVertexArray, sizeof(BindVertexArrayCommand)));
+	command->vertexArray = vertexArray;
+}
+
+void CommandBuffer::drawArrays(unsigned int mode, int first, int count)
+{
+	auto* command = static_cast<DrawArraysCommand*>(allocate(CommandType::DrawArrays, sizeof(DrawArraysCommand)));
+	*command = { mode, first, count };
+}
+
+void CommandBuffer::drawElements(unsigned int mode, int count, unsigned int indexType, size_t indexOffset)
+{
+	auto* command = static_cast<DrawElementsCommand*>(allocate(CommandType::DrawElements, sizeof(DrawElementsCommand)));
+	*command = { mode, count, indexType, indexOffset };
+}
+
+void CommandBuffer::callback(void (*function)(const void*), const void* payload, size_t payloadSize)
+{
+	auto* command = static_cast<CallbackCommand*>(allocate(CommandType::Callback, alignUp(sizeof(CallbackCommand)) + payloadSize));
+	command->function = function;
+	command->payloadSize = payloadSize;
+	if (payloadSize > 0)
+		std::memcpy(reinterpret_cast<unsigned char*>(command) + alignUp(sizeof(CallbackCommand)), payload, payloadSize);
+}
+
+void CommandBuffer::execute() const
+{
+	for (size_t i = 0; i <= currentChunk_ && i < chunks_.size(); ++i)
+	{
+		const unsigned char* command = chunks_[i].data.get();
+		const unsigned char* end = command + chunks_[i].used;
+
+		while (command < end)
+		{
+			const CommandHeader* header = reinterpret_cast<const CommandHeader*>(command);
+			const void* payload = command + headerSize;
+
+			switch (header->type)
+			{
+			case CommandType::Clear:
+			{
+				const auto* clear = static_cast<const ClearCommand*>(payload);
+				glClearColor(clear->color[0], clear->color[1], clear->color[2], clear->color[3]);
+				glClear(GL_COLOR_BUFFER_BIT);
+				break;
+			}
+			case CommandType::Viewport:
+			{
+				const auto* viewport = static_cast<const ViewportCommand*>(payload);
+				glViewport(viewport->x, viewport->y, viewport->width, viewport->height);
+				break;
+			}
+			case CommandType::UseProgram:
+				glUseProgram(shaderProgram(static_cast<const UseProgramCommand*>(payload)->programHandle));
+				break;
+			case CommandType::BindVertexArray:
+				glBindVertexArray(static_cast<const BindVertexArrayCommand*>(payload)->vertexArray);
+				break;
+			case CommandType::DrawArrays:
+			{
+				const auto* draw = static_cast<const DrawArraysCommand*>(payload);
+				glDrawArrays(draw->mode, draw->first, draw->count);
+				break;
+			}
+			case CommandType::DrawElements:
+			{
+				const auto* draw = static_cast<const DrawElementsCommand*>(payload);
+				glDrawElements(draw->mode, draw->count, draw->indexType, (void*)draw->indexOffset);
+				break;
+			}
+			case CommandType::Callback:
+			{
+				const auto* call = static_cast<const CallbackCommand*>(payload);
+				call->function(static_cast<const unsigned char*>(payload) + alignUp(sizeof(CallbackCommand)));
+				break;
+			}
+			}
+
+			command += header->size;
+		}
+	}
+}
+
+void CommandBuffer::reset()
+{
+	for (Chunk& chunk : chunks_)
+		chunk.used = 0;
+	currentChunk_ = 0;
+	commandCount_ = 0;
+}
+
+size_t CommandBuffer::bytesUsed() const
+{
+	size_t bytes = 0;
+	for (const Chunk& chunk : chunks_)
+		bytes += chunk.used;
+	return bytes;
+}
@@ -0,0 +1,64 @@
+#ifndef COMMAND_BUFFER_H
+#define COMMAND_BUFFER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Recorded list of draw and state commands. Recording makes no GL calls, so any thread can fill a
+// buffer; execute() then replays it on the thread that owns the context. Commands are packed back
+// to back into chunks handed out by a linear allocator, and reset() only rewinds it, so a buffer
+// that is reused every frame stops allocating after the first few.
+
+enum class CommandType : std::uint8_t
+{
+	Clear,
+	Viewport,
+	UseProgram,
+	BindVertexArray,
+	DrawArrays,
+	DrawElements,
+	Callback
+};
+
+class CommandBuffer
+{
+public:
+	CommandBuffer() = default;
+
+	CommandBuffer(const CommandBuffer&) = delete;
+	CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+	void clear(float red, float green, float blue, float alpha);
+	void viewport(int x, int y, int width, int height);
+	// a shader pipeline handle, resolved at replay time since the program may still be linking
+	void useProgram(int programHandle);
+	void bindVertexArray(unsigned int vertexArray);
+	void drawArrays(unsigned int mode, int first, int count);
+	void drawElements(unsigned int mode, int count, unsigned int indexType, size_t indexOffset);
+	// anything not covered above; the payload is copied into the buffer and passed back on replay
+	void callback(void (*function)(const void* payload), const void* payload, size_t payloadSize);
+
+	void execute() const;		// GL thread only
+	void reset();
+
+	int commandCount() const { return commandCount_; }
+	size_t bytesUsed() const;
+
+private:
+	struct Chunk
+	{
+		std::unique_ptr<unsigned char[]> data;
+		size_t capacity = 0;
+		size_t used = 0;
+	};
+
+	void* allocate(CommandType type, size_t payloadSize);
+
+	std::vector<Chunk> chunks_;
+	size_t currentChunk_ = 0;
+	int commandCount_ = 0;
+};
+
+#endif
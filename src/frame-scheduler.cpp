@@ -0,0 +1,146 @@
+#include <GLFW/glfw3.h>
+#include "frame-scheduler.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+
+namespace
+{
+	PacingMode pacingMode = PacingMode::Uncapped;
+	std::atomic<bool> damaged{ true };		// the first frame always needs drawing; the render thread sets it too
+
+	std::uint64_t timerFrequency;
+	std::uint64_t frameTicks;			// target frame duration
+	std::uint64_t nextDeadline;
+	// how much earlier than the deadline to stop sleeping and start spinning; grows with the
+	// sleep overshoot this OS actually shows (≈0.1 ms on Linux, up to a timer tick on Windows)
+	double spinMarginSeconds = 0.002;
+
+	// on-demand idles in here; a bounded timeout keeps glfwWindowShouldClose responsive
+	const double idleWaitSeconds = 0.5;
+
+	void damageCallback(GLFWwindow*)
+	{
+		damaged = true;
+	}
+
+	void keyCallback(GLFWwindow*, int, int, int, int) { damaged = true; }
+	void charCallback(GLFWwindow*, unsigned int) { damaged = true; }
+	void mouseButtonCallback(GLFWwindow*, int, int, int) { damaged = true; }
+	void cursorPosCallback(GLFWwindow*, double, double) { damaged = true; }
+	void scrollCallback(GLFWwindow*, double, double) { damaged = true; }
+	void focusCallback(GLFWwindow*, int) { damaged = true; }
+	void sizeCallback(GLFWwindow*, int, int) { damaged = true; }
+
+	double toSeconds(std::uint64_t ticks)
+	{
+		return static_cast<double>(ticks) / timerFrequency;
+	}
+
+	void waitUntil(std::uint64_t deadline)
+	{
+		std::uint64_t now = glfwGetTimerValue();
+		if (now >= deadline) return;
+
+		// coarse part: sleep, and learn from how late the OS wakes us up
+		double sleepSeconds = toSeconds(deadline - now) - spinMarginSeconds;
+		if (sleepSeconds > 0.0)
+		{
+			std::uint64_t beforeSleep = glfwGetTimerValue();
+			std::this_thread::sleep_for(std::chrono::duration<double>(sleepSeconds));
+			double overshoot = toSeconds(glfwGetTimerValue() - beforeSleep) - sleepSeconds;
+
+			double wanted = overshoot * 1.5 + 0.0002;
+			spinMarginSeconds = wanted > spinMarginSeconds ? wanted : spinMarginSeconds * 0.95 + wanted * 0.05;
+			spinMarginSeconds = spinMarginSeconds < 0.0005 ? 0.0005 : (spinMarginSeconds > 0.02 ? 0.02 : spinMarginSeconds);
+		}
+
+		// fine part: spin the last fraction of a millisecond
+		while (glfwGetTimerValue() < deadline)
+			std::this_thread::yield();
+	}
+}
+
+
+void initFrameScheduler(GLFWwindow* window, PacingMode mode, double targetFps)
+{
+	pacingMode = mode;
+	damaged = true;
+	timerFrequency = glfwGetTimerFrequency();
+	frameTicks = static_cast<std::uint64_t>(timerFrequency / (targetFps > 0.0 ? targetFps : 60.0));
+	nextDeadline = glfwGetTimerValue() + frameTicks;
+
+	switch (mode)
+	{
+	case PacingMode::VSync:
+	case PacingMode::OnDemand:
+		glfwSwapInterval(1);
+		break;
+	case PacingMode::AdaptiveVsync:
+		// negative intervals are only honoured with the swap_control_tear extensions
+		if (glfwExtensionSupported("WGL_EXT_swap_control_tear") || glfwExtensionSupported("GLX_EXT_swap_control_tear"))
+			glfwSwapInterval(-1);
+		else
+		{
+			std::cout << "Adaptive vsync is not supported here, using regular vsync\n";
+			glfwSwapInterval(1);
+		}
+		break;
+	case PacingMode::Uncapped:
+	case PacingMode::Capped:
+		glfwSwapInterval(0);
+		break;
+	}
+
+	if (mode == PacingMode::OnDemand)
+	{
+		// anything that could change what's on screen; refresh is where window damage arrives
+		glfwSetWindowRefreshCallback(window, damageCallback);
+		glfwSetKeyCallback(window, keyCallback);
+		glfwSetCharCallback(window, charCallback);
+		glfwSetMouseButtonCallback(window, mouseButtonCallback);
+		glfwSetCursorPosCallback(window, cursorPosCallback);
+		glfwSetScrollCallback(window, scrollCallback);
+		glfwSetWindowFocusCallback(window, focusCallback);
+		glfwSetWindowSizeCallback(window, sizeCallback);
+	}
+}
+
+bool frameSchedulerBeginFrame()
+{
+	if (pacingMode != PacingMode::OnDemand) return true;
+
+	if (!damaged)
+		glfwWaitEventsTimeout(idleWaitSeconds);	// the process sleeps here while nothing happens
+
+	return damaged.exchange(false);
+}
+
+void frameSchedulerPollEvents()
+{
+	// on-demand waits at the top of the loop instead, anything arriving here just marks damage
+	glfwPollEvents();
+}
+
+void frameSchedulerEndFrame()
+{
+	if (pacingMode != PacingMode::Capped) return;
+
+	waitUntil(nextDeadline);
+
+	// a frame that overran by more than a whole period starts a fresh schedule instead of
+	// rushing out several frames back to back to catch up
+	std::uint64_t now = glfwGetTimerValue();
+	nextDeadline += frameTicks;
+	if (nextDeadline + frameTicks < now)
+		nextDeadline = now + frameTicks;
+}
+
+void requestRedraw()
+{
+	damaged = true;
+	if (pacingMode == PacingMode::OnDemand)
+		glfwPostEmptyEvent();	// wakes glfwWaitEventsTimeout when this comes from another thread
+}
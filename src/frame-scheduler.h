@@ -0,0 +1,23 @@
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+struct GLFWwindow;
+
+enum class PacingMode
+{
+	Uncapped,		// as fast as glfwSwapBuffers returns (swap interval 0)
+	VSync,			// swap interval 1
+	AdaptiveVsync,	// swap interval -1 (tears instead of halving the rate when a frame is late)
+	Capped,			// swap interval 0, paced to a target rate with a hybrid sleep/spin wait
+	OnDemand		// sleeps in glfwWaitEventsTimeout, renders only after input or damage
+};
+
+void initFrameScheduler(GLFWwindow* window, PacingMode mode, double targetFps);
+// top of the loop; returns false when there is nothing to render (on-demand woke up idle)
+bool frameSchedulerBeginFrame();
+void frameSchedulerPollEvents();	// replaces glfwPollEvents
+void frameSchedulerEndFrame();		// after swapping; the capped mode waits for its deadline here
+// marks the window as needing a redraw (on-demand mode), e.g. after a resize; any thread may call it
+void requestRedraw();
+
+#endif
@@ -0,0 +1,126 @@
+#define GLAD_GL_CONTEXT_CALLS
+#include <glad/glad.h>
+#include "mock-gl.h"
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+// Drives two GladGLContext tables from one thread, both backed by the mock GL: A is the mock as it is
+// (3.3, no extensions), B goes through a loader that reports 4.6 with a couple of extensions and counts
+// its glClear calls. Every GL call, GLVersion, gladHasExtension and GLAD_GL_* below goes through the
+// current table, so each check shows whether the macro layer really picks the right one.
+
+namespace
+{
+	int failures = 0;
+	int clearsThroughB = 0;
+
+	const char* extensionsOfB[] = { "GL_ARB_buffer_storage", "GL_KHR_debug" };
+	const int extensionCountOfB = sizeof(extensionsOfB) / sizeof(extensionsOfB[0]);
+
+	PFNGLGETSTRINGPROC mockGetString = nullptr;
+	PFNGLGETINTEGERVPROC mockGetIntegerv = nullptr;
+	PFNGLCLEARPROC mockClear = nullptr;
+
+	const GLubyte* APIENTRY getStringOfB(GLenum name)
+	{
+		if (name == GL_VERSION)
+			return reinterpret_cast<const GLubyte*>("4.6 (Core Profile) Mock GL");
+		return mockGetString(name);
+	}
+
+	void APIENTRY getIntegervOfB(GLenum name, GLint* data)
+	{
+		if (name == GL_NUM_EXTENSIONS)
+			*data = extensionCountOfB;
+		else
+			mockGetIntegerv(name, data);
+	}
+
+	const GLubyte* APIENTRY getStringiOfB(GLenum name, GLuint index)
+	{
+		if (name != GL_EXTENSIONS || index >= GLuint(extensionCountOfB))
+			return nullptr;
+		return reinterpret_cast<const GLubyte*>(extensionsOfB[index]);
+	}
+
+	void APIENTRY clearOfB(GLbitfield mask)
+	{
+		clearsThroughB++;
+		mockClear(mask);
+	}
+
+	void* loadB(const char* name)
+	{
+		if (std::strcmp(name, "glGetString") == 0)
+			return reinterpret_cast<void*>(getStringOfB);
+		if (std::strcmp(name, "glGetIntegerv") == 0)
+			return reinterpret_cast<void*>(getIntegervOfB);
+		if (std::strcmp(name, "glGetStringi") == 0)
+			return reinterpret_cast<void*>(getStringiOfB);
+		if (std::strcmp(name, "glClear") == 0)
+			return reinterpret_cast<void*>(clearOfB);
+		return mockGlGetProcAddress(name);
+	}
+
+	void check(bool ok, const char* what)
+	{
+		if (!ok)
+		{
+			std::cout << "FAILED: " << what << std::endl;
+			failures++;
+		}
+	}
+}
+
+int main()
+{
+	mockGetString = reinterpret_cast<PFNGLGETSTRINGPROC>(mockGlGetProcAddress("glGetString"));
+	mockGetIntegerv = reinterpret_cast<PFNGLGETINTEGERVPROC>(mockGlGetProcAddress("glGetIntegerv"));
+	mockClear = reinterpret_cast<PFNGLCLEARPROC>(mockGlGetProcAddress("glClear"));
+
+	GladGLContext a = {};
+	GladGLContext b = {};
+	check(gladLoadGLContext(&a, mockGlGetProcAddress) != 0, "loading table A");
+	check(gladLoadGLContext(&b, loadB) != 0, "loading table B");
+
+	gladSetGLContext(&a);
+	check(GLVersion.major == 3 && GLVersion.minor == 3, "A reports 3.3");
+	check(!GLAD_GL_ARB_buffer_storage, "A has no ARB_buffer_storage");
+	check(!gladHasExtension("GL_KHR_debug"), "A has no KHR_debug");
+	glClear(GL_COLOR_BUFFER_BIT);
+	check(clearsThroughB == 0, "glClear under A skips B's table");
+	check(glGetError() == GL_NO_ERROR, "glClear under A is a valid call");
+
+	gladSetGLContext(&b);
+	check(GLVersion.major == 4 && GLVersion.minor == 6, "B reports 4.6");
+	check(GLAD_GL_ARB_buffer_storage != 0, "B has ARB_buffer_storage");
+	check(gladHasExtension("GL_KHR_debug") != 0, "B has KHR_debug");
+	check(!gladHasExtension("GL_KHR_debu"), "B has no prefix of an extension");
+	glClear(GL_COLOR_BUFFER_BIT);
+	check(clearsThroughB == 1, "glClear under B goes through B's table");
+
+	// switching back must not have been spoiled by loading B after A
+	gladSetGLContext(&a);
+	check(GLVersion.major == 3 && !gladHasExtension("GL_ARB_buffer_storage"), "A is unchanged after B");
+	glClear(GL_COLOR_BUFFER_BIT);
+	check(clearsThroughB == 1, "glClear under A again skips B's table");
+
+	// the current table is per thread, and none of this touched the global pointers
+	GladGLContext* seenByOtherThread = &a;
+	std::thread([&] { seenByOtherThread = gladGetGLContext(); }).join();
+	check(seenByOtherThread == nullptr, "another thread has no current table");
+	check(glad_glClear == nullptr, "the global glClear is still unloaded");
+
+	gladSetGLContext(nullptr);
+	gladUnloadGLContext(&a);
+	gladUnloadGLContext(&b);
+	check(a.extensions == nullptr && b.extensions == nullptr, "unloading frees the extension sets");
+
+	MockGlStats stats = mockGlStats();
+	check(stats.errors == 0, "the mock saw no GL errors");
+
+	if (failures == 0)
+		std::cout << "GL context tables: all checks passed" << std::endl;
+	return failures == 0 ? 0 : 1;
+}
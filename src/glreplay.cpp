@@ -0,0 +1,429 @@
+#include <glad/glad.h>
+#include <glad/glad_trace.h>
+#include <GLFW/glfw3.h>
+#include "mapped-file.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+
+// Re-executes a trace written by Test-example --trace against a headless OSMesa context, one frame at
+// a time, so a captured frame can be profiled or bisected without the application around it. Object
+// names, uniform locations and block indices are mapped from what the traced driver returned to what
+// this one returns; payloads are used straight from the mapped trace. Any GL error, missing payload or
+// broken record (a mapped write outside its mapping included) makes it exit with -1, so scripts can
+// tell a clean replay from one that went wrong.
+
+namespace
+{
+	struct ReplayOptions
+	{
+		const char* path = nullptr;
+		int frames = 0;			// 0 replays them all
+		int width = 800;
+		int height = 600;
+		bool quiet = false;
+	};
+
+	struct Blob
+	{
+		const char* data;
+		size_t size;
+	};
+
+	const int maxParams = 16;
+
+	std::unordered_map<uint64_t, Blob> blobs;
+	std::unordered_map<uint64_t, uint64_t> objects[GLAD_TRACE_OBJECT_COUNT];	// traced name -> replayed name
+	struct Mapping
+	{
+		char* data;
+		size_t length;
+	};
+
+	std::unordered_map<uint64_t, Mapping> mappings;	// buffer target -> what glMapBuffer(Range) returned here
+	uint64_t currentProgram = 0;	// as traced, the key for uniform locations
+	unsigned long long missingBlobs = 0;
+	unsigned long long conflictingBlobs = 0;	// a key the trace gave to two different payloads
+	unsigned long long strayWrites = 0;			// mapped writes outside what is mapped, not replayed
+
+	std::vector<char> outScratch(16 << 20);	// glGet* results nobody reads
+	std::vector<const char*> stringScratch;
+	std::vector<GLuint> nameScratch[maxParams];
+
+	unsigned int mapBufferId = ~0u, mapBufferRangeId = ~0u, unmapBufferId = ~0u, useProgramId = ~0u, readPixelsId = ~0u;
+
+	void printUsage(const char* program)
+	{
+		std::cout << "usage: " << program << " [options] trace.gltrace\n"
+			"  --frames N          replay only the first N frames\n"
+			"  --width W           default framebuffer size (default 800x600)\n"
+			"  --height H\n"
+			"  --quiet             only print the summary, not every frame\n";
+	}
+
+	bool parseReplayOptions(int argc, char** argv, ReplayOptions& options)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			const char* arg = argv[i];
+			bool hasValue = i + 1 < argc;
+
+			if (std::strcmp(arg, "--frames") == 0 && hasValue)
+				options.frames = std::atoi(argv[++i]);
+			else if (std::strcmp(arg, "--width") == 0 && hasValue)
+				options.width = std::atoi(argv[++i]);
+			else if (std::strcmp(arg, "--height") == 0 && hasValue)
+				options.height = std::atoi(argv[++i]);
+			else if (std::strcmp(arg, "--quiet") == 0)
+				options.quiet = true;
+			else if (arg[0] != '-' && options.path == nullptr)
+				options.path = arg;
+			else
+			{
+				printUsage(argv[0]);
+				return false;
+			}
+		}
+
+		if (options.path == nullptr || options.frames < 0 || options.width <= 0 || options.height <= 0)
+		{
+			printUsage(argv[0]);
+			return false;
+		}
+		return true;
+	}
+
+	unsigned int findFunction(const char* name)
+	{
+		for (unsigned int id = 0; id < gladTraceFunctionCount(); ++id)
+		{
+			if (std::strcmp(gladTraceFunction(id)->name, name) == 0)
+				return id;
+		}
+		return ~0u;
+	}
+
+	bool validTrace(const MappedFile& trace, GladTraceHeader& header)
+	{
+		if (!trace.valid() || trace.size() < sizeof(header))
+		{
+			std::cout << "Can't read the trace" << std::endl;
+			return false;
+		}
+		std::memcpy(&header, trace.data(), sizeof(header));
+		if (std::memcmp(header.magic, "GLTR", 4) != 0 || header.version != GLAD_TRACE_VERSION)
+		{
+			std::cout << "Not a GL trace, or one from another version" << std::endl;
+			return false;
+		}
+		if (header.functionCount != gladTraceFunctionCount() || header.pointerSize != sizeof(void*))
+		{
+			std::cout << "The trace was written by a different glad or for a different pointer size" << std::endl;
+			return false;
+		}
+		if (header.recordBytes > trace.size() - sizeof(header))
+		{
+			std::cout << "The trace is cut short" << std::endl;
+			return false;
+		}
+		return true;
+	}
+
+	GLFWwindow* headlessWindowInit(const ReplayOptions& options)
+	{
+		glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+		if (!glfwInit())
+		{
+			std::cout << "Failed to initialize GLFW" << std::endl;
+			return nullptr;
+		}
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+		glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+		glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+		glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+
+		GLFWwindow* window = glfwCreateWindow(options.width, options.height, "Replay", nullptr, nullptr);
+		if (window == nullptr)
+		{
+			std::cout << "Failed to create GLFW window" << std::endl;
+			return nullptr;
+		}
+		glfwMakeContextCurrent(window);
+
+		// the trace already has every lookup it needs in its ids, nothing to gain from lazy loading
+		if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+		{
+			std::cout << "Failed to initialize GLAD" << std::endl;
+			return nullptr;
+		}
+		return window;
+	}
+
+	const char* blobData(uint64_t hash, size_t* size = nullptr)
+	{
+		if (hash == 0)
+			return nullptr;
+		auto found = blobs.find(hash);
+		if (found == blobs.end())
+		{
+			++missingBlobs;
+			return nullptr;
+		}
+		if (size != nullptr)
+			*size = found->second.size;
+		return found->second.data;
+	}
+
+	// locations and block indices only mean something together with their program
+	uint64_t objectKey(unsigned char object, uint64_t value, uint64_t program)
+	{
+		if (object == GLAD_TRACE_OBJECT_LOCATION || object == GLAD_TRACE_OBJECT_BLOCK_INDEX)
+			return (program << 32) | static_cast<uint32_t>(value);
+		return value;
+	}
+
+	// 0 is "no object" for names, but the first location or block index for the other two
+	bool zeroIsNull(unsigned char object)
+	{
+		return object != GLAD_TRACE_OBJECT_LOCATION && object != GLAD_TRACE_OBJECT_BLOCK_INDEX;
+	}
+
+	uint64_t mapObject(unsigned char object, uint64_t value, uint64_t program)
+	{
+		if (object == GLAD_TRACE_OBJECT_NONE || (value == 0 && zeroIsNull(object)))
+			return value;
+		auto found = objects[object].find(objectKey(object, value, program));
+		return found != objects[object].end() ? found->second : value;	// unknown names pass through
+	}
+
+	// the program a location or block index belongs to: the call's own program argument, if it has one
+	uint64_t programOf(const GladTraceFunction& function, const uint64_t* slots)
+	{
+		for (int i = 0; i < function.paramCount; ++i)
+		{
+			if (function.params[i].kind == GLAD_TRACE_SCALAR && function.params[i].object == GLAD_TRACE_OBJECT_PROGRAM)
+				return slots[i];
+		}
+		return currentProgram;
+	}
+
+	void replayCall(unsigned int id, const GladTraceFunction& function, const uint64_t* slots, bool hasReturn)
+	{
+		uint64_t args[maxParams];
+		uint64_t program = programOf(function, slots);
+
+		for (int i = 0; i < function.paramCount; ++i)
+		{
+			const GladTraceParam& param = function.params[i];
+			uint64_t slot = slots[i];
+			size_t size = 0;
+			const char* data;
+
+			switch (param.kind)
+			{
+			case GLAD_TRACE_SCALAR:
+			case GLAD_TRACE_OFFSET:
+				args[i] = mapObject(param.object, slot, program);
+				break;
+			case GLAD_TRACE_BLOB:
+				args[i] = reinterpret_cast<uintptr_t>(blobData(slot));
+				break;
+			case GLAD_TRACE_STRINGS:
+				// back to one pointer per string; the count argument next to it is unchanged
+				stringScratch.clear();
+				data = blobData(slot, &size);
+				for (size_t offset = 0; data != nullptr && offset < size; offset += std::strlen(data + offset) + 1)
+					stringScratch.push_back(data + offset);
+				args[i] = reinterpret_cast<uintptr_t>(data != nullptr ? stringScratch.data() : nullptr);
+				break;
+			case GLAD_TRACE_NAMES_IN:
+			case GLAD_TRACE_NAMES_OUT:
+				data = blobData(slot, &size);
+				nameScratch[i].resize(size / sizeof(GLuint));
+				if (param.kind == GLAD_TRACE_NAMES_IN)
+				{
+					for (size_t n = 0; n < nameScratch[i].size(); ++n)
+					{
+						GLuint name;
+						std::memcpy(&name, data + n * sizeof(GLuint), sizeof(GLuint));
+						nameScratch[i][n] = static_cast<GLuint>(mapObject(param.object, name, program));
+					}
+				}
+				args[i] = reinterpret_cast<uintptr_t>(data != nullptr ? nameScratch[i].data() : nullptr);
+				break;
+			case GLAD_TRACE_OUT:
+				if (id == readPixelsId)
+				{
+					size_t pixels = static_cast<size_t>(slots[2]) * static_cast<size_t>(slots[3]) * 16;
+					if (outScratch.size() < pixels)
+						outScratch.resize(pixels);
+				}
+				args[i] = reinterpret_cast<uintptr_t>(outScratch.data());
+				break;
+			default:	// unused or unsupported
+				args[i] = 0;
+				break;
+			}
+		}
+
+		uint64_t result = gladTraceInvoke(id, args);
+
+		for (int i = 0; i < function.paramCount; ++i)
+		{
+			if (function.params[i].kind != GLAD_TRACE_NAMES_OUT || slots[i] == 0)
+				continue;
+			const char* traced = blobData(slots[i]);
+			for (size_t n = 0; traced != nullptr && n < nameScratch[i].size(); ++n)
+			{
+				GLuint name;
+				std::memcpy(&name, traced + n * sizeof(GLuint), sizeof(GLuint));
+				objects[function.params[i].object][name] = nameScratch[i][n];
+			}
+		}
+		if (hasReturn && function.returnObject != GLAD_TRACE_OBJECT_NONE
+			&& (slots[function.paramCount] != 0 || !zeroIsNull(function.returnObject)))
+		{
+			uint64_t key = objectKey(function.returnObject, slots[function.paramCount], program);
+			objects[function.returnObject][key] = result;
+		}
+
+		if (id == useProgramId)
+			currentProgram = slots[0];
+		else if (id == mapBufferId || id == mapBufferRangeId)
+		{
+			// glMapBuffer maps all of it, glMapBufferRange's length is its third argument
+			GLint bufferSize = 0;
+			if (id == mapBufferId)
+				glGetBufferParameteriv(static_cast<GLenum>(slots[0]), GL_BUFFER_SIZE, &bufferSize);
+			size_t length = id == mapBufferId ? static_cast<size_t>(bufferSize) : static_cast<size_t>(slots[2]);
+			mappings[slots[0]] = { reinterpret_cast<char*>(static_cast<uintptr_t>(result)), length };
+		}
+		else if (id == unmapBufferId)
+			mappings.erase(slots[0]);
+	}
+
+	// keys are only reused for the same bytes, anything else is a broken trace and replays the first payload
+	void storeBlob(uint64_t key, const char* data, size_t size)
+	{
+		auto stored = blobs.emplace(key, Blob{ data, size });
+		if (!stored.second && (stored.first->second.size != size || std::memcmp(stored.first->second.data, data, size) != 0))
+			++conflictingBlobs;
+	}
+
+	void replayMappedWrite(const uint64_t* slots)
+	{
+		size_t size = 0;
+		const char* data = blobData(slots[3], &size);
+		auto mapping = mappings.find(slots[0]);
+		if (data == nullptr || mapping == mappings.end() || mapping->second.data == nullptr)
+			return;
+
+		// the offset and size come from the trace, a broken one must not write past the mapping
+		if (size != slots[2] || slots[1] > mapping->second.length || size > mapping->second.length - slots[1])
+		{
+			++strayWrites;
+			return;
+		}
+		std::memcpy(mapping->second.data + slots[1], data, size);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	ReplayOptions options;
+	if (!parseReplayOptions(argc, argv, options)) return -1;
+
+	MappedFile trace(options.path);
+	GladTraceHeader header;
+	if (!validTrace(trace, header)) return -1;
+
+	GLFWwindow* window = headlessWindowInit(options);
+	if (window == nullptr)
+	{
+		glfwTerminate();
+		return -1;
+	}
+
+	mapBufferId = findFunction("glMapBuffer");
+	mapBufferRangeId = findFunction("glMapBufferRange");
+	unmapBufferId = findFunction("glUnmapBuffer");
+	useProgramId = findFunction("glUseProgram");
+	readPixelsId = findFunction("glReadPixels");
+
+	// every record starts 8-byte aligned and so does the header's end, so the slots can be read in place
+	const char* cursor = trace.data() + sizeof(GladTraceHeader);
+	const char* end = cursor + header.recordBytes;
+	unsigned long long calls = 0, frameCalls = 0, errors = 0;
+	bool complete = true;
+	int frames = 0;
+	double totalMs = 0.0, slowestMs = 0.0;
+	auto frameStart = std::chrono::steady_clock::now();
+
+	while (cursor + sizeof(GladTraceRecord) <= end)
+	{
+		GladTraceRecord record;
+		std::memcpy(&record, cursor, sizeof(record));
+		const uint64_t* slots = reinterpret_cast<const uint64_t*>(cursor + sizeof(record));
+		size_t recordSize = sizeof(record) + (record.id == GLAD_TRACE_RECORD_BLOB
+			? 8 + ((static_cast<size_t>(record.size) + 7) & ~static_cast<size_t>(7))
+			: 8 * (static_cast<size_t>(record.argCount) + record.hasReturn));
+		if (recordSize > static_cast<size_t>(end - cursor))
+		{
+			std::cout << "The trace ends in the middle of a record" << std::endl;
+			complete = false;
+			break;
+		}
+
+		if (record.id == GLAD_TRACE_RECORD_BLOB)
+			storeBlob(slots[0], cursor + sizeof(record) + 8, record.size);
+		else if (record.id == GLAD_TRACE_RECORD_MAPPED_WRITE)
+			replayMappedWrite(slots);
+		else if (record.id == GLAD_TRACE_RECORD_FRAME)
+		{
+			glFinish();
+			while (glGetError() != GL_NO_ERROR)
+				++errors;
+			auto now = std::chrono::steady_clock::now();
+			double ms = std::chrono::duration<double, std::milli>(now - frameStart).count();
+			frameStart = now;
+			totalMs += ms;
+			slowestMs = ms > slowestMs ? ms : slowestMs;
+			++frames;
+			if (!options.quiet)
+				std::printf("frame %5d %8llu calls %10.3f ms\n", frames, frameCalls, ms);
+			frameCalls = 0;
+			if (frames == options.frames)
+				break;
+		}
+		else
+		{
+			const GladTraceFunction* function = gladTraceFunction(record.id);
+			if (function == nullptr || function->paramCount != record.argCount || function->hasReturn != record.hasReturn
+				|| function->paramCount > maxParams)
+			{
+				std::cout << "Unknown call in the trace, stopping" << std::endl;
+				complete = false;
+				break;
+			}
+			replayCall(record.id, *function, slots, record.hasReturn != 0);
+			++calls;
+			++frameCalls;
+		}
+		cursor += recordSize;
+	}
+
+	std::printf("%d of %llu frames, %llu calls, %.3f ms/frame on average, %.3f ms slowest\n", frames,
+		static_cast<unsigned long long>(header.frameCount), calls, frames > 0 ? totalMs / frames : 0.0, slowestMs);
+	if (errors > 0 || missingBlobs > 0 || conflictingBlobs > 0 || strayWrites > 0)
+		std::printf("%llu GL errors at frame ends, %llu payloads missing from the trace, %llu payload keys reused for other data, "
+			"%llu mapped writes outside their mapping\n", errors, missingBlobs, conflictingBlobs, strayWrites);
+
+	glfwTerminate();
+	return complete && errors == 0 && missingBlobs == 0 && conflictingBlobs == 0 && strayWrites == 0 ? 0 : -1;
+}
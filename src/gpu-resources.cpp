@@ -0,0 +1,204 @@
+#include <glad/glad.h>
+#include "gpu-resources.h"
+#include <deque>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+	const int typeCount = static_cast<int>(GpuResourceType::Count);
+
+	struct Slot
+	{
+		unsigned int name;
+		std::uint32_t generation;
+		GpuResourceType type;
+		size_t bytes;
+	};
+
+	// objects released during one frame, deleted once that frame's fence has signaled
+	struct DeletionBatch
+	{
+		GLsync fence;
+		std::vector<unsigned int> names[typeCount];
+	};
+
+	std::vector<Slot> slots = { Slot{} };		// index 0 stays unused so { 0, 0 } can never be valid
+	std::vector<std::uint32_t> freeSlots;
+	std::deque<DeletionBatch> inFlight;
+	DeletionBatch current = {};
+
+	GpuResourceStats stats = {};
+
+	// GpuResource globals in other files can be destroyed after cleanUpGpuResources, or even after
+	// the vectors above; from then on their releases do nothing
+	bool registryClosed = false;
+	struct RegistryLifetime
+	{
+		~RegistryLifetime() { registryClosed = true; }
+	} registryLifetime;
+
+	Slot* findSlot(GpuHandle handle)
+	{
+		if (registryClosed || !handle || handle.index >= slots.size()) return nullptr;
+		Slot& slot = slots[handle.index];
+		return slot.generation == handle.generation ? &slot : nullptr;
+	}
+
+	unsigned int generateName(GpuResourceType type)
+	{
+		unsigned int name = 0;
+		switch (type)
+		{
+		case GpuResourceType::Buffer: glGenBuffers(1, &name); break;
+		case GpuResourceType::VertexArray: glGenVertexArrays(1, &name); break;
+		case GpuResourceType::Texture: glGenTextures(1, &name); break;
+		case GpuResourceType::Renderbuffer: glGenRenderbuffers(1, &name); break;
+		case GpuResourceType::Framebuffer: glGenFramebuffers(1, &name); break;
+		default: break;
+		}
+		return name;
+	}
+
+	// one glDelete* call per type for the whole batch
+	void deleteNames(DeletionBatch& batch)
+	{
+		for (int type = 0; type < typeCount; ++type)
+		{
+			std::vector<unsigned int>& names = batch.names[type];
+			if (names.empty()) continue;
+
+			GLsizei count = static_cast<GLsizei>(names.size());
+			switch (static_cast<GpuResourceType>(type))
+			{
+			case GpuResourceType::Buffer: glDeleteBuffers(count, names.data()); break;
+			case GpuResourceType::VertexArray: glDeleteVertexArrays(count, names.data()); break;
+			case GpuResourceType::Texture: glDeleteTextures(count, names.data()); break;
+			case GpuResourceType::Renderbuffer: glDeleteRenderbuffers(count, names.data()); break;
+			case GpuResourceType::Framebuffer: glDeleteFramebuffers(count, names.data()); break;
+			default: break;
+			}
+
+			stats.deleted += names.size();
+			stats.pendingDeletions -= names.size();
+			names.clear();
+		}
+	}
+}
+
+
+GpuHandle createGpuResource(GpuResourceType type)
+{
+	registryClosed = false;
+
+	std::uint32_t index;
+	if (!freeSlots.empty())
+	{
+		index = freeSlots.back();
+		freeSlots.pop_back();
+	}
+	else
+	{
+		index = static_cast<std::uint32_t>(slots.size());
+		slots.push_back(Slot{});
+	}
+
+	Slot& slot = slots[index];
+	if (slot.generation == 0) slot.generation = 1;	// also skips 0 when the counter wraps
+	slot.name = generateName(type);
+	slot.type = type;
+	slot.bytes = 0;
+
+	++stats.live[static_cast<int>(type)];
+	++stats.created;
+	return { index, slot.generation };
+}
+
+void releaseGpuResource(GpuHandle handle)
+{
+	Slot* slot = findSlot(handle);
+	if (slot == nullptr) return;	// null, or already released through another copy of the handle
+
+	current.names[static_cast<int>(slot->type)].push_back(slot->name);
+	++stats.pendingDeletions;
+	--stats.live[static_cast<int>(slot->type)];
+	stats.liveBytes -= slot->bytes;
+
+	// bumping the generation is what makes every outstanding copy of the handle stale
+	slot->name = 0;
+	slot->bytes = 0;
+	if (++slot->generation == 0) slot->generation = 1;
+	freeSlots.push_back(handle.index);
+}
+
+unsigned int gpuName(GpuHandle handle)
+{
+	Slot* slot = findSlot(handle);
+	return slot != nullptr ? slot->name : 0;
+}
+
+void setGpuResourceBytes(GpuHandle handle, size_t bytes)
+{
+	Slot* slot = findSlot(handle);
+	if (slot == nullptr) return;
+
+	stats.liveBytes += bytes - slot->bytes;
+	slot->bytes = bytes;
+}
+
+void gpuBufferData(GpuHandle buffer, unsigned int target, size_t size, const void* data, unsigned int usage)
+{
+	glBindBuffer(target, gpuName(buffer));
+	glBufferData(target, static_cast<GLsizeiptr>(size), data, usage);
+	setGpuResourceBytes(buffer, size);
+}
+
+void flushGpuDeletions()
+{
+	// close this frame's batch behind a fence; nothing was released → nothing to wait for
+	bool empty = true;
+	for (auto& names : current.names)
+		empty = empty && names.empty();
+	if (!empty)
+	{
+		current.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		inFlight.push_back(std::move(current));
+		current = {};
+	}
+
+	// batches complete in submission order, so stop at the first one that is still busy
+	while (!inFlight.empty())
+	{
+		DeletionBatch& oldest = inFlight.front();
+		GLenum status = glClientWaitSync(oldest.fence, 0, 0);
+		if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) break;
+
+		glDeleteSync(oldest.fence);
+		deleteNames(oldest);
+		inFlight.pop_front();
+	}
+}
+
+GpuResourceStats gpuResourceStats()
+{
+	return stats;
+}
+
+void cleanUpGpuResources()
+{
+	size_t leaked = 0;
+	for (size_t count : stats.live)
+		leaked += count;
+	if (leaked > 0)
+		std::cout << "GPU resource registry: " << leaked << " resources still alive at shutdown\n";
+
+	glFinish();
+	for (DeletionBatch& batch : inFlight)
+	{
+		glDeleteSync(batch.fence);
+		deleteNames(batch);
+	}
+	inFlight.clear();
+	deleteNames(current);
+	registryClosed = true;		// the context goes away next, whatever is still alive goes with it
+}
@@ -0,0 +1,96 @@
+#ifndef GPU_RESOURCES_H
+#define GPU_RESOURCES_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Registry of GL objects behind generational handles. A released handle goes stale immediately
+// (so a second release or a late lookup is harmless), while the GL object itself waits in a
+// deletion queue until the GPU is done with the frames that could still be using it.
+// Everything here must be called from the thread that owns the context.
+
+enum class GpuResourceType : std::uint8_t
+{
+	Buffer,
+	VertexArray,
+	Texture,
+	Renderbuffer,
+	Framebuffer,
+	Count
+};
+
+struct GpuHandle
+{
+	std::uint32_t index = 0;
+	std::uint32_t generation = 0;		// 0 is never handed out, so a default handle is null
+
+	explicit operator bool() const { return generation != 0; }
+};
+
+struct GpuResourceStats
+{
+	size_t live[static_cast<int>(GpuResourceType::Count)];
+	size_t liveBytes;					// what was declared through gpuBufferData / setGpuResourceBytes
+	size_t pendingDeletions;
+	size_t created;
+	size_t deleted;
+};
+
+GpuHandle createGpuResource(GpuResourceType type);
+void releaseGpuResource(GpuHandle handle);
+unsigned int gpuName(GpuHandle handle);		// 0 for null or stale handles
+void setGpuResourceBytes(GpuHandle handle, size_t bytes);
+// glBufferData on the handle's buffer (binding it to target) with its size tracked
+void gpuBufferData(GpuHandle buffer, unsigned int target, size_t size, const void* data, unsigned int usage);
+
+void flushGpuDeletions();		// once per frame, after swapping
+GpuResourceStats gpuResourceStats();
+// waits for the GPU and deletes everything that's still queued; releases after this are no-ops
+void cleanUpGpuResources();
+
+// move-only owner of one registry entry
+template <GpuResourceType Type>
+class GpuResource
+{
+public:
+	GpuResource() = default;
+	~GpuResource() { releaseGpuResource(handle_); }
+
+	static GpuResource create()
+	{
+		GpuResource resource;
+		resource.handle_ = createGpuResource(Type);
+		return resource;
+	}
+
+	GpuResource(GpuResource&& other) noexcept : handle_(other.handle_) { other.handle_ = {}; }
+	GpuResource& operator=(GpuResource&& other) noexcept
+	{
+		if (this != &other)
+		{
+			releaseGpuResource(handle_);
+			handle_ = other.handle_;
+			other.handle_ = {};
+		}
+		return *this;
+	}
+
+	GpuResource(const GpuResource&) = delete;
+	GpuResource& operator=(const GpuResource&) = delete;
+
+	void reset() { releaseGpuResource(handle_); handle_ = {}; }
+	unsigned int name() const { return gpuName(handle_); }
+	GpuHandle handle() const { return handle_; }
+	explicit operator bool() const { return static_cast<bool>(handle_); }
+
+private:
+	GpuHandle handle_;
+};
+
+using GpuBuffer = GpuResource<GpuResourceType::Buffer>;
+using GpuVertexArray = GpuResource<GpuResourceType::VertexArray>;
+using GpuTexture = GpuResource<GpuResourceType::Texture>;
+using GpuRenderbuffer = GpuResource<GpuResourceType::Renderbuffer>;
+using GpuFramebuffer = GpuResource<GpuResourceType::Framebuffer>;
+
+#endif
@@ -0,0 +1,110 @@
+#include <glad/glad.h>
+#include "instancing.h"
+#include "shader.h"
+#include "gpu-resources.h"
+#include "stream-buffer.h"
+#include "vertex-format.h"
+#include <cstddef>
+
+namespace
+{
+	const char* instancedVertexShaderSource = "#version 330 core\n"
+		"layout(location = 0) in vec3 aPos;\n"
+		"layout(location = 1) in vec3 aInstance;\n"		// xy offset, z scale
+		"layout(location = 2) in vec4 aColor;\n"
+		"out vec4 color;\n"
+		"void main()\n"
+		"{\n"
+		"gl_Position = vec4(aPos.xy * aInstance.z + aInstance.xy, aPos.z, 1.0);\n"
+		"color = aColor;\n"
+		"}\0";
+
+	const char* instancedFragmentShaderSource = "#version 330 core\n"
+		"in vec4 color;\n"
+		"out vec4 FragmentColor;\n"
+		"void main()\n"
+		"{\n"
+		"FragmentColor = color;\n"
+		"}\0";
+
+	using InstanceFormat = VertexFormat<attribute::Float<3>, attribute::Unorm8<4>>;
+	static_assert(sizeof(InstanceData) == InstanceFormat::stride && offsetof(InstanceData, r) == InstanceFormat::offsets[1],
+		"InstanceData doesn't match InstanceFormat");
+
+	ShaderProgramHandle instancedProgram;
+	GpuVertexArray instancedVAO;
+	GpuBuffer meshVBO;
+	StreamBuffer instanceBuffer;
+
+	int meshVertexCount = 0;
+	int maxInstanceCount = 0;
+	StreamAllocation mapped;		// this frame's instances, between instancingMap and instancingDraw
+	int mappedCount = 0;
+}
+
+
+bool instancingInit(const float* positions, int vertexCount, int maxInstances)
+{
+	instancedProgram = ShaderProgramHandle(requestShaderProgram(instancedVertexShaderSource, instancedFragmentShaderSource, "Instanced"));
+	if (instancedProgram.get() == -1) return false;
+
+	if (!instanceBuffer.init(GL_ARRAY_BUFFER, static_cast<size_t>(maxInstances) * sizeof(InstanceData))) return false;
+
+	meshVertexCount = vertexCount;
+	maxInstanceCount = maxInstances;
+
+	instancedVAO = GpuVertexArray::create();
+	meshVBO = GpuBuffer::create();
+
+	glBindVertexArray(instancedVAO.name());
+	gpuBufferData(meshVBO.handle(), GL_ARRAY_BUFFER, vertexCount * 3 * sizeof(float), positions, GL_STATIC_DRAW);
+	PositionFormat::setup();
+
+	// the instance attributes get their pointers every frame, once it's known where the data landed
+	InstanceFormat::enable(1, 1);
+
+	glBindVertexArray(0);
+	return true;
+}
+
+InstanceData* instancingMap(int instanceCount)
+{
+	mappedCount = 0;
+	if (instanceCount <= 0 || instanceCount > maxInstanceCount) return nullptr;
+
+	mapped = instanceBuffer.allocate(instanceCount * sizeof(InstanceData), sizeof(InstanceData));
+	if (mapped.data == nullptr) return nullptr;
+
+	mappedCount = instanceCount;
+	return static_cast<InstanceData*>(mapped.data);
+}
+
+void instancingDraw()
+{
+	if (mappedCount == 0) return;
+
+	instanceBuffer.commit(mapped);
+
+	glUseProgram(instancedProgram.program());
+	glBindVertexArray(instancedVAO.name());
+
+	// 3.3 has no base instance, so the attributes are pointed at this frame's region instead
+	glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer.buffer());
+	InstanceFormat::point(1, mapped.offset);
+
+	glDrawArraysInstanced(GL_TRIANGLES, 0, meshVertexCount, mappedCount);
+
+	instanceBuffer.endFrame();
+	mappedCount = 0;
+}
+
+void instancingCleanUp()
+{
+	instancedVAO.reset();
+	meshVBO.reset();
+	instancedProgram.reset();
+	instanceBuffer.destroy();
+	meshVertexCount = 0;
+	maxInstanceCount = 0;
+	mappedCount = 0;
+}
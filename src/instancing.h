@@ -0,0 +1,23 @@
+#ifndef INSTANCING_H
+#define INSTANCING_H
+
+// Instanced renderer: one mesh in a static buffer, drawn instanceCount times by a single
+// glDrawArraysInstanced. The per-instance attributes (glVertexAttribDivisor 1) are rewritten every
+// frame through a StreamBuffer, so moving 100k instances costs one memcpy-sized write and no syncs.
+
+// 16 bytes per instance, like the batch vertices
+struct InstanceData
+{
+	float offsetX, offsetY;		// added to the scaled mesh position
+	float scale;
+	unsigned char r, g, b, a;	// normalized
+};
+
+// positions are xyz triples; maxInstances sizes the per-frame stream region
+bool instancingInit(const float* positions, int vertexCount, int maxInstances);
+// where this frame's instances go, nullptr if instanceCount doesn't fit; call instancingDraw after filling it
+InstanceData* instancingMap(int instanceCount);
+void instancingDraw();
+void instancingCleanUp();
+
+#endif
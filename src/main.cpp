@@ -2,46 +2,152 @@
 #include <GLFW/glfw3.h>
 #include <iostream>
 #include "triangle.h"
+#include "options.h"
+#include "offscreen.h"
+#include "profiler.h"
+#include "batch.h"
+#include "program-cache.h"
+#include "shader.h"
+#include "shader-assets.h"
+#include "gpu-resources.h"
+#include "frame-scheduler.h"
+#include "render-thread.h"
+#include "state-cache.h"
+#include "render-queue.h"
+#include "uniform-buffer.h"
+#include "asset-streaming.h"
+#ifdef GL_TRACE
+#include <glad/glad_trace.h>
+#endif
 
 
-GLFWwindow* windowInit();
+GLFWwindow* windowInit(const AppOptions&);
 void setCallbacks(GLFWwindow*);
-void renderLoop(GLFWwindow*, unsigned int, unsigned int, unsigned int, unsigned int);
+void renderLoop(GLFWwindow*, const AppOptions&, int, int, unsigned int, unsigned int);
+int shutDown(const AppOptions&, int);
 
-int main()
+int main(int argc, char** argv)
 {
-	GLFWwindow* window = windowInit();
+	AppOptions options;
+	if (!parseOptions(argc, argv, options)) return -1;
+
+	GLFWwindow* window = windowInit(options);
 	if (window == NULL)
 	{
 		glfwTerminate();
-		return NULL;
+		return -1;
 	}
 
 	setCallbacks(window);
 
+	if (options.headless && !initOffscreenFramebuffer(options.width, options.height))
+		return shutDown(options, -1);
+
+	if (options.shaderCacheDirectory != nullptr)
+		programCacheInit(options.shaderCacheDirectory);
+
+	if (!initShaderPipeline())
+		return shutDown(options, -1);
+
+	if (!uniformRingInit(64 * 1024))
+		return shutDown(options, -1);
+
+	initShaderAssets(options.shaderDirectory, options.hotReload);
+
 	int statusCode = 0;
 	auto [shaderProgram1, shaderProgram2] = initShaders(statusCode);
-	if (statusCode == -1) return -1;
+	if (statusCode == -1) return shutDown(options, -1);
 
 	auto [VAO1, VAO2] = initVAOs();	// structured binding
 
-	renderLoop(window, shaderProgram1, shaderProgram2, VAO1, VAO2);
-	
+	bool batched = options.renderMode == RenderMode::Batched || options.renderMode == RenderMode::Streaming;
+	if (batched && !initBatchedTriangles(options.shapeCount))
+		return shutDown(options, -1);
+	if (options.renderMode == RenderMode::Streaming && !batchEnableStreaming())
+		return shutDown(options, -1);
+	if (options.renderMode == RenderMode::Indexed && !initIndexedMesh(options.shapeCount, options.quantizeMesh, options.saveMeshPath))
+		return shutDown(options, -1);
+	if (options.renderMode == RenderMode::Instanced && !initInstancedTriangles(options.shapeCount))
+		return shutDown(options, -1);
+
+	// IO threads only when there is a mesh to stream, and only once nothing above can bail out
+	if (options.renderMode == RenderMode::Indexed && options.meshPath != nullptr)
+	{
+		// the built mesh is drawn from the first frame on, the streamed one replaces it when it arrives
+		initAssetStreaming(options.ioThreads, options.uploadBudget);
+		streamIndexedMesh(options.meshPath);
+	}
+
+	if (options.profilePath != nullptr)
+		profilerInit(true);
+
+	renderLoop(window, options, shaderProgram1, shaderProgram2, VAO1, VAO2);
+
+	if (options.stateCache && options.frameLimit > 0)
+	{
+		StateCacheStats stateStats = stateCacheStats();
+		std::cout << "State changes: " << stateStats.issued << " issued, " << stateStats.skipped << " skipped as redundant\n";
+	}
+
+	if (options.profilePath != nullptr)
+	{
+		profilerExport(options.profilePath);
+		profilerShutdown();
+	}
+
+	// a batch job that asked for an image and didn't get one has failed
+	if (options.headless && options.outputPath != nullptr && !saveOffscreenFramebuffer(options.outputPath))
+		return shutDown(options, -1);
+
+	return shutDown(options, 0);
+}
+
+// tears down whatever got initialized so far (every clean-up is fine with nothing to clean up),
+// so no global handle is left for static destruction and no IO thread is left running
+int shutDown(const AppOptions& options, int exitCode)
+{
+	if (options.headless)
+		cleanUpOffscreenFramebuffer();
+	batchCleanUp();
 	cleanUpShadersAndVAOs();
+	cleanUpAssetStreaming();
+	cleanUpShaderAssets();
+	cleanUpShaderPipeline();
+	uniformRingCleanUp();
+	cleanUpGpuResources();
+
+#ifdef GL_TRACE
+	if (options.tracePath != nullptr)
+		gladTraceEnd();
+#endif
 
 	glfwTerminate();
-	return 0;
+	return exitCode;
 }
 
 
-GLFWwindow* windowInit()
+GLFWwindow* windowInit(const AppOptions& options)
 {
-	glfwInit();
+	// no display and no GPU: GLFW's null platform with a software (OSMesa) context
+	if (options.headless)
+		glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+
+	if (!glfwInit())
+	{
+		std::cout << "Failed to initialize GLFW" << std::endl;
+		return NULL;
+	}
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
 	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
-	GLFWwindow* window = glfwCreateWindow(800, 600, "LearnOpenGL", NULL, NULL);
+	if (options.headless)
+	{
+		glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+		glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+	}
+
+	GLFWwindow* window = glfwCreateWindow(options.width, options.height, "LearnOpenGL", NULL, NULL);
 	if (window == 0)
 	{
 		std::cout << "Failed to create GLFW window" << std::endl;
@@ -49,13 +155,25 @@ GLFWwindow* windowInit()
 	}
 	glfwMakeContextCurrent(window);
 
-	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+	// lazily, only the functions that are actually called get looked up
+	int glLoaded = options.lazyGlLoading ? gladLoadGLLoaderLazy((GLADloadproc)glfwGetProcAddress)
+		: gladLoadGLLoader((GLADloadproc)glfwGetProcAddress);
+	if (!glLoaded)
 	{
 		std::cout << "Failed to initialize GLAD" << std::endl;
 		return NULL;
 	}
 
-	glViewport(0, 0, 800, 600);
+#ifdef GL_TRACE
+	// below the state cache, so the trace has the calls that really reach the driver
+	if (options.tracePath != nullptr && !gladTraceBegin(options.tracePath))
+		return NULL;
+#endif
+
+	if (options.stateCache)
+		installStateCache();	// wraps the glad entry points, everything below goes through it
+
+	glViewport(0, 0, options.width, options.height);
 
 	return window;
 }
@@ -69,38 +187,241 @@ void setCallbacks(GLFWwindow* window)
 }
 
 void processInput(GLFWwindow* window);
+void renderLoopThreaded(GLFWwindow*, const AppOptions&, int, int, unsigned int, unsigned int);
+
+void renderLoop(GLFWwindow* window, const AppOptions& options, int shaderProgram1, int shaderProgram2, unsigned int VAO1, unsigned int VAO2)
+{
+	if (options.recordThreads > 0)
+	{
+		renderLoopThreaded(window, options, shaderProgram1, shaderProgram2, VAO1, VAO2);
+		return;
+	}
+
+	const int frameLimit = options.frameLimit;
+	int frameCount = 0;
+	bool programsWerePending = false;
+
+	RenderQueue renderQueue;
+	RenderQueueStats queueTotals = {};
+	const int programs[2] = { shaderProgram1, shaderProgram2 };
+	const unsigned int VAOs[2] = { VAO1, VAO2 };
+
+	initFrameScheduler(window, options.pacingMode, options.targetFps);
+	double startTime = glfwGetTime();
+
+	while (!glfwWindowShouldClose(window) && (frameLimit <= 0 || frameCount < frameLimit))
+	{
+		pollShaderAssets();		// picks up edited shader files
+		pollShaderPrograms();	// never blocks, programs switch from the fallback as soon as they're linked
 
-void renderLoop(GLFWwindow* window, unsigned int shaderProgram1, unsigned int shaderProgram2, unsigned int VAO1, unsigned int VAO2)
+		bool assetsPending = pumpAssetStreaming();		// uploads within the per-frame budget
+
+		// a program that is still linking, or an asset still arriving (or either just finished), changes the picture by itself
+		bool programsPending = shaderProgramsPending() || assetsPending;
+		if (programsPending || programsWerePending)
+			requestRedraw();
+		programsWerePending = programsPending;
+
+		if (!frameSchedulerBeginFrame())
+			continue;			// on-demand: woke up with nothing to redraw
+
+		profilerBeginFrame();	// no-op unless the profiler was initialized
+
+		{
+			ProfileScope scope(ProfilePhase::Input);
+			processInput(window);
+		}
+
+		{
+			ProfileScope scope(ProfilePhase::Clear);
+			glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+			glClear(GL_COLOR_BUFFER_BIT);
+		}
+
+		uploadTriangleMaterials();		// this frame's slice of the uniform ring
+
+		if (options.renderMode == RenderMode::Batched)
+		{
+			ProfileScope scope(ProfilePhase::Draw, 0);
+			batchDraw();		// every shape in a single glMultiDrawArrays
+		}
+		else if (options.renderMode == RenderMode::Streaming)
+		{
+			ProfileScope scope(ProfilePhase::Draw, 0);
+			batchStreamDraw(static_cast<float>(glfwGetTime()));
+		}
+		else if (options.renderMode == RenderMode::Indexed)
+		{
+			ProfileScope scope(ProfilePhase::Draw, 0);
+			drawIndexedMesh();		// to draw a rectangle
+		}
+		else if (options.renderMode == RenderMode::Instanced)
+		{
+			ProfileScope scope(ProfilePhase::Draw, 0);
+			drawInstancedTriangles(static_cast<float>(glfwGetTime()));
+		}
+		else
+		{
+			// submitted interleaved, the queue sorts them into one run per program/VAO; flush times every draw
+			for (int i = 0; i < options.shapeCount; ++i)
+				renderQueue.submit({ programs[i % 2], VAOs[i % 2], triangleMaterial(i), GL_TRIANGLES, 0, 3 });
+
+			RenderQueueStats queueStats = renderQueue.flush();
+			queueTotals.draws += queueStats.draws;
+			queueTotals.programSwitches += queueStats.programSwitches;
+			queueTotals.vertexArraySwitches += queueStats.vertexArraySwitches;
+			queueTotals.materialSwitches += queueStats.materialSwitches;
+		}
+
+		uniformRingEndFrame();
+		profilerEndFrame();
+
+		{
+			ProfileScope scope(ProfilePhase::Swap);
+			glfwSwapBuffers(window);
+#ifdef GL_TRACE
+			gladTraceFrame();
+#endif
+		}
+
+		{
+			ProfileScope scope(ProfilePhase::Poll);
+			frameSchedulerPollEvents();
+		}
+
+		flushGpuDeletions();	// whatever was released frames ago and is no longer in flight
+		frameSchedulerEndFrame();	// capped mode sleeps until the next frame is due
+
+		++frameCount;
+	}
+
+	if (frameLimit > 0)
+	{
+		// a software renderer doesn't pace anything by itself, make sure all frames are really done
+		glFinish();
+		double elapsed = glfwGetTime() - startTime;
+		std::cout << "Rendered " << frameCount << " frames in " << elapsed << " s ("
+			<< (elapsed > 0.0 ? frameCount / elapsed : 0.0) << " frames/s)\n";
+		if (queueTotals.draws > 0)
+			std::cout << "Render queue: " << queueTotals.draws << " draws, " << queueTotals.programSwitches << " program, "
+				<< queueTotals.vertexArraySwitches << " VAO and " << queueTotals.materialSwitches << " material switches\n";
+	}
+}
+
+// what the recording workers need to know about the scene, read-only while a frame is recorded
+struct SceneDescription
+{
+	RenderMode renderMode;
+	int shapeCount;
+	int shaderPrograms[2];
+	unsigned int VAOs[2];
+	float time;
+	int width, height;		// framebuffer size, tracked on the main thread
+};
+
+SceneDescription* threadedScene = nullptr;	// set while the render thread owns the context
+
+void recordScene(CommandBuffer& commands, int worker, int workerCount, const void* sceneData)
 {
-	while (!glfwWindowShouldClose(window))
+	const SceneDescription& scene = *static_cast<const SceneDescription*>(sceneData);
+
+	// worker 0 is replayed first, so the clear goes there
+	if (worker == 0)
+	{
+		commands.viewport(0, 0, scene.width, scene.height);
+		commands.clear(0.2f, 0.3f, 0.3f, 1.0f);
+		commands.callback([](const void*) { uploadTriangleMaterials(); }, nullptr, 0);
+	}
+
+	if (scene.renderMode == RenderMode::Separate)
 	{
+		// every worker takes a contiguous slice of the draws, the triangles alternate between the two programs
+		int begin = scene.shapeCount * worker / workerCount;
+		int end = scene.shapeCount * (worker + 1) / workerCount;
+		for (int i = begin; i < end; ++i)
+		{
+			int material = i % 2;
+			commands.useProgram(scene.shaderPrograms[i % 2]);
+			commands.callback([](const void* index) { bindTriangleMaterial(*static_cast<const int*>(index)); }, &material, sizeof(material));
+			commands.bindVertexArray(scene.VAOs[i % 2]);
+			commands.drawArrays(GL_TRIANGLES, 0, 3);
+		}
+		return;
+	}
+
+	// the other modes already draw everything with one call
+	if (worker != 0) return;
+
+	if (scene.renderMode == RenderMode::Batched)
+		commands.callback([](const void*) { batchDraw(); }, nullptr, 0);
+	else if (scene.renderMode == RenderMode::Streaming)
+		commands.callback([](const void* time) { batchStreamDraw(*static_cast<const float*>(time)); }, &scene.time, sizeof(scene.time));
+	else if (scene.renderMode == RenderMode::Indexed)
+		commands.callback([](const void*) { drawIndexedMesh(); }, nullptr, 0);
+	else if (scene.renderMode == RenderMode::Instanced)
+		commands.callback([](const void* time) { drawInstancedTriangles(*static_cast<const float*>(time)); }, &scene.time, sizeof(scene.time));
+}
+
+void renderLoopThreaded(GLFWwindow* window, const AppOptions& options, int shaderProgram1, int shaderProgram2, unsigned int VAO1, unsigned int VAO2)
+{
+	const int frameLimit = options.frameLimit;
+	int frameCount = 0;
+
+	SceneDescription scene = { options.renderMode, options.shapeCount, { shaderProgram1, shaderProgram2 }, { VAO1, VAO2 }, 0.0f, options.width, options.height };
+	if (!options.headless)
+		glfwGetFramebufferSize(window, &scene.width, &scene.height);
+
+	// sets the swap interval, so the context has to be current for it
+	initFrameScheduler(window, options.pacingMode, options.targetFps);
+	if (!startRenderThread(window, options.recordThreads)) return;
+	threadedScene = &scene;
+
+	double startTime = glfwGetTime();
+
+	// the main thread keeps the window events; GL work only happens on the render thread from here on
+	while (!glfwWindowShouldClose(window) && (frameLimit <= 0 || frameCount < frameLimit))
+	{
+		if (!frameSchedulerBeginFrame())
+			continue;
+
 		processInput(window);
 
-		glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
-		glClear(GL_COLOR_BUFFER_BIT);
+		scene.time = static_cast<float>(glfwGetTime());
+		submitFrame(recordScene, &scene);	// waits here if the render thread falls two frames behind
 
-		glUseProgram(shaderProgram1);
-		glBindVertexArray(VAO1);
-		glDrawArrays(GL_TRIANGLES, 0, 3);		// to draw the 1st triangle 
+		frameSchedulerPollEvents();
+		frameSchedulerEndFrame();
 
-		glUseProgram(shaderProgram2);
-		glBindVertexArray(VAO2);
-		glDrawArrays(GL_TRIANGLES, 0, 3);		// draw the 2nd triangle
+		++frameCount;
+	}
 
-		//glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);	// to draw a rectangle
+	stopRenderThread();
+	threadedScene = nullptr;
 
-		glfwSwapBuffers(window);
-		glfwPollEvents();
+	if (frameLimit > 0)
+	{
+		glFinish();
+		double elapsed = glfwGetTime() - startTime;
+		std::cout << "Rendered " << frameCount << " frames in " << elapsed << " s ("
+			<< (elapsed > 0.0 ? frameCount / elapsed : 0.0) << " frames/s) on " << options.recordThreads << " record thread(s)\n";
 	}
 }
 
 void framebuffer_size_callback(GLFWwindow* window, int width, int height)
 {
-	glViewport(0, 0, width, height);
+	// with a render thread there is no context here, the viewport travels with the next frame instead
+	if (threadedScene != nullptr)
+	{
+		threadedScene->width = width;
+		threadedScene->height = height;
+	}
+	else
+		glViewport(0, 0, width, height);
+	requestRedraw();
 }
 
 void processInput(GLFWwindow* window)
 {
 	if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
 		glfwSetWindowShouldClose(window, true);
-}
\ No newline at end of file
+}
@@ -0,0 +1,86 @@
+#include "mapped-file.h"
+#include <utility>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile(const std::filesystem::path& path)
+{
+#if defined(_WIN32)
+	HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE) return;
+	file_ = file;
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size)) return;
+	size_ = static_cast<size_t>(size.QuadPart);
+	valid_ = true;
+	if (size_ == 0) return;
+	mapping_ = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (mapping_ == NULL) { valid_ = false; return; }
+	data_ = static_cast<const char*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+	valid_ = data_ != nullptr;
+#else
+	descriptor_ = open(path.c_str(), O_RDONLY);
+	if (descriptor_ < 0) return;
+	struct stat status;
+	if (fstat(descriptor_, &status) != 0) return;
+	size_ = static_cast<size_t>(status.st_size);
+	valid_ = true;
+	if (size_ == 0) return;		// mmap refuses empty files, an empty source is still valid
+	void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, descriptor_, 0);
+	if (data == MAP_FAILED) { valid_ = false; return; }
+	data_ = static_cast<const char*>(data);
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+	close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+{
+	*this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+	if (this != &other)
+	{
+		close();
+		data_ = std::exchange(other.data_, nullptr);
+		size_ = std::exchange(other.size_, 0);
+		valid_ = std::exchange(other.valid_, false);
+#if defined(_WIN32)
+		file_ = std::exchange(other.file_, nullptr);
+		mapping_ = std::exchange(other.mapping_, nullptr);
+#else
+		descriptor_ = std::exchange(other.descriptor_, -1);
+#endif
+	}
+	return *this;
+}
+
+void MappedFile::close()
+{
+#if defined(_WIN32)
+	if (data_ != nullptr) UnmapViewOfFile(data_);
+	if (mapping_ != nullptr) CloseHandle(mapping_);
+	if (file_ != nullptr) CloseHandle(file_);
+	file_ = nullptr;
+	mapping_ = nullptr;
+#else
+	if (data_ != nullptr) munmap(const_cast<char*>(data_), size_);
+	if (descriptor_ >= 0) ::close(descriptor_);
+	descriptor_ = -1;
+#endif
+	data_ = nullptr;
+	size_ = 0;
+	valid_ = false;
+}
@@ -0,0 +1,41 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+
+// read-only view of a whole file, mapped rather than copied through a stream
+// (mmap, MapViewOfFile on Windows); the pages stay valid for as long as the object lives
+class MappedFile
+{
+public:
+	MappedFile() = default;
+	explicit MappedFile(const std::filesystem::path& path);
+	~MappedFile();
+
+	MappedFile(MappedFile&& other) noexcept;
+	MappedFile& operator=(MappedFile&& other) noexcept;
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	bool valid() const { return valid_; }	// an empty file is valid, with no data
+	const char* data() const { return data_; }
+	size_t size() const { return size_; }
+	std::string_view contents() const { return data_ != nullptr ? std::string_view(data_, size_) : std::string_view(); }
+
+private:
+	void close();
+
+	const char* data_ = nullptr;
+	size_t size_ = 0;
+	bool valid_ = false;
+#if defined(_WIN32)
+	void* file_ = nullptr;		// HANDLEs, kept opaque so windows.h stays out of the header
+	void* mapping_ = nullptr;
+#else
+	int descriptor_ = -1;
+#endif
+};
+
+#endif
@@ -0,0 +1,269 @@
+#include "mesh-builder.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+
+namespace
+{
+	struct PositionKey
+	{
+		std::uint32_t bits[3];
+
+		bool operator==(const PositionKey& other) const
+		{
+			return bits[0] == other.bits[0] && bits[1] == other.bits[1] && bits[2] == other.bits[2];
+		}
+	};
+
+	struct PositionKeyHash
+	{
+		size_t operator()(const PositionKey& key) const
+		{
+			std::uint64_t hash = 14695981039346656037ull;
+			for (std::uint32_t bits : key.bits)
+				hash = (hash ^ bits) * 1099511628211ull;
+			return static_cast<size_t>(hash);
+		}
+	};
+
+	PositionKey makeKey(const float* position)
+	{
+		PositionKey key;
+		for (int i = 0; i < 3; ++i)
+		{
+			float value = position[i] == 0.0f ? 0.0f : position[i];	// -0.0f and 0.0f are the same vertex
+			std::memcpy(&key.bits[i], &value, sizeof(float));
+		}
+		return key;
+	}
+
+	// ----- Forsyth, "Linear-Speed Vertex Cache Optimisation"
+	const int cacheSize = 32;
+	const float cacheDecayPower = 1.5f;
+	const float lastTriangleScore = 0.75f;
+	const float valenceBoostScale = 2.0f;
+	const float valenceBoostPower = 0.5f;
+
+	float vertexScore(int cachePosition, int remainingTriangles)
+	{
+		if (remainingTriangles == 0) return -1.0f;	// nothing left to gain from this vertex
+
+		float score = 0.0f;
+		if (cachePosition >= 0)
+		{
+			// the three vertices of the last triangle get a fixed score so the next triangle doesn't
+			// simply reuse the same edge over and over
+			if (cachePosition < 3)
+				score = lastTriangleScore;
+			else
+				score = std::pow(1.0f - static_cast<float>(cachePosition - 3) / (cacheSize - 3), cacheDecayPower);
+		}
+
+		// favour vertices with few triangles left so they get finished off and leave the cache
+		score += valenceBoostScale * std::pow(static_cast<float>(remainingTriangles), -valenceBoostPower);
+		return score;
+	}
+}
+
+
+IndexedMesh buildIndexedMesh(const float* soupPositions, size_t soupVertexCount, MeshBuildReport* report)
+{
+	IndexedMesh mesh;
+	mesh.indices.reserve(soupVertexCount);
+
+	std::unordered_map<PositionKey, std::uint32_t, PositionKeyHash> uniqueVertices;
+	uniqueVertices.reserve(soupVertexCount);
+
+	for (size_t i = 0; i < soupVertexCount; ++i)
+	{
+		const float* position = soupPositions + 3 * i;
+		auto [entry, inserted] = uniqueVertices.emplace(makeKey(position), static_cast<std::uint32_t>(mesh.vertexCount()));
+		if (inserted)
+			mesh.positions.insert(mesh.positions.end(), position, position + 3);
+		mesh.indices.push_back(entry->second);
+	}
+
+	double acmrBefore = computeAcmr(mesh.indices);
+	optimizeVertexCache(mesh);
+	optimizeVertexFetch(mesh);
+
+	if (report != nullptr)
+	{
+		report->soupVertices = soupVertexCount;
+		report->uniqueVertices = mesh.vertexCount();
+		report->acmrBefore = acmrBefore;
+		report->acmrAfter = computeAcmr(mesh.indices);
+	}
+	return mesh;
+}
+
+void optimizeVertexCache(IndexedMesh& mesh)
+{
+	const size_t triangleCount = mesh.indices.size() / 3;
+	const size_t vertexCount = mesh.vertexCount();
+	if (triangleCount == 0) return;
+
+	// per-vertex lists of the triangles that still have to be emitted
+	std::vector<std::uint32_t> listStart(vertexCount + 1, 0);
+	for (std::uint32_t index : mesh.indices)
+		++listStart[index + 1];
+	for (size_t v = 0; v < vertexCount; ++v)
+		listStart[v + 1] += listStart[v];
+
+	std::vector<std::uint32_t> remaining(vertexCount, 0);
+	std::vector<std::uint32_t> triangleLists(mesh.indices.size());
+	for (size_t t = 0; t < triangleCount; ++t)
+	{
+		for (int corner = 0; corner < 3; ++corner)
+		{
+			std::uint32_t v = mesh.indices[3 * t + corner];
+			triangleLists[listStart[v] + remaining[v]++] = static_cast<std::uint32_t>(t);
+		}
+	}
+
+	std::vector<int> cachePosition(vertexCount, -1);
+	std::vector<float> score(vertexCount);
+	for (size_t v = 0; v < vertexCount; ++v)
+		score[v] = vertexScore(-1, remaining[v]);
+
+	std::vector<float> triangleScore(triangleCount);
+	std::vector<bool> emitted(triangleCount, false);
+	for (size_t t = 0; t < triangleCount; ++t)
+		triangleScore[t] = score[mesh.indices[3 * t]] + score[mesh.indices[3 * t + 1]] + score[mesh.indices[3 * t + 2]];
+
+	std::vector<std::uint32_t> output;
+	output.reserve(mesh.indices.size());
+
+	// three slots of slack for the vertices pushed out by the newest triangle
+	std::vector<std::uint32_t> cache, nextCache;
+	cache.reserve(cacheSize + 3);
+	nextCache.reserve(cacheSize + 3);
+
+	size_t scanCursor = 0;
+	long bestTriangle = -1;
+	while (output.size() < mesh.indices.size())
+	{
+		if (bestTriangle < 0)
+		{
+			// nothing useful in the cache, start somewhere fresh: the best of what's left
+			float bestScore = -1.0f;
+			while (scanCursor < triangleCount && emitted[scanCursor]) ++scanCursor;
+			for (size_t t = scanCursor; t < triangleCount; ++t)
+			{
+				if (!emitted[t] && triangleScore[t] > bestScore)
+				{
+					bestScore = triangleScore[t];
+					bestTriangle = static_cast<long>(t);
+				}
+			}
+		}
+
+		const std::uint32_t* corners = &mesh.indices[3 * bestTriangle];
+		emitted[bestTriangle] = true;
+		output.insert(output.end(), corners, corners + 3);
+
+		nextCache.clear();
+		for (int corner = 0; corner < 3; ++corner)
+		{
+			std::uint32_t v = corners[corner];
+			nextCache.push_back(v);
+
+			// drop the triangle from the vertex's pending list
+			std::uint32_t* list = &triangleLists[listStart[v]];
+			for (std::uint32_t i = 0; i < remaining[v]; ++i)
+			{
+				if (list[i] == static_cast<std::uint32_t>(bestTriangle))
+				{
+					list[i] = list[--remaining[v]];
+					break;
+				}
+			}
+		}
+		for (std::uint32_t v : cache)
+		{
+			if (v != corners[0] && v != corners[1] && v != corners[2])
+				nextCache.push_back(v);
+		}
+		cache.swap(nextCache);
+
+		// everything that moved in, moved inside or fell out of the cache gets rescored
+		for (std::uint32_t v : nextCache)
+			cachePosition[v] = -1;
+		for (size_t i = 0; i < cache.size(); ++i)
+			cachePosition[cache[i]] = i < static_cast<size_t>(cacheSize) ? static_cast<int>(i) : -1;
+
+		auto rescore = [&](std::uint32_t v)
+		{
+			float newScore = vertexScore(cachePosition[v], remaining[v]);
+			float delta = newScore - score[v];
+			score[v] = newScore;
+			for (std::uint32_t i = 0; i < remaining[v]; ++i)
+				triangleScore[triangleLists[listStart[v] + i]] += delta;
+		};
+		for (std::uint32_t v : nextCache)
+			rescore(v);
+		for (std::uint32_t v : cache)
+			rescore(v);
+
+		if (cache.size() > static_cast<size_t>(cacheSize))
+			cache.resize(cacheSize);
+
+		// the next triangle is the best one that touches the cache
+		bestTriangle = -1;
+		float bestScore = -1.0f;
+		for (std::uint32_t v : cache)
+		{
+			for (std::uint32_t i = 0; i < remaining[v]; ++i)
+			{
+				std::uint32_t t = triangleLists[listStart[v] + i];
+				if (triangleScore[t] > bestScore)
+				{
+					bestScore = triangleScore[t];
+					bestTriangle = static_cast<long>(t);
+				}
+			}
+		}
+	}
+
+	mesh.indices.swap(output);
+}
+
+void optimizeVertexFetch(IndexedMesh& mesh)
+{
+	const std::uint32_t unassigned = 0xFFFFFFFFu;
+	std::vector<std::uint32_t> remap(mesh.vertexCount(), unassigned);
+	std::vector<float> positions;
+	positions.reserve(mesh.positions.size());
+
+	for (std::uint32_t& index : mesh.indices)
+	{
+		if (remap[index] == unassigned)
+		{
+			remap[index] = static_cast<std::uint32_t>(positions.size() / 3);
+			positions.insert(positions.end(), &mesh.positions[3 * index], &mesh.positions[3 * index] + 3);
+		}
+		index = remap[index];
+	}
+
+	mesh.positions.swap(positions);		// unreferenced vertices are dropped on the way
+}
+
+double computeAcmr(const std::vector<std::uint32_t>& indices, int cacheSize)
+{
+	if (indices.size() < 3) return 0.0;
+
+	std::vector<std::uint32_t> fifo(cacheSize, 0xFFFFFFFFu);
+	size_t head = 0;
+	size_t misses = 0;
+
+	for (std::uint32_t index : indices)
+	{
+		if (std::find(fifo.begin(), fifo.end(), index) != fifo.end()) continue;
+
+		fifo[head] = index;
+		head = (head + 1) % fifo.size();
+		++misses;
+	}
+	return static_cast<double>(misses) / (indices.size() / 3);
+}
@@ -0,0 +1,36 @@
+#ifndef MESH_BUILDER_H
+#define MESH_BUILDER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Turns triangle soup (every triangle spells out its three xyz positions, like vertices1/vertices2)
+// into an indexed mesh: identical vertices are merged, triangles are reordered for the
+// post-transform vertex cache (Forsyth's linear-speed algorithm) and vertices are renumbered
+// in first-use order so fetches stay sequential.
+
+struct IndexedMesh
+{
+	std::vector<float> positions;			// xyz per vertex
+	std::vector<std::uint32_t> indices;		// 3 per triangle
+
+	size_t vertexCount() const { return positions.size() / 3; }
+	bool fitsIn16BitIndices() const { return vertexCount() <= 0xFFFF; }
+};
+
+struct MeshBuildReport
+{
+	size_t soupVertices;
+	size_t uniqueVertices;
+	double acmrBefore;		// average cache miss ratio: transformed vertices per triangle (lower is better)
+	double acmrAfter;
+};
+
+IndexedMesh buildIndexedMesh(const float* soupPositions, size_t soupVertexCount, MeshBuildReport* report = nullptr);
+void optimizeVertexCache(IndexedMesh& mesh);
+void optimizeVertexFetch(IndexedMesh& mesh);
+// simulated FIFO post-transform cache, the model most hardware is close to
+double computeAcmr(const std::vector<std::uint32_t>& indices, int cacheSize = 16);
+
+#endif
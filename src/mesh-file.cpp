@@ -0,0 +1,196 @@
+#include <glad/glad.h>
+#include "mesh-file.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <system_error>
+
+namespace
+{
+	size_t alignUp(size_t value)
+	{
+		return (value + meshBlobAlignment - 1) / meshBlobAlignment * meshBlobAlignment;
+	}
+
+	size_t indexSize(std::uint32_t indexType)
+	{
+		return indexType == GL_UNSIGNED_SHORT ? 2 : (indexType == GL_UNSIGNED_INT ? 4 : 0);
+	}
+
+	// bytes one attribute takes in a vertex, 0 for a type glVertexAttribPointer doesn't take
+	size_t attributeSize(std::uint32_t type, std::uint32_t components)
+	{
+		switch (type)
+		{
+		case GL_BYTE: case GL_UNSIGNED_BYTE: return components;
+		case GL_SHORT: case GL_UNSIGNED_SHORT: case GL_HALF_FLOAT: return 2 * components;
+		case GL_INT: case GL_UNSIGNED_INT: case GL_FLOAT: return 4 * components;
+		case GL_DOUBLE: return 8 * components;
+		case GL_INT_2_10_10_10_REV: case GL_UNSIGNED_INT_2_10_10_10_REV: return components == 4 ? 4 : 0;
+		default: return 0;
+		}
+	}
+
+	// every index has to name a vertex, or glDrawElements reads past the vertex buffer
+	template <typename Index>
+	bool indicesInRange(const char* data, std::uint32_t count, std::uint32_t vertexCount)
+	{
+		const Index* indices = reinterpret_cast<const Index*>(data);	// the blob is 64-byte aligned
+		for (std::uint32_t i = 0; i < count; ++i)
+			if (indices[i] >= vertexCount)
+				return false;
+		return true;
+	}
+
+	// a blob has to lie completely inside the file, without the offset + size overflowing
+	bool blobInside(std::uint64_t offset, std::uint64_t size, size_t fileSize)
+	{
+		return offset <= fileSize && size <= fileSize - offset;
+	}
+}
+
+
+bool MeshFile::open(const char* path)
+{
+	close();
+
+	file_ = MappedFile(path);
+	if (!file_.valid())
+	{
+		std::cout << "Failed to read mesh file " << path << "\n";
+		return false;
+	}
+
+	const size_t fileSize = file_.size();
+	const MeshFileHeader* header = reinterpret_cast<const MeshFileHeader*>(file_.data());
+	const char* problem = nullptr;
+
+	if (fileSize < sizeof(MeshFileHeader) || std::memcmp(header->magic, "GLMS", 4) != 0)
+		problem = "not a mesh file";
+	else if (header->version != meshFileVersion)
+		problem = "unsupported version";
+	else if (fileSize - sizeof(MeshFileHeader) < static_cast<std::uint64_t>(header->attributeCount) * sizeof(MeshFileAttribute))
+		problem = "truncated attribute table";
+	else if (!blobInside(header->vertexDataOffset, header->vertexDataSize, fileSize)
+		|| !blobInside(header->indexDataOffset, header->indexDataSize, fileSize))
+		problem = "truncated data";
+	else if (header->vertexDataOffset % meshBlobAlignment != 0 || header->indexDataOffset % meshBlobAlignment != 0)
+		problem = "misaligned data";
+	else if (header->indexCount > 0 && indexSize(header->indexType) == 0)
+		problem = "bad index type";
+	else if (static_cast<std::uint64_t>(header->vertexCount) * header->vertexStride != header->vertexDataSize
+		|| static_cast<std::uint64_t>(header->indexCount) * indexSize(header->indexType) != header->indexDataSize)
+		problem = "sizes don't match the counts";
+	else if (header->indexCount > 0 && !(header->indexType == GL_UNSIGNED_SHORT
+		? indicesInRange<std::uint16_t>(file_.data() + header->indexDataOffset, header->indexCount, header->vertexCount)
+		: indicesInRange<std::uint32_t>(file_.data() + header->indexDataOffset, header->indexCount, header->vertexCount)))
+		problem = "index past the last vertex";
+
+	if (problem == nullptr)
+	{
+		attributes_ = reinterpret_cast<const MeshFileAttribute*>(file_.data() + sizeof(MeshFileHeader));
+		for (std::uint32_t i = 0; i < header->attributeCount && problem == nullptr; ++i)
+		{
+			const MeshFileAttribute& attribute = attributes_[i];
+			size_t size = attribute.components >= 1 && attribute.components <= 4 ? attributeSize(attribute.type, attribute.components) : 0;
+			if (size == 0)
+				problem = "bad attribute type";
+			else if (attribute.location >= meshMaxAttributeLocations)
+				problem = "bad attribute location";
+			else if (static_cast<std::uint64_t>(attribute.offset) + size > header->vertexStride)
+				problem = "attribute outside the vertex";
+		}
+	}
+
+	if (problem != nullptr)
+	{
+		std::cout << "Rejected mesh file " << path << ": " << problem << "\n";
+		close();
+		return false;
+	}
+
+	header_ = header;
+	return true;
+}
+
+void MeshFile::close()
+{
+	file_ = MappedFile();
+	header_ = nullptr;
+	attributes_ = nullptr;
+}
+
+void MeshFile::setupAttributes() const
+{
+	for (std::uint32_t i = 0; i < header_->attributeCount; ++i)
+	{
+		const MeshFileAttribute& attribute = attributes_[i];
+		glVertexAttribPointer(attribute.location, attribute.components, attribute.type, attribute.normalized ? GL_TRUE : GL_FALSE,
+			static_cast<GLsizei>(header_->vertexStride), (void*)static_cast<size_t>(attribute.offset));
+		glEnableVertexAttribArray(attribute.location);
+	}
+}
+
+bool writeMeshFile(const char* path, const std::vector<MeshFileAttribute>& attributes, const void* vertices, size_t vertexStride,
+	size_t vertexCount, const void* indices, unsigned int indexType, size_t indexCount,
+	const float* positionScale, const float* positionOffset)
+{
+	MeshFileHeader header = {};
+	std::memcpy(header.magic, "GLMS", 4);
+	header.version = meshFileVersion;
+	header.attributeCount = static_cast<std::uint32_t>(attributes.size());
+	header.vertexCount = static_cast<std::uint32_t>(vertexCount);
+	header.vertexStride = static_cast<std::uint32_t>(vertexStride);
+	header.indexCount = indices != nullptr ? static_cast<std::uint32_t>(indexCount) : 0;
+	header.indexType = indices != nullptr ? indexType : 0;
+	header.vertexDataOffset = alignUp(sizeof(MeshFileHeader) + attributes.size() * sizeof(MeshFileAttribute));
+	header.vertexDataSize = vertexStride * vertexCount;
+	header.indexDataOffset = alignUp(header.vertexDataOffset + header.vertexDataSize);
+	header.indexDataSize = header.indexCount * indexSize(header.indexType);
+	if (positionScale != nullptr && positionOffset != nullptr)
+	{
+		header.flags |= MeshQuantizedPositions;
+		std::memcpy(header.positionScale, positionScale, sizeof(header.positionScale));
+		std::memcpy(header.positionOffset, positionOffset, sizeof(header.positionOffset));
+	}
+
+	// same as the program cache: write aside and rename, so readers never see half a file
+	std::filesystem::path temporaryPath = path;
+	temporaryPath += ".tmp";
+	{
+		std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+		if (!file)
+		{
+			std::cout << "Failed to write mesh file " << path << "\n";
+			return false;
+		}
+
+		const char padding[meshBlobAlignment] = {};
+		auto padTo = [&](std::uint64_t offset) {
+			file.write(padding, static_cast<std::streamsize>(offset - static_cast<std::uint64_t>(file.tellp())));
+		};
+
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		file.write(reinterpret_cast<const char*>(attributes.data()), attributes.size() * sizeof(MeshFileAttribute));
+		padTo(header.vertexDataOffset);
+		file.write(static_cast<const char*>(vertices), static_cast<std::streamsize>(header.vertexDataSize));
+		padTo(header.indexDataOffset);
+		if (header.indexDataSize > 0)
+			file.write(static_cast<const char*>(indices), static_cast<std::streamsize>(header.indexDataSize));
+		if (!file)
+		{
+			std::cout << "Failed to write mesh file " << path << "\n";
+			return false;
+		}
+	}
+
+	std::error_code error;
+	std::filesystem::rename(temporaryPath, path, error);
+	if (error)
+	{
+		std::cout << "Failed to write mesh file " << path << ": " << error.message() << "\n";
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,94 @@
+#ifndef MESH_FILE_H
+#define MESH_FILE_H
+
+#include "mapped-file.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Binary mesh container (.mesh), little-endian:
+//   MeshFileHeader | MeshFileAttribute[attributeCount] | vertex blob | index blob
+// Both blobs start on a meshBlobAlignment boundary and are stored exactly as the GPU reads them,
+// so loading is a mmap plus validation: the mapped pages go straight to glBufferData.
+// Any layout change bumps meshFileVersion; older versions are rejected, not converted.
+
+const std::uint32_t meshFileVersion = 1;
+const size_t meshBlobAlignment = 64;
+// attribute locations must be below this: GL 3.3's guaranteed GL_MAX_VERTEX_ATTRIBS, since files are
+// validated on IO threads without a context to ask
+const std::uint32_t meshMaxAttributeLocations = 16;
+
+enum MeshFileFlags : std::uint32_t
+{
+	MeshQuantizedPositions = 1,		// p = positionOffset + positionScale * unorm16 (see quantize.h)
+};
+
+struct MeshFileHeader
+{
+	char magic[4];					// "GLMS"
+	std::uint32_t version;
+	std::uint32_t flags;
+	std::uint32_t attributeCount;
+	std::uint32_t vertexCount;
+	std::uint32_t vertexStride;
+	std::uint32_t indexCount;
+	std::uint32_t indexType;		// GL_UNSIGNED_SHORT, GL_UNSIGNED_INT, or 0 without indices
+	std::uint64_t vertexDataOffset;
+	std::uint64_t vertexDataSize;
+	std::uint64_t indexDataOffset;
+	std::uint64_t indexDataSize;
+	float positionScale[3];
+	float positionOffset[3];
+};
+
+// one glVertexAttribPointer worth of layout
+struct MeshFileAttribute
+{
+	std::uint32_t location;
+	std::uint32_t type;				// GL enum
+	std::uint32_t components;
+	std::uint32_t normalized;
+	std::uint32_t offset;			// within a vertex
+};
+
+static_assert(sizeof(MeshFileHeader) == 88, "MeshFileHeader is part of the file format");
+static_assert(sizeof(MeshFileAttribute) == 20, "MeshFileAttribute is part of the file format");
+
+// describes a VertexFormat (see vertex-format.h) for writeMeshFile
+template <typename Format>
+std::vector<MeshFileAttribute> meshFileAttributes(unsigned int firstLocation = 0)
+{
+	std::vector<MeshFileAttribute> attributes;
+	Format::forEachAttribute(firstLocation, [&](unsigned int location, unsigned int type, int components, unsigned char normalized, size_t offset) {
+		attributes.push_back({ location, type, static_cast<std::uint32_t>(components), normalized, static_cast<std::uint32_t>(offset) });
+	});
+	return attributes;
+}
+
+class MeshFile
+{
+public:
+	// maps and validates; returns false (and prints why) for anything that isn't a current, intact mesh file
+	bool open(const char* path);
+	void close();
+
+	const MeshFileHeader& header() const { return *header_; }
+	const MeshFileAttribute* attributes() const { return attributes_; }
+	const void* vertexData() const { return file_.data() + header_->vertexDataOffset; }
+	const void* indexData() const { return header_->indexDataSize > 0 ? file_.data() + header_->indexDataOffset : nullptr; }
+
+	// glVertexAttribPointer + enable for every attribute, with the vertex buffer bound
+	void setupAttributes() const;
+
+private:
+	MappedFile file_;
+	const MeshFileHeader* header_ = nullptr;
+	const MeshFileAttribute* attributes_ = nullptr;
+};
+
+// positionScale/positionOffset may be null for unquantized meshes
+bool writeMeshFile(const char* path, const std::vector<MeshFileAttribute>& attributes, const void* vertices, size_t vertexStride,
+	size_t vertexCount, const void* indices, unsigned int indexType, size_t indexCount,
+	const float* positionScale = nullptr, const float* positionOffset = nullptr);
+
+#endif
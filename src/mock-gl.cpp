@@ -0,0 +1,1067 @@
+#include <glad/glad.h>
+#include "mock-gl.h"
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+	// every entry point the mock implements, mock<Name> below is looked up as gl<Name>
+#define MOCK_GL_ENTRY_POINTS(X) \
+	X(AttachShader) X(BeginQuery) X(BindBuffer) X(BindBufferBase) X(BindBufferRange) X(BindFramebuffer) \
+	X(BindRenderbuffer) X(BindTexture) X(BindVertexArray) X(BlendFunc) X(BlendFuncSeparate) X(BufferData) \
+	X(BufferSubData) X(CheckFramebufferStatus) X(Clear) X(ClearColor) X(ClientWaitSync) X(CompileShader) \
+	X(CreateProgram) X(CreateShader) X(DeleteBuffers) X(DeleteFramebuffers) X(DeleteProgram) X(DeleteQueries) \
+	X(DeleteRenderbuffers) X(DeleteShader) X(DeleteSync) X(DeleteTextures) X(DeleteVertexArrays) X(DepthFunc) \
+	X(DepthMask) X(Disable) X(DrawArrays) X(DrawArraysInstanced) X(DrawElements) X(Enable) \
+	X(EnableVertexAttribArray) X(EndQuery) X(FenceSync) X(Finish) X(Flush) X(FramebufferRenderbuffer) \
+	X(GenBuffers) X(GenFramebuffers) X(GenQueries) X(GenRenderbuffers) X(GenTextures) X(GenVertexArrays) \
+	X(GetError) X(GetIntegerv) X(GetProgramInfoLog) X(GetProgramiv) X(GetQueryObjectiv) X(GetQueryObjectui64v) \
+	X(GetQueryiv) X(GetShaderInfoLog) X(GetShaderiv) X(GetString) X(GetStringi) X(GetUniformBlockIndex) \
+	X(LinkProgram) X(MapBuffer) X(MapBufferRange) X(MultiDrawArrays) X(PixelStorei) X(ReadPixels) \
+	X(RenderbufferStorage) X(ShaderSource) X(UniformBlockBinding) X(UnmapBuffer) X(UseProgram) \
+	X(VertexAttribDivisor) X(VertexAttribPointer) X(Viewport)
+
+	enum EntryPoint
+	{
+#define MOCK_GL_ENUM(name) Entry##name,
+		MOCK_GL_ENTRY_POINTS(MOCK_GL_ENUM)
+#undef MOCK_GL_ENUM
+		EntryCount
+	};
+
+	struct Buffer
+	{
+		std::vector<char> data;
+		GLintptr mapOffset = 0;
+		GLsizeiptr mapLength = 0;
+		bool mapped = false;
+		bool mappedForWriting = false;
+	};
+
+	struct VertexArray
+	{
+		GLuint elementBuffer = 0;
+	};
+
+	struct Shader
+	{
+		GLenum type = 0;
+		std::string source;
+		bool compiled = false;
+	};
+
+	struct Program
+	{
+		std::vector<GLuint> shaders;
+		std::vector<std::string> uniformBlocks;		// found in the sources at link time
+		bool linked = false;
+		bool deletePending = false;					// deleted while current, goes once it isn't
+	};
+
+	struct Renderbuffer
+	{
+		GLsizei width = 0;
+		GLsizei height = 0;
+	};
+
+	struct Framebuffer
+	{
+		GLuint colorAttachment = 0;
+	};
+
+	struct Query
+	{
+		double start = 0.0;
+		GLuint64 result = 0;
+	};
+
+	struct Context
+	{
+		// one name counter for all kinds, so a name used as the wrong kind of object is an error
+		GLuint nextName = 1;
+		uintptr_t nextSync = 1;
+
+		std::unordered_map<GLuint, Buffer> buffers;
+		std::unordered_map<GLuint, VertexArray> vertexArrays;
+		std::unordered_map<GLuint, Shader> shaders;
+		std::unordered_map<GLuint, Program> programs;
+		std::unordered_map<GLuint, Renderbuffer> renderbuffers;
+		std::unordered_map<GLuint, Framebuffer> framebuffers;
+		std::unordered_set<GLuint> textures;
+		std::unordered_map<GLuint, Query> queries;
+		std::unordered_set<GLsync> syncs;
+
+		std::unordered_map<GLenum, GLuint> boundBuffers;	// all but GL_ELEMENT_ARRAY_BUFFER, that one is VAO state
+		VertexArray defaultVertexArray;
+		GLuint vertexArray = 0;
+		GLuint program = 0;
+		GLuint drawFramebuffer = 0;
+		GLuint readFramebuffer = 0;
+		GLuint renderbuffer = 0;
+		GLuint timeElapsedQuery = 0;
+		GLint packAlignment = 4;
+		GLint viewport[4] = { 0, 0, 0, 0 };
+		GLenum error = GL_NO_ERROR;
+	};
+
+	Context context;
+	MockGlStats stats = {};
+	MockGlCostModel cost;
+	unsigned long long callCounts[EntryCount] = {};
+
+	void called(EntryPoint entry)
+	{
+		++callCounts[entry];
+		++stats.calls;
+	}
+
+	// GL keeps the first error until glGetError reads it, the stats count them all
+	void setError(GLenum error)
+	{
+		++stats.errors;
+		if (context.error == GL_NO_ERROR)
+			context.error = error;
+	}
+
+	void charge(double nanoseconds)
+	{
+		stats.gpuNanoseconds += nanoseconds;
+	}
+
+	void upload(size_t bytes)
+	{
+		stats.uploadedBytes += bytes;
+		charge(cost.uploadByte * static_cast<double>(bytes));
+	}
+
+	template <typename Object>
+	void generate(std::unordered_map<GLuint, Object>& objects, GLsizei count, GLuint* names)
+	{
+		if (count < 0) return setError(GL_INVALID_VALUE);
+		for (GLsizei i = 0; i < count; ++i)
+		{
+			names[i] = context.nextName++;
+			objects.emplace(names[i], Object{});
+		}
+	}
+
+	// binding 0 or a name that was generated is fine, anything else isn't in a core context
+	template <typename Objects>
+	bool bindable(const Objects& objects, GLuint name)
+	{
+		if (name == 0 || objects.count(name) != 0) return true;
+		setError(GL_INVALID_OPERATION);
+		return false;
+	}
+
+	VertexArray& currentVertexArray()
+	{
+		auto found = context.vertexArrays.find(context.vertexArray);
+		return found != context.vertexArrays.end() ? found->second : context.defaultVertexArray;
+	}
+
+	GLuint boundBuffer(GLenum target)
+	{
+		if (target == GL_ELEMENT_ARRAY_BUFFER)
+			return currentVertexArray().elementBuffer;
+		auto found = context.boundBuffers.find(target);
+		return found != context.boundBuffers.end() ? found->second : 0;
+	}
+
+	Buffer* targetBuffer(GLenum target)
+	{
+		auto found = context.buffers.find(boundBuffer(target));
+		if (found != context.buffers.end()) return &found->second;
+		setError(GL_INVALID_OPERATION);
+		return nullptr;
+	}
+
+	Shader* findShader(GLuint name)
+	{
+		auto found = context.shaders.find(name);
+		if (found != context.shaders.end()) return &found->second;
+		setError(context.programs.count(name) != 0 ? GL_INVALID_OPERATION : GL_INVALID_VALUE);
+		return nullptr;
+	}
+
+	Program* findProgram(GLuint name)
+	{
+		auto found = context.programs.find(name);
+		if (found != context.programs.end()) return &found->second;
+		setError(context.shaders.count(name) != 0 ? GL_INVALID_OPERATION : GL_INVALID_VALUE);
+		return nullptr;
+	}
+
+	// "uniform Name {" declares a block, "uniform vec4 name;" doesn't
+	void findUniformBlocks(const std::string& source, std::vector<std::string>& blocks)
+	{
+		for (size_t at = source.find("uniform"); at != std::string::npos; at = source.find("uniform", at + 1))
+		{
+			size_t begin = at + 7;
+			if (begin >= source.size() || !std::isspace(static_cast<unsigned char>(source[begin]))) continue;
+			while (begin < source.size() && std::isspace(static_cast<unsigned char>(source[begin]))) ++begin;
+			size_t end = begin;
+			while (end < source.size() && (std::isalnum(static_cast<unsigned char>(source[end])) || source[end] == '_')) ++end;
+			size_t next = end;
+			while (next < source.size() && std::isspace(static_cast<unsigned char>(source[next]))) ++next;
+			if (end > begin && next < source.size() && source[next] == '{')
+				blocks.push_back(source.substr(begin, end - begin));
+		}
+	}
+
+	// shared by the draw calls: what has to be bound before anything can be drawn
+	bool drawable()
+	{
+		if (context.program != 0 && context.vertexArray != 0) return true;
+		setError(GL_INVALID_OPERATION);
+		return false;
+	}
+
+	void submit(GLsizei vertices, GLsizei instances)
+	{
+		unsigned long long submitted = static_cast<unsigned long long>(vertices) * static_cast<unsigned long long>(instances);
+		stats.vertices += submitted;
+		charge(cost.vertex * static_cast<double>(submitted));
+	}
+
+	void draw(GLsizei vertices, GLsizei instances)
+	{
+		if (vertices < 0 || instances < 0) return setError(GL_INVALID_VALUE);
+		++stats.drawCalls;
+		charge(cost.drawCall);
+		submit(vertices, instances);
+	}
+
+	void APIENTRY mockAttachShader(GLuint program, GLuint shader)
+	{
+		called(EntryAttachShader);
+		Program* attachedTo = findProgram(program);
+		if (attachedTo != nullptr && findShader(shader) != nullptr)
+			attachedTo->shaders.push_back(shader);
+	}
+
+	void APIENTRY mockBeginQuery(GLenum target, GLuint id)
+	{
+		called(EntryBeginQuery);
+		auto query = context.queries.find(id);
+		if (target != GL_TIME_ELAPSED || query == context.queries.end() || context.timeElapsedQuery != 0)
+			return setError(GL_INVALID_OPERATION);
+		context.timeElapsedQuery = id;
+		query->second.start = stats.gpuNanoseconds;
+	}
+
+	void APIENTRY mockBindBuffer(GLenum target, GLuint buffer)
+	{
+		called(EntryBindBuffer);
+		if (!bindable(context.buffers, buffer)) return;
+		if (target == GL_ELEMENT_ARRAY_BUFFER)
+			currentVertexArray().elementBuffer = buffer;
+		else
+			context.boundBuffers[target] = buffer;
+	}
+
+	void APIENTRY mockBindBufferBase(GLenum target, GLuint, GLuint buffer)
+	{
+		called(EntryBindBufferBase);
+		if (!bindable(context.buffers, buffer)) return;
+		context.boundBuffers[target] = buffer;
+		charge(cost.bufferBind);
+	}
+
+	void APIENTRY mockBindBufferRange(GLenum target, GLuint, GLuint buffer, GLintptr offset, GLsizeiptr size)
+	{
+		called(EntryBindBufferRange);
+		if (!bindable(context.buffers, buffer)) return;
+		auto found = context.buffers.find(buffer);
+		if (offset < 0 || size <= 0 || (found != context.buffers.end() && static_cast<size_t>(offset + size) > found->second.data.size()))
+			return setError(GL_INVALID_VALUE);
+		context.boundBuffers[target] = buffer;
+		charge(cost.bufferBind);
+	}
+
+	void APIENTRY mockBindFramebuffer(GLenum target, GLuint framebuffer)
+	{
+		called(EntryBindFramebuffer);
+		if (!bindable(context.framebuffers, framebuffer)) return;
+		if (target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER)
+			context.drawFramebuffer = framebuffer;
+		if (target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER)
+			context.readFramebuffer = framebuffer;
+	}
+
+	void APIENTRY mockBindRenderbuffer(GLenum, GLuint renderbuffer)
+	{
+		called(EntryBindRenderbuffer);
+		if (bindable(context.renderbuffers, renderbuffer))
+			context.renderbuffer = renderbuffer;
+	}
+
+	void APIENTRY mockBindTexture(GLenum, GLuint texture)
+	{
+		called(EntryBindTexture);
+		bindable(context.textures, texture);
+	}
+
+	void APIENTRY mockBindVertexArray(GLuint array)
+	{
+		called(EntryBindVertexArray);
+		if (!bindable(context.vertexArrays, array) || array == context.vertexArray) return;
+		context.vertexArray = array;
+		charge(cost.vertexArrayChange);
+	}
+
+	void APIENTRY mockBlendFunc(GLenum, GLenum)
+	{
+		called(EntryBlendFunc);
+	}
+
+	void APIENTRY mockBlendFuncSeparate(GLenum, GLenum, GLenum, GLenum)
+	{
+		called(EntryBlendFuncSeparate);
+	}
+
+	void APIENTRY mockBufferData(GLenum target, GLsizeiptr size, const void* data, GLenum)
+	{
+		called(EntryBufferData);
+		if (size < 0) return setError(GL_INVALID_VALUE);
+		Buffer* buffer = targetBuffer(target);
+		if (buffer == nullptr) return;
+		if (buffer->mapped) return setError(GL_INVALID_OPERATION);
+
+		buffer->data.assign(static_cast<size_t>(size), 0);
+		if (data != nullptr)
+		{
+			std::memcpy(buffer->data.data(), data, static_cast<size_t>(size));
+			upload(static_cast<size_t>(size));
+		}
+	}
+
+	void APIENTRY mockBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data)
+	{
+		called(EntryBufferSubData);
+		Buffer* buffer = targetBuffer(target);
+		if (buffer == nullptr) return;
+		if (offset < 0 || size < 0 || static_cast<size_t>(offset + size) > buffer->data.size())
+			return setError(GL_INVALID_VALUE);
+		if (buffer->mapped) return setError(GL_INVALID_OPERATION);
+
+		if (size > 0)
+			std::memcpy(buffer->data.data() + offset, data, static_cast<size_t>(size));
+		upload(static_cast<size_t>(size));
+	}
+
+	GLenum APIENTRY mockCheckFramebufferStatus(GLenum target)
+	{
+		called(EntryCheckFramebufferStatus);
+		GLuint bound = target == GL_READ_FRAMEBUFFER ? context.readFramebuffer : context.drawFramebuffer;
+		if (bound == 0) return GL_FRAMEBUFFER_COMPLETE;
+
+		GLuint attachment = context.framebuffers[bound].colorAttachment;
+		auto renderbuffer = context.renderbuffers.find(attachment);
+		if (renderbuffer == context.renderbuffers.end())
+			return GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT;
+		return renderbuffer->second.width > 0 && renderbuffer->second.height > 0 ? GL_FRAMEBUFFER_COMPLETE : GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT;
+	}
+
+	void APIENTRY mockClear(GLbitfield)
+	{
+		called(EntryClear);
+		charge(cost.clearPixel * static_cast<double>(context.viewport[2]) * static_cast<double>(context.viewport[3]));
+	}
+
+	void APIENTRY mockClearColor(GLfloat, GLfloat, GLfloat, GLfloat)
+	{
+		called(EntryClearColor);
+	}
+
+	// the mock GPU is always done
+	GLenum APIENTRY mockClientWaitSync(GLsync sync, GLbitfield, GLuint64)
+	{
+		called(EntryClientWaitSync);
+		if (context.syncs.count(sync) != 0) return GL_ALREADY_SIGNALED;
+		setError(GL_INVALID_VALUE);
+		return GL_WAIT_FAILED;
+	}
+
+	void APIENTRY mockCompileShader(GLuint shader)
+	{
+		called(EntryCompileShader);
+		if (Shader* compiled = findShader(shader))
+			compiled->compiled = !compiled->source.empty();
+	}
+
+	GLuint APIENTRY mockCreateProgram()
+	{
+		called(EntryCreateProgram);
+		GLuint name = context.nextName++;
+		context.programs.emplace(name, Program{});
+		return name;
+	}
+
+	GLuint APIENTRY mockCreateShader(GLenum type)
+	{
+		called(EntryCreateShader);
+		if (type != GL_VERTEX_SHADER && type != GL_FRAGMENT_SHADER && type != GL_GEOMETRY_SHADER)
+		{
+			setError(GL_INVALID_ENUM);
+			return 0;
+		}
+		GLuint name = context.nextName++;
+		context.shaders[name].type = type;
+		return name;
+	}
+
+	void APIENTRY mockDeleteBuffers(GLsizei count, const GLuint* buffers)
+	{
+		called(EntryDeleteBuffers);
+		for (GLsizei i = 0; i < count; ++i)
+		{
+			// deleting a bound buffer unbinds it, from the current VAO as well
+			for (auto& binding : context.boundBuffers)
+				if (binding.second == buffers[i]) binding.second = 0;
+			if (currentVertexArray().elementBuffer == buffers[i])
+				currentVertexArray().elementBuffer = 0;
+			context.buffers.erase(buffers[i]);
+		}
+	}
+
+	void APIENTRY mockDeleteFramebuffers(GLsizei count, const GLuint* framebuffers)
+	{
+		called(EntryDeleteFramebuffers);
+		for (GLsizei i = 0; i < count; ++i)
+		{
+			if (context.drawFramebuffer == framebuffers[i]) context.drawFramebuffer = 0;
+			if (context.readFramebuffer == framebuffers[i]) context.readFramebuffer = 0;
+			context.framebuffers.erase(framebuffers[i]);
+		}
+	}
+
+	void APIENTRY mockDeleteProgram(GLuint program)
+	{
+		called(EntryDeleteProgram);
+		if (program == 0) return;
+		if (program == context.program)
+		{
+			if (Program* current = findProgram(program))
+				current->deletePending = true;
+		}
+		else if (context.programs.erase(program) == 0)
+			setError(GL_INVALID_VALUE);
+	}
+
+	void APIENTRY mockDeleteQueries(GLsizei count, const GLuint* ids)
+	{
+		called(EntryDeleteQueries);
+		for (GLsizei i = 0; i < count; ++i)
+		{
+			if (context.timeElapsedQuery == ids[i]) context.timeElapsedQuery = 0;
+			context.queries.erase(ids[i]);
+		}
+	}
+
+	void APIENTRY mockDeleteRenderbuffers(GLsizei count, const GLuint* renderbuffers)
+	{
+		called(EntryDeleteRenderbuffers);
+		for (GLsizei i = 0; i < count; ++i)
+		{
+			if (context.renderbuffer == renderbuffers[i]) context.renderbuffer = 0;
+			context.renderbuffers.erase(renderbuffers[i]);
+		}
+	}
+
+	// attached shaders stay alive in GL until their program goes; linking only looks at the ones still here
+	void APIENTRY mockDeleteShader(GLuint shader)
+	{
+		called(EntryDeleteShader);
+		if (shader != 0 && context.shaders.erase(shader) == 0)
+			setError(GL_INVALID_VALUE);
+	}
+
+	void APIENTRY mockDeleteSync(GLsync sync)
+	{
+		called(EntryDeleteSync);
+		if (sync != nullptr && context.syncs.erase(sync) == 0)
+			setError(GL_INVALID_VALUE);
+	}
+
+	void APIENTRY mockDeleteTextures(GLsizei count, const GLuint* textures)
+	{
+		called(EntryDeleteTextures);
+		for (GLsizei i = 0; i < count; ++i)
+			context.textures.erase(textures[i]);
+	}
+
+	void APIENTRY mockDeleteVertexArrays(GLsizei count, const GLuint* arrays)
+	{
+		called(EntryDeleteVertexArrays);
+		for (GLsizei i = 0; i < count; ++i)
+		{
+			if (context.vertexArray == arrays[i]) context.vertexArray = 0;
+			context.vertexArrays.erase(arrays[i]);
+		}
+	}
+
+	void APIENTRY mockDepthFunc(GLenum)
+	{
+		called(EntryDepthFunc);
+	}
+
+	void APIENTRY mockDepthMask(GLboolean)
+	{
+		called(EntryDepthMask);
+	}
+
+	void APIENTRY mockDisable(GLenum)
+	{
+		called(EntryDisable);
+	}
+
+	void APIENTRY mockDrawArrays(GLenum, GLint, GLsizei count)
+	{
+		called(EntryDrawArrays);
+		if (drawable()) draw(count, 1);
+	}
+
+	void APIENTRY mockDrawArraysInstanced(GLenum, GLint, GLsizei count, GLsizei instanceCount)
+	{
+		called(EntryDrawArraysInstanced);
+		if (drawable()) draw(count, instanceCount);
+	}
+
+	// no client-side index arrays in a core context
+	void APIENTRY mockDrawElements(GLenum, GLsizei count, GLenum, const void*)
+	{
+		called(EntryDrawElements);
+		if (!drawable()) return;
+		if (currentVertexArray().elementBuffer == 0) return setError(GL_INVALID_OPERATION);
+		draw(count, 1);
+	}
+
+	void APIENTRY mockEnable(GLenum)
+	{
+		called(EntryEnable);
+	}
+
+	void APIENTRY mockEnableVertexAttribArray(GLuint)
+	{
+		called(EntryEnableVertexAttribArray);
+		if (context.vertexArray == 0) setError(GL_INVALID_OPERATION);
+	}
+
+	void APIENTRY mockEndQuery(GLenum target)
+	{
+		called(EntryEndQuery);
+		if (target != GL_TIME_ELAPSED || context.timeElapsedQuery == 0) return setError(GL_INVALID_OPERATION);
+		Query& query = context.queries[context.timeElapsedQuery];
+		query.result = stats.gpuNanoseconds > query.start ? static_cast<GLuint64>(stats.gpuNanoseconds - query.start) : 0;	// the stats may have been reset
+		context.timeElapsedQuery = 0;
+	}
+
+	GLsync APIENTRY mockFenceSync(GLenum, GLbitfield)
+	{
+		called(EntryFenceSync);
+		GLsync sync = reinterpret_cast<GLsync>(context.nextSync++);
+		context.syncs.insert(sync);
+		return sync;
+	}
+
+	void APIENTRY mockFinish()
+	{
+		called(EntryFinish);
+	}
+
+	void APIENTRY mockFlush()
+	{
+		called(EntryFlush);
+	}
+
+	void APIENTRY mockFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum, GLuint renderbuffer)
+	{
+		called(EntryFramebufferRenderbuffer);
+		GLuint bound = target == GL_READ_FRAMEBUFFER ? context.readFramebuffer : context.drawFramebuffer;
+		if (bound == 0 || !bindable(context.renderbuffers, renderbuffer)) return setError(GL_INVALID_OPERATION);
+		if (attachment == GL_COLOR_ATTACHMENT0)
+			context.framebuffers[bound].colorAttachment = renderbuffer;
+	}
+
+	void APIENTRY mockGenBuffers(GLsizei count, GLuint* buffers)
+	{
+		called(EntryGenBuffers);
+		generate(context.buffers, count, buffers);
+	}
+
+	void APIENTRY mockGenFramebuffers(GLsizei count, GLuint* framebuffers)
+	{
+		called(EntryGenFramebuffers);
+		generate(context.framebuffers, count, framebuffers);
+	}
+
+	void APIENTRY mockGenQueries(GLsizei count, GLuint* ids)
+	{
+		called(EntryGenQueries);
+		generate(context.queries, count, ids);
+	}
+
+	void APIENTRY mockGenRenderbuffers(GLsizei count, GLuint* renderbuffers)
+	{
+		called(EntryGenRenderbuffers);
+		generate(context.renderbuffers, count, renderbuffers);
+	}
+
+	void APIENTRY mockGenTextures(GLsizei count, GLuint* textures)
+	{
+		called(EntryGenTextures);
+		if (count < 0) return setError(GL_INVALID_VALUE);
+		for (GLsizei i = 0; i < count; ++i)
+		{
+			textures[i] = context.nextName++;
+			context.textures.insert(textures[i]);
+		}
+	}
+
+	void APIENTRY mockGenVertexArrays(GLsizei count, GLuint* arrays)
+	{
+		called(EntryGenVertexArrays);
+		generate(context.vertexArrays, count, arrays);
+	}
+
+	GLenum APIENTRY mockGetError()
+	{
+		called(EntryGetError);
+		GLenum error = context.error;
+		context.error = GL_NO_ERROR;
+		return error;
+	}
+
+	void APIENTRY mockGetIntegerv(GLenum name, GLint* data)
+	{
+		called(EntryGetIntegerv);
+		switch (name)
+		{
+		case GL_MAJOR_VERSION: *data = 3; break;
+		case GL_MINOR_VERSION: *data = 3; break;
+		case GL_NUM_EXTENSIONS: *data = 0; break;
+		case GL_NUM_PROGRAM_BINARY_FORMATS: *data = 0; break;
+		case GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT: *data = 256; break;
+		case GL_MAX_UNIFORM_BLOCK_SIZE: *data = 65536; break;
+		case GL_MAX_UNIFORM_BUFFER_BINDINGS: *data = 36; break;
+		case GL_MAX_VERTEX_ATTRIBS: *data = 16; break;
+		case GL_CURRENT_PROGRAM: *data = static_cast<GLint>(context.program); break;
+		case GL_VERTEX_ARRAY_BINDING: *data = static_cast<GLint>(context.vertexArray); break;
+		case GL_ARRAY_BUFFER_BINDING: *data = static_cast<GLint>(boundBuffer(GL_ARRAY_BUFFER)); break;
+		case GL_ELEMENT_ARRAY_BUFFER_BINDING: *data = static_cast<GLint>(boundBuffer(GL_ELEMENT_ARRAY_BUFFER)); break;
+		case GL_DRAW_FRAMEBUFFER_BINDING: *data = static_cast<GLint>(context.drawFramebuffer); break;
+		case GL_READ_FRAMEBUFFER_BINDING: *data = static_cast<GLint>(context.readFramebuffer); break;
+		case GL_VIEWPORT: std::memcpy(data, context.viewport, sizeof(context.viewport)); break;
+		default: setError(GL_INVALID_ENUM); break;
+		}
+	}
+
+	void infoLog(const char* log, GLsizei bufferSize, GLsizei* length, GLchar* out)
+	{
+		GLsizei written = 0;
+		if (bufferSize > 0)
+		{
+			written = static_cast<GLsizei>(std::strlen(log));
+			if (written > bufferSize - 1) written = bufferSize - 1;
+			std::memcpy(out, log, static_cast<size_t>(written));
+			out[written] = '\0';
+		}
+		if (length != nullptr) *length = written;
+	}
+
+	const char* programLog(const Program& program)
+	{
+		return program.linked ? "" : "mock GL: link failed, an attached shader is missing or didn't compile\n";
+	}
+
+	const char* shaderLog(const Shader& shader)
+	{
+		return shader.compiled ? "" : "mock GL: no source to compile\n";
+	}
+
+	void APIENTRY mockGetProgramInfoLog(GLuint program, GLsizei bufferSize, GLsizei* length, GLchar* log)
+	{
+		called(EntryGetProgramInfoLog);
+		if (Program* found = findProgram(program))
+			infoLog(programLog(*found), bufferSize, length, log);
+	}
+
+	void APIENTRY mockGetProgramiv(GLuint program, GLenum name, GLint* params)
+	{
+		called(EntryGetProgramiv);
+		Program* found = findProgram(program);
+		if (found == nullptr) return;
+		switch (name)
+		{
+		case GL_LINK_STATUS: *params = found->linked ? GL_TRUE : GL_FALSE; break;
+		case GL_COMPLETION_STATUS_KHR: *params = GL_TRUE; break;
+		case GL_DELETE_STATUS: *params = found->deletePending ? GL_TRUE : GL_FALSE; break;
+		case GL_ATTACHED_SHADERS: *params = static_cast<GLint>(found->shaders.size()); break;
+		case GL_ACTIVE_UNIFORM_BLOCKS: *params = static_cast<GLint>(found->uniformBlocks.size()); break;
+		case GL_PROGRAM_BINARY_LENGTH: *params = 0; break;
+		case GL_INFO_LOG_LENGTH:
+		{
+			size_t length = std::strlen(programLog(*found));
+			*params = length > 0 ? static_cast<GLint>(length + 1) : 0;
+			break;
+		}
+		default: setError(GL_INVALID_ENUM); break;
+		}
+	}
+
+	// what the cost model charged between glBeginQuery and glEndQuery, available right away
+	void APIENTRY mockGetQueryObjectiv(GLuint id, GLenum name, GLint* params)
+	{
+		called(EntryGetQueryObjectiv);
+		auto query = context.queries.find(id);
+		if (query == context.queries.end() || id == context.timeElapsedQuery) return setError(GL_INVALID_OPERATION);
+		if (name == GL_QUERY_RESULT_AVAILABLE)
+			*params = GL_TRUE;
+		else if (name == GL_QUERY_RESULT)
+			*params = static_cast<GLint>(query->second.result);
+		else
+			setError(GL_INVALID_ENUM);
+	}
+
+	void APIENTRY mockGetQueryObjectui64v(GLuint id, GLenum name, GLuint64* params)
+	{
+		called(EntryGetQueryObjectui64v);
+		auto query = context.queries.find(id);
+		if (query == context.queries.end() || id == context.timeElapsedQuery) return setError(GL_INVALID_OPERATION);
+		if (name == GL_QUERY_RESULT_AVAILABLE)
+			*params = GL_TRUE;
+		else if (name == GL_QUERY_RESULT)
+			*params = query->second.result;
+		else
+			setError(GL_INVALID_ENUM);
+	}
+
+	void APIENTRY mockGetQueryiv(GLenum target, GLenum name, GLint* params)
+	{
+		called(EntryGetQueryiv);
+		if (target != GL_TIME_ELAPSED) return setError(GL_INVALID_ENUM);
+		if (name == GL_QUERY_COUNTER_BITS)
+			*params = 64;
+		else if (name == GL_CURRENT_QUERY)
+			*params = static_cast<GLint>(context.timeElapsedQuery);
+		else
+			setError(GL_INVALID_ENUM);
+	}
+
+	void APIENTRY mockGetShaderInfoLog(GLuint shader, GLsizei bufferSize, GLsizei* length, GLchar* log)
+	{
+		called(EntryGetShaderInfoLog);
+		if (Shader* found = findShader(shader))
+			infoLog(shaderLog(*found), bufferSize, length, log);
+	}
+
+	void APIENTRY mockGetShaderiv(GLuint shader, GLenum name, GLint* params)
+	{
+		called(EntryGetShaderiv);
+		Shader* found = findShader(shader);
+		if (found == nullptr) return;
+		switch (name)
+		{
+		case GL_COMPILE_STATUS: *params = found->compiled ? GL_TRUE : GL_FALSE; break;
+		case GL_COMPLETION_STATUS_KHR: *params = GL_TRUE; break;
+		case GL_SHADER_TYPE: *params = static_cast<GLint>(found->type); break;
+		case GL_SHADER_SOURCE_LENGTH: *params = found->source.empty() ? 0 : static_cast<GLint>(found->source.size() + 1); break;
+		case GL_INFO_LOG_LENGTH:
+		{
+			size_t length = std::strlen(shaderLog(*found));
+			*params = length > 0 ? static_cast<GLint>(length + 1) : 0;
+			break;
+		}
+		default: setError(GL_INVALID_ENUM); break;
+		}
+	}
+
+	const GLubyte* APIENTRY mockGetString(GLenum name)
+	{
+		called(EntryGetString);
+		const char* value = nullptr;
+		switch (name)
+		{
+		case GL_VENDOR: value = "OpenGL-tutorial"; break;
+		case GL_RENDERER: value = "Mock GL (no rasterization)"; break;
+		case GL_VERSION: value = "3.3 (Core Profile) Mock GL"; break;
+		case GL_SHADING_LANGUAGE_VERSION: value = "3.30"; break;
+		default: setError(GL_INVALID_ENUM); break;		// GL_EXTENSIONS too, it's glGetStringi in a core context
+		}
+		return reinterpret_cast<const GLubyte*>(value);
+	}
+
+	const GLubyte* APIENTRY mockGetStringi(GLenum name, GLuint)
+	{
+		called(EntryGetStringi);
+		setError(name == GL_EXTENSIONS ? GL_INVALID_VALUE : GL_INVALID_ENUM);	// there are none
+		return nullptr;
+	}
+
+	GLuint APIENTRY mockGetUniformBlockIndex(GLuint program, const GLchar* name)
+	{
+		called(EntryGetUniformBlockIndex);
+		Program* found = findProgram(program);
+		if (found == nullptr) return GL_INVALID_INDEX;
+		if (!found->linked)
+		{
+			setError(GL_INVALID_OPERATION);
+			return GL_INVALID_INDEX;
+		}
+		for (size_t i = 0; i < found->uniformBlocks.size(); ++i)
+			if (found->uniformBlocks[i] == name) return static_cast<GLuint>(i);
+		return GL_INVALID_INDEX;
+	}
+
+	void APIENTRY mockLinkProgram(GLuint program)
+	{
+		called(EntryLinkProgram);
+		Program* found = findProgram(program);
+		if (found == nullptr) return;
+
+		found->linked = !found->shaders.empty();
+		found->uniformBlocks.clear();
+		for (GLuint name : found->shaders)
+		{
+			auto shader = context.shaders.find(name);
+			if (shader == context.shaders.end()) continue;		// deleted after attaching, still there for GL
+			found->linked = found->linked && shader->second.compiled;
+			findUniformBlocks(shader->second.source, found->uniformBlocks);
+		}
+	}
+
+	void* map(GLenum target, GLintptr offset, GLsizeiptr length, bool writing)
+	{
+		Buffer* buffer = targetBuffer(target);
+		if (buffer == nullptr) return nullptr;
+		if (offset < 0 || length <= 0 || static_cast<size_t>(offset + length) > buffer->data.size())
+		{
+			setError(GL_INVALID_VALUE);
+			return nullptr;
+		}
+		if (buffer->mapped)
+		{
+			setError(GL_INVALID_OPERATION);
+			return nullptr;
+		}
+		buffer->mapped = true;
+		buffer->mappedForWriting = writing;
+		buffer->mapOffset = offset;
+		buffer->mapLength = length;
+		return buffer->data.data() + offset;
+	}
+
+	void* APIENTRY mockMapBuffer(GLenum target, GLenum access)
+	{
+		called(EntryMapBuffer);
+		Buffer* buffer = targetBuffer(target);
+		if (buffer == nullptr) return nullptr;
+		return map(target, 0, static_cast<GLsizeiptr>(buffer->data.size()), access != GL_READ_ONLY);
+	}
+
+	void* APIENTRY mockMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+	{
+		called(EntryMapBufferRange);
+		if ((access & (GL_MAP_READ_BIT | GL_MAP_WRITE_BIT)) == 0)
+		{
+			setError(GL_INVALID_OPERATION);
+			return nullptr;
+		}
+		return map(target, offset, length, (access & GL_MAP_WRITE_BIT) != 0);
+	}
+
+	void APIENTRY mockMultiDrawArrays(GLenum, const GLint*, const GLsizei* count, GLsizei drawCount)
+	{
+		called(EntryMultiDrawArrays);
+		if (drawCount < 0) return setError(GL_INVALID_VALUE);
+		if (!drawable()) return;
+		for (GLsizei i = 0; i < drawCount; ++i)
+			if (count[i] < 0) return setError(GL_INVALID_VALUE);
+
+		++stats.drawCalls;
+		charge(cost.drawCall + cost.multiDrawItem * static_cast<double>(drawCount));
+		for (GLsizei i = 0; i < drawCount; ++i)
+			submit(count[i], 1);
+	}
+
+	void APIENTRY mockPixelStorei(GLenum name, GLint param)
+	{
+		called(EntryPixelStorei);
+		if (name == GL_PACK_ALIGNMENT)
+			context.packAlignment = param;
+	}
+
+	// the mock framebuffer is black
+	void APIENTRY mockReadPixels(GLint, GLint, GLsizei width, GLsizei height, GLenum format, GLenum type, void* pixels)
+	{
+		called(EntryReadPixels);
+		if (width < 0 || height < 0) return setError(GL_INVALID_VALUE);
+		size_t components = format == GL_RGBA || format == GL_BGRA ? 4 : format == GL_RGB || format == GL_BGR ? 3 : format == GL_RG ? 2 : 1;
+		size_t componentSize = type == GL_UNSIGNED_BYTE || type == GL_BYTE ? 1 : type == GL_UNSIGNED_SHORT || type == GL_SHORT || type == GL_HALF_FLOAT ? 2 : 4;
+		size_t alignment = context.packAlignment > 0 ? static_cast<size_t>(context.packAlignment) : 1;
+		size_t row = static_cast<size_t>(width) * components * componentSize;
+		size_t stride = (row + alignment - 1) / alignment * alignment;
+		size_t bytes = height > 0 ? stride * static_cast<size_t>(height - 1) + row : 0;
+
+		if (boundBuffer(GL_PIXEL_PACK_BUFFER) == 0 && pixels != nullptr)
+			std::memset(pixels, 0, bytes);
+		charge(cost.readbackByte * static_cast<double>(bytes));
+	}
+
+	void APIENTRY mockRenderbufferStorage(GLenum, GLenum, GLsizei width, GLsizei height)
+	{
+		called(EntryRenderbufferStorage);
+		if (context.renderbuffer == 0) return setError(GL_INVALID_OPERATION);
+		if (width < 0 || height < 0) return setError(GL_INVALID_VALUE);
+		context.renderbuffers[context.renderbuffer] = { width, height };
+	}
+
+	void APIENTRY mockShaderSource(GLuint shader, GLsizei count, const GLchar* const* strings, const GLint* lengths)
+	{
+		called(EntryShaderSource);
+		if (count < 0) return setError(GL_INVALID_VALUE);
+		Shader* found = findShader(shader);
+		if (found == nullptr) return;
+		found->source.clear();
+		for (GLsizei i = 0; i < count; ++i)
+		{
+			if (lengths != nullptr && lengths[i] >= 0)
+				found->source.append(strings[i], static_cast<size_t>(lengths[i]));
+			else
+				found->source.append(strings[i]);
+		}
+	}
+
+	void APIENTRY mockUniformBlockBinding(GLuint program, GLuint blockIndex, GLuint)
+	{
+		called(EntryUniformBlockBinding);
+		Program* found = findProgram(program);
+		if (found != nullptr && blockIndex >= found->uniformBlocks.size())
+			setError(GL_INVALID_VALUE);
+	}
+
+	GLboolean APIENTRY mockUnmapBuffer(GLenum target)
+	{
+		called(EntryUnmapBuffer);
+		Buffer* buffer = targetBuffer(target);
+		if (buffer == nullptr) return GL_FALSE;
+		if (!buffer->mapped)
+		{
+			setError(GL_INVALID_OPERATION);
+			return GL_FALSE;
+		}
+		if (buffer->mappedForWriting)
+			upload(static_cast<size_t>(buffer->mapLength));
+		buffer->mapped = false;
+		return GL_TRUE;
+	}
+
+	void APIENTRY mockUseProgram(GLuint program)
+	{
+		called(EntryUseProgram);
+		if (program == context.program) return;
+		if (program != 0)
+		{
+			Program* found = findProgram(program);
+			if (found == nullptr) return;
+			if (!found->linked) return setError(GL_INVALID_OPERATION);
+		}
+
+		auto previous = context.programs.find(context.program);
+		if (previous != context.programs.end() && previous->second.deletePending)
+			context.programs.erase(previous);
+		context.program = program;
+		++stats.programChanges;
+		charge(cost.programChange);
+	}
+
+	void APIENTRY mockVertexAttribDivisor(GLuint, GLuint)
+	{
+		called(EntryVertexAttribDivisor);
+		if (context.vertexArray == 0) setError(GL_INVALID_OPERATION);
+	}
+
+	void APIENTRY mockVertexAttribPointer(GLuint, GLint, GLenum, GLboolean, GLsizei, const void*)
+	{
+		called(EntryVertexAttribPointer);
+		// core contexts need a VAO and a buffer to point into
+		if (context.vertexArray == 0 || boundBuffer(GL_ARRAY_BUFFER) == 0) setError(GL_INVALID_OPERATION);
+	}
+
+	void APIENTRY mockViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+	{
+		called(EntryViewport);
+		if (width < 0 || height < 0) return setError(GL_INVALID_VALUE);
+		context.viewport[0] = x;
+		context.viewport[1] = y;
+		context.viewport[2] = width;
+		context.viewport[3] = height;
+	}
+
+	struct Entry
+	{
+		const char* name;
+		void* proc;
+	};
+
+	const Entry entries[EntryCount] = {
+#define MOCK_GL_ENTRY(name) { "gl" #name, reinterpret_cast<void*>(&mock##name) },
+		MOCK_GL_ENTRY_POINTS(MOCK_GL_ENTRY)
+#undef MOCK_GL_ENTRY
+	};
+
+	int findEntry(const char* name)
+	{
+		for (int i = 0; i < EntryCount; ++i)
+			if (std::strcmp(entries[i].name, name) == 0) return i;
+		return -1;
+	}
+}
+
+void* mockGlGetProcAddress(const char* name)
+{
+	int entry = findEntry(name);
+	return entry >= 0 ? entries[entry].proc : nullptr;
+}
+
+void setMockGlCostModel(const MockGlCostModel& model)
+{
+	cost = model;
+}
+
+MockGlStats mockGlStats()
+{
+	MockGlStats current = stats;
+	current.liveObjects = context.buffers.size() + context.vertexArrays.size() + context.shaders.size() + context.programs.size()
+		+ context.renderbuffers.size() + context.framebuffers.size() + context.textures.size() + context.queries.size() + context.syncs.size();
+	// a program deleted while current lingers for GL, but the application is done with it
+	auto program = context.programs.find(context.program);
+	if (program != context.programs.end() && program->second.deletePending)
+		--current.liveObjects;
+	return current;
+}
+
+unsigned long long mockGlCallCount(const char* name)
+{
+	int entry = findEntry(name);
+	return entry >= 0 ? callCounts[entry] : 0;
+}
+
+void resetMockGlStats()
+{
+	stats = {};
+	for (unsigned long long& count : callCounts)
+		count = 0;
+}
+
+void resetMockGl()
+{
+	context = Context{};
+	resetMockGlStats();
+}
@@ -0,0 +1,44 @@
+#ifndef MOCK_GL_H
+#define MOCK_GL_H
+
+// A GL 3.3 core "driver" without a GPU, for benchmarking the submission code on machines that have
+// none: pass mockGlGetProcAddress to gladLoadGLLoader(Lazy) instead of glfwGetProcAddress. It keeps
+// the object bookkeeping (names, buffer contents, mappings, VAO and program state) and GL errors,
+// counts the calls, and charges every call to a simple cost model instead of rasterizing anything.
+// It advertises no extensions. Only the entry points src/ uses are there, the rest load as NULL.
+// Like a real context it has one current thread at a time; nothing is synchronized.
+
+// rough GPU-side costs in nanoseconds, the defaults are in the ballpark of a mid-range desktop GPU
+struct MockGlCostModel
+{
+	double drawCall = 1000.0;			// fixed cost of every draw command
+	double multiDrawItem = 20.0;		// per draw inside a glMultiDraw* command
+	double vertex = 0.5;				// per vertex and instance
+	double programChange = 2000.0;
+	double vertexArrayChange = 300.0;
+	double bufferBind = 50.0;			// indexed uniform buffer bindings
+	double clearPixel = 0.01;			// per viewport pixel
+	double uploadByte = 0.1;			// glBufferData, glBufferSubData and flushed mappings
+	double readbackByte = 0.2;
+};
+
+struct MockGlStats
+{
+	unsigned long long calls;
+	unsigned long long drawCalls;		// commands, a glMultiDraw* is one
+	unsigned long long vertices;		// summed over instances
+	unsigned long long uploadedBytes;
+	unsigned long long programChanges;
+	unsigned long long errors;			// every call that set a GL error, not just the first one
+	unsigned long long liveObjects;		// buffers, VAOs, shaders, programs, ... not deleted yet
+	double gpuNanoseconds;				// what the cost model says the GPU spent
+};
+
+void* mockGlGetProcAddress(const char* name);
+void setMockGlCostModel(const MockGlCostModel& model);
+MockGlStats mockGlStats();
+unsigned long long mockGlCallCount(const char* name);	// e.g. "glDrawArrays"
+void resetMockGlStats();			// the counters only, objects stay
+void resetMockGl();					// back to a fresh context, e.g. between tests
+
+#endif
@@ -0,0 +1,79 @@
+#include <glad/glad.h>
+#include "offscreen.h"
+#include "gpu-resources.h"
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+	GpuFramebuffer FBO;
+	GpuRenderbuffer colorRenderbuffer;
+	int framebufferWidth;
+	int framebufferHeight;
+}
+
+
+bool initOffscreenFramebuffer(int width, int height)
+{
+	framebufferWidth = width;
+	framebufferHeight = height;
+
+	// the color attachment is a plain renderbuffer - we never sample from it, only read it back
+	colorRenderbuffer = GpuRenderbuffer::create();
+	glBindRenderbuffer(GL_RENDERBUFFER, colorRenderbuffer.name());
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+	setGpuResourceBytes(colorRenderbuffer.handle(), static_cast<size_t>(width) * height * 4);
+
+	FBO = GpuFramebuffer::create();
+	glBindFramebuffer(GL_FRAMEBUFFER, FBO.name());
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorRenderbuffer.name());
+
+	if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+	{
+		std::cout << "Offscreen framebuffer is incomplete!\n";
+		return false;
+	}
+
+	// leave it bound, every subsequent draw goes here
+	glViewport(0, 0, width, height);
+	return true;
+}
+
+bool saveOffscreenFramebuffer(const char* path)
+{
+	std::vector<unsigned char> pixels(static_cast<size_t>(framebufferWidth) * framebufferHeight * 3);
+
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, FBO.name());
+	glPixelStorei(GL_PACK_ALIGNMENT, 1);
+	glReadPixels(0, 0, framebufferWidth, framebufferHeight, GL_RGB, GL_UNSIGNED_BYTE, pixels.data());
+
+	std::ofstream file(path, std::ios::binary);
+	if (!file)
+	{
+		std::cout << "Failed to open " << path << " for writing\n";
+		return false;
+	}
+
+	file << "P6\n" << framebufferWidth << " " << framebufferHeight << "\n255\n";
+
+	// GL rows go bottom-up, PPM rows go top-down
+	const size_t rowSize = static_cast<size_t>(framebufferWidth) * 3;
+	for (int row = framebufferHeight - 1; row >= 0; --row)
+		file.write(reinterpret_cast<const char*>(pixels.data() + row * rowSize), rowSize);
+
+	file.close();
+	if (!file)
+	{
+		std::cout << "Failed to write " << path << "\n";
+		return false;
+	}
+	return true;
+}
+
+void cleanUpOffscreenFramebuffer()
+{
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	FBO.reset();
+	colorRenderbuffer.reset();
+}
@@ -0,0 +1,9 @@
+#ifndef OFFSCREEN_H
+#define OFFSCREEN_H
+
+// framebuffer object used instead of the default framebuffer when running headless
+bool initOffscreenFramebuffer(int width, int height);
+bool saveOffscreenFramebuffer(const char* path);	// binary PPM (P6), false if it couldn't be written
+void cleanUpOffscreenFramebuffer();
+
+#endif
@@ -0,0 +1,177 @@
+#include "options.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace
+{
+	void printUsage(const char* program)
+	{
+		std::cout << "Usage: " << program << " [options]\n"
+			"  --headless          render offscreen without a display (GLFW null platform + OSMesa)\n"
+			"  --size WxH          framebuffer size (default 800x600)\n"
+			"  --frames N          stop after N frames (default: 300 when headless, unlimited otherwise)\n"
+			"  --output FILE.ppm   write the last rendered frame to a file\n"
+			"  --mode MODE         separate (default), batched, streaming, indexed or instanced\n"
+			"  --shapes N          number of triangles (indexed: quads, instanced: instances) to draw (default 2)\n"
+			"  --shader-dir DIR    load *-shader.txt files from DIR (default: the source directory)\n"
+			"  --hot-reload        recompile shaders whenever their files change\n"
+			"  --shader-cache DIR  cache linked program binaries in DIR to skip shader compilation on later runs\n"
+			"  --profile FILE      record per-phase CPU/GPU frame times (FILE.json: Chrome trace, otherwise CSV)\n"
+			"  --pacing MODE       uncapped, vsync (default), adaptive (late frames tear instead of waiting)\n"
+			"                      or on-demand (render only after input or window damage)\n"
+			"  --fps N             cap the frame rate at N without vsync\n"
+			"  --quantize          indexed mode: store positions as 16-bit unorm and report the precision loss\n"
+			"  --mesh FILE.mesh    indexed mode: stream the mesh in from a mesh file, drawing the built one until it's there\n"
+			"  --save-mesh FILE    indexed mode: write the built (and maybe quantized) mesh to a mesh file\n"
+			"  --no-state-cache    pass every GL state change on to the driver, even redundant ones\n"
+			"  --eager-gl          look up every GL function at startup instead of on first use\n"
+			"  --render-thread N   record draw commands on N threads and submit them from a dedicated GL thread\n"
+			"  --io-threads N      threads loading streamed assets (default 1)\n"
+			"  --upload-budget KB  most streamed asset data uploaded per frame (default 2048)\n";
+#ifdef GL_TRACE
+		std::cout << "  --trace FILE        record every GL call into FILE, to be replayed with glreplay\n";
+#endif
+	}
+}
+
+
+bool parseOptions(int argc, char** argv, AppOptions& options)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		const char* arg = argv[i];
+		bool hasValue = i + 1 < argc;
+
+		if (std::strcmp(arg, "--headless") == 0)
+			options.headless = true;
+		else if (std::strcmp(arg, "--size") == 0 && hasValue)
+		{
+			if (std::sscanf(argv[++i], "%dx%d", &options.width, &options.height) != 2 || options.width <= 0 || options.height <= 0)
+			{
+				std::cout << "Invalid framebuffer size: " << argv[i] << "\n";
+				return false;
+			}
+		}
+		else if (std::strcmp(arg, "--frames") == 0 && hasValue)
+			options.frameLimit = std::atoi(argv[++i]);
+		else if (std::strcmp(arg, "--output") == 0 && hasValue)
+			options.outputPath = argv[++i];
+		else if (std::strcmp(arg, "--mode") == 0 && hasValue)
+		{
+			const char* mode = argv[++i];
+			if (std::strcmp(mode, "separate") == 0)
+				options.renderMode = RenderMode::Separate;
+			else if (std::strcmp(mode, "batched") == 0)
+				options.renderMode = RenderMode::Batched;
+			else if (std::strcmp(mode, "streaming") == 0)
+				options.renderMode = RenderMode::Streaming;
+			else if (std::strcmp(mode, "indexed") == 0)
+				options.renderMode = RenderMode::Indexed;
+			else if (std::strcmp(mode, "instanced") == 0)
+				options.renderMode = RenderMode::Instanced;
+			else
+			{
+				std::cout << "Unknown render mode: " << mode << "\n";
+				return false;
+			}
+		}
+		else if (std::strcmp(arg, "--shapes") == 0 && hasValue)
+			options.shapeCount = std::atoi(argv[++i]);
+		else if (std::strcmp(arg, "--shader-dir") == 0 && hasValue)
+			options.shaderDirectory = argv[++i];
+		else if (std::strcmp(arg, "--hot-reload") == 0)
+			options.hotReload = true;
+		else if (std::strcmp(arg, "--shader-cache") == 0 && hasValue)
+			options.shaderCacheDirectory = argv[++i];
+		else if (std::strcmp(arg, "--profile") == 0 && hasValue)
+			options.profilePath = argv[++i];
+		else if (std::strcmp(arg, "--pacing") == 0 && hasValue)
+		{
+			const char* mode = argv[++i];
+			if (std::strcmp(mode, "uncapped") == 0)
+				options.pacingMode = PacingMode::Uncapped;
+			else if (std::strcmp(mode, "vsync") == 0)
+				options.pacingMode = PacingMode::VSync;
+			else if (std::strcmp(mode, "adaptive") == 0)
+				options.pacingMode = PacingMode::AdaptiveVsync;
+			else if (std::strcmp(mode, "on-demand") == 0)
+				options.pacingMode = PacingMode::OnDemand;
+			else
+			{
+				std::cout << "Unknown pacing mode: " << mode << "\n";
+				return false;
+			}
+			options.pacingSet = true;
+		}
+		else if (std::strcmp(arg, "--fps") == 0 && hasValue)
+		{
+			options.targetFps = std::atof(argv[++i]);
+			if (options.targetFps <= 0.0)
+			{
+				std::cout << "Invalid frame rate: " << argv[i] << "\n";
+				return false;
+			}
+			options.pacingMode = PacingMode::Capped;
+			options.pacingSet = true;
+		}
+		else if (std::strcmp(arg, "--quantize") == 0)
+			options.quantizeMesh = true;
+		else if (std::strcmp(arg, "--mesh") == 0 && hasValue)
+			options.meshPath = argv[++i];
+		else if (std::strcmp(arg, "--save-mesh") == 0 && hasValue)
+			options.saveMeshPath = argv[++i];
+		else if (std::strcmp(arg, "--no-state-cache") == 0)
+			options.stateCache = false;
+		else if (std::strcmp(arg, "--eager-gl") == 0)
+			options.lazyGlLoading = false;
+#ifdef GL_TRACE
+		else if (std::strcmp(arg, "--trace") == 0 && hasValue)
+			options.tracePath = argv[++i];
+#endif
+		else if (std::strcmp(arg, "--render-thread") == 0 && hasValue)
+		{
+			options.recordThreads = std::atoi(argv[++i]);
+			if (options.recordThreads <= 0)
+			{
+				std::cout << "Invalid record thread count: " << argv[i] << "\n";
+				return false;
+			}
+		}
+		else if (std::strcmp(arg, "--io-threads") == 0 && hasValue)
+		{
+			options.ioThreads = std::atoi(argv[++i]);
+			if (options.ioThreads <= 0)
+			{
+				std::cout << "Invalid IO thread count: " << argv[i] << "\n";
+				return false;
+			}
+		}
+		else if (std::strcmp(arg, "--upload-budget") == 0 && hasValue)
+		{
+			int kilobytes = std::atoi(argv[++i]);
+			if (kilobytes <= 0)
+			{
+				std::cout << "Invalid upload budget: " << argv[i] << "\n";
+				return false;
+			}
+			options.uploadBudget = static_cast<size_t>(kilobytes) * 1024;
+		}
+		else
+		{
+			printUsage(argv[0]);
+			return false;
+		}
+	}
+
+	// there is nobody to close a headless window, so never loop forever
+	if (options.headless && options.frameLimit <= 0)
+		options.frameLimit = 300;
+
+	// offscreen frames are never presented, so there is nothing to sync to
+	if (options.headless && !options.pacingSet)
+		options.pacingMode = PacingMode::Uncapped;
+
+	return true;
+}
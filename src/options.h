@@ -0,0 +1,50 @@
+#ifndef OPTIONS_H
+#define OPTIONS_H
+
+#include "frame-scheduler.h"
+#include <cstddef>
+
+#ifndef SHADER_DIRECTORY
+#define SHADER_DIRECTORY "."
+#endif
+
+enum class RenderMode
+{
+	Separate,		// one program + VAO + glDrawArrays per triangle
+	Batched,		// everything in one buffer, one glMultiDrawArrays
+	Streaming,		// batched, but the vertices are rewritten every frame through a stream buffer
+	Indexed,		// deduplicated, cache-optimized indexed mesh drawn with glDrawElements
+	Instanced		// one mesh, per-instance attributes streamed every frame, one glDrawArraysInstanced
+};
+
+struct AppOptions
+{
+	bool headless = false;				// null platform + OSMesa, render into an offscreen framebuffer
+	int width = 800;
+	int height = 600;
+	int frameLimit = 0;					// 0 - render until the window is closed
+	const char* outputPath = nullptr;	// where to dump the last rendered frame (.ppm), if anywhere
+	RenderMode renderMode = RenderMode::Separate;
+	int shapeCount = 2;					// how many triangles (quads when indexed) the scene has
+	const char* shaderDirectory = SHADER_DIRECTORY;	// where vertex-shader.txt & co. are loaded from
+	bool hotReload = false;				// recompile shaders when their files change
+	const char* shaderCacheDirectory = nullptr;	// program binary cache, disabled when not set
+	const char* profilePath = nullptr;	// per-phase frame timings, CSV or Chrome trace (.json)
+	PacingMode pacingMode = PacingMode::VSync;	// headless defaults to uncapped
+	double targetFps = 0.0;				// only used by the capped mode
+	bool pacingSet = false;				// --pacing or --fps was given explicitly
+	bool quantizeMesh = false;			// indexed mode: 16-bit quantized positions instead of floats
+	const char* meshPath = nullptr;		// indexed mode: stream the mesh in from this file, the built one stands in meanwhile
+	const char* saveMeshPath = nullptr;	// indexed mode: write the built mesh to this file
+	int ioThreads = 1;					// asset streaming
+	size_t uploadBudget = 2048 * 1024;	// bytes of streamed assets uploaded per frame at most
+	bool stateCache = true;				// drop redundant binds and state changes before they reach the driver
+	bool lazyGlLoading = true;			// look GL functions up on their first call instead of all at startup
+	const char* tracePath = nullptr;	// GL_TRACE builds: record every GL call for glreplay
+	int recordThreads = 0;				// > 0: record commands on that many threads, replay on a render thread
+};
+
+// returns false (and prints usage) if the command line could not be parsed
+bool parseOptions(int argc, char** argv, AppOptions& options);
+
+#endif
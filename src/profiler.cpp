@@ -0,0 +1,262 @@
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include "profiler.h"
+#include "ring-buffer.h"
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	struct Sample
+	{
+		std::uint64_t frame;
+		std::uint64_t start;	// timer ticks
+		std::uint64_t end;
+		ProfilePhase phase;
+		int drawIndex;
+	};
+
+	// enough for a few seconds of frames even if the collector gets descheduled
+	RingBuffer<Sample, 1 << 16> samples;
+	std::vector<Sample> collected;
+	std::thread collector;
+	std::atomic<bool> collecting{ false };
+	std::uint64_t droppedSamples = 0;
+
+	bool enabled = false;
+	std::uint64_t timerFrequency = 1;
+	std::uint64_t frameIndex = 0;
+
+	// GL_TIME_ELAPSED results arrive a few frames late, so keep a small ring of queries in flight
+	const int gpuQueryCount = 4;
+	bool gpuTimers = false;
+	unsigned int gpuQueries[gpuQueryCount];
+	bool gpuQueryPending[gpuQueryCount];
+	std::uint64_t gpuQueryFrame[gpuQueryCount];
+	std::uint64_t gpuQueryStart[gpuQueryCount];
+
+	void collect()
+	{
+		Sample sample;
+		while (samples.pop(sample))
+			collected.push_back(sample);
+	}
+
+	void collectorThread()
+	{
+		while (collecting.load(std::memory_order_acquire))
+		{
+			collect();
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		}
+		collect();
+	}
+
+	void pushSample(const Sample& sample)
+	{
+		if (!samples.push(sample))
+			++droppedSamples;
+	}
+
+	void resolveGpuQuery(int slot, bool wait)
+	{
+		if (!gpuQueryPending[slot]) return;
+
+		if (!wait)
+		{
+			GLint available = 0;
+			glGetQueryObjectiv(gpuQueries[slot], GL_QUERY_RESULT_AVAILABLE, &available);
+			if (!available) return;
+		}
+
+		GLuint64 elapsedNs = 0;
+		glGetQueryObjectui64v(gpuQueries[slot], GL_QUERY_RESULT, &elapsedNs);
+		gpuQueryPending[slot] = false;
+
+		// GPU duration is anchored at the CPU start of the frame that issued it
+		std::uint64_t start = gpuQueryStart[slot];
+		std::uint64_t ticks = static_cast<std::uint64_t>(elapsedNs * (static_cast<double>(timerFrequency) / 1e9));
+		pushSample({ gpuQueryFrame[slot], start, start + ticks, ProfilePhase::Gpu, -1 });
+	}
+
+	const char* phaseName(ProfilePhase phase)
+	{
+		switch (phase)
+		{
+		case ProfilePhase::Input: return "processInput";
+		case ProfilePhase::Clear: return "clear";
+		case ProfilePhase::Draw: return "draw";
+		case ProfilePhase::Swap: return "swap";
+		case ProfilePhase::Poll: return "poll";
+		case ProfilePhase::Gpu: return "gpu";
+		}
+		return "unknown";
+	}
+
+	double toMicroseconds(std::uint64_t ticks)
+	{
+		return ticks * 1e6 / static_cast<double>(timerFrequency);
+	}
+
+	// GPU samples are anchored slightly before the first CPU phase of their frame, so look for the real minimum
+	std::uint64_t earliestStart()
+	{
+		std::uint64_t earliest = collected.front().start;
+		for (const Sample& sample : collected)
+			earliest = sample.start < earliest ? sample.start : earliest;
+		return earliest;
+	}
+
+	bool writeCsv(std::ofstream& file)
+	{
+		file << "frame,phase,draw,start_us,duration_us\n";
+		const std::uint64_t base = earliestStart();
+		for (const Sample& sample : collected)
+		{
+			file << sample.frame << "," << phaseName(sample.phase) << "," << sample.drawIndex << ","
+				<< toMicroseconds(sample.start - base) << ","
+				<< toMicroseconds(sample.end - sample.start) << "\n";
+		}
+		return static_cast<bool>(file);
+	}
+
+	bool writeChromeTrace(std::ofstream& file)
+	{
+		// complete ("X") events; CPU phases on tid 1, GPU frames on tid 2
+		file << "{\"traceEvents\":[\n";
+		const std::uint64_t base = earliestStart();
+		for (size_t i = 0; i < collected.size(); ++i)
+		{
+			const Sample& sample = collected[i];
+			file << "{\"name\":\"" << phaseName(sample.phase);
+			if (sample.phase == ProfilePhase::Draw)
+				file << " " << sample.drawIndex;
+			file << "\",\"cat\":\"" << (sample.phase == ProfilePhase::Gpu ? "gpu" : "cpu")
+				<< "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << (sample.phase == ProfilePhase::Gpu ? 2 : 1)
+				<< ",\"ts\":" << toMicroseconds(sample.start - base)
+				<< ",\"dur\":" << toMicroseconds(sample.end - sample.start)
+				<< ",\"args\":{\"frame\":" << sample.frame << "}}"
+				<< (i + 1 < collected.size() ? ",\n" : "\n");
+		}
+		file << "],\"displayTimeUnit\":\"ms\"}\n";
+		return static_cast<bool>(file);
+	}
+}
+
+
+void profilerInit(bool enableGpuTimers)
+{
+	enabled = true;
+	timerFrequency = glfwGetTimerFrequency();
+	frameIndex = 0;
+
+	// GL_TIME_ELAPSED is core since 3.3, but a driver may still report a zero-bit counter
+	if (enableGpuTimers && GLAD_GL_VERSION_3_3)
+	{
+		GLint counterBits = 0;
+		glGetQueryiv(GL_TIME_ELAPSED, GL_QUERY_COUNTER_BITS, &counterBits);
+		gpuTimers = counterBits > 0;
+	}
+	if (gpuTimers)
+	{
+		glGenQueries(gpuQueryCount, gpuQueries);
+		for (int i = 0; i < gpuQueryCount; ++i)
+			gpuQueryPending[i] = false;
+	}
+
+	collecting.store(true, std::memory_order_release);
+	collector = std::thread(collectorThread);
+}
+
+void profilerBeginFrame()
+{
+	if (!enabled) return;
+	++frameIndex;
+
+	if (gpuTimers)
+	{
+		for (int i = 0; i < gpuQueryCount; ++i)
+			resolveGpuQuery(i, false);
+
+		int slot = static_cast<int>(frameIndex % gpuQueryCount);
+		resolveGpuQuery(slot, true);	// only stalls if the GPU is more than gpuQueryCount frames behind
+
+		gpuQueryFrame[slot] = frameIndex;
+		gpuQueryStart[slot] = profilerNow();
+		glBeginQuery(GL_TIME_ELAPSED, gpuQueries[slot]);
+	}
+}
+
+void profilerEndFrame()
+{
+	if (!enabled || !gpuTimers) return;
+
+	glEndQuery(GL_TIME_ELAPSED);
+	gpuQueryPending[frameIndex % gpuQueryCount] = true;
+}
+
+std::uint64_t profilerNow()
+{
+	return enabled ? glfwGetTimerValue() : 0;
+}
+
+void profilerRecord(ProfilePhase phase, int drawIndex, std::uint64_t start, std::uint64_t end)
+{
+	if (!enabled) return;
+	pushSample({ frameIndex, start, end, phase, drawIndex });
+}
+
+bool profilerExport(const char* path)
+{
+	if (!enabled) return false;
+
+	if (gpuTimers)
+	{
+		for (int i = 0; i < gpuQueryCount; ++i)
+			resolveGpuQuery(i, true);
+	}
+
+	if (collector.joinable())
+	{
+		collecting.store(false, std::memory_order_release);
+		collector.join();
+	}
+	collect();
+
+	if (droppedSamples > 0)
+		std::cout << "Profiler dropped " << droppedSamples << " samples (collector fell behind)\n";
+
+	std::ofstream file(path);
+	if (!file)
+	{
+		std::cout << "Failed to open " << path << " for writing\n";
+		return false;
+	}
+	if (collected.empty()) return true;
+
+	size_t length = std::strlen(path);
+	bool json = length >= 5 && std::strcmp(path + length - 5, ".json") == 0;
+	return json ? writeChromeTrace(file) : writeCsv(file);
+}
+
+void profilerShutdown()
+{
+	if (!enabled) return;
+
+	if (collector.joinable())
+	{
+		collecting.store(false, std::memory_order_release);
+		collector.join();
+	}
+	if (gpuTimers)
+		glDeleteQueries(gpuQueryCount, gpuQueries);
+
+	collected.clear();
+	enabled = false;
+	gpuTimers = false;
+}
@@ -0,0 +1,50 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <cstdint>
+
+enum class ProfilePhase
+{
+	Input,
+	Clear,
+	Draw,
+	Swap,
+	Poll,
+	Gpu			// whole-frame GPU time from a GL_TIME_ELAPSED query
+};
+
+// starts the collector thread; GPU timers are used only if the context exposes them
+void profilerInit(bool enableGpuTimers);
+void profilerBeginFrame();
+void profilerEndFrame();	// call once the frame's GL work is submitted, i.e. right before swapping
+// cpu timestamps in glfwGetTimerValue() ticks
+std::uint64_t profilerNow();
+void profilerRecord(ProfilePhase phase, int drawIndex, std::uint64_t start, std::uint64_t end);
+// stops the collector and writes everything recorded so far; .json gives a Chrome trace, anything else CSV
+bool profilerExport(const char* path);
+void profilerShutdown();
+
+// times the enclosing scope as one phase (drawIndex is only meaningful for ProfilePhase::Draw)
+class ProfileScope
+{
+public:
+	explicit ProfileScope(ProfilePhase phase, int drawIndex = -1)
+		: phase_(phase), drawIndex_(drawIndex), start_(profilerNow())
+	{
+	}
+
+	~ProfileScope()
+	{
+		profilerRecord(phase_, drawIndex_, start_, profilerNow());
+	}
+
+	ProfileScope(const ProfileScope&) = delete;
+	ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+	ProfilePhase phase_;
+	int drawIndex_;
+	std::uint64_t start_;
+};
+
+#endif
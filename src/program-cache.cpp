@@ -0,0 +1,187 @@
+#include <glad/glad.h>
+#include "program-cache.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace
+{
+	struct CacheFileHeader
+	{
+		char magic[4];				// "GLPB"
+		std::uint32_t version;
+		std::uint64_t check;		// a second, unrelated hash of the same input: a file name collision won't match it too
+		std::uint32_t binaryFormat;
+		std::uint32_t binaryLength;
+	};
+
+	const std::uint32_t cacheFileVersion = 2;
+
+	bool enabled = false;
+	std::filesystem::path cacheDirectory;
+	// the file name comes from name, check is stored in the entry
+	struct ProgramKey
+	{
+		std::uint64_t name;			// FNV-1a, 64-bit
+		std::uint64_t check;		// multiply-xorshift, nothing in common with FNV
+	};
+
+	ProgramKey contextKey;			// vendor, renderer and driver version folded in once
+
+	ProgramKey hashBytes(ProgramKey key, const void* data, size_t size)
+	{
+		const unsigned char* bytes = static_cast<const unsigned char*>(data);
+		for (size_t i = 0; i < size; ++i)
+		{
+			key.name ^= bytes[i];
+			key.name *= 1099511628211ull;
+			key.check = (key.check ^ bytes[i]) * 0x9E3779B97F4A7C15ull;
+			key.check ^= key.check >> 29;
+		}
+		return key;
+	}
+
+	ProgramKey hashString(ProgramKey key, const char* string)
+	{
+		if (string == nullptr) string = "";
+		return hashBytes(key, string, std::strlen(string) + 1);	// the terminator separates fields
+	}
+
+	ProgramKey programKey(const char* vertexSource, const char* fragmentSource)
+	{
+		return hashString(hashString(contextKey, vertexSource), fragmentSource);
+	}
+
+	std::filesystem::path entryPath(std::uint64_t key)
+	{
+		char name[32];
+		std::snprintf(name, sizeof(name), "%016llx.bin", static_cast<unsigned long long>(key));
+		return cacheDirectory / name;
+	}
+}
+
+
+bool programCacheInit(const char* directory)
+{
+	enabled = false;
+	if (!GLAD_GL_ARB_get_program_binary)
+	{
+		std::cout << "Program binary cache disabled: GL_ARB_get_program_binary is not supported\n";
+		return false;
+	}
+
+	// some drivers expose the entry points but no formats at all, nothing could ever be reloaded then
+	GLint formatCount = 0;
+	glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+	if (formatCount <= 0)
+	{
+		std::cout << "Program binary cache disabled: the driver has no program binary formats\n";
+		return false;
+	}
+
+	std::error_code error;
+	std::filesystem::create_directories(directory, error);
+	if (error)
+	{
+		std::cout << "Program binary cache disabled: can't create " << directory << " (" << error.message() << ")\n";
+		return false;
+	}
+
+	// GL_VERSION carries the driver version on every vendor we care about
+	contextKey = { 14695981039346656037ull, 0x243F6A8885A308D3ull };
+	contextKey = hashString(contextKey, reinterpret_cast<const char*>(glGetString(GL_VENDOR)));
+	contextKey = hashString(contextKey, reinterpret_cast<const char*>(glGetString(GL_RENDERER)));
+	contextKey = hashString(contextKey, reinterpret_cast<const char*>(glGetString(GL_VERSION)));
+	contextKey = hashString(contextKey, reinterpret_cast<const char*>(glGetString(GL_SHADING_LANGUAGE_VERSION)));
+
+	cacheDirectory = directory;
+	enabled = true;
+	return true;
+}
+
+bool programCacheEnabled()
+{
+	return enabled;
+}
+
+unsigned int programCacheLoad(const char* vertexSource, const char* fragmentSource)
+{
+	if (!enabled) return 0;
+
+	ProgramKey key = programKey(vertexSource, fragmentSource);
+	std::filesystem::path path = entryPath(key.name);
+	std::ifstream file(path, std::ios::binary);
+	if (!file) return 0;
+
+	CacheFileHeader header;
+	if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))
+		|| std::memcmp(header.magic, "GLPB", 4) != 0 || header.version != cacheFileVersion || header.check != key.check)
+		return 0;
+
+	// the length is only believed if the file really has that much after the header, a truncated or
+	// corrupt entry must not make us allocate whatever it claims
+	std::error_code sizeError;
+	std::uintmax_t fileSize = std::filesystem::file_size(path, sizeError);
+	if (sizeError || header.binaryLength == 0 || fileSize - sizeof(header) != header.binaryLength) return 0;
+
+	std::vector<char> binary(header.binaryLength);
+	if (!file.read(binary.data(), binary.size())) return 0;
+
+	unsigned int program = glCreateProgram();
+	glProgramBinary(program, header.binaryFormat, binary.data(), static_cast<GLsizei>(binary.size()));
+
+	// the driver is free to reject a binary at any time (e.g. after an update it didn't tell us about)
+	int success;
+	glGetProgramiv(program, GL_LINK_STATUS, &success);
+	if (!success)
+	{
+		glDeleteProgram(program);
+		std::error_code error;
+		std::filesystem::remove(path, error);
+		return 0;
+	}
+	return program;
+}
+
+void programCachePrepare(unsigned int program)
+{
+	if (enabled)
+		glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+}
+
+void programCacheStore(unsigned int program, const char* vertexSource, const char* fragmentSource)
+{
+	if (!enabled) return;
+
+	GLint length = 0;
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0) return;
+
+	std::vector<char> binary(length);
+	GLenum binaryFormat = 0;
+	glGetProgramBinary(program, length, &length, &binaryFormat, binary.data());
+
+	ProgramKey key = programKey(vertexSource, fragmentSource);
+	CacheFileHeader header = { { 'G', 'L', 'P', 'B' }, cacheFileVersion, key.check, binaryFormat, static_cast<std::uint32_t>(length) };
+
+	// write next to the final name and rename, so a crash never leaves a truncated entry behind
+	std::filesystem::path path = entryPath(key.name);
+	std::filesystem::path temporaryPath = path;
+	temporaryPath += ".tmp";
+	{
+		std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+		if (!file) return;
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		file.write(binary.data(), length);
+		if (!file) return;
+	}
+
+	std::error_code error;
+	std::filesystem::rename(temporaryPath, path, error);
+}
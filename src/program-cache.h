@@ -0,0 +1,16 @@
+#ifndef PROGRAM_CACHE_H
+#define PROGRAM_CACHE_H
+
+// On-disk cache of linked program binaries (GL_ARB_get_program_binary).
+// Entries are keyed by the shader sources plus vendor/renderer/driver version strings,
+// so a driver update simply misses the cache instead of feeding it a stale binary.
+
+// returns false (and leaves the cache disabled) if the context can't hand out program binaries
+bool programCacheInit(const char* directory);
+bool programCacheEnabled();
+// returns 0 on a miss or when the driver rejects the stored binary
+unsigned int programCacheLoad(const char* vertexSource, const char* fragmentSource);
+void programCachePrepare(unsigned int program);		// must be called before glLinkProgram
+void programCacheStore(unsigned int program, const char* vertexSource, const char* fragmentSource);
+
+#endif
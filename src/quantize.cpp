@@ -0,0 +1,181 @@
+#include "quantize.h"
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define QUANTIZE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define QUANTIZE_F16C 1
+#include <immintrin.h>
+#define F16C_FUNCTION __attribute__((target("f16c")))
+#elif defined(_MSC_VER) && defined(_M_X64)
+#define QUANTIZE_F16C 1
+#include <immintrin.h>
+#include <intrin.h>
+#define F16C_FUNCTION
+#endif
+
+namespace
+{
+#ifdef QUANTIZE_F16C
+	bool cpuHasF16c()
+	{
+#ifdef _MSC_VER
+		int info[4];
+		__cpuid(info, 1);
+		return (info[2] & (1 << 29)) != 0;
+#else
+		return __builtin_cpu_supports("f16c");
+#endif
+	}
+
+	const bool hasF16c = cpuHasF16c();
+
+	F16C_FUNCTION size_t convertToHalfF16c(const float* values, std::uint16_t* halves, size_t count)
+	{
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i packed = _mm_cvtps_ph(_mm_loadu_ps(values + i), _MM_FROUND_TO_NEAREST_INT);
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(halves + i), packed);
+		}
+		size_t vectorized = i;
+		for (; i < count; ++i)
+			halves[i] = floatToHalf(values[i]);
+		return vectorized;
+	}
+#else
+	const bool hasF16c = false;
+#endif
+
+	std::uint16_t quantizeUnorm16(float value, float minimum, float inverseScale)
+	{
+		float scaled = (value - minimum) * (inverseScale * 65535.0f);
+		scaled = scaled < 0.0f ? 0.0f : (scaled > 65535.0f ? 65535.0f : scaled);
+		return static_cast<std::uint16_t>(std::lrint(scaled));	// nearest even, same as the SSE path
+	}
+
+	std::uint8_t quantizeUnorm8(float value)
+	{
+		value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+		return static_cast<std::uint8_t>(value * 255.0f + 0.5f);
+	}
+}
+
+
+size_t convertToHalf(const float* values, std::uint16_t* halves, size_t count)
+{
+#ifdef QUANTIZE_F16C
+	if (hasF16c)
+		return convertToHalfF16c(values, halves, count);
+#endif
+	for (size_t i = 0; i < count; ++i)
+		halves[i] = floatToHalf(values[i]);
+	return 0;
+}
+
+size_t quantizePositions(const float* positions, size_t vertexCount, const float minimum[3], const float inverseScale[3], std::uint16_t* quantized)
+{
+	size_t v = 0;
+#ifdef QUANTIZE_SSE2
+	// one vertex per iteration; the 4-float load reads the next vertex's x, so the last one goes scalar
+	const __m128 offset = _mm_setr_ps(minimum[0], minimum[1], minimum[2], 0.0f);
+	const __m128 scale = _mm_setr_ps(inverseScale[0] * 65535.0f, inverseScale[1] * 65535.0f, inverseScale[2] * 65535.0f, 0.0f);
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 top = _mm_set1_ps(65535.0f);
+	const __m128i bias = _mm_set1_epi32(32768);
+	const __m128i flip = _mm_set1_epi16(static_cast<short>(0x8000));
+
+	for (; v + 1 < vertexCount; ++v)
+	{
+		__m128 scaled = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(positions + 3 * v), offset), scale);
+		scaled = _mm_min_ps(_mm_max_ps(scaled, zero), top);
+		__m128i integers = _mm_cvtps_epi32(scaled);		// round to nearest
+		// SSE2 only packs with signed saturation: shift into the signed range and flip the top bit back
+		__m128i packed = _mm_xor_si128(_mm_packs_epi32(_mm_sub_epi32(integers, bias), _mm_setzero_si128()), flip);
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(quantized + 4 * v), packed);
+		quantized[4 * v + 3] = 0;
+	}
+#endif
+	size_t vectorized = v;
+	for (; v < vertexCount; ++v)
+	{
+		for (int axis = 0; axis < 3; ++axis)
+			quantized[4 * v + axis] = quantizeUnorm16(positions[3 * v + axis], minimum[axis], inverseScale[axis]);
+		quantized[4 * v + 3] = 0;
+	}
+	return vectorized;
+}
+
+QuantizedAttributes quantizeVertices(const float* positions, const float* uvs, const float* colors, size_t vertexCount,
+	QuantizationReport* report)
+{
+	QuantizedAttributes result;
+
+	float minimum[3] = { 0.0f, 0.0f, 0.0f }, maximum[3] = { 0.0f, 0.0f, 0.0f };
+	for (size_t v = 0; v < vertexCount; ++v)
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			float value = positions[3 * v + axis];
+			if (v == 0 || value < minimum[axis]) minimum[axis] = value;
+			if (v == 0 || value > maximum[axis]) maximum[axis] = value;
+		}
+
+	// a flat axis (z of every mesh here) still needs a non-zero scale to divide by
+	float inverseScale[3];
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		float extent = maximum[axis] - minimum[axis];
+		result.positionOffset[axis] = minimum[axis];
+		result.positionScale[axis] = extent > 0.0f ? extent : 1.0f;
+		inverseScale[axis] = 1.0f / result.positionScale[axis];
+	}
+
+	result.positions.resize(4 * vertexCount);
+	size_t vectorized = quantizePositions(positions, vertexCount, minimum, inverseScale, result.positions.data());
+
+	if (uvs != nullptr)
+	{
+		result.uvs.resize(2 * vertexCount);
+		vectorized += convertToHalf(uvs, result.uvs.data(), 2 * vertexCount);
+	}
+
+	if (colors != nullptr)
+	{
+		result.colors.resize(4 * vertexCount);
+		for (size_t i = 0; i < 4 * vertexCount; ++i)
+			result.colors[i] = quantizeUnorm8(colors[i]);
+	}
+
+	if (report == nullptr) return result;
+
+	// measured against what the GPU will reconstruct
+	*report = {};
+	double errorSum = 0.0;
+	float largestExtent = std::fmax(result.positionScale[0], std::fmax(result.positionScale[1], result.positionScale[2]));
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		float error = 0.0f;
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			float restored = result.positionOffset[axis] + result.positionScale[axis] * (result.positions[4 * v + axis] / 65535.0f);
+			error = std::fmax(error, std::fabs(restored - positions[3 * v + axis]));
+		}
+		report->maxPositionError = std::fmax(report->maxPositionError, error);
+		errorSum += error;
+	}
+	report->meanPositionError = vertexCount > 0 ? static_cast<float>(errorSum / vertexCount) : 0.0f;
+	report->maxRelativePositionError = report->maxPositionError / largestExtent;
+
+	for (size_t i = 0; i < result.uvs.size(); ++i)
+		report->maxUvError = std::fmax(report->maxUvError, std::fabs(halfToFloat(result.uvs[i]) - uvs[i]));
+	for (size_t i = 0; i < result.colors.size(); ++i)
+		report->maxColorError = std::fmax(report->maxColorError, std::fabs(result.colors[i] / 255.0f - colors[i]));
+
+	report->bytesBefore = vertexCount * (3 + (uvs ? 2 : 0) + (colors ? 4 : 0)) * sizeof(float);
+	report->bytesAfter = (result.positions.size() + result.uvs.size()) * sizeof(std::uint16_t) + result.colors.size();
+	report->simd = vectorized > 0;		// e.g. not for a single vertex, even with SSE2 compiled in
+	return result;
+}
@@ -0,0 +1,47 @@
+#ifndef QUANTIZE_H
+#define QUANTIZE_H
+
+#include "vertex-format.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Vertex attribute compression. Positions become 16-bit unorm coordinates inside the mesh's
+// bounding box (p = positionOffset + positionScale * q, applied in the vertex shader, see
+// QUANTIZED_POSITIONS in vertex-shader.txt), UVs become half floats and colors unorm8.
+// The bulk conversions use SSE2 and F16C where the CPU has them, scalar code otherwise.
+
+struct QuantizedAttributes
+{
+	std::vector<std::uint16_t> positions;	// 4 per vertex: xyz + padding, so a vertex stays 8-byte aligned
+	std::vector<std::uint16_t> uvs;			// 2 halves per vertex, empty without uvs
+	std::vector<std::uint8_t> colors;		// rgba per vertex, empty without colors
+	float positionScale[3];
+	float positionOffset[3];
+};
+
+using QuantizedPositionFormat = VertexFormat<attribute::Unorm16<3>, attribute::Padding<2>>;
+using QuantizedUvFormat = VertexFormat<attribute::Half<2>>;
+using QuantizedColorFormat = VertexFormat<attribute::Unorm8<4>>;
+
+struct QuantizationReport
+{
+	float maxPositionError;		// in mesh units
+	float meanPositionError;
+	float maxRelativePositionError;	// max error over the largest bounding box extent
+	float maxUvError;
+	float maxColorError;
+	size_t bytesBefore;			// as 32-bit floats
+	size_t bytesAfter;
+	bool simd;					// SSE2/F16C paths were used
+};
+
+// positions are xyz, uvs uv and colors rgba floats per vertex; uvs and colors may be null
+QuantizedAttributes quantizeVertices(const float* positions, const float* uvs, const float* colors, size_t vertexCount,
+	QuantizationReport* report = nullptr);
+
+// the bulk conversions on their own, both return how many values went through the SIMD path
+size_t convertToHalf(const float* values, std::uint16_t* halves, size_t count);
+size_t quantizePositions(const float* positions, size_t vertexCount, const float minimum[3], const float inverseScale[3], std::uint16_t* quantized);
+
+#endif
@@ -0,0 +1,132 @@
+#include <glad/glad.h>
+#include "render-queue.h"
+#include "shader.h"
+#include "profiler.h"
+
+namespace
+{
+	const int layerShift = 60;
+	const int translucentShift = 59;
+
+	std::uint64_t quantizeDepth(float depth)
+	{
+		depth = depth < 0.0f ? 0.0f : (depth > 1.0f ? 1.0f : depth);
+		return static_cast<std::uint64_t>(depth * 0xFFFFFF);	// 24 bits
+	}
+}
+
+
+std::uint64_t makeSortKey(int layer, bool translucent, int program, unsigned int vertexArray, unsigned int material, float depth)
+{
+	std::uint64_t key = static_cast<std::uint64_t>(layer & 0xF) << layerShift;
+	std::uint64_t state = (static_cast<std::uint64_t>(program) & 0xFFF) << 18 | (vertexArray & 0x3FF) << 8 | (material & 0xFF);
+
+	if (!translucent)
+		return key | state << 29 | quantizeDepth(depth) << 5;
+
+	// blending needs back to front, so depth goes above the state bits and is inverted
+	return key | 1ull << translucentShift | (0xFFFFFF - quantizeDepth(depth)) << 35 | state << 5;
+}
+
+void radixSort(std::vector<std::uint64_t>& keys, std::vector<std::uint32_t>& values,
+	std::vector<std::uint64_t>& scratchKeys, std::vector<std::uint32_t>& scratchValues)
+{
+	size_t count = keys.size();
+	scratchKeys.resize(count);
+	scratchValues.resize(count);
+
+	// LSD, one byte per pass; all 8 histograms come out of a single read of the keys
+	size_t histograms[8][256] = {};
+	for (std::uint64_t key : keys)
+		for (int pass = 0; pass < 8; ++pass)
+			++histograms[pass][(key >> (pass * 8)) & 0xFF];
+
+	for (int pass = 0; pass < 8; ++pass)
+	{
+		size_t* histogram = histograms[pass];
+
+		// a byte that is the same in every key (most of them, with sparse ids) needs no pass
+		if (histogram[(keys.empty() ? 0 : keys[0] >> (pass * 8)) & 0xFF] == count) continue;
+
+		size_t offset = 0;
+		for (int digit = 0; digit < 256; ++digit)
+		{
+			size_t digitCount = histogram[digit];
+			histogram[digit] = offset;
+			offset += digitCount;
+		}
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			size_t destination = histogram[(keys[i] >> (pass * 8)) & 0xFF]++;
+			scratchKeys[destination] = keys[i];
+			scratchValues[destination] = values[i];
+		}
+		keys.swap(scratchKeys);
+		values.swap(scratchValues);
+	}
+}
+
+
+void RenderQueue::submit(std::uint64_t key, const QueuedDraw& draw)
+{
+	keys_.push_back(key);
+	order_.push_back(static_cast<std::uint32_t>(draws_.size()));
+	draws_.push_back(draw);
+}
+
+void RenderQueue::submit(const QueuedDraw& draw, int layer, bool translucent, float depth)
+{
+	// slices of one frame sit at distinct aligned offsets, good enough as a material id
+	unsigned int material = static_cast<unsigned int>(draw.material.offset / 256);
+	submit(makeSortKey(layer, translucent, draw.program, draw.vertexArray, material, depth), draw);
+}
+
+RenderQueueStats RenderQueue::flush()
+{
+	radixSort(keys_, order_, scratchKeys_, scratchOrder_);
+
+	RenderQueueStats stats = {};
+	int currentProgram = -1;
+	unsigned int currentVertexArray = 0;
+	bool vertexArrayBound = false;
+	UniformSlice currentMaterial;
+
+	for (std::uint32_t index : order_)
+	{
+		// one Draw sample per draw like the unsorted loop had, tagged with the order it was submitted in
+		ProfileScope scope(ProfilePhase::Draw, static_cast<int>(index));
+		const QueuedDraw& draw = draws_[index];
+		if (draw.program != currentProgram)
+		{
+			glUseProgram(shaderProgram(draw.program));
+			currentProgram = draw.program;
+			++stats.programSwitches;
+		}
+		if (!vertexArrayBound || draw.vertexArray != currentVertexArray)
+		{
+			glBindVertexArray(draw.vertexArray);
+			currentVertexArray = draw.vertexArray;
+			vertexArrayBound = true;
+			++stats.vertexArraySwitches;
+		}
+		if (draw.material.size != 0 && (draw.material.offset != currentMaterial.offset || draw.material.size != currentMaterial.size))
+		{
+			bindUniformSlice(materialUniformBinding, draw.material);
+			currentMaterial = draw.material;
+			++stats.materialSwitches;
+		}
+		glDrawArrays(draw.mode, draw.first, draw.count);
+		++stats.draws;
+	}
+
+	clear();
+	return stats;
+}
+
+void RenderQueue::clear()
+{
+	keys_.clear();
+	order_.clear();
+	draws_.clear();
+}
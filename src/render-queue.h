@@ -0,0 +1,61 @@
+#ifndef RENDER_QUEUE_H
+#define RENDER_QUEUE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "uniform-buffer.h"
+
+// Draws are submitted in any order, each with a packed 64-bit sort key, and issued sorted so that
+// draws sharing a program, VAO and material end up next to each other. Key layout, high bits first:
+//   opaque:      layer:4 | 0:1 | program:12 | vertex array:10 | material:8 | depth:24 | unused:5
+//   translucent: layer:4 | 1:1 | far-to-near depth:24 | program:12 | vertex array:10 | material:8 | unused:5
+// so layers are drawn in order, opaque before translucent, opaque grouped by state (front to back
+// within a group) and translucent strictly back to front. Program handles, VAO names and material
+// ids only contribute their low bits, which is enough to group them; correctness never depends on the key.
+
+struct QueuedDraw
+{
+	int program;				// shader pipeline handle
+	unsigned int vertexArray;
+	UniformSlice material;		// bound to materialUniformBinding, nothing if empty
+	unsigned int mode;
+	int first;
+	int count;
+};
+
+struct RenderQueueStats
+{
+	int draws;
+	int programSwitches;
+	int vertexArraySwitches;
+	int materialSwitches;
+};
+
+// depth in [0, 1], 0 being nearest
+std::uint64_t makeSortKey(int layer, bool translucent, int program, unsigned int vertexArray, unsigned int material, float depth);
+// sorts keys ascending and applies the same permutation to values; scratch buffers are reused
+void radixSort(std::vector<std::uint64_t>& keys, std::vector<std::uint32_t>& values,
+	std::vector<std::uint64_t>& scratchKeys, std::vector<std::uint32_t>& scratchValues);
+
+class RenderQueue
+{
+public:
+	void submit(std::uint64_t key, const QueuedDraw& draw);
+	void submit(const QueuedDraw& draw, int layer = 0, bool translucent = false, float depth = 0.0f);
+	// sorts, issues everything (binding only what changes between draws) and empties the queue; with the
+	// profiler on, every draw is a ProfilePhase::Draw sample tagged with its submission index
+	RenderQueueStats flush();
+	void clear();
+
+	size_t size() const { return draws_.size(); }
+
+private:
+	std::vector<std::uint64_t> keys_;
+	std::vector<std::uint32_t> order_;
+	std::vector<QueuedDraw> draws_;
+	std::vector<std::uint64_t> scratchKeys_;
+	std::vector<std::uint32_t> scratchOrder_;
+};
+
+#endif
@@ -0,0 +1,218 @@
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include "render-thread.h"
+#include "shader.h"
+#include "shader-assets.h"
+#include "gpu-resources.h"
+#include "profiler.h"
+#include "uniform-buffer.h"
+#include "asset-streaming.h"
+#include "frame-scheduler.h"
+#ifdef GL_TRACE
+#include <glad/glad_trace.h>
+#endif
+#include <condition_variable>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	const int framesInFlight = 2;
+
+	struct QueuedFrame
+	{
+		std::vector<std::unique_ptr<CommandBuffer>> commands;	// one per recording worker
+		bool ready = false;		// recorded and waiting for replay
+	};
+
+	GLFWwindow* renderWindow = nullptr;
+	QueuedFrame frames[framesInFlight];
+	int submitIndex = 0;		// only touched by the submitting thread
+	int replayIndex = 0;		// only touched by the render thread
+	bool stopping = false;
+	std::mutex frameMutex;
+	std::condition_variable frameCondition;
+	std::thread renderThread;
+
+	// recording workers; the submitting thread is worker 0, these are 1..workerCount-1
+	int workerCount = 0;
+	std::vector<std::thread> workers;
+	std::mutex workMutex;
+	std::condition_variable workCondition;
+	std::condition_variable workDoneCondition;
+	unsigned long long workGeneration = 0;
+	int workRemaining = 0;
+	bool workersStopping = false;
+	RecordFunction currentRecord = nullptr;
+	const void* currentScene = nullptr;
+	QueuedFrame* currentFrame = nullptr;
+
+	void workerThread(int worker)
+	{
+		unsigned long long seenGeneration = 0;
+		for (;;)
+		{
+			{
+				std::unique_lock<std::mutex> lock(workMutex);
+				workCondition.wait(lock, [&] { return workersStopping || workGeneration != seenGeneration; });
+				if (workersStopping) return;
+				seenGeneration = workGeneration;
+			}
+
+			currentRecord(*currentFrame->commands[worker], worker, workerCount, currentScene);
+
+			std::lock_guard<std::mutex> lock(workMutex);
+			if (--workRemaining == 0)
+				workDoneCondition.notify_one();
+		}
+	}
+
+	void renderThreadMain()
+	{
+		glfwMakeContextCurrent(renderWindow);
+		bool wasPending = false;
+
+		for (;;)
+		{
+			QueuedFrame& frame = frames[replayIndex];
+			{
+				std::unique_lock<std::mutex> lock(frameMutex);
+				frameCondition.wait(lock, [&] { return frame.ready || stopping; });
+				if (!frame.ready) break;	// frames are replayed in order, nothing after this one is queued either
+			}
+
+			// everything that needs the context happens here now
+			pollShaderAssets();
+			pollShaderPrograms();
+			bool pending = pumpAssetStreaming() || shaderProgramsPending();
+
+			// like the single-threaded loop: the picture changes by itself while (and right after) anything
+			// is in flight, so on-demand pacing has to keep sending frames
+			if (pending || wasPending)
+				requestRedraw();
+			wasPending = pending;
+
+			profilerBeginFrame();
+			{
+				ProfileScope scope(ProfilePhase::Draw, 0);
+				for (const auto& commands : frame.commands)
+					commands->execute();
+			}
+			uniformRingEndFrame();
+			profilerEndFrame();
+
+			{
+				ProfileScope scope(ProfilePhase::Swap);
+				glfwSwapBuffers(renderWindow);
+#ifdef GL_TRACE
+				gladTraceFrame();
+#endif
+			}
+
+			flushGpuDeletions();
+
+			{
+				std::lock_guard<std::mutex> lock(frameMutex);
+				frame.ready = false;
+			}
+			frameCondition.notify_all();
+			replayIndex = (replayIndex + 1) % framesInFlight;
+		}
+
+		glfwMakeContextCurrent(nullptr);
+	}
+}
+
+
+bool startRenderThread(GLFWwindow* window, int recordThreadCount)
+{
+	if (renderThread.joinable())
+	{
+		std::cout << "The render thread is already running\n";
+		return false;
+	}
+
+	renderWindow = window;
+	workerCount = recordThreadCount > 1 ? recordThreadCount : 1;
+	for (QueuedFrame& frame : frames)
+	{
+		frame.commands.clear();
+		for (int i = 0; i < workerCount; ++i)
+			frame.commands.push_back(std::make_unique<CommandBuffer>());
+		frame.ready = false;
+	}
+	submitIndex = 0;
+	replayIndex = 0;
+	stopping = false;
+	workersStopping = false;
+
+	for (int i = 1; i < workerCount; ++i)
+		workers.emplace_back(workerThread, i);
+
+	// a context can only be current on one thread at a time
+	glfwMakeContextCurrent(nullptr);
+	renderThread = std::thread(renderThreadMain);
+	return true;
+}
+
+void submitFrame(RecordFunction record, const void* scene)
+{
+	QueuedFrame& frame = frames[submitIndex];
+	{
+		std::unique_lock<std::mutex> lock(frameMutex);
+		frameCondition.wait(lock, [&] { return !frame.ready; });
+	}
+
+	for (const auto& commands : frame.commands)
+		commands->reset();
+
+	{
+		std::lock_guard<std::mutex> lock(workMutex);
+		currentRecord = record;
+		currentScene = scene;
+		currentFrame = &frame;
+		workRemaining = workerCount - 1;
+		++workGeneration;
+	}
+	workCondition.notify_all();
+
+	record(*frame.commands[0], 0, workerCount, scene);
+
+	{
+		std::unique_lock<std::mutex> lock(workMutex);
+		workDoneCondition.wait(lock, [] { return workRemaining == 0; });
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(frameMutex);
+		frame.ready = true;
+	}
+	frameCondition.notify_all();
+	submitIndex = (submitIndex + 1) % framesInFlight;
+}
+
+void stopRenderThread()
+{
+	if (!renderThread.joinable()) return;
+
+	{
+		std::lock_guard<std::mutex> lock(frameMutex);
+		stopping = true;
+	}
+	frameCondition.notify_all();
+	renderThread.join();
+
+	{
+		std::lock_guard<std::mutex> lock(workMutex);
+		workersStopping = true;
+	}
+	workCondition.notify_all();
+	for (std::thread& worker : workers)
+		worker.join();
+	workers.clear();
+
+	glfwMakeContextCurrent(renderWindow);
+}
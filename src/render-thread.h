@@ -0,0 +1,23 @@
+#ifndef RENDER_THREAD_H
+#define RENDER_THREAD_H
+
+#include "command-buffer.h"
+
+struct GLFWwindow;
+
+// Splits the frame between threads: recording workers fill one CommandBuffer each, a single
+// render thread that owns the GL context replays them in worker order and swaps, and the thread
+// that calls submitFrame (the main thread, which keeps handling window events as GLFW requires)
+// records the first share itself. Up to two frames are queued between recording and replay.
+
+// records one worker's share of the frame; runs on a worker thread and must not touch GL
+using RecordFunction = void (*)(CommandBuffer& commands, int worker, int workerCount, const void* scene);
+
+// the context must be current on the calling thread, it is moved over to the render thread
+bool startRenderThread(GLFWwindow* window, int recordThreadCount);
+// blocks while the render thread is still busy with the queued frames
+void submitFrame(RecordFunction record, const void* scene);
+// replays what is still queued, joins all threads and makes the context current here again
+void stopRenderThread();
+
+#endif
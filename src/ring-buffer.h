@@ -0,0 +1,50 @@
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <atomic>
+#include <cstddef>
+
+// single-producer / single-consumer lock-free ring buffer
+// Capacity must be a power of two; one thread may push, one (other) thread may pop
+template <typename T, size_t Capacity>
+class RingBuffer
+{
+	static_assert(Capacity > 1 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+	// returns false when the consumer has fallen behind and the buffer is full
+	bool push(const T& item)
+	{
+		size_t head = head_.load(std::memory_order_relaxed);
+		if (head - tail_.load(std::memory_order_acquire) == Capacity)
+			return false;
+
+		items_[head & (Capacity - 1)] = item;
+		head_.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool pop(T& item)
+	{
+		size_t tail = tail_.load(std::memory_order_relaxed);
+		if (tail == head_.load(std::memory_order_acquire))
+			return false;
+
+		item = items_[tail & (Capacity - 1)];
+		tail_.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool empty() const
+	{
+		return tail_.load(std::memory_order_acquire) == head_.load(std::memory_order_acquire);
+	}
+
+private:
+	T items_[Capacity];
+	// keep the two indices on separate cache lines so producer and consumer don't fight over one
+	alignas(64) std::atomic<size_t> head_{ 0 };
+	alignas(64) std::atomic<size_t> tail_{ 0 };
+};
+
+#endif
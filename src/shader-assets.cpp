@@ -0,0 +1,304 @@
+#include "shader-assets.h"
+#include "shader.h"
+#include "mapped-file.h"
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+	struct ProgramAsset
+	{
+		std::string vertexFile;
+		std::string fragmentFile;
+		std::vector<ShaderDefine> defines;
+		std::string name;
+		std::set<std::string> dependencies;		// canonical paths of every file that went in, includes too
+		int handle;
+		int pendingReload;						// -1 when nothing is compiling
+	};
+
+	std::filesystem::path shaderDirectory;
+	std::vector<ProgramAsset> assets;
+
+	std::thread watcher;
+	std::atomic<bool> watching{ false };
+	std::mutex changedMutex;
+	std::set<std::string> changedFiles;
+
+	const int maxIncludeDepth = 16;
+
+	std::string canonicalName(const std::filesystem::path& path)
+	{
+		std::error_code error;
+		std::filesystem::path canonical = std::filesystem::weakly_canonical(path, error);
+		return (error ? path : canonical).string();
+	}
+
+	// every included file gets its own GLSL source string number (the main file is 0); the #line that
+	// starts it names the file in a comment, which is how shader.cpp puts file names under compile logs
+	bool appendFile(const std::filesystem::path& path, int depth, int sourceNumber, int& sourceCount, std::string& output, std::set<std::string>& dependencies)
+	{
+		if (depth > maxIncludeDepth)
+		{
+			std::cout << "Shader include depth exceeded at " << path.string() << "\n";
+			return false;
+		}
+
+		MappedFile file(path);
+		if (!file.valid())
+		{
+			std::cout << "Failed to read shader file " << path.string() << "\n";
+			return false;
+		}
+		dependencies.insert(canonicalName(path));
+
+		std::string_view contents = file.contents();
+		int lineNumber = 0;
+		size_t lineStart = 0;
+		while (lineStart < contents.size())
+		{
+			size_t lineEnd = contents.find('\n', lineStart);
+			if (lineEnd == std::string_view::npos) lineEnd = contents.size();
+			std::string_view line = contents.substr(lineStart, lineEnd - lineStart);
+			++lineNumber;
+
+			size_t directive = line.find_first_not_of(" \t");
+			if (directive != std::string_view::npos && line.compare(directive, 8, "#include") == 0)
+			{
+				size_t open = line.find('"', directive);
+				size_t close = open == std::string_view::npos ? open : line.find('"', open + 1);
+				if (close == std::string_view::npos)
+				{
+					std::cout << path.string() << ":" << lineNumber << ": malformed #include\n";
+					return false;
+				}
+
+				std::filesystem::path included = path.parent_path() / std::string(line.substr(open + 1, close - open - 1));
+				int includedNumber = ++sourceCount;
+				output += "#line 1 " + std::to_string(includedNumber) + " // " + included.string() + "\n";
+				if (!appendFile(included, depth + 1, includedNumber, sourceCount, output, dependencies)) return false;
+				// keep compiler messages pointing at the right line of this file
+				output += "#line " + std::to_string(lineNumber + 1) + " " + std::to_string(sourceNumber) + "\n";
+			}
+			else
+			{
+				output.append(line.data(), line.size());
+				output += '\n';
+			}
+			lineStart = lineEnd + 1;
+		}
+		return true;
+	}
+
+	bool buildSource(const std::string& fileName, const std::vector<ShaderDefine>& defines, std::string& source, std::set<std::string>& dependencies)
+	{
+		std::string body;
+		int sourceCount = 0;
+		if (!appendFile(shaderDirectory / fileName, 0, 0, sourceCount, body, dependencies)) return false;
+		if (defines.empty())
+		{
+			source = std::move(body);
+			return true;
+		}
+
+		std::string injected;
+		for (const ShaderDefine& define : defines)
+			injected += "#define " + define.name + " " + define.value + "\n";
+
+		// #version has to stay the very first statement, so defines go right below it
+		size_t insertAt = 0;
+		size_t version = body.find("#version");
+		if (version != std::string::npos)
+		{
+			size_t lineEnd = body.find('\n', version);
+			insertAt = lineEnd == std::string::npos ? body.size() : lineEnd + 1;
+		}
+		injected += insertAt == 0 ? "#line 1\n" : "#line 2\n";		// injected lines don't count
+		source = body.substr(0, insertAt) + injected + body.substr(insertAt);
+		return true;
+	}
+
+	bool buildProgramSources(ProgramAsset& asset, std::string& vertexSource, std::string& fragmentSource)
+	{
+		std::set<std::string> dependencies;
+		if (!buildSource(asset.vertexFile, asset.defines, vertexSource, dependencies)
+			|| !buildSource(asset.fragmentFile, asset.defines, fragmentSource, dependencies))
+			return false;
+
+		asset.dependencies = std::move(dependencies);
+		return true;
+	}
+
+	void markChanged(const std::string& path)
+	{
+		std::lock_guard<std::mutex> lock(changedMutex);
+		changedFiles.insert(path);
+	}
+
+#if defined(__linux__)
+	void watcherThread()
+	{
+		int notify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		if (notify < 0)
+		{
+			std::cout << "Shader hot reload disabled: inotify_init1 failed\n";
+			return;
+		}
+
+		// editors often save by writing a new file and renaming it over the old one,
+		// so watch the directory rather than the individual files
+		std::filesystem::path directory = canonicalName(shaderDirectory);
+		int watch = inotify_add_watch(notify, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+		if (watch < 0)
+		{
+			std::cout << "Shader hot reload disabled: can't watch " << directory.string() << "\n";
+			close(notify);
+			return;
+		}
+
+		alignas(inotify_event) char buffer[4096];
+		while (watching.load(std::memory_order_acquire))
+		{
+			pollfd descriptor = { notify, POLLIN, 0 };
+			if (poll(&descriptor, 1, 100) <= 0) continue;		// wake up regularly to notice shutdown
+
+			ssize_t length;
+			while ((length = read(notify, buffer, sizeof(buffer))) > 0)
+			{
+				for (char* next = buffer; next < buffer + length;)
+				{
+					const inotify_event* event = reinterpret_cast<const inotify_event*>(next);
+					if (event->len > 0)
+						markChanged((directory / event->name).string());
+					next += sizeof(inotify_event) + event->len;
+				}
+			}
+		}
+
+		close(notify);
+	}
+#else
+	// no inotify here: compare modification times a couple of times per second instead
+	void watcherThread()
+	{
+		std::unordered_map<std::string, std::filesystem::file_time_type> lastWrite;
+		while (watching.load(std::memory_order_acquire))
+		{
+			std::error_code error;
+			for (const auto& entry : std::filesystem::directory_iterator(shaderDirectory, error))
+			{
+				std::string path = canonicalName(entry.path());
+				auto time = entry.last_write_time(error);
+				auto found = lastWrite.find(path);
+				if (found != lastWrite.end() && found->second != time)
+					markChanged(path);
+				lastWrite[path] = time;
+			}
+			std::this_thread::sleep_for(std::chrono::milliseconds(500));
+		}
+	}
+#endif
+}
+
+
+void initShaderAssets(const char* directory, bool hotReload)
+{
+	shaderDirectory = directory;
+
+	if (hotReload && !watching.load())
+	{
+		watching.store(true, std::memory_order_release);
+		watcher = std::thread(watcherThread);
+	}
+}
+
+bool loadShaderSource(const char* fileName, const std::vector<ShaderDefine>& defines, std::string& source)
+{
+	std::set<std::string> dependencies;
+	return buildSource(fileName, defines, source, dependencies);
+}
+
+int loadShaderProgramAsset(const char* vertexFile, const char* fragmentFile, const std::vector<ShaderDefine>& defines, const char* name)
+{
+	ProgramAsset asset = { vertexFile, fragmentFile, defines, name, {}, -1, -1 };
+
+	std::string vertexSource, fragmentSource;
+	if (!buildProgramSources(asset, vertexSource, fragmentSource)) return -1;
+
+	asset.handle = requestShaderProgram(vertexSource.c_str(), fragmentSource.c_str(), name);
+	if (asset.handle == -1) return -1;
+
+	assets.push_back(std::move(asset));
+	return assets.back().handle;
+}
+
+void pollShaderAssets()
+{
+	std::set<std::string> changed;
+	{
+		std::lock_guard<std::mutex> lock(changedMutex);
+		changed.swap(changedFiles);
+	}
+
+	// an asset whose program was deleted by its owner stops reloading
+	for (size_t i = 0; i < assets.size();)
+	{
+		if (shaderProgramAlive(assets[i].handle))
+		{
+			++i;
+			continue;
+		}
+		if (assets[i].pendingReload != -1)
+			deleteShaderProgram(assets[i].pendingReload);
+		assets.erase(assets.begin() + i);
+	}
+
+	for (ProgramAsset& asset : assets)
+	{
+		// swap finished reloads in; a failed one leaves the previous program in place
+		if (asset.pendingReload != -1 && adoptShaderProgram(asset.handle, asset.pendingReload))
+			asset.pendingReload = -1;
+
+		bool dirty = false;
+		for (const std::string& path : changed)
+			dirty = dirty || asset.dependencies.count(path) > 0;
+		if (!dirty) continue;
+
+		std::string vertexSource, fragmentSource;
+		if (!buildProgramSources(asset, vertexSource, fragmentSource)) continue;
+
+		std::cout << "Reloading " << asset.name << "\n";
+		if (asset.pendingReload != -1)
+			deleteShaderProgram(asset.pendingReload);	// superseded before it even finished
+		asset.pendingReload = requestShaderProgram(vertexSource.c_str(), fragmentSource.c_str(), asset.name.c_str());
+	}
+}
+
+void cleanUpShaderAssets()
+{
+	if (watcher.joinable())
+	{
+		watching.store(false, std::memory_order_release);
+		watcher.join();
+	}
+
+	for (ProgramAsset& asset : assets)
+	{
+		if (asset.pendingReload != -1)
+			deleteShaderProgram(asset.pendingReload);
+	}
+	assets.clear();
+}
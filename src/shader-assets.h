@@ -0,0 +1,26 @@
+#ifndef SHADER_ASSETS_H
+#define SHADER_ASSETS_H
+
+#include <string>
+#include <vector>
+
+// Shader sources loaded from files (src/*-shader.txt). Sources may #include "other-file" (relative
+// to the including file) and get extra #defines injected right after #version, so one file can
+// produce several program variants. With hot reload on, edited files are recompiled through the
+// shader pipeline and swapped in once linked, without restarting.
+
+struct ShaderDefine
+{
+	std::string name;
+	std::string value;
+};
+
+void initShaderAssets(const char* directory, bool hotReload);
+// reads a file with includes resolved and defines injected; returns false if it can't be read
+bool loadShaderSource(const char* fileName, const std::vector<ShaderDefine>& defines, std::string& source);
+// returns a shader pipeline handle (see shader.h) or -1 if a file could not be read
+int loadShaderProgramAsset(const char* vertexFile, const char* fragmentFile, const std::vector<ShaderDefine>& defines, const char* name);
+void pollShaderAssets();	// once per frame, on the thread that owns the context
+void cleanUpShaderAssets();
+
+#endif
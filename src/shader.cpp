@@ -0,0 +1,432 @@
+#include <glad/glad.h>
+#include "shader.h"
+#include "program-cache.h"
+#include <climits>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+	const char* fallbackVertexShaderSource = "#version 330 core\n"
+		"layout(location = 0) in vec3 aPos;\n"
+		"void main()\n"
+		"{\n"
+		"gl_Position = vec4(aPos, 1.0);\n"
+		"}\0";
+
+	const char* fallbackFragmentShaderSource = "#version 330 core\n"
+		"out vec4 FragmentColor;\n"
+		"void main()\n"
+		"{\n"
+		"FragmentColor = vec4(0.5f, 0.5f, 0.5f, 1.0f);\n"
+		"}\0";
+
+	enum class ProgramState
+	{
+		Linking,
+		Ready,
+		Failed,
+		Deleted
+	};
+
+	struct PendingProgram
+	{
+		unsigned int program;
+		unsigned int vertexShader;
+		unsigned int fragmentShader;
+		ProgramState state;
+		int generation;					// bumped whenever the slot is freed, so stale handles stop resolving
+		std::string name;
+		std::string vertexSource;		// kept for the program cache until the link is done
+		std::string fragmentSource;
+	};
+
+	// a handle is the slot index in the low bits and the slot's generation above it
+	const int slotBits = 16;
+	const int slotMask = (1 << slotBits) - 1;
+
+	std::vector<PendingProgram> programs;
+	std::vector<int> freeSlots;			// Deleted slots, reused by the next request
+	unsigned int fallbackProgram;
+	bool parallelCompile = false;
+	int pendingCount = 0;
+
+	// programs that share a source (e.g. the common vertex shader) share one shader object,
+	// which lives until nothing in flight needs it any more
+	std::unordered_map<std::string, unsigned int> shaderObjects[2];
+
+	// GLSL 3.30 can't say layout(binding = N), so blocks are bound by name whenever a program shows up
+	std::vector<std::pair<std::string, unsigned int>> uniformBlockBindings;
+
+	// ShaderProgramHandle globals elsewhere may be destroyed after cleanUpShaderPipeline (or after
+	// the containers above), their deletes do nothing by then
+	bool pipelineOpen = false;
+	struct PipelineLifetime
+	{
+		~PipelineLifetime() { pipelineOpen = false; }
+	} pipelineLifetime;
+
+	void applyUniformBlockBindings(unsigned int program)
+	{
+		for (const auto& [blockName, binding] : uniformBlockBindings)
+		{
+			unsigned int blockIndex = glGetUniformBlockIndex(program, blockName.c_str());
+			if (blockIndex != GL_INVALID_INDEX)
+				glUniformBlockBinding(program, blockIndex, binding);
+		}
+	}
+
+	unsigned int submitShader(GLenum type, const char* source)
+	{
+		auto& objects = shaderObjects[type == GL_VERTEX_SHADER ? 0 : 1];
+		auto found = objects.find(source);
+		if (found != objects.end()) return found->second;
+
+		unsigned int shader = glCreateShader(type);
+		if (shader == 0) return 0;
+		glShaderSource(shader, 1, &source, NULL);
+		glCompileShader(shader);	// no status check here, that's what forces the driver to finish
+		objects.emplace(source, shader);
+		return shader;
+	}
+
+	void releaseShaderObjects()
+	{
+		for (auto& objects : shaderObjects)
+		{
+			for (auto& [source, shader] : objects)
+				glDeleteShader(shader);
+			objects.clear();
+		}
+	}
+
+	// shader-assets.cpp starts every include with "#line 1 <n> // <file>", so the source string
+	// numbers in the log can be looked up here
+	void printSourceNames(const std::string& source)
+	{
+		size_t lineStart = 0;
+		while (lineStart < source.size())
+		{
+			size_t lineEnd = source.find('\n', lineStart);
+			if (lineEnd == std::string::npos) lineEnd = source.size();
+			std::string line = source.substr(lineStart, lineEnd - lineStart);
+			lineStart = lineEnd + 1;
+
+			if (line.compare(0, 8, "#line 1 ") != 0) continue;
+			size_t comment = line.find(" // ");
+			if (comment == std::string::npos) continue;
+			std::cout << "  source " << line.substr(8, comment - 8) << " is " << line.substr(comment + 4) << "\n";
+		}
+	}
+
+	void printShaderLog(unsigned int shader, const char* kind, const std::string& name, const std::string& source)
+	{
+		int success;
+		glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+		if (success) return;
+
+		char infoLog[512];
+		glGetShaderInfoLog(shader, 512, NULL, infoLog);
+		std::cout << name << " " << kind << " shader compiling error! " << infoLog << "\n";
+		printSourceNames(source);
+	}
+
+	// returns 0 (and prints why) if the driver wouldn't even create the objects
+	unsigned int submitProgram(const char* vertexSource, const char* fragmentSource, PendingProgram& pending)
+	{
+		pending.vertexShader = submitShader(GL_VERTEX_SHADER, vertexSource);
+		pending.fragmentShader = submitShader(GL_FRAGMENT_SHADER, fragmentSource);
+		pending.program = pending.vertexShader != 0 && pending.fragmentShader != 0 ? glCreateProgram() : 0;
+		if (pending.program == 0)
+		{
+			std::cout << pending.name << " could not be submitted, the driver refused to create its objects\n";
+			if (pendingCount == 0)
+				releaseShaderObjects();
+			return 0;
+		}
+
+		// linking right behind the compiles is fine: a failed compile just shows up as a failed link
+		glAttachShader(pending.program, pending.vertexShader);
+		glAttachShader(pending.program, pending.fragmentShader);
+		programCachePrepare(pending.program);
+		glLinkProgram(pending.program);
+		return pending.program;
+	}
+
+	// returns true once the program left the Linking state
+	bool finishProgram(PendingProgram& pending, bool wait)
+	{
+		if (pending.state != ProgramState::Linking) return true;
+
+		if (!wait && parallelCompile)
+		{
+			int complete = 0;
+			glGetProgramiv(pending.program, GL_COMPLETION_STATUS_KHR, &complete);
+			if (!complete) return false;
+		}
+
+		int success;
+		glGetProgramiv(pending.program, GL_LINK_STATUS, &success);
+		if (success)
+		{
+			pending.state = ProgramState::Ready;
+			applyUniformBlockBindings(pending.program);
+			programCacheStore(pending.program, pending.vertexSource.c_str(), pending.fragmentSource.c_str());
+		}
+		else
+		{
+			printShaderLog(pending.vertexShader, "vertex", pending.name, pending.vertexSource);
+			printShaderLog(pending.fragmentShader, "fragment", pending.name, pending.fragmentSource);
+
+			char infoLog[512];
+			glGetProgramInfoLog(pending.program, 512, NULL, infoLog);
+			std::cout << pending.name << " linking error! " << infoLog << "\n";
+
+			glDeleteProgram(pending.program);
+			pending.program = 0;
+			pending.state = ProgramState::Failed;
+		}
+
+		pending.vertexSource.clear();
+		pending.fragmentSource.clear();
+		if (--pendingCount == 0)
+			releaseShaderObjects();
+		return true;
+	}
+
+	// drops a link still in flight without waiting for it, the caller deletes the GL program
+	void cancelLink(PendingProgram& pending)
+	{
+		if (pending.state != ProgramState::Linking) return;
+
+		pending.state = ProgramState::Failed;
+		pending.vertexSource.clear();
+		pending.fragmentSource.clear();
+		if (--pendingCount == 0)
+			releaseShaderObjects();
+	}
+
+	// waits for a link still in flight, the GL program is gone afterwards
+	void discardProgram(PendingProgram& pending)
+	{
+		if (pending.state == ProgramState::Linking)
+			finishProgram(pending, true);
+		if (pending.program != 0)
+			glDeleteProgram(pending.program);
+		pending.program = 0;
+	}
+
+	PendingProgram* findProgram(int handle)
+	{
+		if (!pipelineOpen || handle < 0) return nullptr;
+		int slot = handle & slotMask;
+		if (slot >= static_cast<int>(programs.size()) || programs[slot].generation != handle >> slotBits) return nullptr;
+		return &programs[slot];
+	}
+
+	// the slot goes back on the free list, every handle to it is stale from here on
+	void releaseSlot(PendingProgram& pending)
+	{
+		pending.program = 0;
+		pending.state = ProgramState::Deleted;
+		pending.generation = (pending.generation + 1) & (INT_MAX >> slotBits);
+		freeSlots.push_back(static_cast<int>(&pending - programs.data()));
+	}
+
+	int storeProgram(PendingProgram&& pending)
+	{
+		int slot;
+		if (!freeSlots.empty())
+		{
+			slot = freeSlots.back();
+			freeSlots.pop_back();
+			pending.generation = programs[slot].generation;
+			programs[slot] = std::move(pending);
+		}
+		else if (programs.size() <= static_cast<size_t>(slotMask))
+		{
+			slot = static_cast<int>(programs.size());
+			pending.generation = 0;
+			programs.push_back(std::move(pending));
+		}
+		else
+		{
+			std::cout << "Out of shader program slots\n";
+			if (pending.program != 0)
+				discardProgram(pending);
+			return -1;
+		}
+		return (programs[slot].generation << slotBits) | slot;
+	}
+}
+
+
+bool initShaderPipeline()
+{
+	pipelineOpen = true;
+
+	// let the driver pick how many compiler threads it wants
+	parallelCompile = GLAD_GL_KHR_parallel_shader_compile != 0;
+	if (parallelCompile)
+		glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+
+	fallbackProgram = createShaderProgram(fallbackVertexShaderSource, fallbackFragmentShaderSource, "Fallback");
+	return fallbackProgram != 0;
+}
+
+int requestShaderProgram(const char* vertexSource, const char* fragmentSource, const char* name)
+{
+	PendingProgram pending = {};
+	pending.name = name;
+
+	// a cached binary is ready straight away
+	pending.program = programCacheLoad(vertexSource, fragmentSource);
+	if (pending.program != 0)
+	{
+		pending.state = ProgramState::Ready;
+		applyUniformBlockBindings(pending.program);
+	}
+	else
+	{
+		pending.state = ProgramState::Linking;
+		pending.vertexSource = vertexSource;
+		pending.fragmentSource = fragmentSource;
+		if (submitProgram(vertexSource, fragmentSource, pending) == 0) return -1;
+		++pendingCount;
+
+		// a driver that already finished gets to report a broken program right here
+		if (parallelCompile && finishProgram(pending, false) && pending.state == ProgramState::Failed) return -1;
+	}
+
+	return storeProgram(std::move(pending));
+}
+
+void pollShaderPrograms()
+{
+	if (pendingCount == 0) return;
+
+	for (PendingProgram& pending : programs)
+		finishProgram(pending, false);
+}
+
+bool shaderProgramsPending()
+{
+	return pendingCount > 0;
+}
+
+unsigned int shaderProgram(int handle)
+{
+	PendingProgram* pending = findProgram(handle);
+	if (pending == nullptr || pending->state != ProgramState::Ready) return fallbackProgram;
+	return pending->program;
+}
+
+bool shaderProgramReady(int handle)
+{
+	PendingProgram* pending = findProgram(handle);
+	return pending != nullptr && pending->state == ProgramState::Ready;
+}
+
+bool shaderProgramFailed(int handle)
+{
+	PendingProgram* pending = findProgram(handle);
+	return pending != nullptr && pending->state == ProgramState::Failed;
+}
+
+bool shaderProgramAlive(int handle)
+{
+	return findProgram(handle) != nullptr;
+}
+
+bool adoptShaderProgram(int handle, int replacement)
+{
+	PendingProgram* target = findProgram(handle);
+	PendingProgram* source = findProgram(replacement);
+	if (source == nullptr) return true;
+	if (target == nullptr)
+	{
+		// whoever owned handle let it go in the meantime
+		deleteShaderProgram(replacement);
+		return true;
+	}
+
+	if (source->state == ProgramState::Linking) return false;
+	if (source->state != ProgramState::Ready)
+	{
+		// keep drawing with whatever the handle had before
+		deleteShaderProgram(replacement);
+		return true;
+	}
+
+	// a link of the target's that is still in flight is superseded, it must not keep the pipeline busy
+	cancelLink(*target);
+	if (target->program != 0)
+		glDeleteProgram(target->program);
+	target->program = source->program;
+	target->state = ProgramState::Ready;
+
+	releaseSlot(*source);
+	return true;
+}
+
+void deleteShaderProgram(int handle)
+{
+	PendingProgram* pending = findProgram(handle);
+	if (pending == nullptr) return;
+
+	discardProgram(*pending);
+	releaseSlot(*pending);
+}
+
+void cleanUpShaderPipeline()
+{
+	for (PendingProgram& pending : programs)
+		discardProgram(pending);
+	programs.clear();
+	freeSlots.clear();
+	pipelineOpen = false;
+
+	glDeleteProgram(fallbackProgram);
+	fallbackProgram = 0;
+}
+
+unsigned int createShaderProgram(const char* vertexSource, const char* fragmentSource, const char* name)
+{
+	// a cached binary skips compiling and linking altogether
+	unsigned int cachedProgram = programCacheLoad(vertexSource, fragmentSource);
+	if (cachedProgram != 0)
+	{
+		applyUniformBlockBindings(cachedProgram);
+		return cachedProgram;
+	}
+
+	PendingProgram pending = {};
+	pending.name = name;
+	pending.state = ProgramState::Linking;
+	pending.vertexSource = vertexSource;
+	pending.fragmentSource = fragmentSource;
+	if (submitProgram(vertexSource, fragmentSource, pending) == 0) return 0;
+	++pendingCount;
+
+	finishProgram(pending, true);
+	return pending.program;
+}
+
+void setUniformBlockBinding(const char* blockName, unsigned int binding)
+{
+	bool known = false;
+	for (auto& entry : uniformBlockBindings)
+		if (entry.first == blockName)
+		{
+			entry.second = binding;
+			known = true;
+		}
+	if (!known)
+		uniformBlockBindings.emplace_back(blockName, binding);
+
+	for (const PendingProgram& pending : programs)
+		if (pending.state == ProgramState::Ready)
+			applyUniformBlockBindings(pending.program);
+}
@@ -0,0 +1,69 @@
+#ifndef SHADER_H
+#define SHADER_H
+
+// ----- asynchronous pipeline
+// Every compile and link is submitted up front and polled once per frame without blocking
+// (GL_KHR_parallel_shader_compile when the driver has it). Until a program is linked, its handle
+// resolves to a trivial fallback program, so rendering can start right away.
+
+bool initShaderPipeline();		// builds the fallback program, returns false if even that fails
+// returns a handle (not a GL name), or -1 if the request could not be submitted or the driver
+// already knows it won't link; handles of deleted programs go stale and their slots get reused
+int requestShaderProgram(const char* vertexSource, const char* fragmentSource, const char* name);
+void pollShaderPrograms();
+bool shaderProgramsPending();
+// the linked program, or the fallback while it's still in flight (or failed to build)
+unsigned int shaderProgram(int handle);
+bool shaderProgramReady(int handle);
+bool shaderProgramFailed(int handle);
+bool shaderProgramAlive(int handle);		// false once the handle was deleted or adopted
+// once replacement is linked, it takes over handle (old program deleted, replacement handle released);
+// returns true when the request is settled, whether it was adopted or failed to build
+bool adoptShaderProgram(int handle, int replacement);
+void deleteShaderProgram(int handle);
+void cleanUpShaderPipeline();
+// every program that has a uniform block with this name gets it bound to binding, including
+// programs that are already linked and everything linked, loaded from the cache or reloaded later
+void setUniformBlockBinding(const char* blockName, unsigned int binding);
+
+// move-only owner of a pipeline handle
+class ShaderProgramHandle
+{
+public:
+	ShaderProgramHandle() = default;
+	explicit ShaderProgramHandle(int handle) : handle_(handle) {}
+	~ShaderProgramHandle() { reset(); }
+
+	ShaderProgramHandle(ShaderProgramHandle&& other) noexcept : handle_(other.handle_) { other.handle_ = -1; }
+	ShaderProgramHandle& operator=(ShaderProgramHandle&& other) noexcept
+	{
+		if (this != &other)
+		{
+			reset();
+			handle_ = other.handle_;
+			other.handle_ = -1;
+		}
+		return *this;
+	}
+
+	ShaderProgramHandle(const ShaderProgramHandle&) = delete;
+	ShaderProgramHandle& operator=(const ShaderProgramHandle&) = delete;
+
+	void reset()
+	{
+		if (handle_ != -1) deleteShaderProgram(handle_);
+		handle_ = -1;
+	}
+	int get() const { return handle_; }
+	unsigned int program() const { return shaderProgram(handle_); }
+
+private:
+	int handle_ = -1;
+};
+
+// ----- blocking
+// compiles and links a vertex + fragment shader pair, returns 0 (and prints the log) on failure;
+// the caller owns the returned program
+unsigned int createShaderProgram(const char* vertexSource, const char* fragmentSource, const char* name);
+
+#endif
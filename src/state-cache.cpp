@@ -0,0 +1,272 @@
+#include <glad/glad.h>
+#include "state-cache.h"
+#include <array>
+
+namespace
+{
+	template <typename T>
+	struct Shadow
+	{
+		T value{};
+		bool known = false;
+
+		// true if the driver has to see this call
+		bool set(const T& newValue)
+		{
+			if (known && value == newValue) return false;
+			value = newValue;
+			known = true;
+			return true;
+		}
+	};
+
+	StateCacheStats stats = {};
+
+	bool issue(bool changed)
+	{
+		++(changed ? stats.issued : stats.skipped);
+		return changed;
+	}
+
+	const GLenum bufferTargets[] = {
+		GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_UNIFORM_BUFFER, GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+		GL_PIXEL_PACK_BUFFER, GL_PIXEL_UNPACK_BUFFER, GL_TEXTURE_BUFFER, GL_TRANSFORM_FEEDBACK_BUFFER
+	};
+	const int bufferTargetCount = sizeof(bufferTargets) / sizeof(bufferTargets[0]);
+
+	const GLenum capabilities[] = {
+		GL_BLEND, GL_DEPTH_TEST, GL_CULL_FACE, GL_SCISSOR_TEST, GL_STENCIL_TEST,
+		GL_FRAMEBUFFER_SRGB, GL_PRIMITIVE_RESTART, GL_POLYGON_OFFSET_FILL, GL_MULTISAMPLE
+	};
+	const int capabilityCount = sizeof(capabilities) / sizeof(capabilities[0]);
+
+	Shadow<GLuint> program;
+	Shadow<GLuint> vertexArray;
+	Shadow<GLuint> buffers[bufferTargetCount];		// GL_ELEMENT_ARRAY_BUFFER is part of the VAO
+	Shadow<GLuint> drawFramebuffer;
+	Shadow<GLuint> readFramebuffer;
+	Shadow<bool> enabled[capabilityCount];
+	Shadow<std::array<GLenum, 4>> blendFunc;		// src rgb, dst rgb, src alpha, dst alpha
+	Shadow<GLenum> depthFunc;
+	Shadow<GLboolean> depthMask;
+	Shadow<std::array<GLfloat, 4>> clearColor;
+	Shadow<std::array<GLint, 4>> viewport;
+
+	// the real entry points
+	PFNGLUSEPROGRAMPROC realUseProgram;
+	PFNGLBINDVERTEXARRAYPROC realBindVertexArray;
+	PFNGLDELETEVERTEXARRAYSPROC realDeleteVertexArrays;
+	PFNGLBINDBUFFERPROC realBindBuffer;
+	PFNGLBINDBUFFERBASEPROC realBindBufferBase;
+	PFNGLBINDBUFFERRANGEPROC realBindBufferRange;
+	PFNGLDELETEBUFFERSPROC realDeleteBuffers;
+	PFNGLBINDFRAMEBUFFERPROC realBindFramebuffer;
+	PFNGLDELETEFRAMEBUFFERSPROC realDeleteFramebuffers;
+	PFNGLENABLEPROC realEnable;
+	PFNGLDISABLEPROC realDisable;
+	PFNGLBLENDFUNCPROC realBlendFunc;
+	PFNGLBLENDFUNCSEPARATEPROC realBlendFuncSeparate;
+	PFNGLDEPTHFUNCPROC realDepthFunc;
+	PFNGLDEPTHMASKPROC realDepthMask;
+	PFNGLCLEARCOLORPROC realClearColor;
+	PFNGLVIEWPORTPROC realViewport;
+
+	int bufferSlot(GLenum target)
+	{
+		for (int i = 0; i < bufferTargetCount; ++i)
+			if (bufferTargets[i] == target) return i;
+		return -1;
+	}
+
+	int capabilitySlot(GLenum capability)
+	{
+		for (int i = 0; i < capabilityCount; ++i)
+			if (capabilities[i] == capability) return i;
+		return -1;
+	}
+
+	void APIENTRY cachedUseProgram(GLuint name)
+	{
+		if (issue(program.set(name)))
+			realUseProgram(name);
+	}
+
+	void APIENTRY cachedBindVertexArray(GLuint name)
+	{
+		if (issue(vertexArray.set(name)))
+		{
+			realBindVertexArray(name);
+			buffers[bufferSlot(GL_ELEMENT_ARRAY_BUFFER)].known = false;	// comes with the VAO
+		}
+	}
+
+	void APIENTRY cachedDeleteVertexArrays(GLsizei count, const GLuint* names)
+	{
+		// deleting the bound VAO reverts to VAO 0, whose element buffer we never saw
+		for (GLsizei i = 0; i < count; ++i)
+			if (vertexArray.known && vertexArray.value == names[i])
+			{
+				vertexArray.value = 0;
+				buffers[bufferSlot(GL_ELEMENT_ARRAY_BUFFER)].known = false;
+			}
+		realDeleteVertexArrays(count, names);
+	}
+
+	void APIENTRY cachedBindBuffer(GLenum target, GLuint name)
+	{
+		int slot = bufferSlot(target);
+		if (slot < 0 ? issue(true) : issue(buffers[slot].set(name)))
+			realBindBuffer(target, name);
+	}
+
+	// the indexed binding isn't cached, but it also replaces the generic one
+	void APIENTRY cachedBindBufferBase(GLenum target, GLuint index, GLuint name)
+	{
+		int slot = bufferSlot(target);
+		if (slot >= 0) buffers[slot].set(name);
+		issue(true);
+		realBindBufferBase(target, index, name);
+	}
+
+	void APIENTRY cachedBindBufferRange(GLenum target, GLuint index, GLuint name, GLintptr offset, GLsizeiptr size)
+	{
+		int slot = bufferSlot(target);
+		if (slot >= 0) buffers[slot].set(name);
+		issue(true);
+		realBindBufferRange(target, index, name, offset, size);
+	}
+
+	void APIENTRY cachedDeleteBuffers(GLsizei count, const GLuint* names)
+	{
+		for (GLsizei i = 0; i < count; ++i)
+			for (Shadow<GLuint>& buffer : buffers)
+				if (buffer.known && buffer.value == names[i])
+					buffer.value = 0;
+		realDeleteBuffers(count, names);
+	}
+
+	void APIENTRY cachedBindFramebuffer(GLenum target, GLuint name)
+	{
+		bool changed = false;
+		if (target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER)
+			changed |= drawFramebuffer.set(name);
+		if (target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER)
+			changed |= readFramebuffer.set(name);
+		if (issue(changed))
+			realBindFramebuffer(target, name);
+	}
+
+	void APIENTRY cachedDeleteFramebuffers(GLsizei count, const GLuint* names)
+	{
+		for (GLsizei i = 0; i < count; ++i)
+		{
+			if (drawFramebuffer.known && drawFramebuffer.value == names[i]) drawFramebuffer.value = 0;
+			if (readFramebuffer.known && readFramebuffer.value == names[i]) readFramebuffer.value = 0;
+		}
+		realDeleteFramebuffers(count, names);
+	}
+
+	void APIENTRY cachedEnable(GLenum capability)
+	{
+		int slot = capabilitySlot(capability);
+		if (slot < 0 ? issue(true) : issue(enabled[slot].set(true)))
+			realEnable(capability);
+	}
+
+	void APIENTRY cachedDisable(GLenum capability)
+	{
+		int slot = capabilitySlot(capability);
+		if (slot < 0 ? issue(true) : issue(enabled[slot].set(false)))
+			realDisable(capability);
+	}
+
+	void APIENTRY cachedBlendFunc(GLenum source, GLenum destination)
+	{
+		if (issue(blendFunc.set({ source, destination, source, destination })))
+			realBlendFunc(source, destination);
+	}
+
+	void APIENTRY cachedBlendFuncSeparate(GLenum sourceRgb, GLenum destinationRgb, GLenum sourceAlpha, GLenum destinationAlpha)
+	{
+		if (issue(blendFunc.set({ sourceRgb, destinationRgb, sourceAlpha, destinationAlpha })))
+			realBlendFuncSeparate(sourceRgb, destinationRgb, sourceAlpha, destinationAlpha);
+	}
+
+	void APIENTRY cachedDepthFunc(GLenum function)
+	{
+		if (issue(depthFunc.set(function)))
+			realDepthFunc(function);
+	}
+
+	void APIENTRY cachedDepthMask(GLboolean flag)
+	{
+		if (issue(depthMask.set(flag)))
+			realDepthMask(flag);
+	}
+
+	void APIENTRY cachedClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+	{
+		if (issue(clearColor.set({ red, green, blue, alpha })))
+			realClearColor(red, green, blue, alpha);
+	}
+
+	void APIENTRY cachedViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+	{
+		if (issue(viewport.set({ x, y, width, height })))
+			realViewport(x, y, width, height);
+	}
+
+	template <typename Function>
+	void wrap(Function& gladPointer, Function& real, Function cached)
+	{
+		if (gladPointer == cached || gladPointer == nullptr) return;	// already installed / not loaded
+		real = gladPointer;
+		gladPointer = cached;
+	}
+}
+
+
+void installStateCache()
+{
+	wrap(glad_glUseProgram, realUseProgram, cachedUseProgram);
+	wrap(glad_glBindVertexArray, realBindVertexArray, cachedBindVertexArray);
+	wrap(glad_glDeleteVertexArrays, realDeleteVertexArrays, cachedDeleteVertexArrays);
+	wrap(glad_glBindBuffer, realBindBuffer, cachedBindBuffer);
+	wrap(glad_glBindBufferBase, realBindBufferBase, cachedBindBufferBase);
+	wrap(glad_glBindBufferRange, realBindBufferRange, cachedBindBufferRange);
+	wrap(glad_glDeleteBuffers, realDeleteBuffers, cachedDeleteBuffers);
+	wrap(glad_glBindFramebuffer, realBindFramebuffer, cachedBindFramebuffer);
+	wrap(glad_glDeleteFramebuffers, realDeleteFramebuffers, cachedDeleteFramebuffers);
+	wrap(glad_glEnable, realEnable, cachedEnable);
+	wrap(glad_glDisable, realDisable, cachedDisable);
+	wrap(glad_glBlendFunc, realBlendFunc, cachedBlendFunc);
+	wrap(glad_glBlendFuncSeparate, realBlendFuncSeparate, cachedBlendFuncSeparate);
+	wrap(glad_glDepthFunc, realDepthFunc, cachedDepthFunc);
+	wrap(glad_glDepthMask, realDepthMask, cachedDepthMask);
+	wrap(glad_glClearColor, realClearColor, cachedClearColor);
+	wrap(glad_glViewport, realViewport, cachedViewport);
+
+	invalidateStateCache();
+}
+
+void invalidateStateCache()
+{
+	program.known = false;
+	vertexArray.known = false;
+	for (Shadow<GLuint>& buffer : buffers)
+		buffer.known = false;
+	drawFramebuffer.known = false;
+	readFramebuffer.known = false;
+	for (Shadow<bool>& capability : enabled)
+		capability.known = false;
+	blendFunc.known = false;
+	depthFunc.known = false;
+	depthMask.known = false;
+	clearColor.known = false;
+	viewport.known = false;
+}
+
+StateCacheStats stateCacheStats()
+{
+	return stats;
+}
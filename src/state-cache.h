@@ -0,0 +1,20 @@
+#ifndef STATE_CACHE_H
+#define STATE_CACHE_H
+
+// Shadow copy of the GL state the renderer touches most. installStateCache() swaps the glad
+// function pointers (glad_glUseProgram, glad_glBindVertexArray, glad_glBindBuffer, ...) for wrappers
+// that drop calls setting a value that is already current, so callers keep writing plain GL.
+// The shadow starts out unknown and belongs to one context, used from one thread at a time.
+
+struct StateCacheStats
+{
+	unsigned long long issued;		// calls passed on to the driver
+	unsigned long long skipped;		// redundant calls dropped
+};
+
+void installStateCache();			// after gladLoadGLLoader
+// forget everything, e.g. after code that doesn't go through glad changed state behind our back
+void invalidateStateCache();
+StateCacheStats stateCacheStats();
+
+#endif
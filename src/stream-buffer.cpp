@@ -0,0 +1,125 @@
+#include <glad/glad.h>
+#include "stream-buffer.h"
+#include <iostream>
+
+
+bool StreamBuffer::init(unsigned int target, size_t frameCapacity, int frameCount)
+{
+	destroy();
+	if (frameCount < 1 || frameCount > maxFrameCount) return false;
+
+	target_ = target;
+	frameCapacity_ = frameCapacity;
+	frameCount_ = frameCount;
+	region_ = 0;
+	used_ = 0;
+	regionStarted_ = false;
+
+	size_t totalSize = frameCapacity * frameCount;
+	buffer_ = GpuBuffer::create();
+	glBindBuffer(target_, buffer_.name());
+
+	if (GLAD_GL_ARB_buffer_storage)
+	{
+		// immutable storage mapped once for the buffer's whole lifetime
+		const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		glBufferStorage(target_, static_cast<GLsizeiptr>(totalSize), nullptr, flags);
+		persistentData_ = static_cast<char*>(glMapBufferRange(target_, 0, static_cast<GLsizeiptr>(totalSize), flags));
+		if (persistentData_ == nullptr)
+		{
+			std::cout << "Persistent mapping of the stream buffer failed\n";
+			buffer_.reset();
+			return false;
+		}
+	}
+	else
+	{
+		glBufferData(target_, static_cast<GLsizeiptr>(totalSize), nullptr, GL_STREAM_DRAW);
+	}
+
+	setGpuResourceBytes(buffer_.handle(), totalSize);
+	return true;
+}
+
+void StreamBuffer::destroy()
+{
+	for (int i = 0; i < frameCount_; ++i)
+	{
+		if (fences_[i] != nullptr)
+			glDeleteSync(fences_[i]);
+		fences_[i] = nullptr;
+	}
+
+	if (persistentData_ != nullptr)
+	{
+		glBindBuffer(target_, buffer_.name());
+		glUnmapBuffer(target_);
+		persistentData_ = nullptr;
+	}
+	buffer_.reset();		// the registry defers the actual delete until the GPU is done
+	frameCount_ = 0;
+}
+
+void StreamBuffer::beginRegion()
+{
+	// normally long signaled: the region was last used frameCount_ frames ago
+	GLsync& fence = fences_[region_];
+	if (fence != nullptr)
+	{
+		GLenum status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+		while (status == GL_TIMEOUT_EXPIRED)
+			status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);	// 1 ms steps
+		glDeleteSync(fence);
+		fence = nullptr;
+	}
+	regionStarted_ = true;
+}
+
+StreamAllocation StreamBuffer::allocate(size_t size, size_t alignment)
+{
+	StreamAllocation allocation;
+	if (frameCount_ == 0) return allocation;
+	if (!regionStarted_) beginRegion();
+
+	// alignment doesn't need to be a power of two (vertex strides usually aren't); it's the offset into
+	// the whole buffer that has to be aligned, and regions don't start at a multiple of it in general
+	size_t regionStart = region_ * frameCapacity_;
+	size_t aligned = (regionStart + used_ + alignment - 1) / alignment * alignment - regionStart;
+	if (aligned + size > frameCapacity_) return allocation;
+
+	allocation.offset = regionStart + aligned;
+	allocation.size = size;
+	used_ = aligned + size;
+
+	if (persistentData_ != nullptr)
+	{
+		allocation.data = persistentData_ + allocation.offset;
+	}
+	else
+	{
+		// the fence already told us nobody reads this range, so the driver doesn't need to sync
+		glBindBuffer(target_, buffer_.name());
+		allocation.data = glMapBufferRange(target_, static_cast<GLintptr>(allocation.offset), static_cast<GLsizeiptr>(size),
+			GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+	}
+	return allocation;
+}
+
+void StreamBuffer::commit(const StreamAllocation& allocation)
+{
+	// coherent persistent mappings need nothing, the mapped-range path must unmap before drawing
+	if (persistentData_ != nullptr || allocation.data == nullptr) return;
+
+	glBindBuffer(target_, buffer_.name());
+	glUnmapBuffer(target_);
+}
+
+void StreamBuffer::endFrame()
+{
+	if (frameCount_ == 0 || !regionStarted_) return;
+
+	fences_[region_] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	region_ = (region_ + 1) % frameCount_;
+	used_ = 0;
+	regionStarted_ = false;
+}
@@ -0,0 +1,56 @@
+#ifndef STREAM_BUFFER_H
+#define STREAM_BUFFER_H
+
+#include "gpu-resources.h"
+#include <cstddef>
+
+// Ring of per-frame regions in one buffer for data that is rewritten every frame.
+// With GL_ARB_buffer_storage the whole buffer is mapped once (persistent + coherent); on plain 3.3
+// each allocation is mapped unsynchronized. Either way a region is only reused after the fence
+// of the frame that last used it has signaled, so CPU writes never wait on in-flight draws.
+
+struct StreamAllocation
+{
+	void* data = nullptr;		// nullptr when the request didn't fit into this frame's region
+	size_t offset = 0;			// byte offset into buffer()
+	size_t size = 0;
+};
+
+class StreamBuffer
+{
+public:
+	StreamBuffer() = default;
+	~StreamBuffer() { destroy(); }
+
+	StreamBuffer(const StreamBuffer&) = delete;
+	StreamBuffer& operator=(const StreamBuffer&) = delete;
+
+	bool init(unsigned int target, size_t frameCapacity, int frameCount = 3);
+	void destroy();
+
+	// write into data, then commit before anything draws from it
+	StreamAllocation allocate(size_t size, size_t alignment = 16);
+	void commit(const StreamAllocation& allocation);
+	void endFrame();		// after the frame's draws were submitted
+
+	unsigned int buffer() const { return buffer_.name(); }
+	bool persistent() const { return persistentData_ != nullptr; }
+	size_t frameCapacity() const { return frameCapacity_; }
+
+	static constexpr int maxFrameCount = 8;
+
+private:
+	void beginRegion();
+
+	GpuBuffer buffer_;
+	unsigned int target_ = 0;
+	size_t frameCapacity_ = 0;
+	int frameCount_ = 0;
+	int region_ = 0;
+	size_t used_ = 0;
+	bool regionStarted_ = false;
+	char* persistentData_ = nullptr;
+	struct __GLsync* fences_[maxFrameCount] = {};
+};
+
+#endif
@@ -1,8 +1,21 @@
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 #include "triangle.h"
+#include "batch.h"
+#include "instancing.h"
+#include "shader.h"
+#include "shader-assets.h"
+#include "gpu-resources.h"
+#include "mesh-builder.h"
+#include "uniform-buffer.h"
+#include "vertex-format.h"
+#include "quantize.h"
+#include "mesh-file.h"
+#include "asset-streaming.h"
+#include <cmath>
 #include <iostream>
 #include <utility>
+#include <vector>
 
 namespace
 {
@@ -13,20 +26,50 @@ namespace
 		"gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0);\n"
 		"}\0";
 
-	const char* fragmentShaderSource1 = "#version 330 core\n"
-		"out vec4 FragmentColor;\n"
+	const char* quantizedVertexShaderSource = "#version 330 core\n"
+		"layout(location = 0) in vec3 aPos;\n"
+		"layout(std140) uniform Dequantize\n"
+		"{\n"
+		"vec4 positionScale;\n"
+		"vec4 positionOffset;\n"
+		"};\n"
 		"void main()\n"
 		"{\n"
-		"FragmentColor = vec4(1.0f, 0.5f, 0.2f, 1.0f);\n"
+		"gl_Position = vec4(positionOffset.xyz + positionScale.xyz * aPos, 1.0);\n"
 		"}\0";
 
-	const char* fragmentShaderSource2 = "#version 330 core\n"
+	const char* fragmentShaderSource = "#version 330 core\n"
 		"out vec4 FragmentColor;\n"
+		"layout(std140) uniform Material\n"
+		"{\n"
+		"vec4 color;\n"
+		"};\n"
 		"void main()\n"
 		"{\n"
-		"FragmentColor = vec4(1.0f, 1.0f, 0.0f, 1.0f);\n"
+		"FragmentColor = color;\n"
 		"}\0";
 
+	// mirrors the Material block in fragment-shader.txt
+	struct MaterialUniforms
+	{
+		std140::vec4 color;
+	};
+
+	constexpr auto materialOffsets = std140::offsets<std140::vec4>();
+	static_assert(offsetof(MaterialUniforms, color) == materialOffsets[0], "MaterialUniforms::color is not where std140 puts it");
+	static_assert(sizeof(MaterialUniforms) == std140::blockSize<std140::vec4>(), "MaterialUniforms does not match its std140 size");
+
+	// mirrors the Dequantize block in vertex-shader.txt
+	struct DequantizeUniforms
+	{
+		std140::vec4 positionScale;
+		std140::vec4 positionOffset;
+	};
+
+	constexpr auto dequantizeOffsets = std140::offsets<std140::vec4, std140::vec4>();
+	static_assert(offsetof(DequantizeUniforms, positionOffset) == dequantizeOffsets[1], "DequantizeUniforms::positionOffset is not where std140 puts it");
+	static_assert(sizeof(DequantizeUniforms) == std140::blockSize<std140::vec4, std140::vec4>(), "DequantizeUniforms does not match its std140 size");
+
 	float vertices1[] = {
 		-0.8f, -0.5f, 0.0f,
 		-0.8f, 0.5f, 0.0f,
@@ -46,140 +89,353 @@ namespace
 		-0.5f, -0.5f, 0.0f
 	};
 
+	// the two materials, uploaded as MaterialUniforms every frame
+	float triangleColors[2][3] = {
+		{ 1.0f, 0.5f, 0.2f },
+		{ 1.0f, 1.0f, 0.0f }
+	};
+
 	unsigned int rectangleIndices[] = {
 		1, 2, 0,
 		1, 2, 3
 	};
 
-	unsigned int EBO;
-	unsigned int VAO[2];
-	unsigned int VBO[2];
-	unsigned int shaderPrograms[2];
+	// owned through the GPU resource registry, released (not deleted outright) in cleanUpShadersAndVAOs
+	GpuBuffer EBO;
+	GpuVertexArray VAO[2];
+	GpuBuffer VBO[2];
+	ShaderProgramHandle triangleProgram;		// both triangles, the color is a material now
+	UniformSlice materialSlices[2];			// where this frame's materials are in the uniform ring
+
+	GpuVertexArray meshVAO;
+	GpuBuffer meshVBO;
+	GpuBuffer meshEBO;
+	GLuint meshVertexArray;		// meshVAO, or the streamed mesh's once it has arrived
+	GLenum meshIndexType;
+	GLsizei meshIndexCount;
+	int streamedMeshAsset = -1;		// asset handle until it's adopted
+	ShaderProgramHandle quantizedMeshProgram;	// -1 unless the mesh was quantized
+	DequantizeUniforms meshDequantize;
+
+	int instanceCount;
+	int instanceColumns;
+
+	// the mesh program variant that undoes the position quantization (see quantize.h)
+	bool requestQuantizedMeshProgram(const float positionScale[3], const float positionOffset[3])
+	{
+		meshDequantize.positionScale = { positionScale[0], positionScale[1], positionScale[2], 0.0f };
+		meshDequantize.positionOffset = { positionOffset[0], positionOffset[1], positionOffset[2], 0.0f };
+
+		// same files, patched to dequantize
+		setUniformBlockBinding("Dequantize", dequantizeUniformBinding);
+		const std::vector<ShaderDefine> quantizedDefines = { { "QUANTIZED_POSITIONS", "1" } };
+		quantizedMeshProgram = ShaderProgramHandle(loadShaderProgramAsset("vertex-shader.txt", "fragment-shader.txt", quantizedDefines, "Quantized mesh program"));
+		if (quantizedMeshProgram.get() == -1)
+			quantizedMeshProgram = ShaderProgramHandle(requestShaderProgram(quantizedVertexShaderSource, fragmentShaderSource, "Quantized mesh program"));
+		return quantizedMeshProgram.get() != -1;
+	}
+
+	// the placeholder mesh goes away, the streamed one (owned by asset-streaming.cpp) takes its place
+	void adoptStreamedMesh(const StreamedMesh& mesh)
+	{
+		if (mesh.indexCount == 0)
+		{
+			std::cout << "Streamed mesh has no indices, keeping the built-in one\n";
+			return;
+		}
+
+		meshVAO.reset();
+		meshVBO.reset();
+		meshEBO.reset();
+		meshVertexArray = mesh.vertexArray;
+		meshIndexCount = mesh.indexCount;
+		meshIndexType = mesh.indexType;
+
+		if (mesh.quantizedPositions)
+			requestQuantizedMeshProgram(mesh.positionScale, mesh.positionOffset);
+		else
+			quantizedMeshProgram.reset();
+	}
 }
 
 
-std::pair<unsigned int, unsigned int> initShaders(int& statusCode)
+std::pair<int, int> initShaders(int& statusCode)
 {
-	// create a vertex shader object
-	unsigned int vertexShader;
-	vertexShader = glCreateShader(GL_VERTEX_SHADER);
-
-	// attach vertex shader source to corresponding object
-	glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-	// compile it at run-time
-	glCompileShader(vertexShader);
-
-	// check for compiling errors
-	int success;
-	glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-	if (!success)
-	{
-		char infoLog[512];
-		glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
-		std::cout << "Vertex shader compiling error! " << infoLog << "\n";
+	// one program for both triangles, each draw binds its color as a Material uniform block;
+	// it's only submitted here, renderLoop draws with the fallback program until it's linked
+	setUniformBlockBinding("Material", materialUniformBinding);
+
+	// prefer the shader files (they can be edited while running), the literals above are the fallback
+	triangleProgram = ShaderProgramHandle(loadShaderProgramAsset("vertex-shader.txt", "fragment-shader.txt", {}, "Shader program"));
+	if (triangleProgram.get() == -1)
+		triangleProgram = ShaderProgramHandle(requestShaderProgram(vertexShaderSource, fragmentShaderSource, "Shader program"));
+
+	if (triangleProgram.get() == -1)
+	{
 		statusCode = -1;
 		return {};	// no pair essentially
 	}
 
-	// do the same for fragment shader
-	unsigned int fragmentShaders[2];
-	fragmentShaders[0] = glCreateShader(GL_FRAGMENT_SHADER);
-	fragmentShaders[1] = glCreateShader(GL_FRAGMENT_SHADER);
+	return { triangleProgram.get(), triangleProgram.get() };
+}
+
+std::pair<unsigned int, unsigned int> initVAOs()
+{
+	// generate VAO and bind it (so that the subsequent operations on VBO and VertexAttribPointer will be attached to the current VAO)
+	VAO[0] = GpuVertexArray::create();
+	VAO[1] = GpuVertexArray::create();
+
+	//// ----- Vertex Buffer Object (VBO) (to draw a triangle)
+
+	// Vertex Buffer Object (stores a bunch of vertices)
+
+	VBO[0] = GpuBuffer::create();		// generate a vertices buffer
+	VBO[1] = GpuBuffer::create();
+
+	glBindVertexArray(VAO[0].name());
+	gpuBufferData(VBO[0].handle(), GL_ARRAY_BUFFER, sizeof(vertices1), vertices1, GL_STATIC_DRAW);
+
+	PositionFormat::setup();
 
-	glShaderSource(fragmentShaders[0], 1, &fragmentShaderSource1, NULL);
-	glCompileShader(fragmentShaders[0]);
+	// do the same with another VAO
+	glBindVertexArray(VAO[1].name());
+
+	gpuBufferData(VBO[1].handle(), GL_ARRAY_BUFFER, sizeof(vertices2), vertices2, GL_STATIC_DRAW);
+
+	PositionFormat::setup();
 
-	glShaderSource(fragmentShaders[1], 1, &fragmentShaderSource2, NULL);
-	glCompileShader(fragmentShaders[1]);
+	return { VAO[0].name(), VAO[1].name() };
+}
 
+void cleanUpShadersAndVAOs()
+{
+	// queued for deletion, the registry deletes them once the GPU is done with them
 	for (int i = 0; i < 2; ++i)
 	{
-		glGetShaderiv(fragmentShaders[i], GL_COMPILE_STATUS, &success);
-		if (!success)
-		{
-			char infoLog[512];
-			glGetShaderInfoLog(fragmentShaders[i], 512, NULL, infoLog);
-			std::cout << "Fragment shader " << i << " compiling error! " << infoLog << "\n";
-			statusCode = -1;
-			return {};
-		}
+		VAO[i].reset();
+		VBO[i].reset();
+		materialSlices[i] = {};
 	}
+	triangleProgram.reset();
+	EBO.reset();
 
-	// create a shader program (a combination of few shaders) that is going to be used in rendering
-	shaderPrograms[0] = glCreateProgram();
-	shaderPrograms[1] = glCreateProgram();
+	meshVAO.reset();
+	meshVBO.reset();
+	meshEBO.reset();
+	quantizedMeshProgram.reset();
 
-	// attach shaders to program and link them
-	for (int i = 0; i < 2; ++i)
+	instancingCleanUp();
+}
+
+bool initBatchedTriangles(int shapeCount)
+{
+	if (!batchInit()) return false;
+
+	if (shapeCount <= 2)
+	{
+		// the two tutorial triangles where they always were, or just the first one
+		batchAddShape(vertices1, 3, triangleColors[0]);
+		if (shapeCount == 2)
+			batchAddShape(vertices2, 3, triangleColors[1]);
+	}
+	else
 	{
-		glAttachShader(shaderPrograms[i], vertexShader);
-		glAttachShader(shaderPrograms[i], fragmentShaders[i]);
-		glLinkProgram(shaderPrograms[i]);
+		// tile the viewport with a square grid, alternating between the two triangles
+		int columns = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(shapeCount))));
+		float cellSize = 2.0f / columns;
+		float scale = 1.0f / columns;	// both triangles fit into [-0.8, 0.8], so this keeps them inside a cell
 
-		// check for errors
-		glGetProgramiv(shaderPrograms[i], GL_LINK_STATUS, &success);
-		if (!success)
+		for (int i = 0; i < shapeCount; ++i)
 		{
-			char infoLog[512];
-			glGetProgramInfoLog(shaderPrograms[i], 512, NULL, infoLog);
-			std::cout << "Shader program " << i << " linking error! " << infoLog << "\n";
-			statusCode = -1;
-			return {};
+			const float* source = (i % 2 == 0) ? vertices1 : vertices2;
+			float centerX = -1.0f + cellSize * (i % columns + 0.5f);
+			float centerY = -1.0f + cellSize * (i / columns + 0.5f);
+
+			float positions[9];
+			for (int v = 0; v < 3; ++v)
+			{
+				positions[3 * v] = centerX + source[3 * v] * scale;
+				positions[3 * v + 1] = centerY + source[3 * v + 1] * scale;
+				positions[3 * v + 2] = source[3 * v + 2];
+			}
+			batchAddShape(positions, 3, triangleColors[i % 2]);
 		}
-	}	
-
-	// delete shader objects because we've linked them to shader program
-	glDeleteShader(vertexShader);
-	glDeleteShader(fragmentShaders[0]);
-	glDeleteShader(fragmentShaders[1]);
+	}
 
-	return { shaderPrograms[0], shaderPrograms[1] };
+	batchUpload();
+	return true;
 }
 
-std::pair<unsigned int, unsigned int> initVAOs()
+bool initIndexedMesh(int shapeCount, bool quantize, const char* savePath)
 {
-	// generate VAO and bind it (so that the subsequent operations on VBO and VertexAttribPointer will be attached to the current VAO)
-	glGenVertexArrays(2, VAO);
+	// the builder wants triangle soup, so spell out every triangle's corners
+	std::vector<float> soup;
+	if (shapeCount <= 1)
+	{
+		for (unsigned int index : rectangleIndices)
+			soup.insert(soup.end(), &rectangleVertices[3 * index], &rectangleVertices[3 * index] + 3);
+	}
+	else
+	{
+		int columns = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(shapeCount))));
+		int rows = (shapeCount + columns - 1) / columns;
+		float cellWidth = 1.8f / columns;
+		float cellHeight = 1.8f / rows;
 
-	// ----- Element Buffer Object (EBO) (to draw a rectangle)
-	/*glGenBuffers(1, &EBO);
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(rectangleIndices), rectangleIndices, GL_STATIC_DRAW);
+		for (int i = 0; i < shapeCount; ++i)
+		{
+			float x0 = -0.9f + cellWidth * (i % columns), x1 = x0 + cellWidth;
+			float y0 = -0.9f + cellHeight * (i / columns), y1 = y0 + cellHeight;
+			const float quad[18] = {
+				x0, y0, 0.0f,  x1, y0, 0.0f,  x1, y1, 0.0f,
+				x0, y0, 0.0f,  x1, y1, 0.0f,  x0, y1, 0.0f
+			};
+			soup.insert(soup.end(), quad, quad + 18);
+		}
+	}
 
-	glGenBuffers(1, &VBO);
-	glBindBuffer(GL_ARRAY_BUFFER, VBO);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(rectangleVertices), rectangleVertices, GL_STATIC_DRAW);*/
+	MeshBuildReport report;
+	IndexedMesh mesh = buildIndexedMesh(soup.data(), soup.size() / 3, &report);
+	std::cout << "Indexed mesh: " << report.soupVertices << " -> " << report.uniqueVertices << " vertices, ACMR "
+		<< report.acmrBefore << " -> " << report.acmrAfter << "\n";
+
+	// whatever goes to the GPU is also what a mesh file stores
+	QuantizedAttributes quantized;
+	std::vector<MeshFileAttribute> attributes;
+	const void* vertexData;
+	size_t vertexStride;
+	if (quantize)
+	{
+		QuantizationReport quantization;
+		quantized = quantizeVertices(mesh.positions.data(), nullptr, nullptr, mesh.vertexCount(), &quantization);
+		std::cout << "Quantized positions: " << quantization.bytesBefore << " -> " << quantization.bytesAfter << " bytes, max error "
+			<< quantization.maxPositionError << " (" << quantization.maxRelativePositionError * 100.0f << "% of the extent), mean "
+			<< quantization.meanPositionError << (quantization.simd ? ", SIMD" : ", scalar") << "\n";
+
+		attributes = meshFileAttributes<QuantizedPositionFormat>();
+		vertexData = quantized.positions.data();
+		vertexStride = QuantizedPositionFormat::stride;
+	}
+	else
+	{
+		attributes = meshFileAttributes<PositionFormat>();
+		vertexData = mesh.positions.data();
+		vertexStride = PositionFormat::stride;
+	}
 
-	//// ----- Vertex Buffer Object (VBO) (to draw a triangle)
+	std::vector<unsigned short> indices16;
+	const void* indexData = mesh.indices.data();
+	GLenum indexType = GL_UNSIGNED_INT;
+	if (mesh.fitsIn16BitIndices())
+	{
+		indices16.assign(mesh.indices.begin(), mesh.indices.end());
+		indexData = indices16.data();
+		indexType = GL_UNSIGNED_SHORT;
+	}
 
-	// Vertex Buffer Object (stores a bunch of vertices)
+	if (savePath != nullptr && writeMeshFile(savePath, attributes, vertexData, vertexStride, mesh.vertexCount(), indexData, indexType,
+		mesh.indices.size(), quantize ? quantized.positionScale : nullptr, quantize ? quantized.positionOffset : nullptr))
+		std::cout << "Wrote " << savePath << "\n";
+
+	meshVAO = GpuVertexArray::create();
+	meshVBO = GpuBuffer::create();
+	meshEBO = GpuBuffer::create();
+
+	glBindVertexArray(meshVAO.name());
+	gpuBufferData(meshVBO.handle(), GL_ARRAY_BUFFER, vertexStride * mesh.vertexCount(), vertexData, GL_STATIC_DRAW);
+	if (quantize)
+		QuantizedPositionFormat::setup();
+	else
+		PositionFormat::setup();
+
+	// the element buffer binding is VAO state, so it has to go in while the VAO is bound
+	meshIndexCount = static_cast<GLsizei>(mesh.indices.size());
+	meshIndexType = indexType;
+	gpuBufferData(meshEBO.handle(), GL_ELEMENT_ARRAY_BUFFER, mesh.indices.size() * (indexType == GL_UNSIGNED_SHORT ? 2 : 4), indexData, GL_STATIC_DRAW);
+
+	glBindVertexArray(0);
+	meshVertexArray = meshVAO.name();
+	return !quantize || requestQuantizedMeshProgram(quantized.positionScale, quantized.positionOffset);
+}
 
-	glGenBuffers(2, VBO);		// generate a vertices buffer
+void streamIndexedMesh(const char* path)
+{
+	streamedMeshAsset = requestMeshAsset(path);
+}
 
-	glBindVertexArray(VAO[0]);
-	glBindBuffer(GL_ARRAY_BUFFER, VBO[0]);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices1), vertices1, GL_STATIC_DRAW);
+void drawIndexedMesh()
+{
+	if (streamedMeshAsset != -1)
+	{
+		if (const StreamedMesh* streamed = streamedMesh(streamedMeshAsset))
+		{
+			adoptStreamedMesh(*streamed);
+			streamedMeshAsset = -1;
+		}
+		else if (assetState(streamedMeshAsset) == AssetState::Failed)
+			streamedMeshAsset = -1;
+	}
+
+	if (quantizedMeshProgram.get() != -1)
+	{
+		glUseProgram(quantizedMeshProgram.program());
+		bindUniformSlice(dequantizeUniformBinding, uploadUniforms(meshDequantize));
+	}
+	else
+		glUseProgram(triangleProgram.program());
+	bindTriangleMaterial(0);
+	glBindVertexArray(meshVertexArray);
+	glDrawElements(GL_TRIANGLES, meshIndexCount, meshIndexType, 0);
+}
 
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-	glEnableVertexAttribArray(0);
+bool initInstancedTriangles(int shapeCount)
+{
+	instanceCount = shapeCount > 1 ? shapeCount : 1;
+	instanceColumns = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(instanceCount))));
+	return instancingInit(vertices1, 3, instanceCount);
+}
 
-	// do the same with another VAO
-	glBindVertexArray(VAO[1]);
+void drawInstancedTriangles(float time)
+{
+	InstanceData* instances = instancingMap(instanceCount);
+	if (instances == nullptr) return;
 
-	glBindBuffer(GL_ARRAY_BUFFER, VBO[1]);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices2), vertices2, GL_STATIC_DRAW);
+	float cellSize = 2.0f / instanceColumns;
+	float scale = 1.0f / instanceColumns;
 
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-	glEnableVertexAttribArray(0);
+	// written straight into the mapped stream buffer, nothing is staged on the CPU side
+	for (int i = 0; i < instanceCount; ++i)
+	{
+		const float* color = triangleColors[i % 2];
+		InstanceData& instance = instances[i];
+		instance.offsetX = -1.0f + cellSize * (i % instanceColumns + 0.5f) + 0.02f * std::sin(2.0f * time + 0.7f * i);
+		instance.offsetY = -1.0f + cellSize * (i / instanceColumns + 0.5f);
+		instance.scale = scale;
+		instance.r = static_cast<unsigned char>(color[0] * 255.0f + 0.5f);
+		instance.g = static_cast<unsigned char>(color[1] * 255.0f + 0.5f);
+		instance.b = static_cast<unsigned char>(color[2] * 255.0f + 0.5f);
+		instance.a = 255;
+	}
 
-	return { VAO[0], VAO[1] };
+	instancingDraw();
 }
 
-void cleanUpShadersAndVAOs()
+void uploadTriangleMaterials()
+{
+	for (int i = 0; i < 2; ++i)
+	{
+		MaterialUniforms material;
+		material.color = { triangleColors[i][0], triangleColors[i][1], triangleColors[i][2], 1.0f };
+		materialSlices[i] = uploadUniforms(material);
+	}
+}
+
+UniformSlice triangleMaterial(int index)
 {
-	glDeleteVertexArrays(2, VAO);
-	glDeleteBuffers(2, VBO);
+	return materialSlices[index % 2];
+}
 
-	glDeleteProgram(shaderPrograms[0]);
-	glDeleteProgram(shaderPrograms[1]);
-}
\ No newline at end of file
+void bindTriangleMaterial(int index)
+{
+	bindUniformSlice(materialUniformBinding, triangleMaterial(index));
+}
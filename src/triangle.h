@@ -1,10 +1,34 @@
 #ifndef TRIANGLE_H
 #define TRIANGLE_H
 
+#include "uniform-buffer.h"
 #include <utility>
 
-std::pair<unsigned int, unsigned int> initShaders(int& statusCode);
+// returns shader pipeline handles (see shader.h), the programs may still be compiling;
+// both triangles share one program now and get their color from a material
+std::pair<int, int> initShaders(int& statusCode);
 std::pair<unsigned int, unsigned int> initVAOs();
 void cleanUpShadersAndVAOs();
 
+// once per frame, before anything draws with the triangle program: the two colors as Material blocks
+void uploadTriangleMaterials();
+UniformSlice triangleMaterial(int index);
+void bindTriangleMaterial(int index);
+
+// the rectangle (or, for shapeCount > 2, a tessellated grid of that many quads) through the indexed mesh builder;
+// quantize stores the positions as 16-bit unorm and draws with the dequantizing shader variant;
+// with a savePath the result is also written out as a mesh file (see mesh-file.h)
+bool initIndexedMesh(int shapeCount, bool quantize, const char* savePath = nullptr);
+// replaces the indexed mesh with one from a mesh file once asset streaming (see asset-streaming.h) has
+// it on the GPU; until then drawIndexedMesh keeps drawing what initIndexedMesh built
+void streamIndexedMesh(const char* path);
+void drawIndexedMesh();
+
+// fills the batch renderer with shapeCount copies of the two triangles tiled over the viewport
+bool initBatchedTriangles(int shapeCount);
+
+// shapeCount instances of the 1st triangle tiled like the batch, swaying, drawn with one instanced call
+bool initInstancedTriangles(int shapeCount);
+void drawInstancedTriangles(float time);
+
 #endif
\ No newline at end of file
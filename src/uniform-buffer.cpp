@@ -0,0 +1,59 @@
+#include <glad/glad.h>
+#include "uniform-buffer.h"
+#include "stream-buffer.h"
+#include <cstring>
+#include <iostream>
+
+namespace
+{
+	StreamBuffer uniformRing;
+	size_t offsetAlignment = 256;	// the largest value drivers report, replaced by the real one
+}
+
+
+bool uniformRingInit(size_t frameCapacity)
+{
+	GLint alignment = 0;
+	glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+	if (alignment > 0)
+		offsetAlignment = static_cast<size_t>(alignment);
+
+	// every frame's region has to start aligned too
+	frameCapacity = std140::alignUp(frameCapacity, offsetAlignment);
+	if (!uniformRing.init(GL_UNIFORM_BUFFER, frameCapacity))
+	{
+		std::cout << "Failed to create the uniform ring buffer\n";
+		return false;
+	}
+	return true;
+}
+
+UniformSlice uploadUniformData(const void* data, size_t size)
+{
+	UniformSlice slice;
+	StreamAllocation allocation = uniformRing.allocate(size, offsetAlignment);
+	if (allocation.data == nullptr) return slice;
+
+	std::memcpy(allocation.data, data, size);
+	uniformRing.commit(allocation);
+
+	slice.offset = allocation.offset;
+	slice.size = size;
+	return slice;
+}
+
+void bindUniformSlice(unsigned int binding, const UniformSlice& slice)
+{
+	if (slice.size == 0) return;
+	glBindBufferRange(GL_UNIFORM_BUFFER, binding, uniformRing.buffer(), static_cast<GLintptr>(slice.offset), static_cast<GLsizeiptr>(slice.size));
+}
+
+void uniformRingEndFrame()
+{
+	uniformRing.endFrame();
+}
+
+void uniformRingCleanUp()
+{
+	uniformRing.destroy();
+}
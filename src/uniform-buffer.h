@@ -0,0 +1,105 @@
+#ifndef UNIFORM_BUFFER_H
+#define UNIFORM_BUFFER_H
+
+#include <array>
+#include <cstddef>
+
+// ----- std140 layout
+// Block structs are written with the std140:: types below, whose alignas matches the std140 base
+// alignment, so the compiler lays them out the way GLSL does. std140::offsets<...>() computes the
+// std140 offsets of a member type list at compile time; static_assert them against offsetof so a
+// struct that drifts from its GLSL block (a vec3 followed by a scalar, say) doesn't compile.
+
+namespace std140
+{
+	struct alignas(8) vec2 { float x, y; };
+	struct alignas(16) vec4 { float x, y, z, w; };
+	struct alignas(16) mat4 { vec4 columns[4]; };
+	// 12 bytes in std140 and a following scalar packs into its tail, which C++ can't do;
+	// the offset check catches that case, put the scalar first or use a vec4
+	struct alignas(16) vec3 { float x, y, z; };
+
+	// arrays round every element up to 16 bytes
+	template <typename T, size_t Count>
+	struct array
+	{
+		struct alignas(16) Element { T value; };
+		Element elements[Count];
+
+		T& operator[](size_t i) { return elements[i].value; }
+		const T& operator[](size_t i) const { return elements[i].value; }
+	};
+
+	// base alignment and size of each type under std140
+	template <typename T> struct Layout;
+	template <> struct Layout<float> { static constexpr size_t alignment = 4, size = 4; };
+	template <> struct Layout<int> { static constexpr size_t alignment = 4, size = 4; };
+	template <> struct Layout<unsigned int> { static constexpr size_t alignment = 4, size = 4; };
+	template <> struct Layout<vec2> { static constexpr size_t alignment = 8, size = 8; };
+	template <> struct Layout<vec3> { static constexpr size_t alignment = 16, size = 12; };
+	template <> struct Layout<vec4> { static constexpr size_t alignment = 16, size = 16; };
+	template <> struct Layout<mat4> { static constexpr size_t alignment = 16, size = 64; };
+	template <typename T, size_t Count> struct Layout<array<T, Count>>
+	{
+		static constexpr size_t alignment = 16;
+		static constexpr size_t size = Count * ((Layout<T>::size + 15) / 16 * 16);
+	};
+
+	constexpr size_t alignUp(size_t value, size_t alignment)
+	{
+		return (value + alignment - 1) / alignment * alignment;
+	}
+
+	template <typename... Members>
+	constexpr std::array<size_t, sizeof...(Members)> offsets()
+	{
+		constexpr size_t alignments[] = { Layout<Members>::alignment... };
+		constexpr size_t sizes[] = { Layout<Members>::size... };
+
+		std::array<size_t, sizeof...(Members)> result = {};
+		size_t offset = 0;
+		for (size_t i = 0; i < sizeof...(Members); ++i)
+		{
+			offset = alignUp(offset, alignments[i]);
+			result[i] = offset;
+			offset += sizes[i];
+		}
+		return result;
+	}
+
+	// the whole block, padded like a struct member would be
+	template <typename... Members>
+	constexpr size_t blockSize()
+	{
+		constexpr size_t sizes[] = { Layout<Members>::size... };
+		return alignUp(offsets<Members...>()[sizeof...(Members) - 1] + sizes[sizeof...(Members) - 1], 16);
+	}
+}
+
+// ----- per-frame uniform ring
+// A StreamBuffer on GL_UNIFORM_BUFFER: every upload lands in the current frame's region at the
+// driver's offset alignment and is bound with glBindBufferRange, so uniforms never stall on a
+// buffer the GPU is still reading. Context thread only.
+
+// binding points shared by the C++ side and setUniformBlockBinding (see shader.h)
+const unsigned int materialUniformBinding = 0;
+const unsigned int dequantizeUniformBinding = 1;
+
+struct UniformSlice
+{
+	size_t offset = 0;
+	size_t size = 0;		// 0: nothing uploaded
+};
+
+bool uniformRingInit(size_t frameCapacity);
+UniformSlice uploadUniformData(const void* data, size_t size);
+template <typename Block>
+UniformSlice uploadUniforms(const Block& block)
+{
+	return uploadUniformData(&block, sizeof(Block));
+}
+void bindUniformSlice(unsigned int binding, const UniformSlice& slice);
+void uniformRingEndFrame();		// after the frame's draws
+void uniformRingCleanUp();
+
+#endif
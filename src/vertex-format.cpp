@@ -0,0 +1,75 @@
+#include "vertex-format.h"
+#include <cmath>
+#include <cstring>
+
+std::uint16_t floatToHalf(float value)
+{
+	std::uint32_t bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+
+	std::uint32_t sign = (bits >> 16) & 0x8000;
+	std::uint32_t exponent = (bits >> 23) & 0xFF;
+	std::uint32_t mantissa = bits & 0x7FFFFF;
+
+	if (exponent == 0xFF)	// inf stays inf, nan stays a (quiet) nan
+		return static_cast<std::uint16_t>(sign | 0x7C00 | (mantissa != 0 ? 0x200 : 0));
+
+	int halfExponent = static_cast<int>(exponent) - 127 + 15;
+	if (halfExponent >= 31)	// too large
+		return static_cast<std::uint16_t>(sign | 0x7C00);
+
+	if (halfExponent <= 0)
+	{
+		// subnormal (or zero): shift the implicit 1 in, rounding to nearest even
+		if (halfExponent < -10) return static_cast<std::uint16_t>(sign);
+		mantissa |= 0x800000;
+		int shift = 14 - halfExponent;
+		std::uint32_t half = mantissa >> shift;
+		std::uint32_t remainder = mantissa & ((1u << shift) - 1);
+		std::uint32_t halfway = 1u << (shift - 1);
+		if (remainder > halfway || (remainder == halfway && (half & 1)))
+			++half;
+		return static_cast<std::uint16_t>(sign | half);
+	}
+
+	std::uint32_t half = sign | (static_cast<std::uint32_t>(halfExponent) << 10) | (mantissa >> 13);
+	std::uint32_t remainder = mantissa & 0x1FFF;
+	if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1)))
+		++half;		// a carry into the exponent is still the right answer (up to inf)
+	return static_cast<std::uint16_t>(half);
+}
+
+float halfToFloat(std::uint16_t half)
+{
+	std::uint32_t sign = static_cast<std::uint32_t>(half & 0x8000) << 16;
+	std::uint32_t exponent = (half >> 10) & 0x1F;
+	std::uint32_t mantissa = half & 0x3FF;
+	std::uint32_t bits;
+
+	if (exponent == 0)
+	{
+		// subnormal halves are normal floats
+		float magnitude = std::ldexp(static_cast<float>(mantissa), -24);
+		return sign ? -magnitude : magnitude;
+	}
+	if (exponent == 31)
+		bits = sign | 0x7F800000 | (mantissa << 13);
+	else
+		bits = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+
+	float value;
+	std::memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+std::uint32_t packSnorm10_10_10_2(float x, float y, float z, float w)
+{
+	// c / (2^(b-1) - 1), the GL 4.2 mapping current drivers use in 3.3 contexts too; keeps 0 exact
+	auto pack = [](float value, int bits) {
+		value = value < -1.0f ? -1.0f : (value > 1.0f ? 1.0f : value);
+		float scale = static_cast<float>((1 << (bits - 1)) - 1);
+		int packed = static_cast<int>(std::lround(value * scale));
+		return static_cast<std::uint32_t>(packed) & ((1u << bits) - 1);
+	};
+	return pack(x, 10) | pack(y, 10) << 10 | pack(z, 10) << 20 | pack(w, 2) << 30;
+}
@@ -0,0 +1,122 @@
+#ifndef VERTEX_FORMAT_H
+#define VERTEX_FORMAT_H
+
+#include <glad/glad.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+// Compile-time vertex layouts: a VertexFormat lists its attribute types in order, and stride,
+// offsets and the glVertexAttribPointer calls all come from that list. Attributes are packed
+// back to back with no implicit padding (add attribute::Padding where the struct has some), so
+// static_assert the C++ vertex struct against stride and offsets where it's declared.
+
+namespace attribute
+{
+	template <GLenum Type, GLint Components, size_t ComponentSize, bool Normalized>
+	struct Descriptor
+	{
+		static constexpr GLenum type = Type;
+		static constexpr GLint components = Components;
+		static constexpr size_t size = ComponentSize * Components;
+		static constexpr GLboolean normalized = Normalized ? GL_TRUE : GL_FALSE;
+	};
+
+	template <GLint Components> using Float = Descriptor<GL_FLOAT, Components, 4, false>;
+	template <GLint Components> using Half = Descriptor<GL_HALF_FLOAT, Components, 2, false>;
+	template <GLint Components> using Unorm8 = Descriptor<GL_UNSIGNED_BYTE, Components, 1, true>;
+	template <GLint Components> using Snorm8 = Descriptor<GL_BYTE, Components, 1, true>;
+	template <GLint Components> using Unorm16 = Descriptor<GL_UNSIGNED_SHORT, Components, 2, true>;
+	template <GLint Components> using Snorm16 = Descriptor<GL_SHORT, Components, 2, true>;
+	// xyz in 10 bits each plus a 2-bit w in one 32-bit word, see packSnorm10_10_10_2
+	using Snorm10_10_10_2 = Descriptor<GL_INT_2_10_10_10_REV, 4, 1, true>;
+
+	// bytes the struct has but the shader doesn't read; takes no attribute location
+	template <size_t Bytes>
+	struct Padding
+	{
+		static constexpr GLenum type = 0;
+		static constexpr GLint components = 0;
+		static constexpr size_t size = Bytes;
+		static constexpr GLboolean normalized = GL_FALSE;
+	};
+}
+
+template <typename... Attributes>
+struct VertexFormat
+{
+	static constexpr size_t attributeCount = sizeof...(Attributes);
+	static constexpr size_t stride = (Attributes::size + ... + 0);
+	static constexpr std::array<size_t, attributeCount> offsets = [] {
+		constexpr size_t sizes[] = { Attributes::size... };
+		std::array<size_t, attributeCount> result = {};
+		size_t offset = 0;
+		for (size_t i = 0; i < attributeCount; ++i)
+		{
+			result[i] = offset;
+			offset += sizes[i];
+		}
+		return result;
+	}();
+
+	// points every attribute at the buffer bound to GL_ARRAY_BUFFER, starting at baseOffset;
+	// locations are handed out in order from firstLocation, padding skipped
+	static void point(GLuint firstLocation = 0, size_t baseOffset = 0)
+	{
+		forEachAttribute(firstLocation, [baseOffset](GLuint location, GLenum type, GLint components, GLboolean normalized, size_t offset) {
+			glVertexAttribPointer(location, components, type, normalized, static_cast<GLsizei>(stride), (void*)(baseOffset + offset));
+		});
+	}
+
+	// divisor 1 makes them per-instance attributes
+	static void enable(GLuint firstLocation = 0, GLuint divisor = 0)
+	{
+		forEachAttribute(firstLocation, [divisor](GLuint location, GLenum, GLint, GLboolean, size_t) {
+			glEnableVertexAttribArray(location);
+			if (divisor != 0)
+				glVertexAttribDivisor(location, divisor);
+		});
+	}
+
+	// the usual VAO setup, with the vertex buffer already bound
+	static void setup(GLuint firstLocation = 0, GLuint divisor = 0, size_t baseOffset = 0)
+	{
+		point(firstLocation, baseOffset);
+		enable(firstLocation, divisor);
+	}
+
+	// how many locations the format occupies
+	static constexpr GLuint locationCount = ((Attributes::components > 0 ? 1u : 0u) + ... + 0u);
+
+	// function(location, type, components, normalized, offset) for every attribute but padding
+	template <typename Function>
+	static void forEachAttribute(GLuint firstLocation, Function function)
+	{
+		applyEach(firstLocation, function, std::index_sequence_for<Attributes...>());
+	}
+
+private:
+
+	template <typename Function, size_t... Indices>
+	static void applyEach(GLuint firstLocation, Function& function, std::index_sequence<Indices...>)
+	{
+		GLuint location = firstLocation;
+		auto one = [&](GLenum type, GLint components, GLboolean normalized, size_t offset) {
+			if (components == 0) return;	// padding
+			function(location++, type, components, normalized, offset);
+		};
+		(one(Attributes::type, Attributes::components, Attributes::normalized, offsets[Indices]), ...);
+	}
+};
+
+// the plain xyz float positions most of the meshes here use
+using PositionFormat = VertexFormat<attribute::Float<3>>;
+
+// packing helpers for the compact attribute types
+std::uint16_t floatToHalf(float value);
+float halfToFloat(std::uint16_t half);
+// components in [-1, 1]; w only has 2 bits (-1, 0 or 1)
+std::uint32_t packSnorm10_10_10_2(float x, float y, float z, float w = 0.0f);
+
+#endif